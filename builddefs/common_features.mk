@@ -25,6 +25,7 @@ QUANTUM_SRC += \
     $(QUANTUM_DIR)/keyboard.c \
     $(QUANTUM_DIR)/keymap_common.c \
     $(QUANTUM_DIR)/keycode_config.c \
+    $(QUANTUM_DIR)/spsc_queue.c \
     $(QUANTUM_DIR)/sync_timer.c \
     $(QUANTUM_DIR)/logging/debug.c \
     $(QUANTUM_DIR)/logging/sendchar.c \
@@ -135,35 +136,42 @@ ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
         VPATH += $(QUANTUM_DIR)/pointing_device
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device.c
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_auto_mouse.c
-        ifneq ($(strip $(POINTING_DEVICE_DRIVER)), custom)
-            SRC += drivers/sensors/$(strip $(POINTING_DEVICE_DRIVER)).c
-            OPT_DEFS += -DPOINTING_DEVICE_DRIVER_$(strip $(shell echo $(POINTING_DEVICE_DRIVER) | tr '[:lower:]' '[:upper:]'))
+        # A secondary driver (e.g. a trackpad next to a trackball) is polled on
+        # its own schedule and fused into the primary's report.
+        POINTING_DEVICE_DRIVERS := $(strip $(POINTING_DEVICE_DRIVER))
+        ifneq ($(strip $(POINTING_DEVICE_SECONDARY_DRIVER)),)
+            ifeq ($(filter $(POINTING_DEVICE_SECONDARY_DRIVER),$(VALID_POINTING_DEVICE_DRIVER_TYPES)),)
+                $(call CATASTROPHIC_ERROR,Invalid POINTING_DEVICE_SECONDARY_DRIVER,POINTING_DEVICE_SECONDARY_DRIVER="$(POINTING_DEVICE_SECONDARY_DRIVER)" is not a valid pointing device type)
+            endif
+            ifeq ($(strip $(POINTING_DEVICE_SECONDARY_DRIVER)),$(strip $(POINTING_DEVICE_DRIVER)))
+                $(call CATASTROPHIC_ERROR,Invalid POINTING_DEVICE_SECONDARY_DRIVER,POINTING_DEVICE_SECONDARY_DRIVER must differ from POINTING_DEVICE_DRIVER)
+            endif
+            POINTING_DEVICE_DRIVERS += $(strip $(POINTING_DEVICE_SECONDARY_DRIVER))
+            OPT_DEFS += -DPOINTING_DEVICE_SECONDARY_DRIVER_NAME=$(strip $(POINTING_DEVICE_SECONDARY_DRIVER))
         endif
-        OPT_DEFS += -DPOINTING_DEVICE_DRIVER_$(strip $(POINTING_DEVICE_DRIVER))
+        $(foreach dr,$(filter-out custom,$(POINTING_DEVICE_DRIVERS)),\
+            $(eval SRC += drivers/sensors/$(dr).c)\
+            $(eval OPT_DEFS += -DPOINTING_DEVICE_DRIVER_$(shell echo $(dr) | tr '[:lower:]' '[:upper:]')))
+        $(foreach dr,$(POINTING_DEVICE_DRIVERS),\
+            $(eval OPT_DEFS += -DPOINTING_DEVICE_DRIVER_$(dr)))
         OPT_DEFS += -DPOINTING_DEVICE_DRIVER_NAME=$(strip $(POINTING_DEVICE_DRIVER))
-        ifeq ($(strip $(POINTING_DEVICE_DRIVER)), adns9800)
+        ifneq ($(filter adns9800 cirque_pinnacle_spi paw3222 pmw3360 pmw3389,$(POINTING_DEVICE_DRIVERS)),)
             SPI_DRIVER_REQUIRED = yes
-        else ifeq ($(strip $(POINTING_DEVICE_DRIVER)), analog_joystick)
-            ANALOG_DRIVER_REQUIRED = yes
-        else ifeq ($(strip $(POINTING_DEVICE_DRIVER)), azoteq_iqs5xx)
-            I2C_DRIVER_REQUIRED = yes
-        else ifeq ($(strip $(POINTING_DEVICE_DRIVER)), cirque_pinnacle_i2c)
+        endif
+        ifneq ($(filter azoteq_iqs5xx cirque_pinnacle_i2c pimoroni_trackball,$(POINTING_DEVICE_DRIVERS)),)
             I2C_DRIVER_REQUIRED = yes
+        endif
+        ifneq ($(filter analog_joystick,$(POINTING_DEVICE_DRIVERS)),)
+            ANALOG_DRIVER_REQUIRED = yes
+        endif
+        ifneq ($(filter cirque_pinnacle_i2c cirque_pinnacle_spi,$(POINTING_DEVICE_DRIVERS)),)
             SRC += drivers/sensors/cirque_pinnacle.c
             SRC += drivers/sensors/cirque_pinnacle_gestures.c
             SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_gestures.c
-        else ifeq ($(strip $(POINTING_DEVICE_DRIVER)), cirque_pinnacle_spi)
-            SPI_DRIVER_REQUIRED = yes
-            SRC += drivers/sensors/cirque_pinnacle.c
-            SRC += drivers/sensors/cirque_pinnacle_gestures.c
-            SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_gestures.c
-        else ifeq ($(strip $(POINTING_DEVICE_DRIVER)), paw3222)
-            SPI_DRIVER_REQUIRED = yes
-        else ifeq ($(strip $(POINTING_DEVICE_DRIVER)), pimoroni_trackball)
-            I2C_DRIVER_REQUIRED = yes
-        else ifneq ($(filter $(strip $(POINTING_DEVICE_DRIVER)),pmw3360 pmw3389),)
-            SPI_DRIVER_REQUIRED = yes
+        endif
+        ifneq ($(filter pmw3360 pmw3389,$(POINTING_DEVICE_DRIVERS)),)
             SRC += drivers/sensors/pmw33xx_common.c
+            SRC += drivers/sensors/pmw33xx_profiles.c
         endif
     endif
 endif
@@ -476,6 +484,8 @@ ifeq ($(strip $(RGB_MATRIX_ENABLE)), yes)
     SRC += $(QUANTUM_DIR)/color.c
     SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix.c
     SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix_drivers.c
+    SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix_indicator_rules.c
+    SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix_layers.c
     LIB8TION_ENABLE := yes
     CIE1931_CURVE := yes
 
@@ -651,6 +661,15 @@ ifeq ($(strip $(DYNAMIC_KEYMAP_ENABLE)), yes)
     SEND_STRING_ENABLE := yes
 endif
 
+ifeq ($(strip $(ANALOG_MATRIX_ENABLE)), yes)
+    # The analog matrix provides the custom matrix 'lite' implementation,
+    # the keyboard only supplies raw ADC readings.
+    CUSTOM_MATRIX := lite
+    OPT_DEFS += -DANALOG_MATRIX_ENABLE
+    ANALOG_DRIVER_REQUIRED = yes
+    QUANTUM_SRC += $(QUANTUM_DIR)/analog_matrix.c
+endif
+
 VALID_CUSTOM_MATRIX_TYPES:= yes lite no
 
 CUSTOM_MATRIX ?= no
@@ -669,12 +688,35 @@ ifneq ($(strip $(CUSTOM_MATRIX)), yes)
     endif
 endif
 
+VALID_MATRIX_READ_MODES := default port_batched
+
+MATRIX_READ_MODE ?= default
+ifeq ($(filter $(MATRIX_READ_MODE),$(VALID_MATRIX_READ_MODES)),)
+    $(call CATASTROPHIC_ERROR,Invalid MATRIX_READ_MODE,MATRIX_READ_MODE="$(MATRIX_READ_MODE)" is not a valid matrix read mode)
+endif
+ifeq ($(strip $(MATRIX_READ_MODE)), port_batched)
+    OPT_DEFS += -DMATRIX_READ_PORT_BATCHED
+endif
+
+MATRIX_UNROLLED ?= no
+ifeq ($(strip $(MATRIX_UNROLLED)), yes)
+    OPT_DEFS += -DMATRIX_UNROLLED
+endif
+
 # Debounce Modules. Set DEBOUNCE_TYPE=custom if including one manually.
 DEBOUNCE_TYPE ?= sym_defer_g
 ifneq ($(strip $(DEBOUNCE_TYPE)), custom)
     QUANTUM_SRC += $(QUANTUM_DIR)/debounce/$(strip $(DEBOUNCE_TYPE)).c
 endif
 
+# Diagnostic mode that profiles raw-scan bounce behaviour per key and reports
+# a recommended debounce algorithm and DEBOUNCE value over the console
+DEBOUNCE_PROFILING ?= no
+ifeq ($(strip $(DEBOUNCE_PROFILING)), yes)
+    OPT_DEFS += -DDEBOUNCE_PROFILING
+    QUANTUM_SRC += $(QUANTUM_DIR)/debounce_profiling.c
+endif
+
 
 VALID_SERIAL_DRIVER_TYPES := bitbang usart vendor
 
@@ -749,6 +791,11 @@ ifeq ($(strip $(HAPTIC_ENABLE)),yes)
         ifeq ($(strip $(HAPTIC_DRIVER)), solenoid)
             SRC += solenoid.c
         endif
+
+        ifeq ($(strip $(DEFERRED_EXEC_ENABLE)), yes)
+            OPT_DEFS += -DHAPTIC_PATTERNS
+            SRC += $(QUANTUM_DIR)/haptic_pattern.c
+        endif
     endif
 endif
 
@@ -947,11 +994,17 @@ ifeq ($(strip $(DIP_SWITCH_ENABLE)), yes)
     endif
 endif
 
+ifeq ($(strip $(LEADER_ENABLE)), yes)
+    ifeq ($(strip $(LEADER_MAP_ENABLE)), yes)
+        OPT_DEFS += -DLEADER_MAP_ENABLE
+    endif
+endif
+
 ifeq ($(strip $(BATTERY_ENABLE)), yes)
     BATTERY_DRIVER_REQUIRED := yes
 endif
 
-VALID_BATTERY_DRIVER_TYPES := adc custom vendor
+VALID_BATTERY_DRIVER_TYPES := adc custom max17048 vendor
 
 BATTERY_DRIVER ?= none
 ifeq ($(strip $(BATTERY_DRIVER_REQUIRED)), yes)
@@ -971,6 +1024,9 @@ ifeq ($(strip $(BATTERY_DRIVER_REQUIRED)), yes)
     ifeq ($(strip $(BATTERY_DRIVER)), adc)
         ANALOG_DRIVER_REQUIRED = yes
     endif
+    ifeq ($(strip $(BATTERY_DRIVER)), max17048)
+        I2C_DRIVER_REQUIRED = yes
+    endif
 endif
 
 VALID_WS2812_DRIVER_TYPES := bitbang custom i2c pwm spi vendor
@@ -1009,11 +1065,29 @@ ifeq ($(strip $(ANALOG_DRIVER_REQUIRED)), yes)
     QUANTUM_LIB_SRC += analog.c
 endif
 
+ifeq ($(strip $(I2C_ASYNC_ENABLE)), yes)
+    I2C_DRIVER_REQUIRED = yes
+    OPT_DEFS += -DI2C_ASYNC_ENABLE
+    QUANTUM_LIB_SRC += i2c_master_async.c
+endif
+
+ifeq ($(strip $(I2C_HEALTH_ENABLE)), yes)
+    I2C_DRIVER_REQUIRED = yes
+    OPT_DEFS += -DI2C_HEALTH_ENABLE
+    QUANTUM_LIB_SRC += i2c_health.c
+endif
+
 ifeq ($(strip $(I2C_DRIVER_REQUIRED)), yes)
     OPT_DEFS += -DHAL_USE_I2C=TRUE
     QUANTUM_LIB_SRC += i2c_master.c
 endif
 
+ifeq ($(strip $(SPI_ASYNC_ENABLE)), yes)
+    SPI_DRIVER_REQUIRED = yes
+    OPT_DEFS += -DSPI_ASYNC_ENABLE
+    QUANTUM_LIB_SRC += spi_master_async.c
+endif
+
 ifeq ($(strip $(SPI_DRIVER_REQUIRED)), yes)
     OPT_DEFS += -DHAL_USE_SPI=TRUE
     QUANTUM_LIB_SRC += spi_master.c
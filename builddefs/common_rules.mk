@@ -381,6 +381,13 @@ dump_vars:
 objs-size:
 	for i in $(OBJ); do echo $$i; done | sort | xargs $(SIZE)
 
+# Per-subsystem flash/RAM ledger from the linker map, with a diff against the
+# previous run's ledger when one exists.
+SIZE_LEDGER = $(BUILD_DIR)/$(TARGET)_size_ledger.json
+size-ledger: $(BUILD_DIR)/$(TARGET).elf
+	@if test -f $(SIZE_LEDGER); then mv $(SIZE_LEDGER) $(SIZE_LEDGER).prev; fi
+	python3 util/size_ledger.py $(BUILD_DIR)/$(TARGET).map -o $(SIZE_LEDGER) --diff $(SIZE_LEDGER).prev
+
 
 # size check optionally implemented in its platform.mk
 check-size:
@@ -399,7 +406,7 @@ $(eval $(foreach OUTPUT,$(OUTPUTS),$(shell mkdir -p $(OUTPUT) 2>/dev/null)))
 
 
 # Listing of phony targets.
-.PHONY : all dump_vars finish sizebefore sizeafter qmkversion \
+.PHONY : all dump_vars finish sizebefore sizeafter size-ledger qmkversion \
 gccversion build elf hex uf2 eep lss sym coff extcoff \
 clean clean_list debug gdb-config show_path \
 program teensy dfu dfu-ee dfu-start \
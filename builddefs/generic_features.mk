@@ -39,21 +39,30 @@ GENERIC_FEATURES = \
     KEYCODE_STRING \
     KEY_LOCK \
     KEY_OVERRIDE \
+    LATENCY_TEST_RIG \
+    LATENCY_TRACE \
     LAYER_LOCK \
     LEADER \
     MAGIC \
+    MICRO_BENCH \
     MOUSEKEY \
     MUSIC \
+    NVM_SNAPSHOT \
     OS_DETECTION \
     PROGRAMMABLE_BUTTON \
+    RAW_HID_CHANNELS \
     REPEAT_KEY \
+    SCAN_HISTOGRAM \
     SECURE \
     SEND_STRING \
     SEQUENCER \
     SPACE_CADET \
+    SPARSE_KEYMAP \
     SWAP_HANDS \
     TAP_DANCE \
+    TASK_STATS \
     TRI_LAYER \
+    USAGE_STATS \
     VIA \
     VIRTSER \
     WPM \
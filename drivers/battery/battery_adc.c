@@ -26,6 +26,31 @@
 #    define BATTERY_ADC_RESOLUTION 10
 #endif
 
+#ifdef BATTERY_ADC_SAG_MV
+#    if defined(RGB_MATRIX_ENABLE)
+#        include "rgb_matrix.h"
+#    elif defined(RGBLIGHT_ENABLE)
+#        include "rgblight.h"
+#    endif
+
+// Lit LEDs pull the pack voltage down through its internal resistance, which
+// reads as a lower charge than the cell actually holds. Add the configured
+// sag back while the lighting load is on; keyboards with a better model of
+// their load (displays, per-LED brightness) can override this.
+__attribute__((weak)) uint16_t battery_adc_sag_compensation_mv(void) {
+#    if defined(RGB_MATRIX_ENABLE)
+    if (rgb_matrix_is_enabled()) {
+        return BATTERY_ADC_SAG_MV;
+    }
+#    elif defined(RGBLIGHT_ENABLE)
+    if (rgblight_is_enabled()) {
+        return BATTERY_ADC_SAG_MV;
+    }
+#    endif
+    return 0;
+}
+#endif // BATTERY_ADC_SAG_MV
+
 void battery_driver_init(void) {
     gpio_set_pin_input(BATTERY_ADC_PIN);
 }
@@ -39,6 +64,10 @@ uint16_t battery_driver_get_mv(void) {
     bat_mv = bat_mv * (BATTERY_VOLTAGE_DIVIDER_R1 + BATTERY_ADC_VOLTAGE_DIVIDER_R2) / BATTERY_ADC_VOLTAGE_DIVIDER_R2;
 #endif
 
+#ifdef BATTERY_ADC_SAG_MV
+    bat_mv += battery_adc_sag_compensation_mv();
+#endif
+
     return bat_mv;
 }
 
@@ -26,4 +26,13 @@ void battery_driver_init(void);
  */
 uint8_t battery_driver_sample_percent(void);
 
+#ifdef BATTERY_ADC_SAG_MV
+/**
+ * \brief Millivolts of voltage sag to add back to the ADC reading while the
+ * board's lighting load is on. Weakly defined; override to model the actual
+ * load, e.g. scaling with LED brightness or display state.
+ */
+uint16_t battery_adc_sag_compensation_mv(void);
+#endif
+
 /** \} */
@@ -0,0 +1,72 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "battery_driver.h"
+#include "i2c_master.h"
+
+#ifdef I2C_ASYNC_ENABLE
+#    include "i2c_master_async.h"
+#endif
+
+#ifndef MAX17048_I2C_ADDRESS
+#    define MAX17048_I2C_ADDRESS 0x36
+#endif
+
+#ifndef MAX17048_I2C_TIMEOUT
+#    define MAX17048_I2C_TIMEOUT 100
+#endif
+
+#define MAX17048_REG_VCELL 0x02
+#define MAX17048_REG_SOC 0x04
+
+static uint8_t last_percent = 100;
+
+static uint8_t soc_to_percent(const uint8_t *raw) {
+    // SOC register: high byte is whole percent, low byte is 1/256 percent.
+    // The gauge can report slightly above 100 on a full cell.
+    return raw[0] > 100 ? 100 : raw[0];
+}
+
+void battery_driver_init(void) {
+    i2c_init();
+
+    uint8_t raw[2];
+    if (i2c_read_register(MAX17048_I2C_ADDRESS << 1, MAX17048_REG_SOC, raw, sizeof(raw), MAX17048_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) {
+        last_percent = soc_to_percent(raw);
+    }
+}
+
+#ifdef I2C_ASYNC_ENABLE
+
+static uint8_t soc_buffer[2];
+static bool    read_in_flight = false;
+
+static void soc_read_callback(i2c_status_t status, void *user_data) {
+    (void)user_data;
+    if (status == I2C_STATUS_SUCCESS) {
+        last_percent = soc_to_percent(soc_buffer);
+    }
+    read_in_flight = false;
+}
+
+uint8_t battery_driver_sample_percent(void) {
+    // The gauge integrates charge on its own; sampling just fetches its
+    // running estimate. Kick the read through the async queue and report the
+    // previous estimate, so the battery task never blocks on the bus.
+    if (!read_in_flight) {
+        read_in_flight = i2c_enqueue_read_register(MAX17048_I2C_ADDRESS << 1, MAX17048_REG_SOC, soc_buffer, sizeof(soc_buffer), MAX17048_I2C_TIMEOUT, I2C_ASYNC_PRIORITY_LOW, soc_read_callback, NULL);
+    }
+    return last_percent;
+}
+
+#else
+
+uint8_t battery_driver_sample_percent(void) {
+    uint8_t raw[2];
+    if (i2c_read_register(MAX17048_I2C_ADDRESS << 1, MAX17048_REG_SOC, raw, sizeof(raw), MAX17048_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) {
+        last_percent = soc_to_percent(raw);
+    }
+    return last_percent;
+}
+
+#endif // I2C_ASYNC_ENABLE
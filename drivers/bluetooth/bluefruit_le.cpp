@@ -125,6 +125,7 @@ enum ble_system_event_bits {
 #define SdepTimeout 150             /* milliseconds */
 #define SdepShortTimeout 10         /* milliseconds */
 #define SdepBackOff 25              /* microseconds */
+#define SdepSendRetryInterval 25    /* milliseconds */
 #define BatteryUpdateInterval 10000 /* milliseconds */
 
 static bool at_command(const char *cmd, char *resp, uint16_t resplen, bool verbose, uint16_t timeout = SdepTimeout);
@@ -246,6 +247,9 @@ static void resp_buf_read_one(bool greedy) {
     }
 }
 
+static bool     send_backoff      = false;
+static uint16_t last_send_failure = 0;
+
 static void send_buf_send_one(uint16_t timeout = SdepTimeout) {
     struct queue_item item;
 
@@ -254,6 +258,16 @@ static void send_buf_send_one(uint16_t timeout = SdepTimeout) {
         return;
     }
 
+    // After a failed send, let the module recover for a bit instead of
+    // stalling the main loop with a blocking wait; the queued item is
+    // retried on a later pass.
+    if (send_backoff) {
+        if (timer_elapsed(last_send_failure) < SdepSendRetryInterval) {
+            return;
+        }
+        send_backoff = false;
+    }
+
     if (!send_buf.peek(item)) {
         return;
     }
@@ -263,7 +277,8 @@ static void send_buf_send_one(uint16_t timeout = SdepTimeout) {
         dprintf("send_buf_send_one: have %d remaining\n", (int)send_buf.size());
     } else {
         dprint("failed to send, will retry\n");
-        wait_ms(SdepTimeout);
+        send_backoff      = true;
+        last_send_failure = timer_read();
         resp_buf_read_one(true);
     }
 }
@@ -595,6 +610,19 @@ static bool process_queue_item(struct queue_item *item, uint16_t timeout) {
     }
 }
 
+static void send_buf_enqueue(const struct queue_item &item) {
+    if (send_buf.enqueue(item)) {
+        return;
+    }
+    // Queue congested: drop the oldest entry and admit the new one rather
+    // than blocking host_keyboard_send() on the module. The freshest report
+    // reflects the current key state, so it's the one worth keeping.
+    struct queue_item discarded;
+    send_buf.get(discarded);
+    send_buf.enqueue(item);
+    dprint("send_buf full, dropped oldest entry\n");
+}
+
 void bluefruit_le_send_keyboard(report_keyboard_t *report) {
     struct queue_item item;
 
@@ -607,9 +635,7 @@ void bluefruit_le_send_keyboard(report_keyboard_t *report) {
     item.key.keys[4]  = report->keys[4];
     item.key.keys[5]  = report->keys[5];
 
-    while (!send_buf.enqueue(item)) {
-        send_buf_send_one();
-    }
+    send_buf_enqueue(item);
 }
 
 void bluefruit_le_send_consumer(uint16_t usage) {
@@ -618,9 +644,7 @@ void bluefruit_le_send_consumer(uint16_t usage) {
     item.queue_type = QTConsumer;
     item.consumer   = usage;
 
-    while (!send_buf.enqueue(item)) {
-        send_buf_send_one();
-    }
+    send_buf_enqueue(item);
 }
 
 void bluefruit_le_send_mouse(report_mouse_t *report) {
@@ -633,9 +657,7 @@ void bluefruit_le_send_mouse(report_mouse_t *report) {
     item.mousemove.pan     = report->h;
     item.mousemove.buttons = report->buttons;
 
-    while (!send_buf.enqueue(item)) {
-        send_buf_send_one();
-    }
+    send_buf_enqueue(item);
 }
 
 bool bluefruit_le_set_mode_leds(bool on) {
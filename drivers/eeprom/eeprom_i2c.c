@@ -39,6 +39,11 @@
 #include "eeprom_driver.h"
 #include "eeprom_i2c.h"
 
+#ifdef NVM_STATS_ENABLE
+#    include "timer.h"
+#    include "nvm_stats.h"
+#endif // NVM_STATS_ENABLE
+
 // #define DEBUG_EEPROM_OUTPUT
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
@@ -90,9 +95,17 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
     uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE];
     fill_target_address(complete_packet, addr);
 
+#ifdef NVM_STATS_ENABLE
+    uint32_t start = timer_read_us();
+#endif // NVM_STATS_ENABLE
+
     i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE, 100);
     i2c_receive(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), buf, len, 100);
 
+#ifdef NVM_STATS_ENABLE
+    nvm_stats_record_read((uint32_t)(uintptr_t)addr, timer_elapsed_us(start));
+#endif // NVM_STATS_ENABLE
+
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
     dprintf("[EEPROM R] 0x%04X: ", ((int)addr));
     for (size_t i = 0; i < len; ++i) {
@@ -107,6 +120,10 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
     uint8_t  *read_buf    = (uint8_t *)buf;
     uintptr_t target_addr = (uintptr_t)addr;
 
+#ifdef NVM_STATS_ENABLE
+    uint32_t start = timer_read_us();
+#endif // NVM_STATS_ENABLE
+
 #if defined(EXTERNAL_EEPROM_WP_PIN)
     gpio_set_pin_output(EXTERNAL_EEPROM_WP_PIN);
     gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 0);
@@ -145,4 +162,8 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
     gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 1);
     gpio_set_pin_input_high(EXTERNAL_EEPROM_WP_PIN);
 #endif
+
+#ifdef NVM_STATS_ENABLE
+    nvm_stats_record_write((uint32_t)(uintptr_t)addr, timer_elapsed_us(start));
+#endif // NVM_STATS_ENABLE
 }
@@ -38,6 +38,10 @@
 #include "eeprom_driver.h"
 #include "eeprom_spi.h"
 
+#ifdef NVM_STATS_ENABLE
+#    include "nvm_stats.h"
+#endif // NVM_STATS_ENABLE
+
 #define CMD_WREN 6
 #define CMD_WRDI 4
 #define CMD_RDSR 5
@@ -116,7 +120,12 @@ void eeprom_driver_erase(void) {
 #endif
 }
 
+#ifdef NVM_STATS_ENABLE
+// Wrapped so that the stall accounting also covers the early-exit timeout paths
+static void eeprom_read_block_impl(void *buf, const void *addr, size_t len) {
+#else
 void eeprom_read_block(void *buf, const void *addr, size_t len) {
+#endif // NVM_STATS_ENABLE
     //-------------------------------------------------
     // Wait for the write-in-progress bit to be cleared
     spi_status_t response = spi_eeprom_wait_while_busy(EXTERNAL_EEPROM_SPI_TIMEOUT);
@@ -152,7 +161,17 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
     spi_stop();
 }
 
+#ifdef NVM_STATS_ENABLE
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    uint32_t start = timer_read_us();
+    eeprom_read_block_impl(buf, addr, len);
+    nvm_stats_record_read((uint32_t)(uintptr_t)addr, timer_elapsed_us(start));
+}
+
+static void eeprom_write_block_impl(const void *buf, void *addr, size_t len) {
+#else
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
+#endif // NVM_STATS_ENABLE
     bool      res;
     uint8_t  *read_buf    = (uint8_t *)buf;
     uintptr_t target_addr = (uintptr_t)addr;
@@ -223,3 +242,11 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
     spi_write(CMD_WRDI);
     spi_stop();
 }
+
+#ifdef NVM_STATS_ENABLE
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    uint32_t start = timer_read_us();
+    eeprom_write_block_impl(buf, addr, len);
+    nvm_stats_record_write((uint32_t)(uintptr_t)addr, timer_elapsed_us(start));
+}
+#endif // NVM_STATS_ENABLE
@@ -20,6 +20,10 @@
 #include "eeprom_driver.h"
 #include "eeprom_transient.h"
 
+#ifdef NVM_STATS_ENABLE
+#    include "nvm_stats.h"
+#endif // NVM_STATS_ENABLE
+
 __attribute__((aligned(4))) static uint8_t transientBuffer[TRANSIENT_EEPROM_SIZE] = {0};
 
 size_t clamp_length(intptr_t offset, size_t len) {
@@ -50,6 +54,10 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
     if (len > 0) {
         memcpy(buf, &transientBuffer[offset], len);
     }
+#ifdef NVM_STATS_ENABLE
+    // RAM-backed, so access counts are tracked but stall time is negligible
+    nvm_stats_record_read((uint32_t)(uintptr_t)addr, 0);
+#endif // NVM_STATS_ENABLE
 }
 
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
@@ -58,4 +66,7 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
     if (len > 0) {
         memcpy(&transientBuffer[offset], buf, len);
     }
+#ifdef NVM_STATS_ENABLE
+    nvm_stats_record_write((uint32_t)(uintptr_t)addr, 0);
+#endif // NVM_STATS_ENABLE
 }
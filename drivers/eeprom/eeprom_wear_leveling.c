@@ -6,6 +6,11 @@
 #include "eeprom_driver.h"
 #include "wear_leveling.h"
 
+#ifdef NVM_STATS_ENABLE
+#    include "timer.h"
+#    include "nvm_stats.h"
+#endif // NVM_STATS_ENABLE
+
 void eeprom_driver_init(void) {
     wear_leveling_init();
 }
@@ -21,9 +26,21 @@ void eeprom_driver_erase(void) {
 }
 
 void eeprom_read_block(void *buf, const void *addr, size_t len) {
+#ifdef NVM_STATS_ENABLE
+    uint32_t start = timer_read_us();
+#endif // NVM_STATS_ENABLE
     wear_leveling_read((uint32_t)addr, buf, len);
+#ifdef NVM_STATS_ENABLE
+    nvm_stats_record_read((uint32_t)addr, timer_elapsed_us(start));
+#endif // NVM_STATS_ENABLE
 }
 
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
+#ifdef NVM_STATS_ENABLE
+    uint32_t start = timer_read_us();
+#endif // NVM_STATS_ENABLE
     wear_leveling_write((uint32_t)addr, buf, len);
+#ifdef NVM_STATS_ENABLE
+    nvm_stats_record_write((uint32_t)addr, timer_elapsed_us(start));
+#endif // NVM_STATS_ENABLE
 }
@@ -83,6 +83,17 @@ flash_status_t flash_erase_chip(void);
  */
 flash_status_t flash_erase_block(uint32_t addr);
 
+/**
+ * @brief Initiates a block erase operation.
+ *
+ * This function does not wait for the flash to become ready.
+ *
+ * @param addr The address of the block to erase.
+ *
+ * @return FLASH_STATUS_SUCCESS if the erase command was successfully sent, FLASH_STATUS_TIMEOUT if the flash is busy, or FLASH_STATUS_ERROR if an error occurred.
+ */
+flash_status_t flash_begin_erase_block(uint32_t addr);
+
 /**
  * @brief Erases a sector of flash memory.
  *
@@ -95,6 +106,17 @@ flash_status_t flash_erase_block(uint32_t addr);
  */
 flash_status_t flash_erase_sector(uint32_t addr);
 
+/**
+ * @brief Initiates a sector erase operation.
+ *
+ * This function does not wait for the flash to become ready.
+ *
+ * @param addr The address of the sector to erase.
+ *
+ * @return FLASH_STATUS_SUCCESS if the erase command was successfully sent, FLASH_STATUS_TIMEOUT if the flash is busy, or FLASH_STATUS_ERROR if an error occurred.
+ */
+flash_status_t flash_begin_erase_sector(uint32_t addr);
+
 /**
  * @brief Reads a range of flash memory.
  *
@@ -121,6 +143,58 @@ flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len);
  */
 flash_status_t flash_write_range(uint32_t addr, const void *buf, size_t len);
 
+/**
+ * @brief Completion callback for asynchronous flash operations.
+ *
+ * @param status The final status of the operation, FLASH_STATUS_SUCCESS if it completed, FLASH_STATUS_TIMEOUT if the flash stayed busy past the deadline.
+ */
+typedef void (*flash_async_callback_t)(flash_status_t status);
+
+/**
+ * @brief Initiates a sector erase and returns immediately.
+ *
+ * The erase proceeds inside the flash chip while the firmware keeps running;
+ * completion is detected by flash_async_task() which then invokes the
+ * callback. Only one asynchronous operation may be in flight at a time, and
+ * no other flash operation may be issued until the callback has fired.
+ *
+ * @param addr The address of the sector to erase.
+ * @param callback Invoked from flash_async_task() on completion, may be NULL.
+ *
+ * @return FLASH_STATUS_SUCCESS if the erase was started, FLASH_STATUS_BUSY if another asynchronous operation is still in flight, or any error from flash_begin_erase_sector().
+ */
+flash_status_t flash_erase_sector_async(uint32_t addr, flash_async_callback_t callback);
+
+/**
+ * @brief Initiates a block erase and returns immediately.
+ *
+ * See flash_erase_sector_async() for the completion contract.
+ *
+ * @param addr The address of the block to erase.
+ * @param callback Invoked from flash_async_task() on completion, may be NULL.
+ *
+ * @return FLASH_STATUS_SUCCESS if the erase was started, FLASH_STATUS_BUSY if another asynchronous operation is still in flight, or any error from flash_begin_erase_block().
+ */
+flash_status_t flash_erase_block_async(uint32_t addr, flash_async_callback_t callback);
+
+/**
+ * @brief Whether an asynchronous operation is still in flight.
+ *
+ * @return true if a previously started asynchronous erase has not yet completed.
+ */
+bool flash_async_pending(void);
+
+/**
+ * @brief Progresses any in-flight asynchronous operation.
+ *
+ * Polls the flash's busy flag once and returns, so the caller's loop keeps
+ * running while an erase is in progress. Invoked from the housekeeping task;
+ * a no-op when nothing is pending.
+ *
+ * @return FLASH_STATUS_BUSY while the operation is still in progress, otherwise the final status passed to the callback, or FLASH_STATUS_SUCCESS when idle.
+ */
+flash_status_t flash_async_task(void);
+
 #ifdef __cplusplus
 }
 #endif
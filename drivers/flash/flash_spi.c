@@ -209,7 +209,7 @@ flash_status_t flash_erase_chip(void) {
     return flash_wait_erase_chip();
 }
 
-flash_status_t flash_erase_sector(uint32_t addr) {
+flash_status_t flash_begin_erase_sector(uint32_t addr) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
 
     /* Check that the address exceeds the limit. */
@@ -239,6 +239,15 @@ flash_status_t flash_erase_sector(uint32_t addr) {
         return response;
     }
 
+    return response;
+}
+
+flash_status_t flash_erase_sector(uint32_t addr) {
+    flash_status_t response = flash_begin_erase_sector(addr);
+    if (response != FLASH_STATUS_SUCCESS) {
+        return response;
+    }
+
     /* Wait for the write-in-progress bit to be cleared.*/
     response = spi_flash_wait_while_busy();
     if (response != FLASH_STATUS_SUCCESS) {
@@ -249,7 +258,7 @@ flash_status_t flash_erase_sector(uint32_t addr) {
     return response;
 }
 
-flash_status_t flash_erase_block(uint32_t addr) {
+flash_status_t flash_begin_erase_block(uint32_t addr) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
 
     /* Check that the address exceeds the limit. */
@@ -279,6 +288,15 @@ flash_status_t flash_erase_block(uint32_t addr) {
         return response;
     }
 
+    return response;
+}
+
+flash_status_t flash_erase_block(uint32_t addr) {
+    flash_status_t response = flash_begin_erase_block(addr);
+    if (response != FLASH_STATUS_SUCCESS) {
+        return response;
+    }
+
     /* Wait for the write-in-progress bit to be cleared.*/
     response = spi_flash_wait_while_busy();
     if (response != FLASH_STATUS_SUCCESS) {
@@ -289,6 +307,69 @@ flash_status_t flash_erase_block(uint32_t addr) {
     return response;
 }
 
+/* Asynchronous erase engine: the erase command is issued up front and the
+   flash chip performs it internally, so instead of busy-waiting on the WIP
+   flag (hundreds of milliseconds for a sector erase) completion is detected
+   by a single status-register poll per flash_async_task() invocation. */
+static struct {
+    bool                   active;
+    uint32_t               deadline;
+    flash_async_callback_t callback;
+} async_op;
+
+static flash_status_t spi_flash_erase_async(flash_status_t begin_response, flash_async_callback_t callback) {
+    if (begin_response != FLASH_STATUS_SUCCESS) {
+        return begin_response;
+    }
+
+    async_op.active   = true;
+    async_op.deadline = timer_read32() + (EXTERNAL_FLASH_SPI_TIMEOUT);
+    async_op.callback = callback;
+    return FLASH_STATUS_SUCCESS;
+}
+
+flash_status_t flash_erase_sector_async(uint32_t addr, flash_async_callback_t callback) {
+    if (async_op.active) {
+        return FLASH_STATUS_BUSY;
+    }
+    return spi_flash_erase_async(flash_begin_erase_sector(addr), callback);
+}
+
+flash_status_t flash_erase_block_async(uint32_t addr, flash_async_callback_t callback) {
+    if (async_op.active) {
+        return FLASH_STATUS_BUSY;
+    }
+    return spi_flash_erase_async(flash_begin_erase_block(addr), callback);
+}
+
+bool flash_async_pending(void) {
+    return async_op.active;
+}
+
+flash_status_t flash_async_task(void) {
+    if (!async_op.active) {
+        return FLASH_STATUS_SUCCESS;
+    }
+
+    flash_status_t response = flash_is_busy();
+    if (response == FLASH_STATUS_BUSY) {
+        if (timer_read32() < async_op.deadline) {
+            /* Still erasing; yield back to the main loop. */
+            return FLASH_STATUS_BUSY;
+        }
+        dprint("Erase still busy past deadline! [spi flash async task]\n");
+        response = FLASH_STATUS_TIMEOUT;
+    }
+
+    async_op.active                 = false;
+    flash_async_callback_t callback = async_op.callback;
+    async_op.callback               = NULL;
+    if (callback != NULL) {
+        callback(response);
+    }
+    return response;
+}
+
 flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
     uint8_t       *read_buf = (uint8_t *)buf;
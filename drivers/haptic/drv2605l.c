@@ -19,6 +19,10 @@
 #include "i2c_master.h"
 #include <math.h>
 
+#ifdef I2C_ASYNC_ENABLE
+#    include "i2c_master_async.h"
+#endif
+
 uint8_t drv2605l_write_buffer[2];
 uint8_t drv2605l_read_buffer;
 
@@ -119,8 +123,53 @@ void drv2605l_amplitude(uint8_t amplitude) {
     drv2605l_write(DRV2605L_REG_RTP_INPUT, amplitude);
 }
 
+#ifdef I2C_ASYNC_ENABLE
+/* A trigger is three register writes: halt any running effect, load the
+ * sequencer slot with the (on-chip ROM library) waveform, and set the GO bit.
+ * With the async queue these are enqueued instead of blocking the keystroke
+ * path; a pulse requested while a trigger is still in flight only replaces
+ * the pending sequence (latest wins) rather than stacking bus transactions.
+ */
+static const uint8_t drv2605l_go_stop  = 0x00;
+static const uint8_t drv2605l_go_start = 0x01;
+
+static uint8_t drv2605l_pending_sequence;
+static bool    drv2605l_trigger_in_flight = false;
+static bool    drv2605l_trigger_pending   = false;
+
+static void drv2605l_trigger_enqueue(void);
+
+static void drv2605l_trigger_callback(i2c_status_t status, void *user_data) {
+    if (drv2605l_trigger_pending) {
+        drv2605l_trigger_pending = false;
+        drv2605l_trigger_enqueue();
+    } else {
+        drv2605l_trigger_in_flight = false;
+    }
+}
+
+static void drv2605l_trigger_enqueue(void) {
+    bool queued = i2c_enqueue_write_register(DRV2605L_I2C_ADDRESS << 1, DRV2605L_REG_GO, &drv2605l_go_stop, 1, 100, I2C_ASYNC_PRIORITY_NORMAL, NULL, NULL);
+    queued      = queued && i2c_enqueue_write_register(DRV2605L_I2C_ADDRESS << 1, DRV2605L_REG_WAVEFORM_SEQUENCER_1, &drv2605l_pending_sequence, 1, 100, I2C_ASYNC_PRIORITY_NORMAL, NULL, NULL);
+    queued      = queued && i2c_enqueue_write_register(DRV2605L_I2C_ADDRESS << 1, DRV2605L_REG_GO, &drv2605l_go_start, 1, 100, I2C_ASYNC_PRIORITY_NORMAL, drv2605l_trigger_callback, NULL);
+
+    /* on a full queue the pulse is simply dropped; any writes that did fit are
+     * harmless without the GO bit, and the next pulse starts a fresh trigger */
+    drv2605l_trigger_in_flight = queued;
+}
+#endif // I2C_ASYNC_ENABLE
+
 void drv2605l_pulse(uint8_t sequence) {
+#ifdef I2C_ASYNC_ENABLE
+    drv2605l_pending_sequence = sequence;
+    if (drv2605l_trigger_in_flight) {
+        drv2605l_trigger_pending = true;
+        return;
+    }
+    drv2605l_trigger_enqueue();
+#else
     drv2605l_write(DRV2605L_REG_GO, 0x00);
     drv2605l_write(DRV2605L_REG_WAVEFORM_SEQUENCER_1, sequence);
     drv2605l_write(DRV2605L_REG_GO, 0x01);
+#endif
 }
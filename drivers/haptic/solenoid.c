@@ -105,6 +105,30 @@ void solenoid_fire_handler(void) {
 #endif
 }
 
+/**
+ * @brief Whether any solenoid is currently within its dwell cycle
+ *
+ */
+bool solenoid_active(void) {
+    for (uint8_t i = 0; i < NUMBER_OF_SOLENOIDS; i++) {
+        if (solenoid_on[i]) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Directly energises or releases all solenoids, bypassing the dwell
+ * state machine. Pattern playback owns its own timing, so driven solenoids
+ * are not entered into the dwell bookkeeping.
+ */
+void solenoid_drive(bool energize) {
+    for (uint8_t i = 0; i < NUMBER_OF_SOLENOIDS; i++) {
+        gpio_write_pin(solenoid_pads[i], energize ? solenoid_active_state[i] : !solenoid_active_state[i]);
+        solenoid_on[i]      = false;
+        solenoid_buzzing[i] = false;
+    }
+}
+
 /**
  * @brief Checks active solenoid to stop them, and to handle buzz mode
  *
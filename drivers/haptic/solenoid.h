@@ -63,6 +63,9 @@ void solenoid_stop(uint8_t index);
 void solenoid_fire(uint8_t index);
 void solenoid_fire_handler(void);
 
+bool solenoid_active(void);
+void solenoid_drive(bool energize);
+
 void solenoid_check(void);
 
 void solenoid_setup(void);
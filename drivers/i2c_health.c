@@ -0,0 +1,128 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "i2c_health.h"
+#include "debug.h"
+
+#include <string.h>
+
+static i2c_health_stats_t device_stats[I2C_HEALTH_MAX_DEVICES];
+static uint8_t            device_count       = 0;
+static uint8_t            consecutive_errors = 0;
+static uint8_t            bus_clears         = 0;
+static bool               speed_reduced      = false;
+
+static i2c_health_stats_t* find_slot(uint8_t address) {
+    for (uint8_t i = 0; i < device_count; i++) {
+        if (device_stats[i].address == address) {
+            return &device_stats[i];
+        }
+    }
+    if (device_count < I2C_HEALTH_MAX_DEVICES) {
+        i2c_health_stats_t* slot = &device_stats[device_count++];
+        slot->address            = address;
+        return slot;
+    }
+    return NULL;
+}
+
+void i2c_health_record(uint8_t address, i2c_status_t status, uint16_t elapsed_ms) {
+    i2c_health_stats_t* slot = find_slot(address);
+    if (slot != NULL) {
+        slot->latency_last_ms = elapsed_ms;
+        if (elapsed_ms > slot->latency_max_ms) {
+            slot->latency_max_ms = elapsed_ms;
+        }
+        if (status == I2C_STATUS_SUCCESS) {
+            slot->ok_count++;
+        } else if (status == I2C_STATUS_TIMEOUT) {
+            if (slot->timeout_count < UINT16_MAX) slot->timeout_count++;
+        } else {
+            if (slot->error_count < UINT16_MAX) slot->error_count++;
+        }
+    }
+
+    if (status == I2C_STATUS_SUCCESS) {
+        consecutive_errors = 0;
+        return;
+    }
+
+    if (++consecutive_errors >= I2C_HEALTH_BUS_CLEAR_THRESHOLD) {
+        consecutive_errors = 0;
+        dprintf("i2c health: error streak, clearing bus\n");
+        i2c_health_bus_clear();
+        if (++bus_clears >= I2C_HEALTH_FALLBACK_THRESHOLD && !speed_reduced) {
+            speed_reduced = true;
+            dprintf("i2c health: bus unstable, dropping to fallback speed\n");
+            i2c_health_set_speed(true);
+        }
+    }
+}
+
+uint8_t i2c_health_device_count(void) {
+    return device_count;
+}
+
+const i2c_health_stats_t* i2c_health_get(uint8_t index) {
+    if (index >= device_count) {
+        return NULL;
+    }
+    return &device_stats[index];
+}
+
+uint8_t i2c_health_bus_clear_count(void) {
+    return bus_clears;
+}
+
+bool i2c_health_speed_reduced(void) {
+    return speed_reduced;
+}
+
+void i2c_health_reset(void) {
+    memset(device_stats, 0, sizeof(device_stats));
+    device_count       = 0;
+    consecutive_errors = 0;
+    bus_clears         = 0;
+    if (speed_reduced) {
+        speed_reduced = false;
+        i2c_health_set_speed(false);
+    }
+}
+
+void i2c_health_dump(void) {
+    dprintf("i2c health: %u devices, %u bus clears%s\n", device_count, bus_clears, speed_reduced ? ", fallback speed" : "");
+    for (uint8_t i = 0; i < device_count; i++) {
+        const i2c_health_stats_t* s = &device_stats[i];
+        dprintf("  0x%02X: ok %lu, err %u, timeout %u, latency last %ums max %ums\n", s->address, (unsigned long)s->ok_count, s->error_count, s->timeout_count, s->latency_last_ms, s->latency_max_ms);
+    }
+}
+
+void i2c_health_raw_hid_report(uint8_t *data, uint8_t length) {
+    memset(data, 0, length);
+    uint8_t offset = 0;
+    if (length < 3) return;
+    data[offset++] = device_count;
+    data[offset++] = bus_clears;
+    data[offset++] = speed_reduced ? 1 : 0;
+    for (uint8_t i = 0; i < device_count; i++) {
+        const i2c_health_stats_t* s = &device_stats[i];
+        if ((uint8_t)(length - offset) < 13) break;
+        data[offset++] = s->address;
+        data[offset++] = s->ok_count & 0xFF;
+        data[offset++] = (s->ok_count >> 8) & 0xFF;
+        data[offset++] = (s->ok_count >> 16) & 0xFF;
+        data[offset++] = (s->ok_count >> 24) & 0xFF;
+        data[offset++] = s->error_count & 0xFF;
+        data[offset++] = s->error_count >> 8;
+        data[offset++] = s->timeout_count & 0xFF;
+        data[offset++] = s->timeout_count >> 8;
+        data[offset++] = s->latency_last_ms & 0xFF;
+        data[offset++] = s->latency_last_ms >> 8;
+        data[offset++] = s->latency_max_ms & 0xFF;
+        data[offset++] = s->latency_max_ms >> 8;
+    }
+}
+
+__attribute__((weak)) void i2c_health_bus_clear(void) {}
+
+__attribute__((weak)) void i2c_health_set_speed(bool reduced) {}
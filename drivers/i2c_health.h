@@ -0,0 +1,108 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "i2c_master.h"
+
+/**
+ * \file
+ *
+ * \defgroup i2c_health I2C bus health monitor
+ *
+ * \brief Per-device error and latency accounting for the blocking I2C Master API, with automatic recovery.
+ *
+ * Every transaction is recorded against its device address. When errors come
+ * in an unbroken streak the monitor asks the platform driver to perform a bus
+ * clear (clocking SCL until a stuck slave releases SDA, then issuing a STOP);
+ * when bus clears themselves keep recurring, the bus speed is dropped to the
+ * platform's fallback rate for the rest of the session, trading throughput
+ * for stability on marginal wiring.
+ *
+ * Stats can be dumped to the console with i2c_health_dump() or serialized
+ * for a raw HID stats channel with i2c_health_raw_hid_report().
+ *
+ * Enable with `I2C_HEALTH_ENABLE = yes` in rules.mk.
+ * \{
+ */
+
+// Number of distinct device addresses tracked; further addresses are ignored
+#ifndef I2C_HEALTH_MAX_DEVICES
+#    define I2C_HEALTH_MAX_DEVICES 8
+#endif
+
+// Consecutive failed transactions (any device) before a bus clear is attempted
+#ifndef I2C_HEALTH_BUS_CLEAR_THRESHOLD
+#    define I2C_HEALTH_BUS_CLEAR_THRESHOLD 3
+#endif
+
+// Bus clears before the bus speed is dropped to the fallback rate
+#ifndef I2C_HEALTH_FALLBACK_THRESHOLD
+#    define I2C_HEALTH_FALLBACK_THRESHOLD 3
+#endif
+
+/**
+ * \brief Accumulated statistics for one device address.
+ */
+typedef struct i2c_health_stats_t {
+    uint8_t  address;         /**< 7-bit address, pre-shifted as used by the I2C API */
+    uint32_t ok_count;        /**< Successful transactions */
+    uint16_t error_count;     /**< Transactions failed with I2C_STATUS_ERROR */
+    uint16_t timeout_count;   /**< Transactions failed with I2C_STATUS_TIMEOUT */
+    uint16_t latency_last_ms; /**< Duration of the most recent transaction */
+    uint16_t latency_max_ms;  /**< Longest transaction seen */
+} i2c_health_stats_t;
+
+/**
+ * \brief Records the outcome of one transaction. Called by the platform I2C driver.
+ *
+ * \param address The pre-shifted device address.
+ * \param status The result of the transaction.
+ * \param elapsed_ms How long the transaction took.
+ */
+void i2c_health_record(uint8_t address, i2c_status_t status, uint16_t elapsed_ms);
+
+/** \brief Gets the number of device addresses seen so far. */
+uint8_t i2c_health_device_count(void);
+
+/** \brief Gets the stats slot at the given index, or NULL if out of range. */
+const i2c_health_stats_t* i2c_health_get(uint8_t index);
+
+/** \brief Gets the number of bus clears performed. */
+uint8_t i2c_health_bus_clear_count(void);
+
+/** \brief Whether the bus has been dropped to the fallback speed. */
+bool i2c_health_speed_reduced(void);
+
+/** \brief Clears all statistics and restores the configured bus speed. */
+void i2c_health_reset(void);
+
+/** \brief Prints all device stats over the console. */
+void i2c_health_dump(void);
+
+/**
+ * \brief Serializes the stats into a raw HID response buffer.
+ *
+ * Layout: `data[0]` = device count, `data[1]` = bus clear count, `data[2]` =
+ * speed reduced flag, followed by one packed \ref i2c_health_stats_t per
+ * device, truncated to `length`.
+ */
+void i2c_health_raw_hid_report(uint8_t *data, uint8_t length);
+
+/**
+ * \brief Performs a bus clear. Weakly defined; implemented by platform
+ * drivers that can bit-bang the bus pins, a no-op elsewhere.
+ */
+void i2c_health_bus_clear(void);
+
+/**
+ * \brief Switches between the configured and the fallback bus speed. Weakly
+ * defined; implemented by platform drivers whose clock is runtime-adjustable,
+ * a no-op elsewhere.
+ */
+void i2c_health_set_speed(bool reduced);
+
+/** \} */
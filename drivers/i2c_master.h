@@ -113,6 +113,29 @@ i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t*
  */
 i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout);
 
+/**
+ * \brief One (register, buffer, length) segment of an i2c_write_segments() transfer.
+ */
+typedef struct i2c_segment_t {
+    uint8_t        regaddr;
+    const uint8_t* data;
+    uint16_t       length;
+} i2c_segment_t;
+
+/**
+ * \brief Write to multiple 8-bit-addressed registers on the I2C device in one chained transaction.
+ *
+ * Segments are written back to back; on AVR a repeated start separates them instead of a stop/start turnaround, and on ChibiOS the peripheral is started once for the whole chain. The transfer stops at the first failing segment.
+ *
+ * \param devaddr The 7-bit I2C address of the device.
+ * \param segments A pointer to the segments to transmit.
+ * \param count The number of segments.
+ * \param timeout The time in milliseconds to wait for a response from the target device.
+ *
+ * \return `I2C_STATUS_TIMEOUT` if the timeout period elapses, `I2C_STATUS_ERROR` if some other error occurs, otherwise `I2C_STATUS_SUCCESS`.
+ */
+i2c_status_t i2c_write_segments(uint8_t devaddr, const i2c_segment_t* segments, uint8_t count, uint16_t timeout);
+
 /**
  * \brief Read from a register with an 8-bit address on the I2C device.
  *
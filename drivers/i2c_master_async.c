@@ -0,0 +1,131 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stddef.h>
+
+#include "i2c_master_async.h"
+
+typedef enum i2c_async_op_t {
+    I2C_ASYNC_OP_TRANSMIT,
+    I2C_ASYNC_OP_RECEIVE,
+    I2C_ASYNC_OP_WRITE_REGISTER,
+    I2C_ASYNC_OP_READ_REGISTER,
+} i2c_async_op_t;
+
+typedef struct i2c_async_txn_t {
+    bool                 active;
+    i2c_async_op_t       op;
+    i2c_async_priority_t priority;
+    uint16_t             seq; // enqueue order within a priority class
+    uint8_t              address;
+    uint8_t              regaddr;
+    uint8_t             *data; // const-ness restored by the executing call
+    uint16_t             length;
+    uint16_t             timeout;
+    i2c_async_callback_t callback;
+    void                *user_data;
+} i2c_async_txn_t;
+
+static i2c_async_txn_t queue[I2C_ASYNC_QUEUE_DEPTH];
+static uint16_t        next_seq = 0;
+
+static bool enqueue(i2c_async_op_t op, uint8_t address, uint8_t regaddr, uint8_t *data, uint16_t length, uint16_t timeout, i2c_async_priority_t priority, i2c_async_callback_t callback, void *user_data) {
+    for (uint8_t i = 0; i < (I2C_ASYNC_QUEUE_DEPTH); i++) {
+        if (!queue[i].active) {
+            queue[i] = (i2c_async_txn_t){
+                .active    = true,
+                .op        = op,
+                .priority  = priority,
+                .seq       = next_seq++,
+                .address   = address,
+                .regaddr   = regaddr,
+                .data      = data,
+                .length    = length,
+                .timeout   = timeout,
+                .callback  = callback,
+                .user_data = user_data,
+            };
+            return true;
+        }
+    }
+    return false;
+}
+
+bool i2c_enqueue_transmit(uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout, i2c_async_priority_t priority, i2c_async_callback_t callback, void *user_data) {
+    return enqueue(I2C_ASYNC_OP_TRANSMIT, address, 0, (uint8_t *)data, length, timeout, priority, callback, user_data);
+}
+
+bool i2c_enqueue_receive(uint8_t address, uint8_t *data, uint16_t length, uint16_t timeout, i2c_async_priority_t priority, i2c_async_callback_t callback, void *user_data) {
+    return enqueue(I2C_ASYNC_OP_RECEIVE, address, 0, data, length, timeout, priority, callback, user_data);
+}
+
+bool i2c_enqueue_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout, i2c_async_priority_t priority, i2c_async_callback_t callback, void *user_data) {
+    return enqueue(I2C_ASYNC_OP_WRITE_REGISTER, devaddr, regaddr, (uint8_t *)data, length, timeout, priority, callback, user_data);
+}
+
+bool i2c_enqueue_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t *data, uint16_t length, uint16_t timeout, i2c_async_priority_t priority, i2c_async_callback_t callback, void *user_data) {
+    return enqueue(I2C_ASYNC_OP_READ_REGISTER, devaddr, regaddr, data, length, timeout, priority, callback, user_data);
+}
+
+uint8_t i2c_async_pending(void) {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < (I2C_ASYNC_QUEUE_DEPTH); i++) {
+        if (queue[i].active) {
+            count++;
+        }
+    }
+    return count;
+}
+
+static i2c_async_txn_t *next_transaction(void) {
+    i2c_async_txn_t *best = NULL;
+    for (uint8_t i = 0; i < (I2C_ASYNC_QUEUE_DEPTH); i++) {
+        if (!queue[i].active) {
+            continue;
+        }
+        // Higher priority class wins; within a class, the oldest entry wins.
+        // Sequence numbers are compared with wraparound-safe arithmetic.
+        if (best == NULL || queue[i].priority < best->priority || (queue[i].priority == best->priority && (int16_t)(queue[i].seq - best->seq) < 0)) {
+            best = &queue[i];
+        }
+    }
+    return best;
+}
+
+static i2c_status_t execute(const i2c_async_txn_t *txn) {
+    switch (txn->op) {
+        case I2C_ASYNC_OP_TRANSMIT:
+            return i2c_transmit(txn->address, txn->data, txn->length, txn->timeout);
+        case I2C_ASYNC_OP_RECEIVE:
+            return i2c_receive(txn->address, txn->data, txn->length, txn->timeout);
+        case I2C_ASYNC_OP_WRITE_REGISTER:
+            return i2c_write_register(txn->address, txn->regaddr, txn->data, txn->length, txn->timeout);
+        case I2C_ASYNC_OP_READ_REGISTER:
+            return i2c_read_register(txn->address, txn->regaddr, txn->data, txn->length, txn->timeout);
+        default:
+            return I2C_STATUS_ERROR;
+    }
+}
+
+bool i2c_async_task(void) {
+    i2c_async_txn_t *txn = next_transaction();
+    if (txn == NULL) {
+        return false;
+    }
+
+    // Snapshot before releasing the slot, so the callback can safely enqueue
+    // a follow-up transaction
+    i2c_async_txn_t current = *txn;
+    txn->active             = false;
+
+    i2c_status_t status = execute(&current);
+    if (current.callback != NULL) {
+        current.callback(status, current.user_data);
+    }
+    return true;
+}
+
+void i2c_async_flush(void) {
+    while (i2c_async_task()) {
+    }
+}
@@ -0,0 +1,141 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "i2c_master.h"
+
+/**
+ * \file
+ *
+ * \defgroup i2c_master_async I2C Master Async Queue API
+ *
+ * \brief Prioritised transaction queue layered on top of the blocking I2C Master API.
+ *
+ * Consumers enqueue transactions instead of performing them inline; the queue
+ * is drained one transaction per i2c_async_task() invocation from the
+ * housekeeping task. This bounds the bus time spent in any single pass of the
+ * main loop to one transaction, and lets latency-sensitive consumers (sensor
+ * reads) jump ahead of bulk ones (LED refreshes) when the bus is contended.
+ *
+ * Data buffers are not copied: they must remain valid until the transaction's
+ * callback has been invoked.
+ * \{
+ */
+
+/**
+ * \brief Relative scheduling priority of a queued transaction.
+ *
+ * Within a priority class transactions execute in enqueue order; a higher
+ * class always runs before a lower one regardless of age.
+ */
+typedef enum i2c_async_priority_t {
+    I2C_ASYNC_PRIORITY_HIGH = 0, //< Latency-sensitive transfers, e.g. sensor reads.
+    I2C_ASYNC_PRIORITY_NORMAL,   //< Default.
+    I2C_ASYNC_PRIORITY_LOW,      //< Bulk transfers that can wait, e.g. LED frame data.
+} i2c_async_priority_t;
+
+/**
+ * \brief Completion callback for a queued transaction.
+ *
+ * \param status The result of the underlying blocking call.
+ * \param user_data The pointer supplied at enqueue time.
+ */
+typedef void (*i2c_async_callback_t)(i2c_status_t status, void *user_data);
+
+/**
+ * \brief Number of transactions the queue can hold.
+ */
+#ifndef I2C_ASYNC_QUEUE_DEPTH
+#    define I2C_ASYNC_QUEUE_DEPTH 8
+#endif
+
+/**
+ * \brief Queue a transmit to the selected I2C device; executed later as i2c_transmit().
+ *
+ * \param address The 7-bit I2C address of the device.
+ * \param data A pointer to the data to transmit, which must stay valid until the callback fires.
+ * \param length The number of bytes to write.
+ * \param timeout The time in milliseconds to wait for a response once the transaction executes.
+ * \param priority The scheduling priority class.
+ * \param callback Invoked from i2c_async_task() on completion, may be NULL.
+ * \param user_data Passed through to the callback.
+ *
+ * \return `true` if the transaction was queued, `false` if the queue is full.
+ */
+bool i2c_enqueue_transmit(uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout, i2c_async_priority_t priority, i2c_async_callback_t callback, void *user_data);
+
+/**
+ * \brief Queue a receive from the selected I2C device; executed later as i2c_receive().
+ *
+ * \param address The 7-bit I2C address of the device.
+ * \param data A pointer to a buffer to read into, which must stay valid until the callback fires.
+ * \param length The number of bytes to read.
+ * \param timeout The time in milliseconds to wait for a response once the transaction executes.
+ * \param priority The scheduling priority class.
+ * \param callback Invoked from i2c_async_task() on completion, may be NULL.
+ * \param user_data Passed through to the callback.
+ *
+ * \return `true` if the transaction was queued, `false` if the queue is full.
+ */
+bool i2c_enqueue_receive(uint8_t address, uint8_t *data, uint16_t length, uint16_t timeout, i2c_async_priority_t priority, i2c_async_callback_t callback, void *user_data);
+
+/**
+ * \brief Queue a register write; executed later as i2c_write_register().
+ *
+ * \param devaddr The 7-bit I2C address of the device.
+ * \param regaddr The register address to write to.
+ * \param data A pointer to the data to transmit, which must stay valid until the callback fires.
+ * \param length The number of bytes to write.
+ * \param timeout The time in milliseconds to wait for a response once the transaction executes.
+ * \param priority The scheduling priority class.
+ * \param callback Invoked from i2c_async_task() on completion, may be NULL.
+ * \param user_data Passed through to the callback.
+ *
+ * \return `true` if the transaction was queued, `false` if the queue is full.
+ */
+bool i2c_enqueue_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout, i2c_async_priority_t priority, i2c_async_callback_t callback, void *user_data);
+
+/**
+ * \brief Queue a register read; executed later as i2c_read_register().
+ *
+ * \param devaddr The 7-bit I2C address of the device.
+ * \param regaddr The register address to read from.
+ * \param data A pointer to a buffer to read into, which must stay valid until the callback fires.
+ * \param length The number of bytes to read.
+ * \param timeout The time in milliseconds to wait for a response once the transaction executes.
+ * \param priority The scheduling priority class.
+ * \param callback Invoked from i2c_async_task() on completion, may be NULL.
+ * \param user_data Passed through to the callback.
+ *
+ * \return `true` if the transaction was queued, `false` if the queue is full.
+ */
+bool i2c_enqueue_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t *data, uint16_t length, uint16_t timeout, i2c_async_priority_t priority, i2c_async_callback_t callback, void *user_data);
+
+/**
+ * \brief Number of transactions currently waiting in the queue.
+ */
+uint8_t i2c_async_pending(void);
+
+/**
+ * \brief Execute the highest-priority queued transaction, if any.
+ *
+ * Invoked from the housekeeping task; at most one transaction is executed per
+ * call so the main loop never stalls for more than a single transfer.
+ *
+ * \return `true` if a transaction was executed.
+ */
+bool i2c_async_task(void);
+
+/**
+ * \brief Synchronously drain the entire queue.
+ *
+ * Useful before transfers that must observe all previously queued writes,
+ * e.g. reading back a register that a queued transaction modifies.
+ */
+void i2c_async_flush(void);
+
+/** \} */
@@ -21,6 +21,7 @@
 #include "i2c_master.h"
 #include "gpio.h"
 #include "wait.h"
+#include "util.h"
 
 #define IS31FL3741_PWM_0_REGISTER_COUNT 180
 #define IS31FL3741_PWM_1_REGISTER_COUNT 171
@@ -110,33 +111,39 @@ void is31fl3741_select_page(uint8_t index, uint8_t page) {
 void is31fl3741_write_pwm_buffer(uint8_t index) {
     is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
 
-    // Transmit PWM0 registers in 6 transfers of 30 bytes.
+    // Transmit PWM0 registers as one chained transaction of 6 segments of 30 bytes.
 
-    // Iterate over the pwm_buffer_0 contents at 30 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_0_REGISTER_COUNT; i += 30) {
+    i2c_segment_t segments_0[IS31FL3741_PWM_0_REGISTER_COUNT / 30];
+    for (uint8_t i = 0; i < ARRAY_SIZE(segments_0); i++) {
+        segments_0[i].regaddr = i * 30;
+        segments_0[i].data    = driver_buffers[index].pwm_buffer_0 + i * 30;
+        segments_0[i].length  = 30;
+    }
 #if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
+    for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
+        if (i2c_write_segments(i2c_addresses[index] << 1, segments_0, ARRAY_SIZE(segments_0), IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+    }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT);
+    i2c_write_segments(i2c_addresses[index] << 1, segments_0, ARRAY_SIZE(segments_0), IS31FL3741_I2C_TIMEOUT);
 #endif
-    }
 
     is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
 
-    // Transmit PWM1 registers in 9 transfers of 19 bytes.
+    // Transmit PWM1 registers as one chained transaction of 9 segments of 19 bytes.
 
-    // Iterate over the pwm_buffer_1 contents at 19 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_1_REGISTER_COUNT; i += 19) {
+    i2c_segment_t segments_1[IS31FL3741_PWM_1_REGISTER_COUNT / 19];
+    for (uint8_t i = 0; i < ARRAY_SIZE(segments_1); i++) {
+        segments_1[i].regaddr = i * 19;
+        segments_1[i].data    = driver_buffers[index].pwm_buffer_1 + i * 19;
+        segments_1[i].length  = 19;
+    }
 #if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
+    for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
+        if (i2c_write_segments(i2c_addresses[index] << 1, segments_1, ARRAY_SIZE(segments_1), IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+    }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT);
+    i2c_write_segments(i2c_addresses[index] << 1, segments_1, ARRAY_SIZE(segments_1), IS31FL3741_I2C_TIMEOUT);
 #endif
-    }
 }
 
 void is31fl3741_init_drivers(void) {
@@ -30,6 +30,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "timer.h"
 #include "print.h"
 #include <string.h>
+#include "mem_transfer.h"
 #include "progmem.h"
 #include "wait.h"
 
@@ -378,7 +379,7 @@ void oled_clear(void) {
     oled_dirty  = OLED_ALL_BLOCKS_MASK;
 }
 
-static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
+static void calc_bounds(uint8_t update_start, uint8_t num_blocks, uint8_t *cmd_array) {
     // Calculate commands to set memory addressing bounds.
     uint8_t start_page   = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_WIDTH;
     uint8_t start_column = OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_WIDTH;
@@ -390,10 +391,11 @@ static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
     cmd_array[2] = PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + start_column) >> 4 & 0x0f);
 #else
     // Commands for use in Horizontal Addressing mode.
-    cmd_array[1] = start_column + OLED_COLUMN_OFFSET;
-    cmd_array[4] = start_page;
-    cmd_array[2] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) % OLED_DISPLAY_WIDTH + cmd_array[1];
-    cmd_array[5] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) / OLED_DISPLAY_WIDTH - 1 + cmd_array[4];
+    uint16_t run_length = OLED_BLOCK_SIZE * num_blocks;
+    cmd_array[1]        = start_column + OLED_COLUMN_OFFSET;
+    cmd_array[4]        = start_page;
+    cmd_array[2]        = (run_length + OLED_DISPLAY_WIDTH - 1) % OLED_DISPLAY_WIDTH + cmd_array[1];
+    cmd_array[5]        = (run_length + OLED_DISPLAY_WIDTH - 1) / OLED_DISPLAY_WIDTH - 1 + cmd_array[4];
 #endif
 }
 
@@ -460,6 +462,25 @@ void oled_render_dirty(bool all) {
             ++update_start;
         }
 
+        uint8_t num_blocks = 1;
+#if OLED_IC_HAS_HORIZONTAL_MODE
+        if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+            // Coalesce adjacent dirty blocks into a single transfer, as long as the combined range is still
+            // expressible as a column/page window -- either within a single page row, or spanning whole rows.
+            while (update_start + num_blocks < OLED_BLOCK_COUNT && (oled_dirty & ((OLED_BLOCK_TYPE)1 << (update_start + num_blocks))) && (num_processed < OLED_UPDATE_PROCESS_LIMIT || all)) {
+                uint16_t start_byte = OLED_BLOCK_SIZE * update_start;
+                uint16_t run_length = OLED_BLOCK_SIZE * (num_blocks + 1);
+                bool     single_row = (start_byte % OLED_DISPLAY_WIDTH) + run_length <= OLED_DISPLAY_WIDTH;
+                bool     whole_rows = (start_byte % OLED_DISPLAY_WIDTH) == 0 && (run_length % OLED_DISPLAY_WIDTH) == 0;
+                if (!single_row && !whole_rows) {
+                    break;
+                }
+                ++num_blocks;
+                ++num_processed;
+            }
+        }
+#endif
+
         // Set column & page position
 #if OLED_IC_HAS_HORIZONTAL_MODE
         static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
@@ -467,7 +488,7 @@ void oled_render_dirty(bool all) {
         static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
 #endif
         if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            calc_bounds(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
+            calc_bounds(update_start, num_blocks, &display_start[1]); // Offset from I2C_CMD byte at the start
         } else {
             calc_bounds_90(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
         }
@@ -479,8 +500,8 @@ void oled_render_dirty(bool all) {
         }
 
         if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            // Send render data chunk as is
-            if (!oled_send_data(&oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE)) {
+            // Send the render data for the whole coalesced run as a single chunk
+            if (!oled_send_data(&oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE * num_blocks)) {
                 print("oled_render data failed\n");
                 return;
             }
@@ -523,8 +544,8 @@ void oled_render_dirty(bool all) {
 #endif
         }
 
-        // Clear dirty flag of just rendered block
-        oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+        // Clear dirty flags of the just rendered blocks
+        oled_dirty &= ~((OLED_BLOCK_TYPE)((((((OLED_BLOCK_TYPE)1 << (num_blocks - 1)) - 1) << 1) | 1)) << update_start);
     }
 }
 
@@ -625,11 +646,86 @@ void oled_write_char(const char data, bool invert) {
     oled_advance_char();
 }
 
+// Renders a run of printable characters into a scratch line buffer and commits
+// it with one copy and one dirty-region update, skipping the commit entirely
+// when the rendered glyphs match what the buffer already holds. Consumes at
+// most the remainder of the current display line; returns the number of
+// characters rendered so the caller can continue with the rest of the string.
+static uint16_t oled_write_run(const char *data, uint16_t length, bool invert) {
+    static uint8_t run_buffer[OLED_DISPLAY_WIDTH > OLED_DISPLAY_HEIGHT ? OLED_DISPLAY_WIDTH : OLED_DISPLAY_HEIGHT];
+
+    uint16_t cursor_index = oled_cursor - &oled_buffer[0];
+    uint8_t  chars_fit    = (oled_rotation_width - (cursor_index % oled_rotation_width)) / OLED_FONT_WIDTH;
+
+    if (chars_fit == 0) {
+        // Partial cell at the end of the line; let the single-glyph path spill
+        // into the next line the way it always has
+        oled_write_char(data[0], invert);
+        return 1;
+    }
+    if (length > chars_fit) {
+        length = chars_fit;
+    }
+
+    uint16_t run_bytes = length * OLED_FONT_WIDTH;
+    for (uint16_t i = 0; i < length; i++) {
+        uint8_t  cast_data = (uint8_t)data[i]; // font based on unsigned type for index
+        uint8_t *glyph_out = &run_buffer[i * OLED_FONT_WIDTH];
+        if (cast_data < OLED_FONT_START || cast_data > OLED_FONT_END) {
+            memset(glyph_out, 0x00, OLED_FONT_WIDTH);
+        } else {
+            memcpy_P(glyph_out, &font[(cast_data - OLED_FONT_START) * OLED_FONT_WIDTH], OLED_FONT_WIDTH);
+        }
+        if (invert) {
+            InvertCharacter(glyph_out);
+        }
+    }
+
+    // Trim the commit to the span that actually changed so a status line that
+    // rewrites itself every tick only dirties the glyphs that differ
+    uint16_t first = 0;
+    while (first < run_bytes && oled_buffer[cursor_index + first] == run_buffer[first]) {
+        first++;
+    }
+    if (first < run_bytes) {
+        uint16_t last = run_bytes;
+        while (last > first && oled_buffer[cursor_index + last - 1] == run_buffer[last - 1]) {
+            last--;
+        }
+        memcpy(&oled_buffer[cursor_index + first], &run_buffer[first], last - first);
+        for (uint16_t block = (cursor_index + first) / OLED_BLOCK_SIZE; block <= (cursor_index + last - 1) / OLED_BLOCK_SIZE; block++) {
+            oled_dirty |= ((OLED_BLOCK_TYPE)1 << block);
+        }
+    }
+
+    // Advance past the run, wrapping exactly as oled_advance_char() would
+    uint16_t next_index      = cursor_index + run_bytes;
+    uint8_t  remaining_space = oled_rotation_width - (next_index % oled_rotation_width);
+    if (remaining_space < OLED_FONT_WIDTH) {
+        next_index += remaining_space;
+    }
+    if (next_index >= OLED_MATRIX_SIZE) {
+        next_index = 0;
+    }
+    oled_cursor = &oled_buffer[next_index];
+
+    return length;
+}
+
 void oled_write(const char *data, bool invert) {
     const char *end = data + strlen(data);
     while (data < end) {
-        oled_write_char(*data, invert);
-        data++;
+        // Control characters move the cursor and cannot join a run
+        if (*data == '\n' || *data == '\r') {
+            oled_write_char(*data, invert);
+            data++;
+            continue;
+        }
+        uint16_t run = 0;
+        while (&data[run] < end && data[run] != '\n' && data[run] != '\r') {
+            run++;
+        }
+        data += oled_write_run(data, run, invert);
     }
 }
 
@@ -656,6 +752,59 @@ void oled_pan(bool left) {
     oled_dirty = OLED_ALL_BLOCKS_MASK;
 }
 
+void oled_shift_up(uint8_t lines) {
+    if (lines == 0) {
+        return;
+    }
+    if (lines >= OLED_DISPLAY_HEIGHT / 8) {
+        oled_clear();
+        return;
+    }
+    uint16_t shift = (uint16_t)lines * OLED_DISPLAY_WIDTH;
+    // Shift the buffer contents up, then blank the vacated lines, only dirtying
+    // the blocks whose contents actually changed so the next render transmits a
+    // partial update instead of the whole frame
+    for (uint16_t i = 0; i < OLED_MATRIX_SIZE - shift; i++) {
+        uint8_t c = oled_buffer[i + shift];
+        if (oled_buffer[i] == c) continue;
+        oled_buffer[i] = c;
+        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+    }
+    for (uint16_t i = OLED_MATRIX_SIZE - shift; i < OLED_MATRIX_SIZE; i++) {
+        if (oled_buffer[i] == 0x00) continue;
+        oled_buffer[i] = 0x00;
+        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+    }
+}
+
+void oled_copy_region(uint16_t src_index, uint16_t dst_index, uint16_t size) {
+    if (src_index >= OLED_MATRIX_SIZE || dst_index >= OLED_MATRIX_SIZE) {
+        return;
+    }
+    if ((src_index + size) > OLED_MATRIX_SIZE) size = OLED_MATRIX_SIZE - src_index;
+    if ((dst_index + size) > OLED_MATRIX_SIZE) size = OLED_MATRIX_SIZE - dst_index;
+    if (size == 0 || src_index == dst_index) {
+        return;
+    }
+    // Copy away from the overlap so a destination byte is never read after it
+    // has been written, same guarantee as memmove
+    if (dst_index < src_index) {
+        for (uint16_t i = 0; i < size; i++) {
+            uint8_t c = oled_buffer[src_index + i];
+            if (oled_buffer[dst_index + i] == c) continue;
+            oled_buffer[dst_index + i] = c;
+            oled_dirty |= ((OLED_BLOCK_TYPE)1 << ((dst_index + i) / OLED_BLOCK_SIZE));
+        }
+    } else {
+        for (uint16_t i = size; i > 0; i--) {
+            uint8_t c = oled_buffer[src_index + i - 1];
+            if (oled_buffer[dst_index + i - 1] == c) continue;
+            oled_buffer[dst_index + i - 1] = c;
+            oled_dirty |= ((OLED_BLOCK_TYPE)1 << ((dst_index + i - 1) / OLED_BLOCK_SIZE));
+        }
+    }
+}
+
 oled_buffer_reader_t oled_read_raw(uint16_t start_index) {
     if (start_index > OLED_MATRIX_SIZE) start_index = OLED_MATRIX_SIZE;
     oled_buffer_reader_t ret_reader;
@@ -674,11 +823,21 @@ void oled_write_raw_byte(const char data, uint16_t index) {
 void oled_write_raw(const char *data, uint16_t size) {
     uint16_t cursor_start_index = oled_cursor - &oled_buffer[0];
     if ((size + cursor_start_index) > OLED_MATRIX_SIZE) size = OLED_MATRIX_SIZE - cursor_start_index;
-    for (uint16_t i = cursor_start_index; i < cursor_start_index + size; i++) {
-        uint8_t c = *data++;
-        if (oled_buffer[i] == c) continue;
-        oled_buffer[i] = c;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+    // Compare and copy one dirty block at a time instead of per byte; this
+    // preserves the per-block dirty granularity while letting the bulk moves
+    // go through the platform transfer service.
+    uint16_t index = cursor_start_index;
+    uint16_t end   = cursor_start_index + size;
+    while (index < end) {
+        uint16_t block_end = (index / OLED_BLOCK_SIZE + 1) * OLED_BLOCK_SIZE;
+        if (block_end > end) block_end = end;
+        uint16_t length = block_end - index;
+        if (memcmp(&oled_buffer[index], data, length) != 0) {
+            mem_transfer_copy(&oled_buffer[index], data, length, NULL, NULL);
+            oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+        }
+        data += length;
+        index = block_end;
     }
 }
 
@@ -704,10 +863,17 @@ void oled_write_pixel(uint8_t x, uint8_t y, bool on) {
 
 #if defined(__AVR__)
 void oled_write_P(const char *data, bool invert) {
-    uint8_t c = pgm_read_byte(data);
-    while (c != 0) {
-        oled_write_char(c, invert);
-        c = pgm_read_byte(++data);
+    // Stage the flash-resident string through a small stack chunk so it goes
+    // through the same batched run renderer as RAM strings
+    char   chunk[OLED_DISPLAY_WIDTH / OLED_FONT_WIDTH + 1];
+    size_t remaining = strlen_P(data);
+    while (remaining) {
+        size_t length = remaining < sizeof(chunk) - 1 ? remaining : sizeof(chunk) - 1;
+        memcpy_P(chunk, data, length);
+        chunk[length] = '\0';
+        oled_write(chunk, invert);
+        data += length;
+        remaining -= length;
     }
 }
 
@@ -379,6 +379,16 @@ void oled_write_ln(const char *data, bool invert);
 // Useful for moving the screen in preparation for new drawing
 void oled_pan(bool left);
 
+// Shifts the buffer contents up by the given number of lines (of 8 pixels each),
+// blanking the vacated lines at the bottom
+// Only the blocks that actually changed are marked dirty, so scrolling text costs
+// one buffer move plus a partial transmit rather than a full redraw
+void oled_shift_up(uint8_t lines);
+
+// Copies size bytes within the buffer from src_index to dst_index, handling
+// overlapping regions, marking only the changed blocks dirty
+void oled_copy_region(uint16_t src_index, uint16_t dst_index, uint16_t size);
+
 // Returns a pointer to the requested start index in the buffer plus remaining
 // buffer length as struct
 oled_buffer_reader_t oled_read_raw(uint16_t start_index);
@@ -6,6 +6,38 @@
 #    include "spi_master.h"
 #    include "qp_comms_spi.h"
 
+#    ifdef QUANTUM_PAINTER_SPI_ASYNC
+#        include <string.h>
+#    endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Optional background streaming
+
+#    ifdef QUANTUM_PAINTER_SPI_ASYNC
+
+#        ifndef QUANTUM_PAINTER_SPI_ASYNC_CHUNK_SIZE
+#            define QUANTUM_PAINTER_SPI_ASYNC_CHUNK_SIZE 1024
+#        endif
+
+// Ping-pong bounce buffers: while one chunk is streamed to the panel in the background, the next is copied into the
+// other buffer -- overlapping transmission with the pixel conversion happening upstream.
+static uint8_t spi_async_bounce_buffer[2][QUANTUM_PAINTER_SPI_ASYNC_CHUNK_SIZE];
+static uint8_t spi_async_next_buffer = 0;
+static bool    spi_async_in_flight   = false;
+
+static void qp_comms_spi_async_sync(void) {
+    if (spi_async_in_flight) {
+        spi_transmit_async_wait();
+        spi_async_in_flight = false;
+    }
+}
+
+#    else // QUANTUM_PAINTER_SPI_ASYNC
+
+static inline void qp_comms_spi_async_sync(void) {}
+
+#    endif // QUANTUM_PAINTER_SPI_ASYNC
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Base SPI support
 
@@ -33,7 +65,21 @@ bool qp_comms_spi_start(painter_device_t device) {
 uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint32_t byte_count) {
     uint32_t       bytes_remaining = byte_count;
     const uint8_t *p               = (const uint8_t *)data;
-    const uint32_t max_msg_length  = 1024;
+
+#    ifdef QUANTUM_PAINTER_SPI_ASYNC
+    while (bytes_remaining > 0) {
+        uint32_t bytes_this_loop = MIN(bytes_remaining, QUANTUM_PAINTER_SPI_ASYNC_CHUNK_SIZE);
+        uint8_t *bounce          = spi_async_bounce_buffer[spi_async_next_buffer];
+        memcpy(bounce, p, bytes_this_loop);
+        qp_comms_spi_async_sync();
+        spi_transmit_async(bounce, bytes_this_loop);
+        spi_async_in_flight = true;
+        spi_async_next_buffer ^= 1;
+        p += bytes_this_loop;
+        bytes_remaining -= bytes_this_loop;
+    }
+#    else
+    const uint32_t max_msg_length = 1024;
 
     while (bytes_remaining > 0) {
         uint32_t bytes_this_loop = MIN(bytes_remaining, max_msg_length);
@@ -41,6 +87,7 @@ uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint3
         p += bytes_this_loop;
         bytes_remaining -= bytes_this_loop;
     }
+#    endif
 
     return byte_count - bytes_remaining;
 }
@@ -48,6 +95,7 @@ uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint3
 bool qp_comms_spi_stop(painter_device_t device) {
     painter_driver_t      *driver       = (painter_driver_t *)device;
     qp_comms_spi_config_t *comms_config = (qp_comms_spi_config_t *)driver->comms_config;
+    qp_comms_spi_async_sync();
     spi_stop();
     gpio_write_pin_high(comms_config->chip_select_pin);
     return true;
@@ -101,6 +149,8 @@ uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *da
 bool qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t               *driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    // The D/C pin must not change while pixel data is still streaming in the background.
+    qp_comms_spi_async_sync();
     gpio_write_pin_low(comms_config->dc_pin);
     spi_write(cmd);
     return true;
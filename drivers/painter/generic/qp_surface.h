@@ -74,4 +74,19 @@ painter_device_t qp_make_rgb888_surface(uint16_t panel_width, uint16_t panel_hei
  */
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface);
 
+/**
+ * Helper method to mark a region of the surface as dirty, without drawing through Quantum Painter.
+ *
+ * Intended for use after modifying the backing buffer directly; the next `qp_surface_draw` will include the region.
+ * Coordinates extending past the edge of the surface are clamped.
+ *
+ * @param surface[in] the surface to invalidate
+ * @param left[in] the x-location of the left side of the region
+ * @param top[in] the y-location of the top side of the region
+ * @param right[in] the x-location of the right side of the region
+ * @param bottom[in] the y-location of the bottom side of the region
+ * @return whether the region was valid and has been marked dirty
+ */
+bool qp_surface_invalidate(painter_device_t surface, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
+
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
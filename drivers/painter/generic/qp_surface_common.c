@@ -49,6 +49,28 @@ void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y
     }
 }
 
+bool qp_surface_invalidate(painter_device_t surface, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    painter_driver_t         *driver = (painter_driver_t *)surface;
+    surface_painter_device_t *handle = (surface_painter_device_t *)driver;
+
+    if (left > right || top > bottom || left >= driver->panel_width || top >= driver->panel_height) {
+        qp_dprintf("qp_surface_invalidate: fail (invalid region)\n");
+        return false;
+    }
+
+    // Clamp to the panel, then grow the dirty region to cover both corners
+    if (right >= driver->panel_width) {
+        right = driver->panel_width - 1;
+    }
+    if (bottom >= driver->panel_height) {
+        bottom = driver->panel_height - 1;
+    }
+    qp_surface_update_dirty(&handle->dirty, left, top);
+    qp_surface_update_dirty(&handle->dirty, right, bottom);
+    qp_dprintf("qp_surface_invalidate: ok\n");
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Driver vtable
 
@@ -53,6 +53,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "ps2.h"
 #include "ps2_io.h"
 #include "print.h"
+#include "spsc_queue.h"
 #include "wait.h"
 
 #define WAIT(stat, us, err)     \
@@ -65,6 +66,13 @@ POSSIBILITY OF SUCH DAMAGE.
 
 uint8_t ps2_error = PS2_ERR_NONE;
 
+/* Ring buffer to store scan codes from keyboard. The ISR is the only producer
+ * and the main loop the only consumer, so the lock-free queue needs no
+ * interrupt masking around any of its operations. */
+#define PBUF_SIZE 32
+static uint8_t      pbuf_data[PBUF_SIZE];
+static spsc_queue_t pbuf;
+
 static inline uint8_t pbuf_dequeue(void);
 static inline void    pbuf_enqueue(uint8_t data);
 static inline void    pbuf_clear(void);
@@ -92,6 +100,7 @@ void palCallback(void *arg) {
 #endif // PROTOCOL_CHIBIOS
 
 void ps2_host_init(void) {
+    spsc_queue_init(&pbuf, pbuf_data, sizeof(uint8_t), PBUF_SIZE);
     idle();
     PS2_INT_INIT();
     PS2_INT_ON();
@@ -262,85 +271,19 @@ void ps2_host_set_led(uint8_t led) {
 /*--------------------------------------------------------------------
  * Ring buffer to store scan codes from keyboard
  *------------------------------------------------------------------*/
-#define PBUF_SIZE 32
-static uint8_t     pbuf[PBUF_SIZE];
-static uint8_t     pbuf_head = 0;
-static uint8_t     pbuf_tail = 0;
 static inline void pbuf_enqueue(uint8_t data) {
-#if defined(__AVR__)
-    uint8_t sreg = SREG;
-    cli();
-#elif defined(PROTOCOL_CHIBIOS)
-    chSysLockFromISR();
-#endif
-
-    uint8_t next = (pbuf_head + 1) % PBUF_SIZE;
-    if (next != pbuf_tail) {
-        pbuf[pbuf_head] = data;
-        pbuf_head       = next;
-    } else {
+    if (!spsc_queue_enqueue(&pbuf, &data)) {
         print("pbuf: full\n");
     }
-
-#if defined(__AVR__)
-    SREG = sreg;
-#elif defined(PROTOCOL_CHIBIOS)
-    chSysUnlockFromISR();
-#endif
 }
 static inline uint8_t pbuf_dequeue(void) {
     uint8_t val = 0;
-
-#if defined(__AVR__)
-    uint8_t sreg = SREG;
-    cli();
-#elif defined(PROTOCOL_CHIBIOS)
-    chSysLock();
-#endif
-
-    if (pbuf_head != pbuf_tail) {
-        val       = pbuf[pbuf_tail];
-        pbuf_tail = (pbuf_tail + 1) % PBUF_SIZE;
-    }
-
-#if defined(__AVR__)
-    SREG = sreg;
-#elif defined(PROTOCOL_CHIBIOS)
-    chSysUnlock();
-#endif
-
+    spsc_queue_dequeue(&pbuf, &val);
     return val;
 }
 bool pbuf_has_data(void) {
-#if defined(__AVR__)
-    uint8_t sreg = SREG;
-    cli();
-#elif defined(PROTOCOL_CHIBIOS)
-    chSysLock();
-#endif
-
-    bool has_data = (pbuf_head != pbuf_tail);
-
-#if defined(__AVR__)
-    SREG = sreg;
-#elif defined(PROTOCOL_CHIBIOS)
-    chSysUnlock();
-#endif
-    return has_data;
+    return !spsc_queue_is_empty(&pbuf);
 }
 static inline void pbuf_clear(void) {
-#if defined(__AVR__)
-    uint8_t sreg = SREG;
-    cli();
-#elif defined(PROTOCOL_CHIBIOS)
-    chSysLock();
-#endif
-
-    pbuf_head = pbuf_tail = 0;
-
-#if defined(__AVR__)
-    SREG = sreg;
-#elif defined(PROTOCOL_CHIBIOS)
-    chSysUnlock();
-#endif
+    spsc_queue_clear(&pbuf);
 }
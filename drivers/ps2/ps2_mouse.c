@@ -92,16 +92,39 @@ void ps2_mouse_task(void) {
         return;
     }
 #else
-    if (pbuf_has_data()) {
-        mouse_report.buttons = ps2_host_recv_response();
-        mouse_report.x       = ps2_host_recv_response();
-        mouse_report.y       = ps2_host_recv_response();
+    /* drain the receive buffer and assemble whole packets, so that a
+     * partially received packet never stalls the main loop waiting for its
+     * remaining bytes to arrive */
+    static uint8_t packet[PS2_MOUSE_PACKET_SIZE];
+    static uint8_t packet_len = 0;
+
+    bool complete = false;
+    while (!complete && pbuf_has_data()) {
+        uint8_t data = ps2_host_recv();
+        if (ps2_error != PS2_ERR_NONE) {
+            break;
+        }
+        if (packet_len == 0 && !(data & (1 << PS2_MOUSE_ALWAYS_1))) {
+            /* not a valid first byte; drop it to regain packet framing */
+            if (debug_mouse) xprintf("ps2_mouse: dropped %02X to resync\n", data);
+            continue;
+        }
+        packet[packet_len++] = data;
+        if (packet_len == PS2_MOUSE_PACKET_SIZE) {
+            packet_len = 0;
+            complete   = true;
+        }
+    }
+
+    if (complete) {
+        mouse_report.buttons = packet[0];
+        mouse_report.x       = packet[1];
+        mouse_report.y       = packet[2];
 #    ifdef PS2_MOUSE_ENABLE_SCROLLING
-        mouse_report.v = -(ps2_host_recv_response() & PS2_MOUSE_SCROLL_MASK);
+        mouse_report.v = -(packet[3] & PS2_MOUSE_SCROLL_MASK);
 #    endif
     } else {
-        if (debug_mouse) print("ps2_mouse: fail to get mouse packet\n");
-        /* return here to avoid updating the mouse button state */
+        /* no complete packet yet; avoid updating the mouse button state */
         return;
     }
 #endif
@@ -79,11 +79,19 @@ __attribute__((unused)) static enum ps2_mouse_mode_e {
 #define PS2_MOUSE_BTN_LEFT 0
 #define PS2_MOUSE_BTN_RIGHT 1
 #define PS2_MOUSE_BTN_MIDDLE 2
+#define PS2_MOUSE_ALWAYS_1 3
 #define PS2_MOUSE_X_SIGN 4
 #define PS2_MOUSE_Y_SIGN 5
 #define PS2_MOUSE_X_OVFLW 6
 #define PS2_MOUSE_Y_OVFLW 7
 
+/* number of bytes in a movement packet */
+#ifdef PS2_MOUSE_ENABLE_SCROLLING
+#    define PS2_MOUSE_PACKET_SIZE 4
+#else
+#    define PS2_MOUSE_PACKET_SIZE 3
+#endif
+
 /* mouse button to start scrolling; set 0 to disable scroll */
 #ifndef PS2_MOUSE_SCROLL_BTN_MASK
 #    define PS2_MOUSE_SCROLL_BTN_MASK (1 << PS2_MOUSE_BTN_MIDDLE)
@@ -296,24 +296,9 @@ bool cirque_pinnacle_init(void) {
     return touchpad_init;
 }
 
-pinnacle_data_t cirque_pinnacle_read_data(void) {
-    uint8_t         data_ready = 0;
-    uint8_t         data[6]    = {0};
-    pinnacle_data_t result     = {0};
-
-    // Check if there is valid data available
-    RAP_ReadBytes(HOSTREG__STATUS1, &data_ready, 1);
-    if ((data_ready & HOSTREG__STATUS1__DATA_READY) == 0) {
-        // no data available yet
-        result.valid = false; // be explicit
-        return result;
-    }
-
-    // Read all data bytes
-    RAP_ReadBytes(HOSTREG__PACKETBYTE_0, data, 6);
-
-    // Get ready for the next data sample
-    cirque_pinnacle_clear_flags();
+// Decodes a raw 6-byte packet (registers 0x12-0x17) into a valid sample
+static pinnacle_data_t cirque_pinnacle_decode_sample(const uint8_t* data) {
+    pinnacle_data_t result = {0};
 
 #if CIRQUE_PINNACLE_POSITION_MODE
     // Decode data for absolute mode
@@ -353,6 +338,112 @@ pinnacle_data_t cirque_pinnacle_read_data(void) {
     return result;
 }
 
+#ifdef CIRQUE_PINNACLE_ASYNC_SAMPLING
+#    ifndef CIRQUE_PINNACLE_SAMPLE_FIFO_SIZE
+#        define CIRQUE_PINNACLE_SAMPLE_FIFO_SIZE 4
+#    endif
+#    ifndef CIRQUE_PINNACLE_ASYNC_FILTER_SHIFT
+#        define CIRQUE_PINNACLE_ASYNC_FILTER_SHIFT 1
+#    endif
+#    ifndef CIRQUE_PINNACLE_ASYNC_MOTION_THRESHOLD
+#        define CIRQUE_PINNACLE_ASYNC_MOTION_THRESHOLD 1
+#    endif
+
+// Single-producer/single-consumer sample FIFO between the async transaction
+// callbacks (producer) and cirque_pinnacle_read_data() (consumer). Each index
+// is only written by its own side, so no locking is needed.
+static pinnacle_data_t  sample_fifo[CIRQUE_PINNACLE_SAMPLE_FIFO_SIZE];
+static volatile uint8_t sample_fifo_head = 0; // next slot to write
+static volatile uint8_t sample_fifo_tail = 0; // next slot to read
+
+static void sample_fifo_push(const pinnacle_data_t* sample) {
+    uint8_t next = (uint8_t)((sample_fifo_head + 1) % CIRQUE_PINNACLE_SAMPLE_FIFO_SIZE);
+    if (next == sample_fifo_tail) {
+        // Full: drop the oldest sample, fresh positions are worth more than stale ones
+        sample_fifo_tail = (uint8_t)((sample_fifo_tail + 1) % CIRQUE_PINNACLE_SAMPLE_FIFO_SIZE);
+    }
+    sample_fifo[sample_fifo_head] = *sample;
+    sample_fifo_head              = next;
+}
+
+bool cirque_pinnacle_async_sample_pop(pinnacle_data_t* sample) {
+    if (sample_fifo_head == sample_fifo_tail) {
+        return false;
+    }
+    *sample          = sample_fifo[sample_fifo_tail];
+    sample_fifo_tail = (uint8_t)((sample_fifo_tail + 1) % CIRQUE_PINNACLE_SAMPLE_FIFO_SIZE);
+    return true;
+}
+
+void cirque_pinnacle_async_sample_ready(const uint8_t* packet) {
+    pinnacle_data_t sample = cirque_pinnacle_decode_sample(packet);
+
+#    if CIRQUE_PINNACLE_POSITION_MODE
+    static uint16_t        filtered_x = 0, filtered_y = 0;
+    static pinnacle_data_t last_admitted = {0};
+
+    if (sample.touchDown && last_admitted.touchDown) {
+        // Low-pass the absolute coordinates while the finger stays down, then
+        // decimate: a sample that doesn't move past the threshold and changes
+        // neither pressure nor buttons carries no information the gesture
+        // logic needs, so it never reaches the main loop.
+        filtered_x = (uint16_t)(filtered_x + ((int16_t)(sample.xValue - filtered_x) / (1 << CIRQUE_PINNACLE_ASYNC_FILTER_SHIFT)));
+        filtered_y = (uint16_t)(filtered_y + ((int16_t)(sample.yValue - filtered_y) / (1 << CIRQUE_PINNACLE_ASYNC_FILTER_SHIFT)));
+        sample.xValue = filtered_x;
+        sample.yValue = filtered_y;
+        if (abs((int16_t)(sample.xValue - last_admitted.xValue)) <= CIRQUE_PINNACLE_ASYNC_MOTION_THRESHOLD && //
+            abs((int16_t)(sample.yValue - last_admitted.yValue)) <= CIRQUE_PINNACLE_ASYNC_MOTION_THRESHOLD && //
+            sample.zValue == last_admitted.zValue && sample.buttonFlags == last_admitted.buttonFlags) {
+            return;
+        }
+    } else {
+        // Touch-down/lift-off transitions always pass through and reset the filter
+        filtered_x = sample.xValue;
+        filtered_y = sample.yValue;
+    }
+    last_admitted = sample;
+#    else
+    static uint8_t last_buttons = 0;
+    if (sample.xDelta == 0 && sample.yDelta == 0 && sample.wheelCount == 0 && sample.buttons == last_buttons) {
+        return;
+    }
+    last_buttons = sample.buttons;
+#    endif
+
+    sample_fifo_push(&sample);
+}
+#endif // CIRQUE_PINNACLE_ASYNC_SAMPLING
+
+pinnacle_data_t cirque_pinnacle_read_data(void) {
+#ifdef CIRQUE_PINNACLE_ASYNC_SAMPLING
+    pinnacle_data_t result = {0};
+
+    // Kick off the next sample chain (no-op if one is already in flight) and
+    // hand back the oldest pre-filtered sample, if any arrived
+    cirque_pinnacle_async_sample_start();
+    cirque_pinnacle_async_sample_pop(&result);
+    return result;
+#else
+    uint8_t data_ready = 0;
+    uint8_t data[6]    = {0};
+
+    // Check if there is valid data available
+    RAP_ReadBytes(HOSTREG__STATUS1, &data_ready, 1);
+    if ((data_ready & HOSTREG__STATUS1__DATA_READY) == 0) {
+        // no data available yet
+        return (pinnacle_data_t){.valid = false}; // be explicit
+    }
+
+    // Read all data bytes
+    RAP_ReadBytes(HOSTREG__PACKETBYTE_0, data, 6);
+
+    // Get ready for the next data sample
+    cirque_pinnacle_clear_flags();
+
+    return cirque_pinnacle_decode_sample(data);
+#endif
+}
+
 #ifdef POINTING_DEVICE_GESTURES_CURSOR_GLIDE_ENABLE
 static bool cursor_glide_enable = true;
 
@@ -124,3 +124,15 @@ void            cirque_pinnacle_set_scale(uint16_t scale);
 uint16_t        cirque_pinnacle_get_cpi(void);
 void            cirque_pinnacle_set_cpi(uint16_t cpi);
 report_mouse_t  cirque_pinnacle_get_report(report_mouse_t mouse_report);
+
+#ifdef CIRQUE_PINNACLE_ASYNC_SAMPLING
+#    if !defined(POINTING_DEVICE_DRIVER_cirque_pinnacle_i2c)
+#        error "CIRQUE_PINNACLE_ASYNC_SAMPLING requires the cirque_pinnacle_i2c driver"
+#    endif
+// Begins the next sample transaction chain on the async bus queue, if idle (bus-specific)
+void cirque_pinnacle_async_sample_start(void);
+// Decodes, pre-filters and queues a raw 6-byte packet; called from the bus transaction callbacks
+void cirque_pinnacle_async_sample_ready(const uint8_t* packet);
+// Pops the oldest pre-filtered sample; returns false if none are queued
+bool cirque_pinnacle_async_sample_pop(pinnacle_data_t* sample);
+#endif
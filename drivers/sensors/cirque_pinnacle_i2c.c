@@ -26,3 +26,81 @@ void RAP_Write(uint8_t address, uint8_t data) {
         pointing_device_set_status(POINTING_DEVICE_STATUS_FAILED);
     }
 }
+
+#ifdef CIRQUE_PINNACLE_ASYNC_SAMPLING
+#    include "i2c_master_async.h"
+
+// Sampling state machine on the async I2C queue. Each completion callback
+// enqueues the next RAP transaction of the chain, so one full sample costs a
+// handful of short transfers spread over successive housekeeping passes
+// instead of a single multi-register blocking read on the pointing device
+// poll. The stage names the transaction whose callback fires next.
+typedef enum {
+    ASYNC_SAMPLE_IDLE,        // no sample in flight
+    ASYNC_SAMPLE_STATUS_ADDR, // Status1 register address written
+    ASYNC_SAMPLE_STATUS_READ, // Status1 read issued
+    ASYNC_SAMPLE_PACKET_ADDR, // PacketByte_0 register address written
+    ASYNC_SAMPLE_PACKET_READ, // 6-byte packet read issued
+    ASYNC_SAMPLE_CLEAR,       // SW_DR/SW_CC flag clear issued
+} async_sample_stage_t;
+
+static async_sample_stage_t async_stage = ASYNC_SAMPLE_IDLE;
+static uint8_t              async_status;
+static uint8_t              async_packet[6];
+static const uint8_t        async_clear_value = HOSTREG__STATUS1_DEFVAL & ~(HOSTREG__STATUS1__COMMAND_COMPLETE | HOSTREG__STATUS1__DATA_READY);
+
+static void async_sample_callback(i2c_status_t status, void* user_data) {
+    if (status != I2C_STATUS_SUCCESS) {
+        pd_dprintf("error cirque_pinnacle async sample\n");
+        pointing_device_set_status(POINTING_DEVICE_STATUS_FAILED);
+        async_stage = ASYNC_SAMPLE_IDLE;
+        return;
+    }
+
+    bool queued = true;
+    switch (async_stage) {
+        case ASYNC_SAMPLE_STATUS_ADDR:
+            async_stage = ASYNC_SAMPLE_STATUS_READ;
+            queued      = i2c_enqueue_read_register(CIRQUE_PINNACLE_ADDR << 1, READ_MASK | HOSTREG__STATUS1, &async_status, 1, CIRQUE_PINNACLE_TIMEOUT, I2C_ASYNC_PRIORITY_HIGH, async_sample_callback, NULL);
+            break;
+        case ASYNC_SAMPLE_STATUS_READ:
+            if ((async_status & HOSTREG__STATUS1__DATA_READY) == 0) {
+                // no data available yet, try again on the next poll
+                async_stage = ASYNC_SAMPLE_IDLE;
+                return;
+            }
+            async_stage = ASYNC_SAMPLE_PACKET_ADDR;
+            queued      = i2c_enqueue_write_register(CIRQUE_PINNACLE_ADDR << 1, READ_MASK | HOSTREG__PACKETBYTE_0, NULL, 0, CIRQUE_PINNACLE_TIMEOUT, I2C_ASYNC_PRIORITY_HIGH, async_sample_callback, NULL);
+            break;
+        case ASYNC_SAMPLE_PACKET_ADDR:
+            async_stage = ASYNC_SAMPLE_PACKET_READ;
+            queued      = i2c_enqueue_read_register(CIRQUE_PINNACLE_ADDR << 1, READ_MASK | HOSTREG__PACKETBYTE_0, async_packet, sizeof(async_packet), CIRQUE_PINNACLE_TIMEOUT, I2C_ASYNC_PRIORITY_HIGH, async_sample_callback, NULL);
+            break;
+        case ASYNC_SAMPLE_PACKET_READ:
+            cirque_pinnacle_async_sample_ready(async_packet);
+            // Get ready for the next data sample
+            async_stage = ASYNC_SAMPLE_CLEAR;
+            queued      = i2c_enqueue_write_register(CIRQUE_PINNACLE_ADDR << 1, WRITE_MASK | HOSTREG__STATUS1, &async_clear_value, 1, CIRQUE_PINNACLE_TIMEOUT, I2C_ASYNC_PRIORITY_HIGH, async_sample_callback, NULL);
+            break;
+        case ASYNC_SAMPLE_CLEAR:
+        default:
+            async_stage = ASYNC_SAMPLE_IDLE;
+            return;
+    }
+
+    if (!queued) {
+        // Queue full; abandon this sample and restart the chain on the next poll
+        async_stage = ASYNC_SAMPLE_IDLE;
+    }
+}
+
+void cirque_pinnacle_async_sample_start(void) {
+    if (async_stage != ASYNC_SAMPLE_IDLE) {
+        return;
+    }
+    async_stage = ASYNC_SAMPLE_STATUS_ADDR;
+    if (!i2c_enqueue_write_register(CIRQUE_PINNACLE_ADDR << 1, READ_MASK | HOSTREG__STATUS1, NULL, 0, CIRQUE_PINNACLE_TIMEOUT, I2C_ASYNC_PRIORITY_HIGH, async_sample_callback, NULL)) {
+        async_stage = ASYNC_SAMPLE_IDLE;
+    }
+}
+#endif // CIRQUE_PINNACLE_ASYNC_SAMPLING
@@ -10,8 +10,12 @@
 
 #include "pointing_device_internal.h"
 #include "pmw33xx_common.h"
+#ifdef PMW33XX_PROFILES
+#    include "pmw33xx_profiles.h"
+#endif
 #include "string.h"
 #include "wait.h"
+#include "gpio.h"
 #include "spi_master.h"
 #include "progmem.h"
 
@@ -23,6 +27,11 @@ static const pin_t cs_pins_right[] = PMW33XX_CS_PINS_RIGHT;
 static bool in_burst_left[ARRAY_SIZE(cs_pins_left)]   = {0};
 static bool in_burst_right[ARRAY_SIZE(cs_pins_right)] = {0};
 
+#ifdef PMW33XX_MOTION_PINS
+static const pin_t motion_pins_left[]  = PMW33XX_MOTION_PINS;
+static const pin_t motion_pins_right[] = PMW33XX_MOTION_PINS_RIGHT;
+#endif
+
 bool __attribute__((cold)) pmw33xx_upload_firmware(uint8_t sensor);
 bool __attribute__((cold)) pmw33xx_check_signature(uint8_t sensor);
 
@@ -180,6 +189,10 @@ bool pmw33xx_init(uint8_t sensor) {
 
     spi_stop();
 
+#ifdef PMW33XX_MOTION_PINS
+    gpio_set_pin_input_high(motion_pins[sensor]);
+#endif
+
     wait_ms(10);
     pmw33xx_set_cpi(sensor, PMW33XX_CPI);
 
@@ -211,6 +224,14 @@ pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor) {
         }
         in_burst[sensor] = true;
     }
+#ifdef PMW33XX_MOTION_PINS
+    // MOTION is active-low: while it stays deasserted the sensor has nothing
+    // to report, so skip the SPI burst entirely. Any deltas that occur latch
+    // inside the sensor until the next read once the line asserts.
+    else if (gpio_read_pin(motion_pins[sensor])) {
+        return report;
+    }
+#endif
 
     if (!pmw33xx_spi_start(sensor)) {
         return report;
@@ -249,6 +270,10 @@ uint16_t pmw33xx_get_cpi_wrapper(void) {
 }
 
 report_mouse_t pmw33xx_get_report(report_mouse_t mouse_report) {
+#ifdef PMW33XX_PROFILES
+    // Drip-feed any outstanding profile register writes, one per poll
+    pmw33xx_profile_pump();
+#endif
     pmw33xx_report_t report    = pmw33xx_read_burst(0);
     static bool      in_motion = false;
 
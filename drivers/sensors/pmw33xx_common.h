@@ -89,9 +89,29 @@ STATIC_ASSERT(sizeof((pmw33xx_report_t){0}.motion) == 1, "pmw33xx_report_t.motio
 #    define PMW33XX_CS_PINS_RIGHT {PMW33XX_CS_PIN_RIGHT}
 #endif
 
+// Optional MOTION interrupt pin(s): when defined, the motion burst read is
+// skipped entirely while the sensor holds its (active-low) MOTION line
+// deasserted, freeing the SPI bus whenever the sensor is stationary. Deltas
+// latch inside the sensor until the next read, so no motion is lost while
+// reads are being skipped. Support single and plural spellings, mirroring the
+// chip select pins.
+#if defined(PMW33XX_MOTION_PIN) && !defined(PMW33XX_MOTION_PINS)
+#    define PMW33XX_MOTION_PINS {PMW33XX_MOTION_PIN}
+#endif
+#if defined(PMW33XX_MOTION_PINS) && !defined(PMW33XX_MOTION_PINS_RIGHT)
+#    if defined(PMW33XX_MOTION_PIN_RIGHT)
+#        define PMW33XX_MOTION_PINS_RIGHT {PMW33XX_MOTION_PIN_RIGHT}
+#    else
+#        define PMW33XX_MOTION_PINS_RIGHT PMW33XX_MOTION_PINS
+#    endif
+#endif
+
 // Defines so the old variable names are swapped by the appropiate value on each half
 #define cs_pins (is_keyboard_left() ? cs_pins_left : cs_pins_right)
 #define in_burst (is_keyboard_left() ? in_burst_left : in_burst_right)
+#ifdef PMW33XX_MOTION_PINS
+#    define motion_pins (is_keyboard_left() ? motion_pins_left : motion_pins_right)
+#endif
 #define pmw33xx_number_of_sensors (is_keyboard_left() ? ARRAY_SIZE((pin_t[])PMW33XX_CS_PINS) : ARRAY_SIZE((pin_t[])PMW33XX_CS_PINS_RIGHT))
 
 #if PMW33XX_CPI > PMW33XX_CPI_MAX || PMW33XX_CPI < PMW33XX_CPI_MIN || (PMW33XX_CPI % PMW33XX_CPI_STEP) != 0U
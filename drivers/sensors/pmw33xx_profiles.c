@@ -0,0 +1,73 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef PMW33XX_PROFILES
+
+#    include "pmw33xx_profiles.h"
+#    include "pmw33xx_common.h"
+#    include "keymap_introspection.h"
+#    include "pointing_device_internal.h"
+
+typedef struct profile_reg_write_t {
+    uint8_t reg;
+    uint8_t value;
+} profile_reg_write_t;
+
+// Largest batch: two CPI bytes (PMW3389) plus liftoff, angle tune, angle snap
+#    define PROFILE_BATCH_MAX 5
+
+static profile_reg_write_t batch[PROFILE_BATCH_MAX];
+static uint8_t             batch_len       = 0;
+static uint8_t             batch_cursor    = 0;
+static uint8_t             batch_total     = 0;
+static uint8_t             current_profile = 0;
+
+static void compile_batch(const pmw33xx_profile_t* profile) {
+    batch_len = 0;
+#    if defined(POINTING_DEVICE_DRIVER_pmw3389)
+    uint16_t cpival              = CONSTRAIN((profile->cpi / PMW33XX_CPI_STEP), (PMW33XX_CPI_MIN / PMW33XX_CPI_STEP), (PMW33XX_CPI_MAX / PMW33XX_CPI_STEP)) - 1U;
+    batch[batch_len++]           = (profile_reg_write_t){REG_Resolution_H, (cpival >> 8) & 0xFF};
+    batch[batch_len++]           = (profile_reg_write_t){REG_Resolution_L, cpival & 0xFF};
+#    else
+    uint8_t cpival     = CONSTRAIN((profile->cpi / PMW33XX_CPI_STEP), (PMW33XX_CPI_MIN / PMW33XX_CPI_STEP), (PMW33XX_CPI_MAX / PMW33XX_CPI_STEP)) - 1U;
+    batch[batch_len++] = (profile_reg_write_t){REG_Config1, cpival};
+#    endif
+    batch[batch_len++] = (profile_reg_write_t){REG_Lift_Config, profile->liftoff};
+    batch[batch_len++] = (profile_reg_write_t){REG_Angle_Tune, (uint8_t)CONSTRAIN(profile->angle_tune, -127, 127)};
+    batch[batch_len++] = (profile_reg_write_t){REG_Angle_Snap, profile->angle_snap ? 0x80 : 0x00};
+}
+
+void pmw33xx_profile_select(uint8_t index) {
+    if (index >= pmw33xx_profile_count()) {
+        return;
+    }
+    current_profile = index;
+    compile_batch(pmw33xx_profile_get(index));
+    batch_cursor = 0;
+    batch_total  = batch_len * pmw33xx_number_of_sensors;
+    pd_dprintf("pmw33xx: profile %u queued, %u register writes\n", index, batch_total);
+}
+
+uint8_t pmw33xx_profile_current(void) {
+    return current_profile;
+}
+
+void pmw33xx_profile_next(void) {
+    pmw33xx_profile_select((current_profile + 1) % pmw33xx_profile_count());
+}
+
+bool pmw33xx_profile_dirty(void) {
+    return batch_cursor < batch_total;
+}
+
+void pmw33xx_profile_pump(void) {
+    if (batch_cursor >= batch_total) {
+        return;
+    }
+    uint8_t                    sensor = batch_cursor / batch_len;
+    const profile_reg_write_t* write  = &batch[batch_cursor % batch_len];
+    pmw33xx_write(sensor, write->reg, write->value);
+    batch_cursor++;
+}
+
+#endif // PMW33XX_PROFILES
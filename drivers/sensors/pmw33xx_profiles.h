@@ -0,0 +1,48 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Named sensor profiles for the PMW33XX family. A profile bundles the tuning
+ * registers that users flip together -- CPI, liftoff distance and angle
+ * snapping -- and is compiled into a register-write batch when selected. The
+ * batch is drained one register per sensor poll through pmw33xx_profile_pump()
+ * rather than written inline, so a profile switch never stalls the main loop
+ * for the full write sequence (each PMW33XX register write busy-waits ~180us
+ * of bus turnaround time).
+ *
+ * Define PMW33XX_PROFILES in config.h and declare the table in your keymap:
+ *
+ *     const pmw33xx_profile_t pmw33xx_profiles[] = {
+ *         {.cpi = 800,  .liftoff = 0x02, .angle_tune = 0, .angle_snap = false},
+ *         {.cpi = 1600, .liftoff = 0x02, .angle_tune = 0, .angle_snap = true},
+ *     };
+ */
+
+typedef struct pmw33xx_profile_t {
+    uint16_t cpi;        // counts per inch, constrained to the sensor's range/step
+    uint8_t  liftoff;    // REG_Lift_Config value, same encoding as PMW33XX_LIFTOFF_DISTANCE
+    int8_t   angle_tune; // rotation applied in-sensor, in degrees
+    bool     angle_snap; // snap near-straight motion to the axes
+} pmw33xx_profile_t;
+
+// The profile table, defined in the keymap.
+extern const pmw33xx_profile_t pmw33xx_profiles[];
+
+// Starts applying the given profile to all sensors; out-of-range indices are ignored.
+void pmw33xx_profile_select(uint8_t index);
+
+// Gets the index of the most recently selected profile.
+uint8_t pmw33xx_profile_current(void);
+
+// Selects the next profile, wrapping at the end of the table.
+void pmw33xx_profile_next(void);
+
+// Whether a selected profile still has register writes outstanding.
+bool pmw33xx_profile_dirty(void);
+
+// Writes at most one outstanding register; called from the sensor poll path.
+void pmw33xx_profile_pump(void);
@@ -93,6 +93,30 @@ spi_status_t spi_read(void);
  */
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
+/**
+ * \brief Begin sending multiple bytes to the selected SPI device, returning before the transfer has completed.
+ *
+ * On platforms with DMA-backed SPI the transfer proceeds in the background, allowing the caller to perform other work
+ * while it is in flight. Platforms without background transfer support fall back to a blocking transmit. The caller
+ * must keep `data` valid and unmodified, and must not start another SPI operation, until `spi_transmit_async_wait()`
+ * has returned.
+ *
+ * \param data A pointer to the data to write from.
+ * \param length The number of bytes to write. Take care not to overrun the length of `data`.
+ *
+ * \return `SPI_STATUS_ERROR` if the transfer could not be started, otherwise `SPI_STATUS_SUCCESS`.
+ */
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length);
+
+/**
+ * \brief Wait for a transfer started by `spi_transmit_async()` to complete.
+ *
+ * Safe to call when no transfer is in flight, in which case it returns immediately.
+ *
+ * \return `SPI_STATUS_ERROR` if some error occurs, otherwise `SPI_STATUS_SUCCESS`.
+ */
+spi_status_t spi_transmit_async_wait(void);
+
 /**
  * \brief Receive multiple bytes from the selected SPI device.
  *
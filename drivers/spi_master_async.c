@@ -0,0 +1,137 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stddef.h>
+
+#include "spi_master_async.h"
+
+typedef struct spi_async_txn_t {
+    bool                      active;
+    spi_async_priority_t      priority;
+    uint16_t                  seq; // enqueue order within a priority class
+    const spi_async_device_t *device;
+    const uint8_t            *tx_data;
+    uint16_t                  tx_length;
+    uint8_t                  *rx_data;
+    uint16_t                  rx_length;
+    spi_async_callback_t      callback;
+    void                     *user_data;
+} spi_async_txn_t;
+
+static spi_async_txn_t queue[SPI_ASYNC_QUEUE_DEPTH];
+static uint16_t        next_seq = 0;
+
+// Transaction whose transmit phase is proceeding in the background; the bus
+// stays held (chip select asserted) until it is collected
+static spi_async_txn_t in_flight;
+static bool            in_flight_active = false;
+
+bool spi_enqueue_transaction(const spi_async_device_t *device, const uint8_t *tx_data, uint16_t tx_length, uint8_t *rx_data, uint16_t rx_length, spi_async_priority_t priority, spi_async_callback_t callback, void *user_data) {
+    for (uint8_t i = 0; i < (SPI_ASYNC_QUEUE_DEPTH); i++) {
+        if (!queue[i].active) {
+            queue[i] = (spi_async_txn_t){
+                .active    = true,
+                .priority  = priority,
+                .seq       = next_seq++,
+                .device    = device,
+                .tx_data   = tx_data,
+                .tx_length = tx_length,
+                .rx_data   = rx_data,
+                .rx_length = rx_length,
+                .callback  = callback,
+                .user_data = user_data,
+            };
+            return true;
+        }
+    }
+    return false;
+}
+
+uint8_t spi_async_pending(void) {
+    uint8_t count = in_flight_active ? 1 : 0;
+    for (uint8_t i = 0; i < (SPI_ASYNC_QUEUE_DEPTH); i++) {
+        if (queue[i].active) {
+            count++;
+        }
+    }
+    return count;
+}
+
+static spi_async_txn_t *next_transaction(void) {
+    spi_async_txn_t *best = NULL;
+    for (uint8_t i = 0; i < (SPI_ASYNC_QUEUE_DEPTH); i++) {
+        if (!queue[i].active) {
+            continue;
+        }
+        // Higher priority class wins; within a class, the oldest entry wins.
+        // Sequence numbers are compared with wraparound-safe arithmetic.
+        if (best == NULL || queue[i].priority < best->priority || (queue[i].priority == best->priority && (int16_t)(queue[i].seq - best->seq) < 0)) {
+            best = &queue[i];
+        }
+    }
+    return best;
+}
+
+static void complete(const spi_async_txn_t *txn, spi_status_t status) {
+    spi_stop();
+    if (txn->callback != NULL) {
+        txn->callback(status, txn->user_data);
+    }
+}
+
+// Collect the in-flight transmit phase, perform any receive phase, release the bus
+static void collect_in_flight(void) {
+    spi_status_t status = spi_transmit_async_wait();
+    if (status == SPI_STATUS_SUCCESS && in_flight.rx_length > 0) {
+        status = spi_receive(in_flight.rx_data, in_flight.rx_length);
+    }
+    in_flight_active = false;
+    complete(&in_flight, status);
+}
+
+bool spi_async_task(void) {
+    if (in_flight_active) {
+        collect_in_flight();
+        return true;
+    }
+
+    spi_async_txn_t *slot = next_transaction();
+    if (slot == NULL) {
+        return false;
+    }
+
+    // Snapshot before releasing the slot, so the callback can safely enqueue
+    // a follow-up transaction
+    spi_async_txn_t txn = *slot;
+    slot->active        = false;
+
+    spi_start_config_t config = txn.device->config;
+    if (!spi_start_extended(&config)) {
+        // Bus held by a direct spi_start() caller; put the transaction back
+        // and retry on the next pass
+        *slot = txn;
+        return false;
+    }
+
+    if (txn.tx_length > 0) {
+        spi_status_t status = spi_transmit_async(txn.tx_data, txn.tx_length);
+        if (status != SPI_STATUS_SUCCESS) {
+            complete(&txn, status);
+            return true;
+        }
+        // Leave the transfer proceeding in the background; the next
+        // invocation collects it
+        in_flight        = txn;
+        in_flight_active = true;
+        return true;
+    }
+
+    // Receive-only transactions are short sensor reads; perform them inline
+    complete(&txn, txn.rx_length > 0 ? spi_receive(txn.rx_data, txn.rx_length) : SPI_STATUS_SUCCESS);
+    return true;
+}
+
+void spi_async_flush(void) {
+    while (spi_async_task()) {
+    }
+}
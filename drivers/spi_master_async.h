@@ -0,0 +1,103 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "spi_master.h"
+
+/**
+ * \file
+ *
+ * \defgroup spi_master_async SPI Master Async Queue API
+ *
+ * \brief Bus arbitration layer with queued per-device transactions on top of the SPI Master API.
+ *
+ * Each device captures its bus parameters (slave select pin, endianness, mode,
+ * divisor) once in a context struct; consumers then enqueue transactions
+ * against the device instead of performing spi_start()/spi_stop() inline. The
+ * queue is drained from the housekeeping task, and the transmit phase of each
+ * transaction runs through spi_transmit_async(), so on DMA-backed platforms a
+ * large transfer (e.g. a display flush) proceeds in the background while the
+ * main loop keeps scanning; completion is collected on the following pass.
+ *
+ * While a transaction is in flight the bus is held by the manager; direct
+ * spi_start() callers will be refused until it completes. Data buffers are not
+ * copied and must remain valid until the transaction's callback has fired.
+ * \{
+ */
+
+/**
+ * \brief Relative scheduling priority of a queued transaction.
+ *
+ * Within a priority class transactions execute in enqueue order; a higher
+ * class always runs before a lower one regardless of age.
+ */
+typedef enum spi_async_priority_t {
+    SPI_ASYNC_PRIORITY_HIGH = 0, //< Latency-sensitive transfers, e.g. sensor reads.
+    SPI_ASYNC_PRIORITY_NORMAL,   //< Default.
+    SPI_ASYNC_PRIORITY_LOW,      //< Bulk transfers that can wait, e.g. display frame data.
+} spi_async_priority_t;
+
+/**
+ * \brief Per-device transaction context, capturing the bus parameters applied for every queued transaction.
+ */
+typedef struct spi_async_device_t {
+    spi_start_config_t config;
+} spi_async_device_t;
+
+/**
+ * \brief Completion callback for a queued transaction.
+ *
+ * \param status The result of the transfer.
+ * \param user_data The pointer supplied at enqueue time.
+ */
+typedef void (*spi_async_callback_t)(spi_status_t status, void *user_data);
+
+/**
+ * \brief Number of transactions the queue can hold.
+ */
+#ifndef SPI_ASYNC_QUEUE_DEPTH
+#    define SPI_ASYNC_QUEUE_DEPTH 8
+#endif
+
+/**
+ * \brief Queue a transaction against a device: an optional transmit phase followed by an optional receive phase.
+ *
+ * \param device The device context whose bus parameters are applied for the transfer.
+ * \param tx_data A pointer to the data to transmit, NULL if there is no transmit phase. Must stay valid until the callback fires.
+ * \param tx_length The number of bytes to write.
+ * \param rx_data A pointer to a buffer to read into after the transmit phase, NULL if there is no receive phase. Must stay valid until the callback fires.
+ * \param rx_length The number of bytes to read.
+ * \param priority The scheduling priority class.
+ * \param callback Invoked from spi_async_task() on completion, may be NULL.
+ * \param user_data Passed through to the callback.
+ *
+ * \return `true` if the transaction was queued, `false` if the queue is full.
+ */
+bool spi_enqueue_transaction(const spi_async_device_t *device, const uint8_t *tx_data, uint16_t tx_length, uint8_t *rx_data, uint16_t rx_length, spi_async_priority_t priority, spi_async_callback_t callback, void *user_data);
+
+/**
+ * \brief Number of transactions currently waiting in the queue, including one in flight.
+ */
+uint8_t spi_async_pending(void);
+
+/**
+ * \brief Progress the queue: collect a completed in-flight transfer, or start the highest-priority queued transaction.
+ *
+ * Invoked from the housekeeping task. The transmit phase is started with
+ * spi_transmit_async() and left to proceed in the background; the next
+ * invocation collects it, performs any receive phase and fires the callback.
+ *
+ * \return `true` if any work was performed.
+ */
+bool spi_async_task(void);
+
+/**
+ * \brief Synchronously drain the queue, including any in-flight transfer.
+ */
+void spi_async_flush(void);
+
+/** \} */
@@ -32,7 +32,7 @@ typedef enum {
 static td_state_t td_state;
 accent_state_t accent_state = ACCENT_NONE;
 
-tap_dance_action_t tap_dance_actions[TAP_DANCE_ACTIONS_COUNT] = {
+const tap_dance_action_t tap_dance_actions[TAP_DANCE_ACTIONS_COUNT] PROGMEM = {
   [TD_SFT_CAPSW]  = ACTION_TAP_DANCE_FN_ADVANCED(NULL, dance_shift_capsword_finished, dance_shift_capsword_reset),
   [TD_NAV_ACCENT] = ACTION_TAP_DANCE_FN_ADVANCED(NULL, dance_nav_accent_finished,     dance_nav_accent_reset),
   [TD_NUM_ACCENT] = ACTION_TAP_DANCE_FN_ADVANCED(NULL, dance_num_accent_finished,     dance_num_accent_reset)
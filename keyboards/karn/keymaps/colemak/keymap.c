@@ -10,7 +10,7 @@ enum {
 };
 
 // Tap Dance definitions
-tap_dance_action_t tap_dance_actions[] = {
+const tap_dance_action_t tap_dance_actions[] PROGMEM = {
     // Tap once for F1, twice for F11
     [TD_F1_F11] = ACTION_TAP_DANCE_DOUBLE(KC_F1, KC_F11),
     [TD_F2_F12] = ACTION_TAP_DANCE_DOUBLE(KC_F2, KC_F12),
@@ -126,6 +126,6 @@ void tk_reset(tap_dance_state_t *state, void *user_data){
 }
 
 //associate the tap dance key with its functionality
-tap_dance_action_t tap_dance_actions[] = {
+const tap_dance_action_t tap_dance_actions[] PROGMEM = {
     [TAPPY_KEY] = ACTION_TAP_DANCE_FN_ADVANCED(NULL, tk_finished, tk_reset)
 };
@@ -79,7 +79,7 @@ void se_reset (tap_dance_state_t *state, void *user_data) {
   se_tap_state.state = 0;
 }
 
-tap_dance_action_t tap_dance_actions[] = {
+const tap_dance_action_t tap_dance_actions[] PROGMEM = {
   [SE_TAP_DANCE] = ACTION_TAP_DANCE_FN_ADVANCED(NULL, se_finished, se_reset)
 };
 
@@ -63,7 +63,7 @@ layer_state_t layer_state_set_user(layer_state_t state)
 
 
 // Tap Dance Definitions
-tap_dance_action_t tap_dance_actions[] = {
+const tap_dance_action_t tap_dance_actions[] PROGMEM = {
     // Tap once for
     [TD_SCAPS] = ACTION_TAP_DANCE_DOUBLE(KC_LSFT, KC_CAPS),
 };
@@ -0,0 +1,109 @@
+"""Predict the resource and scan-rate cost of a keyboard's enabled features.
+
+Sums the per-feature flash/RAM/scan-time annotations from
+data/mappings/feature_costs.hjson over the features a keyboard:keymap build
+would enable, so reviewers can see the predicted impact before compiling.
+"""
+from pathlib import Path
+
+from milc import cli
+
+from qmk.decorators import automagic_keyboard, automagic_keymap
+from qmk.info import info_json, keymap_json
+from qmk.json_schema import json_load
+from qmk.keyboard import keyboard_completer, keyboard_folder
+from qmk.keymap import keymap_completer, locate_keymap
+from qmk.path import is_keyboard
+
+# Nominal scan loop budget used to express overhead as a scan rate. A bare
+# keyboard on the reference target scans at roughly this rate; feature scan
+# time is added on top of the base loop time.
+BASE_SCAN_RATE_HZ = 2000
+
+
+def _feature_costs():
+    return json_load(Path('data/mappings/feature_costs.hjson'))
+
+
+def _enabled_features(info_data):
+    return sorted(feature for feature, enabled in info_data.get('features', {}).items() if enabled)
+
+
+@cli.argument('-kb', '--keyboard', type=keyboard_folder, completer=keyboard_completer, help='Keyboard to predict costs for.')
+@cli.argument('-km', '--keymap', completer=keymap_completer, help='Keymap to predict costs for (Optional).')
+@cli.subcommand('Predict flash/RAM/scan-rate cost of enabled features.')
+@automagic_keyboard
+@automagic_keymap
+def budget(cli):
+    """Sum feature cost annotations for a keyboard (and optionally a keymap).
+    """
+    if not cli.config.budget.keyboard:
+        cli.log.error('Missing parameter: --keyboard')
+        cli.subcommands['budget'].print_help()
+        return False
+
+    if not is_keyboard(cli.config.budget.keyboard):
+        cli.log.error('Invalid keyboard: "%s"', cli.config.budget.keyboard)
+        return False
+
+    keyboard = cli.config.budget.keyboard
+    keymap = cli.config.budget.keymap
+
+    if keymap and locate_keymap(keyboard, keymap):
+        # Includes features enabled at the keymap level (keymap.json/rules.mk).
+        info_data = keymap_json(keyboard, keymap)
+        target = f'{keyboard}:{keymap}'
+    else:
+        if keymap:
+            cli.log.warning('Keymap "%s" not found for %s, showing keyboard-level features only.', keymap, keyboard)
+        info_data = info_json(keyboard)
+        target = keyboard
+
+    costs = _feature_costs()
+    enabled = _enabled_features(info_data)
+
+    if not enabled:
+        cli.log.info('No features enabled for %s.', target)
+        return True
+
+    total_flash = 0
+    total_ram = 0
+    total_scan_us = 0.0
+    total_event_us = 0.0
+    unannotated = []
+
+    cli.echo('Predicted feature costs for {fg_cyan}%s{fg_reset}:', target)
+    cli.echo('')
+    cli.echo('    %-20s %10s %10s %10s %10s', 'Feature', 'Flash', 'RAM', 'Scan µs', 'Event µs')
+
+    for feature in enabled:
+        cost = costs.get(feature)
+        if cost is None:
+            unannotated.append(feature)
+            continue
+
+        flash = cost.get('flash', 0)
+        ram = cost.get('ram', 0)
+        scan_us = cost.get('scan_us', 0.0)
+        event_us = cost.get('event_us', 0.0)
+
+        total_flash += flash
+        total_ram += ram
+        total_scan_us += scan_us
+        total_event_us += event_us
+
+        cli.echo('    %-20s %10d %10d %10.1f %10.1f', feature, flash, ram, scan_us, event_us)
+
+    cli.echo('    %-20s %10s %10s %10s %10s', '', '-' * 8, '-' * 8, '-' * 8, '-' * 8)
+    cli.echo('    %-20s %10d %10d %10.1f %10.1f', 'Total', total_flash, total_ram, total_scan_us, total_event_us)
+    cli.echo('')
+
+    base_loop_us = 1e6 / BASE_SCAN_RATE_HZ
+    predicted_rate = 1e6 / (base_loop_us + total_scan_us)
+    cli.echo('Predicted idle scan rate: {fg_cyan}%.0f Hz{fg_reset} (reference base %d Hz, +%.1f µs/scan)', predicted_rate, BASE_SCAN_RATE_HZ, total_scan_us)
+
+    if unannotated:
+        cli.log.info('No cost annotations for: %s', ', '.join(unannotated))
+
+    cli.log.info('Values are measured on the reference target with default configuration; treat them as estimates.')
+    return True
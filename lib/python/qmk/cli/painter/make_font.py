@@ -8,11 +8,25 @@ from qmk.painter import generate_subs, render_header, render_source, valid_forma
 from milc import cli
 
 
+def _read_subset_glyphs(subset_from):
+    """Collects the unique printable characters contained in the supplied comma-separated list of text files.
+
+    Used to subset a font to only the glyphs actually referenced by e.g. a keymap's strings.
+    """
+    glyphs = ''
+    if subset_from:
+        for filename in subset_from.split(','):
+            text = normpath(filename).read_text(encoding='utf-8')
+            glyphs += ''.join(c for c in text if ord(c) >= 0x20 and ord(c) != 0x7F)
+    return glyphs
+
+
 @cli.argument('-f', '--font', required=True, help='Specify input font file.')
 @cli.argument('-o', '--output', required=True, help='Specify output image path.')
 @cli.argument('-s', '--size', default=12, help='Specify font size. Default 12.')
 @cli.argument('-n', '--no-ascii', arg_only=True, action='store_true', help='Disables output of the full ASCII character set (0x20..0x7E), exporting only the glyphs specified.')
 @cli.argument('-u', '--unicode-glyphs', default='', help='Also generate the specified unicode glyphs.')
+@cli.argument('-t', '--subset-from', default='', help='Also generate the glyphs contained in the specified text file(s), comma-separated. Combine with --no-ascii to subset the font to only those glyphs.')
 @cli.argument('-a', '--no-aa', arg_only=True, action='store_true', help='Disable anti-aliasing on fonts.')
 @cli.subcommand('Converts an input font to something QMK understands')
 def painter_make_font_image(cli):
@@ -20,7 +34,8 @@ def painter_make_font_image(cli):
     font = QFFFont(cli)
     # Read from the input file
     cli.args.font = normpath(cli.args.font)
-    font.generate_image(cli.args.font, cli.args.size, include_ascii_glyphs=(not cli.args.no_ascii), unicode_glyphs=cli.args.unicode_glyphs, use_aa=(False if cli.args.no_aa else True))
+    extra_glyphs = cli.args.unicode_glyphs + _read_subset_glyphs(cli.args.subset_from)
+    font.generate_image(cli.args.font, cli.args.size, include_ascii_glyphs=(not cli.args.no_ascii), unicode_glyphs=extra_glyphs, use_aa=(False if cli.args.no_aa else True))
     # Render out the data
     font.save_to_image(normpath(cli.args.output))
 
@@ -29,6 +44,7 @@ def painter_make_font_image(cli):
 @cli.argument('-o', '--output', default='', help='Specify output directory. Defaults to same directory as input.')
 @cli.argument('-n', '--no-ascii', arg_only=True, action='store_true', help='Disables output of the full ASCII character set (0x20..0x7E), exporting only the glyphs specified.')
 @cli.argument('-u', '--unicode-glyphs', default='', help='Also generate the specified unicode glyphs.')
+@cli.argument('-t', '--subset-from', default='', help='Also generate the glyphs contained in the specified text file(s), comma-separated. Combine with --no-ascii to subset the font to only those glyphs.')
 @cli.argument('-f', '--format', required=True, help=f'Output format, valid types: {", ".join(valid_formats.keys())}')
 @cli.argument('-r', '--no-rle', arg_only=True, action='store_true', help='Disable the use of RLE to minimise converted image size.')
 @cli.argument('-w', '--raw', arg_only=True, action='store_true', help='Writes out the QFF file as raw data instead of c/h combo.')
@@ -42,7 +58,8 @@ def painter_convert_font_image(cli):
 
     # Read from the input file
     cli.args.input = normpath(cli.args.input)
-    font.read_from_image(cli.args.input, include_ascii_glyphs=(not cli.args.no_ascii), unicode_glyphs=cli.args.unicode_glyphs)
+    extra_glyphs = cli.args.unicode_glyphs + _read_subset_glyphs(cli.args.subset_from)
+    font.read_from_image(cli.args.input, include_ascii_glyphs=(not cli.args.no_ascii), unicode_glyphs=extra_glyphs)
 
     # Work out the output directory
     if len(cli.args.output) == 0:
@@ -61,7 +78,7 @@ def painter_convert_font_image(cli):
         return
 
     # Work out the text substitutions for rendering the output data
-    metadata = {"glyphs": _generate_font_glyphs_list(not cli.args.no_ascii, cli.args.unicode_glyphs)}
+    metadata = {"glyphs": _generate_font_glyphs_list(not cli.args.no_ascii, extra_glyphs)}
     subs = generate_subs(cli, out_bytes, font_metadata=metadata, command_name="painter_convert_font_image")
 
     # Render and write the header file
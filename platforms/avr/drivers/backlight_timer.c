@@ -140,7 +140,17 @@ void backlight_set(uint8_t level) {
     set_pwm(cie_lightness(rescale_limit_val(ICRx * (uint32_t)level / BACKLIGHT_LEVELS)));
 }
 
-void backlight_task(void) {}
+#ifdef BACKLIGHT_BREATHING
+static void breathing_curve_update(void);
+#endif
+
+void backlight_task(void) {
+#ifdef BACKLIGHT_BREATHING
+    // Regenerate the resolved breathing curve outside of interrupt context
+    // whenever the level or period has changed
+    breathing_curve_update();
+#endif
+}
 
 #ifdef BACKLIGHT_BREATHING
 #    define BREATHING_NO_HALT 0
@@ -148,13 +158,24 @@ void backlight_task(void) {}
 #    define BREATHING_HALT_ON 2
 #    define BREATHING_STEPS 128
 
-static uint8_t  breathing_halt    = BREATHING_NO_HALT;
-static uint16_t breathing_counter = 0;
+static uint8_t breathing_halt = BREATHING_NO_HALT;
 
 static uint8_t breath_scale_counter = 1;
 /* Run the breathing loop at ~120Hz*/
 const uint8_t breathing_ISR_frequency = 120;
 
+// Breathing curve with level scaling, duty cycle limit and CIE correction
+// already applied, so the tick handler is reduced to a table lookup. This
+// matters doubly here as breathing_task() runs inside the overflow ISR that
+// also has to turn the LED pins back on.
+// Regenerated by breathing_curve_update() only when level or period changes.
+static uint16_t breathing_curve[BREATHING_STEPS];
+static uint16_t breathing_step_ticks   = 1;
+static uint16_t breathing_step_counter = 0;
+static uint8_t  breathing_index        = 0;
+static uint8_t  breathing_curve_level  = UINT8_MAX;
+static uint8_t  breathing_curve_period = 0;
+
 static bool breathing = false;
 
 bool is_breathing(void) {
@@ -170,18 +191,21 @@ bool is_breathing(void) {
             breathing = false;            \
         } while (0)
 
-#    define breathing_min()        \
-        do {                       \
-            breathing_counter = 0; \
+#    define breathing_min()             \
+        do {                            \
+            breathing_index        = 0; \
+            breathing_step_counter = 0; \
         } while (0)
-#    define breathing_max()                                                           \
-        do {                                                                          \
-            breathing_counter = get_breathing_period() * breathing_ISR_frequency / 2; \
+#    define breathing_max()                               \
+        do {                                              \
+            breathing_index        = BREATHING_STEPS / 2; \
+            breathing_step_counter = 0;                   \
         } while (0)
 
 void breathing_enable(void) {
-    breathing_counter = 0;
-    breathing_halt    = BREATHING_NO_HALT;
+    breathing_min();
+    breathing_halt = BREATHING_NO_HALT;
+    breathing_curve_update();
     breathing_interrupt_enable();
 }
 
@@ -191,6 +215,7 @@ void breathing_pulse(void) {
     else
         breathing_max();
     breathing_halt = BREATHING_HALT_ON;
+    breathing_curve_update();
     breathing_interrupt_enable();
 }
 
@@ -217,6 +242,28 @@ static inline uint16_t scale_backlight(uint16_t v) {
     return v / BACKLIGHT_LEVELS * get_backlight_level();
 }
 
+static void breathing_curve_update(void) {
+    uint8_t level  = get_backlight_level();
+    uint8_t period = get_breathing_period();
+    if (level == breathing_curve_level && period == breathing_curve_period) {
+        return;
+    }
+    // Pause breathing while the table is rewritten; 16 bit writes are not
+    // atomic on AVR and the overflow ISR reads the table
+    bool running = is_breathing();
+    if (running) breathing_interrupt_disable();
+    for (uint8_t i = 0; i < BREATHING_STEPS; i++) {
+        breathing_curve[i] = cie_lightness(rescale_limit_val(scale_backlight((uint32_t)pgm_read_byte(&breathing_table[i]) * ICRx / 255)));
+    }
+    breathing_step_ticks = (uint16_t)period * breathing_ISR_frequency / BREATHING_STEPS;
+    if (breathing_step_ticks == 0) {
+        breathing_step_ticks = 1;
+    }
+    breathing_curve_level  = level;
+    breathing_curve_period = period;
+    if (running) breathing_interrupt_enable();
+}
+
 void breathing_task(void) {
     // Only run this ISR at ~120 Hz
     if (breath_scale_counter++ == BREATHING_SCALE_FACTOR) {
@@ -224,21 +271,20 @@ void breathing_task(void) {
     } else {
         return;
     }
-    uint16_t interval = (uint16_t)get_breathing_period() * breathing_ISR_frequency / BREATHING_STEPS;
-    // resetting after one period to prevent ugly reset at overflow.
-    breathing_counter = (breathing_counter + 1) % (get_breathing_period() * breathing_ISR_frequency);
-    uint8_t index     = breathing_counter / interval;
-    // limit index to max step value
-    if (index >= BREATHING_STEPS) {
-        index = BREATHING_STEPS - 1;
+    // All curve math lives in breathing_curve_update(); stepping through the
+    // precomputed table is the only per-tick work left
+    if (++breathing_step_counter >= breathing_step_ticks) {
+        breathing_step_counter = 0;
+        if (++breathing_index >= BREATHING_STEPS) {
+            breathing_index = 0;
+        }
     }
 
-    if (((breathing_halt == BREATHING_HALT_ON) && (index == BREATHING_STEPS / 2)) || ((breathing_halt == BREATHING_HALT_OFF) && (index == BREATHING_STEPS - 1))) {
+    if (((breathing_halt == BREATHING_HALT_ON) && (breathing_index == BREATHING_STEPS / 2)) || ((breathing_halt == BREATHING_HALT_OFF) && (breathing_index == BREATHING_STEPS - 1))) {
         breathing_interrupt_disable();
     }
 
-    // Set PWM to a brightnessvalue scaled to the configured resolution
-    set_pwm(cie_lightness(rescale_limit_val(scale_backlight((uint32_t)pgm_read_byte(&breathing_table[index]) * ICRx / 255))));
+    set_pwm(breathing_curve[breathing_index]);
 }
 
 #endif // BACKLIGHT_BREATHING
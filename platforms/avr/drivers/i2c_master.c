@@ -39,6 +39,28 @@
 
 #define TWBR_val (((F_CPU / F_SCL) - 16) / 2)
 
+#ifdef I2C_HEALTH_ENABLE
+#    include "i2c_health.h"
+#    define I2C_HEALTH_BEGIN() uint16_t health_start = timer_read()
+#    define I2C_HEALTH_END(addr, status) i2c_health_record((addr), (status), timer_elapsed(health_start))
+
+#    ifndef F_SCL_FALLBACK
+#        define F_SCL_FALLBACK 100000UL // fallback SCL frequency for an unstable bus
+#    endif
+#    define TWBR_val_fallback (((F_CPU / F_SCL_FALLBACK) - 16) / 2)
+
+void i2c_health_set_speed(bool reduced) {
+    TWBR = (uint8_t)(reduced ? TWBR_val_fallback : TWBR_val);
+}
+#else
+#    define I2C_HEALTH_BEGIN() \
+        do {                   \
+        } while (0)
+#    define I2C_HEALTH_END(addr, status) \
+        do {                             \
+        } while (0)
+#endif
+
 __attribute__((weak)) void i2c_init(void) {
     TWSR = 0; /* no prescaler */
     TWBR = (uint8_t)TWBR_val;
@@ -162,6 +184,7 @@ int16_t i2c_read_nack(uint16_t timeout) {
 }
 
 i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    I2C_HEALTH_BEGIN();
     i2c_status_t status = i2c_start(address | I2C_ACTION_WRITE, timeout);
 
     for (uint16_t i = 0; i < length && status >= 0; i++) {
@@ -170,10 +193,12 @@ i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length,
 
     i2c_stop();
 
+    I2C_HEALTH_END(address, status);
     return status;
 }
 
 i2c_status_t i2c_transmit_P(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    I2C_HEALTH_BEGIN();
     i2c_status_t status = i2c_start(address | I2C_ACTION_WRITE, timeout);
 
     for (uint16_t i = 0; i < length && status >= 0; i++) {
@@ -182,10 +207,12 @@ i2c_status_t i2c_transmit_P(uint8_t address, const uint8_t* data, uint16_t lengt
 
     i2c_stop();
 
+    I2C_HEALTH_END(address, status);
     return status;
 }
 
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
+    I2C_HEALTH_BEGIN();
     i2c_status_t status = i2c_start(address | I2C_ACTION_READ, timeout);
 
     for (uint16_t i = 0; i < (length - 1) && status >= 0; i++) {
@@ -204,10 +231,13 @@ i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16
 
     i2c_stop();
 
-    return (status < 0) ? status : I2C_STATUS_SUCCESS;
+    i2c_status_t result = (status < 0) ? status : I2C_STATUS_SUCCESS;
+    I2C_HEALTH_END(address, result);
+    return result;
 }
 
 i2c_status_t i2c_transmit_and_receive(uint8_t address, const uint8_t* tx_data, uint16_t tx_length, uint8_t* rx_data, uint16_t rx_length, uint16_t timeout) {
+    I2C_HEALTH_BEGIN();
     i2c_status_t status = i2c_start(address | I2C_ACTION_WRITE, timeout);
 
     for (uint16_t i = 0; i < tx_length && status >= 0; i++) {
@@ -230,10 +260,12 @@ i2c_status_t i2c_transmit_and_receive(uint8_t address, const uint8_t* tx_data, u
 
     i2c_stop();
 
+    I2C_HEALTH_END(address, status);
     return status;
 }
 
 i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    I2C_HEALTH_BEGIN();
     i2c_status_t status = i2c_start(devaddr | 0x00, timeout);
     if (status >= 0) {
         status = i2c_write(regaddr, timeout);
@@ -245,10 +277,35 @@ i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t*
 
     i2c_stop();
 
+    I2C_HEALTH_END(devaddr, status);
+    return status;
+}
+
+i2c_status_t i2c_write_segments(uint8_t devaddr, const i2c_segment_t* segments, uint8_t count, uint16_t timeout) {
+    I2C_HEALTH_BEGIN();
+    i2c_status_t status = I2C_STATUS_SUCCESS;
+
+    for (uint8_t s = 0; s < count && status >= 0; s++) {
+        // The first i2c_start() sends a start condition, subsequent ones a
+        // repeated start, chaining the segments without a stop in between.
+        status = i2c_start(devaddr | 0x00, timeout);
+        if (status >= 0) {
+            status = i2c_write(segments[s].regaddr, timeout);
+
+            for (uint16_t i = 0; i < segments[s].length && status >= 0; i++) {
+                status = i2c_write(segments[s].data[i], timeout);
+            }
+        }
+    }
+
+    i2c_stop();
+
+    I2C_HEALTH_END(devaddr, status);
     return status;
 }
 
 i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    I2C_HEALTH_BEGIN();
     i2c_status_t status = i2c_start(devaddr | 0x00, timeout);
     if (status >= 0) {
         status = i2c_write(regaddr >> 8, timeout);
@@ -264,10 +321,12 @@ i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8
 
     i2c_stop();
 
+    I2C_HEALTH_END(devaddr, status);
     return status;
 }
 
 i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    I2C_HEALTH_BEGIN();
     i2c_status_t status = i2c_start(devaddr, timeout);
     if (status < 0) {
         goto error;
@@ -297,10 +356,13 @@ i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data,
 error:
     i2c_stop();
 
-    return (status < 0) ? status : I2C_STATUS_SUCCESS;
+    i2c_status_t result = (status < 0) ? status : I2C_STATUS_SUCCESS;
+    I2C_HEALTH_END(devaddr, result);
+    return result;
 }
 
 i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    I2C_HEALTH_BEGIN();
     i2c_status_t status = i2c_start(devaddr, timeout);
     if (status < 0) {
         goto error;
@@ -334,11 +396,15 @@ i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* dat
 error:
     i2c_stop();
 
-    return (status < 0) ? status : I2C_STATUS_SUCCESS;
+    i2c_status_t result = (status < 0) ? status : I2C_STATUS_SUCCESS;
+    I2C_HEALTH_END(devaddr, result);
+    return result;
 }
 
 __attribute__((weak)) i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout) {
+    I2C_HEALTH_BEGIN();
     i2c_status_t status = i2c_start(address, timeout);
     i2c_stop();
+    I2C_HEALTH_END(address, status);
     return status;
 }
@@ -133,6 +133,7 @@
 // custom setup in config.h
 // #define TID_SEND_ADJUST 2
 // #define SERIAL_DELAY 6             // micro sec
+// #define SERIAL_DELAY_CYCLES 88     // cycles, optional finer-grained override of SERIAL_DELAY
 // #define READ_WRITE_START_ADJUST 30 // cycles
 // #define READ_WRITE_WIDTH_ADJUST 8 // cycles
 #    else
@@ -215,8 +216,22 @@
 #        endif /* SELECT_SOFT_SERIAL_SPEED */
 #    endif     /* SERIAL_DELAY */
 
-#    define SERIAL_DELAY_HALF1 (SERIAL_DELAY / 2)
-#    define SERIAL_DELAY_HALF2 (SERIAL_DELAY - SERIAL_DELAY / 2)
+// Bit timing in CPU cycles derived from F_CPU. __builtin_avr_delay_cycles
+// emits a cycle-exact delay sequence, so half-bit delays keep cycle
+// granularity instead of rounding to whole microseconds, and an odd bit
+// width splits exactly across the two halves. SERIAL_DELAY_CYCLES can be set
+// directly in config.h for bit times between the standard speed tiers.
+#    ifndef SERIAL_DELAY_CYCLES
+#        define SERIAL_DELAY_CYCLES ((F_CPU / 1000000) * SERIAL_DELAY)
+#    endif
+#    define SERIAL_DELAY_HALF1_CYCLES (SERIAL_DELAY_CYCLES / 2)
+#    define SERIAL_DELAY_HALF2_CYCLES (SERIAL_DELAY_CYCLES - SERIAL_DELAY_CYCLES / 2)
+
+// The fixed in-bit adjustments must fit inside one bit time, otherwise the
+// selected speed cannot be met at this F_CPU.
+#    if SERIAL_DELAY_CYCLES <= (READ_WRITE_START_ADJUST + READ_WRITE_WIDTH_ADJUST)
+#        error bit time shorter than the read/write adjustment budget; choose a slower SELECT_SOFT_SERIAL_SPEED
+#    endif
 
 #    define SLAVE_INT_WIDTH_US 1
 #    define SLAVE_INT_ACK_WIDTH_UNIT 2
@@ -224,17 +239,17 @@
 
 inline static void serial_delay(void) ALWAYS_INLINE;
 inline static void serial_delay(void) {
-    _delay_us(SERIAL_DELAY);
+    _delay_sub_us(SERIAL_DELAY_CYCLES);
 }
 
 inline static void serial_delay_half1(void) ALWAYS_INLINE;
 inline static void serial_delay_half1(void) {
-    _delay_us(SERIAL_DELAY_HALF1);
+    _delay_sub_us(SERIAL_DELAY_HALF1_CYCLES);
 }
 
 inline static void serial_delay_half2(void) ALWAYS_INLINE;
 inline static void serial_delay_half2(void) {
-    _delay_us(SERIAL_DELAY_HALF2);
+    _delay_sub_us(SERIAL_DELAY_HALF2_CYCLES);
 }
 
 inline static void serial_output(void) ALWAYS_INLINE;
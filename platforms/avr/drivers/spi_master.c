@@ -171,6 +171,16 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    // The AVR SPI peripheral has no DMA, so background transfers are not
+    // possible; fall back to a blocking transmit.
+    return spi_transmit(data, length);
+}
+
+spi_status_t spi_transmit_async_wait(void) {
+    return SPI_STATUS_SUCCESS;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spi_status_t status;
 
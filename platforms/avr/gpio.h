@@ -38,3 +38,12 @@ typedef uint8_t pin_t;
 #define gpio_read_pin(pin) ((bool)(PINx_ADDRESS(pin) & _BV((pin) & 0xF)))
 
 #define gpio_toggle_pin(pin) (PORTx_ADDRESS(pin) ^= _BV((pin) & 0xF))
+
+/* Operation of GPIO by port. */
+
+typedef uint8_t port_id_t;
+typedef uint8_t port_data_t;
+
+#define gpio_pin_to_port(pin) ((port_id_t)((pin) >> PORT_SHIFTER))
+#define gpio_pin_to_port_bit(pin) ((port_data_t)_BV((pin) & 0xF))
+#define gpio_read_port(port) ((port_data_t)_SFR_IO8(ADDRESS_BASE + (port)))
@@ -0,0 +1,42 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "crc.h"
+
+#include <ch.h>
+#include <hal.h>
+
+/* Hardware-offloaded CRC8 using the STM32 CRC unit, on families where the unit
+ * has a programmable polynomial (F0/F3/F7/G4/L4 and friends). It is configured
+ * for the same CRC-8 (polynomial 0x31, init 0xff) that the software
+ * implementation in quantum/crc.c computes, which remains the fallback on all
+ * other targets via its weak symbols. */
+#if defined(CRC_ENABLE) && defined(MCU_STM32) && defined(CRC_POL_POL) && defined(rccEnableCRC)
+
+void crc_init(void) {
+    rccEnableCRC(true);
+    CRC->INIT = 0xFF;
+    CRC->POL  = 0x31;
+    CRC->CR   = CRC_CR_POLYSIZE_1 | CRC_CR_RESET; /* 8-bit polynomial size */
+}
+
+uint8_t crc8(const void *data, size_t data_len) {
+    const uint8_t *d = (const uint8_t *)data;
+
+    /* The CRC unit is a single shared peripheral -- keep concurrent callers
+     * (the main loop vs. the split target's transport thread) from
+     * interleaving their byte streams. */
+    syssts_t sts = chSysGetStatusAndLockX();
+
+    CRC->CR |= CRC_CR_RESET;
+    while (data_len--) {
+        /* Byte-wide access so the unit consumes exactly one byte per write. */
+        *(volatile uint8_t *)&CRC->DR = *d++;
+    }
+    uint8_t crc = (uint8_t)CRC->DR;
+
+    chSysRestoreStatusX(sts);
+    return crc;
+}
+
+#endif // defined(CRC_ENABLE) && defined(MCU_STM32) && defined(CRC_POL_POL) && defined(rccEnableCRC)
@@ -88,10 +88,32 @@ static const dacsample_t dac_buffer_trapezoid[] = {
 };
 #endif // AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID
 
+#if defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE)
+#    define DAC_SAMPLE_WAVETABLE dac_buffer_sine
+#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRIANGLE)
+#    define DAC_SAMPLE_WAVETABLE dac_buffer_triangle
+#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID)
+#    define DAC_SAMPLE_WAVETABLE dac_buffer_trapezoid
+#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_SQUARE)
+#    define DAC_SAMPLE_WAVETABLE dac_buffer_square
+#endif
+
+/* the full uint32_t range of a phase accumulator maps to one period of the
+ * wavetable, so the accumulator wraps around for free and its top bits index
+ * the table directly; requires a power-of-two wavetable length */
+#define DAC_WAVETABLE_PHASE_SHIFT (32 - __builtin_ctz(ARRAY_SIZE(DAC_SAMPLE_WAVETABLE)))
+
 static dacsample_t dac_buffer[AUDIO_DAC_BUFFER_SIZE];
 
 /* keep track of the sample position for for each frequency */
-static float dac_if[AUDIO_MAX_SIMULTANEOUS_TONES] = {0.0};
+static uint32_t dac_phase[AUDIO_MAX_SIMULTANEOUS_TONES] = {0};
+
+/* phase advance per sample for each tone, and the 16.16 fixed-point scale
+ * factor for the number of active tones; both are precomputed whenever the
+ * set of active tones changes, to keep floating-point math and divisions out
+ * of the per-sample path */
+static uint32_t dac_phase_increment[AUDIO_MAX_SIMULTANEOUS_TONES] = {0};
+static uint32_t dac_value_scale                                   = 0;
 
 static float   active_tones_snapshot[AUDIO_MAX_SIMULTANEOUS_TONES] = {0};
 static uint8_t active_tones_snapshot_length                        = 0;
@@ -123,61 +145,19 @@ __attribute__((weak)) uint16_t dac_value_generate(void) {
     }
 
     /* doing additive wave synthesis over all currently playing tones = adding up
-     * sine-wave-samples for each frequency, scaled by the number of active tones
+     * wavetable-samples for each frequency, scaled by the number of active tones
      */
-    uint_fast16_t value     = 0;
-    float         frequency = 0.0f;
-
-#if defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE)
-    const size_t wavetable_length = ARRAY_SIZE(dac_buffer_sine);
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRIANGLE)
-    const size_t wavetable_length = ARRAY_SIZE(dac_buffer_triangle);
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID)
-    const size_t wavetable_length = ARRAY_SIZE(dac_buffer_trapezoid);
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_SQUARE)
-    const size_t wavetable_length = ARRAY_SIZE(dac_buffer_square);
-#endif
+    uint_fast16_t value = 0;
 
     for (size_t i = 0; i < active_tones_snapshot_length; i++) {
         /* Note: a user implementation does not have to rely on the active_tones_snapshot, but
          * could directly query the active frequencies through audio_get_processed_frequency */
-        frequency = active_tones_snapshot[i];
-
-        float new_dac_if = dac_if[i];
-        new_dac_if += frequency * ((float)wavetable_length / AUDIO_DAC_SAMPLE_RATE * 2.0f / 3.0f);
-        /*Note: the 2/3 are necessary to get the correct frequencies on the
-         *      DAC output (as measured with an oscilloscope), since the gpt
-         *      timer runs with 3*AUDIO_DAC_SAMPLE_RATE; and the DAC callback
-         *      is called twice per conversion.*/
-
-        while (new_dac_if >= wavetable_length)
-            new_dac_if -= wavetable_length;
-        dac_if[i] = new_dac_if;
 
         // Wavetable generation/lookup
-        size_t dac_i = (size_t)new_dac_if;
+        size_t dac_i = dac_phase[i] >> DAC_WAVETABLE_PHASE_SHIFT;
+        dac_phase[i] += dac_phase_increment[i];
 
-#if defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE)
-        value += dac_buffer_sine[dac_i] / active_tones_snapshot_length;
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRIANGLE)
-        value += dac_buffer_triangle[dac_i] / active_tones_snapshot_length;
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID)
-        value += dac_buffer_trapezoid[dac_i] / active_tones_snapshot_length;
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_SQUARE)
-        value += dac_buffer_square[dac_i] / active_tones_snapshot_length;
-#endif
-        /*
-        // SINE
-        value += dac_buffer_sine[dac_i] / active_tones_snapshot_length / 3;
-        // TRIANGLE
-        value += dac_buffer_triangle[dac_i] / active_tones_snapshot_length / 3;
-        // SQUARE
-        value += dac_buffer_square[dac_i] / active_tones_snapshot_length / 3;
-        //NOTE: combination of these three wave-forms is more exemplary - and doesn't sound particularly good :-P
-        */
-
-        // STAIRS (mostly usefully as test-pattern)
-        // value_avg = dac_buffer_staircase[dac_i] / active_tones_snapshot_length;
+        value += ((uint32_t)DAC_SAMPLE_WAVETABLE[dac_i] * dac_value_scale) >> 16;
     }
 
     return value;
@@ -243,9 +223,15 @@ static void dac_end(DACDriver *dacp) {
             for (uint8_t i = 0; i < active_tones; i++) {
                 float freq = audio_get_processed_frequency(i);
                 if (freq > 0) { // disregard 'rest' notes, with valid frequency 0.0f; which would only lower the resulting waveform volume during the additive synthesis step
+                    /*Note: the 2/3 are necessary to get the correct frequencies on the
+                     *      DAC output (as measured with an oscilloscope), since the gpt
+                     *      timer runs with 3*AUDIO_DAC_SAMPLE_RATE; and the DAC callback
+                     *      is called twice per conversion.*/
+                    dac_phase_increment[active_tones_snapshot_length]     = (uint32_t)(freq * (4294967296.0f / AUDIO_DAC_SAMPLE_RATE * 2.0f / 3.0f));
                     active_tones_snapshot[active_tones_snapshot_length++] = freq;
                 }
             }
+            dac_value_scale = (active_tones_snapshot_length > 0) ? (uint32_t)0x10000 / active_tones_snapshot_length : 0;
 
             if ((0 == active_tones_snapshot_length) && (OUTPUT_REACHED_ZERO_BEFORE_OFF == state)) {
                 state = OUTPUT_OFF;
@@ -358,7 +344,8 @@ void audio_driver_start_impl(void) {
     gptStartContinuous(&GPTD6, 2U);
 
     for (uint8_t i = 0; i < AUDIO_MAX_SIMULTANEOUS_TONES; i++) {
-        dac_if[i]                = 0.0f;
+        dac_phase[i]             = 0;
+        dac_phase_increment[i]   = 0;
         active_tones_snapshot[i] = 0.0f;
     }
     active_tones_snapshot_length = 0;
@@ -22,6 +22,7 @@
 #include <stdbool.h>
 #include "util.h"
 #include "debug.h"
+#include "timer.h"
 #include "eeprom_legacy_emulated_flash.h"
 #include "legacy_flash_ops.h"
 #include "eeprom_driver.h"
@@ -156,6 +157,34 @@ static uint8_t *DataBuf = (uint8_t *)WordBuf;
 /* Pointer to the first available slot within the write log */
 static uint16_t *empty_slot;
 
+#ifdef FEE_WRITEBACK_DELAY_MS
+/* Write-back cache: flash programming of written words is deferred by
+ * FEE_WRITEBACK_DELAY_MS. Repeated writes to the same address within the
+ * window (eeconfig bytes hammered by host configurators) collapse into one
+ * log entry, and the two bytes of a flash word dirtied by separate byte
+ * writes are combined into a single halfword program. Reads are unaffected,
+ * as they are always served from the DataBuf cache; the trade-off is that a
+ * power loss inside the window loses the deferred updates. */
+#    ifndef FEE_WRITEBACK_SLOTS
+#        define FEE_WRITEBACK_SLOTS 8
+#    endif
+typedef struct {
+    uint16_t address; /* word-aligned */
+    uint8_t  mask;    /* bit 0: low byte dirty, bit 1: high byte dirty */
+} writeback_slot_t;
+
+static writeback_slot_t writeback_slots[FEE_WRITEBACK_SLOTS];
+static uint8_t          writeback_count = 0;
+static uint32_t         writeback_timer = 0;
+#endif
+
+/* Bytes of write log remaining below which the housekeeping task compacts
+ * preemptively, so the erase-and-rewrite pause lands while idle instead of
+ * inside the write that would have filled the log. */
+#ifndef FEE_COMPACTION_HEADROOM
+#    define FEE_COMPACTION_HEADROOM 16
+#endif
+
 // #define DEBUG_EEPROM_OUTPUT
 
 /*
@@ -302,6 +331,12 @@ static void eeprom_clear(void) {
 
     empty_slot = (uint16_t *)FEE_WRITE_LOG_BASE_ADDRESS;
     eeprom_printf("eeprom_clear empty_slot: 0x%08lx\n", (uint32_t)empty_slot);
+
+#ifdef FEE_WRITEBACK_DELAY_MS
+    /* Anything pending is either stale (erase) or about to be persisted
+     * wholesale from DataBuf (compaction) */
+    writeback_count = 0;
+#endif
 }
 
 /* Erase emulated eeprom */
@@ -437,6 +472,71 @@ static uint8_t eeprom_write_log_byte_entry(uint16_t Address) {
     return status;
 }
 
+#ifdef FEE_WRITEBACK_DELAY_MS
+/* Program one cached word from DataBuf into flash */
+static void eeprom_writeback_flush_slot(const writeback_slot_t *slot) {
+    uint16_t address = slot->address;
+
+    /* First, attempt to write directly into the compacted flash area */
+    if (eeprom_write_direct_entry(address)) {
+        return;
+    }
+    /* Otherwise append to the write log; addresses below the byte range use
+     * one byte entry per dirty byte, exactly as the immediate path would */
+    if (address < FEE_BYTE_RANGE) {
+        if (slot->mask & 1) {
+            eeprom_write_log_byte_entry(address);
+        }
+        if (slot->mask & 2) {
+            eeprom_write_log_byte_entry(address + 1);
+        }
+    } else {
+        eeprom_write_log_word_entry(address);
+    }
+}
+
+static void eeprom_writeback_flush(void) {
+    /* A slot flush can trigger compaction, which persists all of DataBuf and
+     * zeroes writeback_count; the loop condition re-checks it so the
+     * remaining (already persisted) slots are not logged twice */
+    for (uint8_t i = 0; i < writeback_count; i++) {
+        eeprom_writeback_flush_slot(&writeback_slots[i]);
+    }
+    writeback_count = 0;
+}
+
+static void eeprom_writeback_mark(uint16_t address, uint8_t mask) {
+    for (uint8_t i = 0; i < writeback_count; i++) {
+        if (writeback_slots[i].address == address) {
+            writeback_slots[i].mask |= mask;
+            return;
+        }
+    }
+    if (writeback_count == FEE_WRITEBACK_SLOTS) {
+        eeprom_writeback_flush();
+    }
+    if (writeback_count == 0) {
+        writeback_timer = timer_read32();
+    }
+    writeback_slots[writeback_count].address = address;
+    writeback_slots[writeback_count].mask    = mask;
+    writeback_count++;
+}
+#endif /* FEE_WRITEBACK_DELAY_MS */
+
+void eeprom_legacy_emulated_flash_task(void) {
+#ifdef FEE_WRITEBACK_DELAY_MS
+    /* Flush pending writes once the combining window has passed */
+    if (writeback_count > 0 && timer_elapsed32(writeback_timer) >= FEE_WRITEBACK_DELAY_MS) {
+        eeprom_writeback_flush();
+    }
+#endif
+    /* Preemptively compact while idle once the log is nearly full */
+    if ((uintptr_t)empty_slot > FEE_WRITE_LOG_LAST_ADDRESS - FEE_COMPACTION_HEADROOM) {
+        eeprom_compact();
+    }
+}
+
 uint8_t EEPROM_WriteDataByte(uint16_t Address, uint8_t DataByte) {
     /* if the address is out-of-bounds, do nothing */
     if (Address >= FEE_DENSITY_BYTES) {
@@ -454,6 +554,11 @@ uint8_t EEPROM_WriteDataByte(uint16_t Address, uint8_t DataByte) {
     DataBuf[Address] = DataByte;
     eeprom_printf("EEPROM_WriteDataByte DataBuf[0x%04x] = 0x%02x\n", Address, DataBuf[Address]);
 
+#ifdef FEE_WRITEBACK_DELAY_MS
+    /* Defer the flash write; adjacent and repeated updates combine in the cache */
+    eeprom_writeback_mark(Address & 0xFFFE, 1 << (Address & 1));
+    return FLASH_COMPLETE;
+#else
     /* perform the write into flash memory */
     /* First, attempt to write directly into the compacted flash area */
     FLASH_Status status = eeprom_write_direct_entry(Address);
@@ -469,6 +574,7 @@ uint8_t EEPROM_WriteDataByte(uint16_t Address, uint8_t DataByte) {
         eeprom_printf("EEPROM_WriteDataByte [STATUS == %d]\n", status);
     }
     return status;
+#endif /* FEE_WRITEBACK_DELAY_MS */
 }
 
 uint8_t EEPROM_WriteDataWord(uint16_t Address, uint16_t DataWord) {
@@ -501,6 +607,16 @@ uint8_t EEPROM_WriteDataWord(uint16_t Address, uint16_t DataWord) {
     *(uint16_t *)(&DataBuf[Address]) = DataWord;
     eeprom_printf("EEPROM_WriteDataWord DataBuf[0x%04x] = 0x%04x\n", Address, *(uint16_t *)(&DataBuf[Address]));
 
+#ifdef FEE_WRITEBACK_DELAY_MS
+    {
+        /* Defer the flash write, tracking which bytes actually changed */
+        uint8_t mask = 0;
+        if ((uint8_t)oldValue != (uint8_t)DataWord) mask |= 1;
+        if ((oldValue >> 8) != (DataWord >> 8)) mask |= 2;
+        eeprom_writeback_mark(Address, mask);
+    }
+    return FLASH_COMPLETE;
+#else
     /* perform the write into flash memory */
     /* First, attempt to write directly into the compacted flash area */
     final_status = eeprom_write_direct_entry(Address);
@@ -527,6 +643,7 @@ uint8_t EEPROM_WriteDataWord(uint16_t Address, uint16_t DataWord) {
         eeprom_printf("EEPROM_WriteDataWord [STATUS == %d]\n", final_status);
     }
     return final_status;
+#endif /* FEE_WRITEBACK_DELAY_MS */
 }
 
 uint8_t EEPROM_ReadDataByte(uint16_t Address) {
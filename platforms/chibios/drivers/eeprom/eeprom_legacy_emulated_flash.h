@@ -30,4 +30,8 @@ uint8_t  EEPROM_WriteDataWord(uint16_t Address, uint16_t DataWord);
 uint8_t  EEPROM_ReadDataByte(uint16_t Address);
 uint16_t EEPROM_ReadDataWord(uint16_t Address);
 
+/* Housekeeping: flushes the deferred write-back cache (FEE_WRITEBACK_DELAY_MS)
+ * and compacts the write log preemptively while idle */
+void eeprom_legacy_emulated_flash_task(void);
+
 void print_eeprom(void);
@@ -32,6 +32,21 @@
 #include <ch.h>
 #include <hal.h>
 
+#ifdef I2C_HEALTH_ENABLE
+#    include "i2c_health.h"
+#    include "timer.h"
+#    include "wait.h"
+#    define I2C_HEALTH_BEGIN() uint16_t health_start = timer_read()
+#    define I2C_HEALTH_END(addr, status) i2c_health_record((addr), (status), timer_elapsed(health_start))
+#else
+#    define I2C_HEALTH_BEGIN() \
+        do {                   \
+        } while (0)
+#    define I2C_HEALTH_END(addr, status) \
+        do {                             \
+        } while (0)
+#endif
+
 #ifndef I2C_DRIVER
 #    define I2C_DRIVER I2CD1
 #endif
@@ -90,6 +105,38 @@
 #    endif
 #endif
 
+#ifdef I2C_HEALTH_ENABLE
+// Fallback bus speed for when the health monitor deems the bus unstable. On
+// TIMINGR-based parts the timing register cannot be derived from a clock rate
+// at runtime; provide fallback timing values in config.h to get speed
+// renegotiation there, otherwise the fallback keeps the primary timings and
+// only the bus clear recovery is effective.
+#    ifdef USE_I2CV1
+#        ifndef I2C1_CLOCK_SPEED_FALLBACK
+#            define I2C1_CLOCK_SPEED_FALLBACK 100000
+#        endif
+#    else
+#        ifndef I2C1_CLOCK_SPEED_FALLBACK
+#            define I2C1_CLOCK_SPEED_FALLBACK 100000
+#        endif
+#        ifndef I2C1_TIMINGR_PRESC_FALLBACK
+#            define I2C1_TIMINGR_PRESC_FALLBACK I2C1_TIMINGR_PRESC
+#        endif
+#        ifndef I2C1_TIMINGR_SCLDEL_FALLBACK
+#            define I2C1_TIMINGR_SCLDEL_FALLBACK I2C1_TIMINGR_SCLDEL
+#        endif
+#        ifndef I2C1_TIMINGR_SDADEL_FALLBACK
+#            define I2C1_TIMINGR_SDADEL_FALLBACK I2C1_TIMINGR_SDADEL
+#        endif
+#        ifndef I2C1_TIMINGR_SCLH_FALLBACK
+#            define I2C1_TIMINGR_SCLH_FALLBACK I2C1_TIMINGR_SCLH
+#        endif
+#        ifndef I2C1_TIMINGR_SCLL_FALLBACK
+#            define I2C1_TIMINGR_SCLL_FALLBACK I2C1_TIMINGR_SCLL
+#        endif
+#    endif
+#endif
+
 static const I2CConfig i2cconfig = {
 #if defined(USE_I2CV1_CONTRIB)
     I2C1_CLOCK_SPEED,
@@ -107,6 +154,62 @@ static const I2CConfig i2cconfig = {
 #endif
 };
 
+#ifdef I2C_HEALTH_ENABLE
+static const I2CConfig i2cconfig_fallback = {
+#    if defined(USE_I2CV1_CONTRIB)
+    I2C1_CLOCK_SPEED_FALLBACK,
+#    elif defined(USE_I2CV1)
+    I2C1_OPMODE,
+    I2C1_CLOCK_SPEED_FALLBACK,
+    STD_DUTY_CYCLE,
+#    elif defined(WB32F3G71xx) || defined(WB32FQ95xx)
+    I2C1_OPMODE,
+    I2C1_CLOCK_SPEED_FALLBACK,
+#    else
+    STM32_TIMINGR_PRESC(I2C1_TIMINGR_PRESC_FALLBACK) | STM32_TIMINGR_SCLDEL(I2C1_TIMINGR_SCLDEL_FALLBACK) | STM32_TIMINGR_SDADEL(I2C1_TIMINGR_SDADEL_FALLBACK) | STM32_TIMINGR_SCLH(I2C1_TIMINGR_SCLH_FALLBACK) | STM32_TIMINGR_SCLL(I2C1_TIMINGR_SCLL_FALLBACK), 0, 0
+#    endif
+};
+static const I2CConfig* i2cconfig_active = &i2cconfig;
+
+void i2c_health_set_speed(bool reduced) {
+    i2cconfig_active = reduced ? &i2cconfig_fallback : &i2cconfig;
+    // The next transaction restarts the peripheral with the new config
+    i2cStop(&I2C_DRIVER);
+}
+
+void i2c_health_bus_clear(void) {
+    // Clock SCL manually until a stuck slave has shifted out the byte it is
+    // holding and releases SDA, then issue a STOP by hand.
+    i2cStop(&I2C_DRIVER);
+    palSetLineMode(I2C1_SCL_PIN, PAL_MODE_OUTPUT_OPENDRAIN);
+    palSetLineMode(I2C1_SDA_PIN, PAL_MODE_INPUT);
+    palSetLine(I2C1_SCL_PIN);
+    wait_us(5);
+    for (uint8_t i = 0; i < 9 && palReadLine(I2C1_SDA_PIN) == PAL_LOW; i++) {
+        palClearLine(I2C1_SCL_PIN);
+        wait_us(5);
+        palSetLine(I2C1_SCL_PIN);
+        wait_us(5);
+    }
+    palSetLineMode(I2C1_SDA_PIN, PAL_MODE_OUTPUT_OPENDRAIN);
+    palClearLine(I2C1_SDA_PIN);
+    wait_us(5);
+    palSetLine(I2C1_SDA_PIN);
+    wait_us(5);
+#    if defined(USE_GPIOV1)
+    palSetLineMode(I2C1_SCL_PIN, I2C1_SCL_PAL_MODE);
+    palSetLineMode(I2C1_SDA_PIN, I2C1_SDA_PAL_MODE);
+#    else
+    palSetLineMode(I2C1_SCL_PIN, PAL_MODE_ALTERNATE(I2C1_SCL_PAL_MODE) | PAL_OUTPUT_TYPE_OPENDRAIN);
+    palSetLineMode(I2C1_SDA_PIN, PAL_MODE_ALTERNATE(I2C1_SDA_PAL_MODE) | PAL_OUTPUT_TYPE_OPENDRAIN);
+#    endif
+}
+
+#    define I2C_CONFIG_ACTIVE i2cconfig_active
+#else
+#    define I2C_CONFIG_ACTIVE (&i2cconfig)
+#endif
+
 /**
  * @brief Handles any I2C error condition by stopping the I2C peripheral and
  * aborting any ongoing transactions. Furthermore ChibiOS status codes are
@@ -149,25 +252,35 @@ __attribute__((weak)) void i2c_init(void) {
 }
 
 i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    I2C_HEALTH_BEGIN();
+    i2cStart(&I2C_DRIVER, I2C_CONFIG_ACTIVE);
+    msg_t        status = i2cMasterTransmitTimeout(&I2C_DRIVER, (address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
+    i2c_status_t result = i2c_epilogue(status);
+    I2C_HEALTH_END(address, result);
+    return result;
 }
 
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterReceiveTimeout(&I2C_DRIVER, (address >> 1), data, length, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    I2C_HEALTH_BEGIN();
+    i2cStart(&I2C_DRIVER, I2C_CONFIG_ACTIVE);
+    msg_t        status = i2cMasterReceiveTimeout(&I2C_DRIVER, (address >> 1), data, length, TIME_MS2I(timeout));
+    i2c_status_t result = i2c_epilogue(status);
+    I2C_HEALTH_END(address, result);
+    return result;
 }
 
 i2c_status_t i2c_transmit_and_receive(uint8_t address, const uint8_t* tx_data, uint16_t tx_length, uint8_t* rx_data, uint16_t rx_length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (address >> 1), tx_data, tx_length, rx_data, rx_length, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    I2C_HEALTH_BEGIN();
+    i2cStart(&I2C_DRIVER, I2C_CONFIG_ACTIVE);
+    msg_t        status = i2cMasterTransmitTimeout(&I2C_DRIVER, (address >> 1), tx_data, tx_length, rx_data, rx_length, TIME_MS2I(timeout));
+    i2c_status_t result = i2c_epilogue(status);
+    I2C_HEALTH_END(address, result);
+    return result;
 }
 
 i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    I2C_HEALTH_BEGIN();
+    i2cStart(&I2C_DRIVER, I2C_CONFIG_ACTIVE);
 
     uint8_t complete_packet[length + 1];
     for (uint16_t i = 0; i < length; i++) {
@@ -175,12 +288,35 @@ i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t*
     }
     complete_packet[0] = regaddr;
 
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), complete_packet, length + 1, 0, 0, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    msg_t        status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), complete_packet, length + 1, 0, 0, TIME_MS2I(timeout));
+    i2c_status_t result = i2c_epilogue(status);
+    I2C_HEALTH_END(devaddr, result);
+    return result;
+}
+
+i2c_status_t i2c_write_segments(uint8_t devaddr, const i2c_segment_t* segments, uint8_t count, uint16_t timeout) {
+    I2C_HEALTH_BEGIN();
+    // Start the peripheral once for the whole chain instead of per segment.
+    i2cStart(&I2C_DRIVER, I2C_CONFIG_ACTIVE);
+
+    i2c_status_t status = I2C_STATUS_SUCCESS;
+    for (uint8_t s = 0; s < count && status == I2C_STATUS_SUCCESS; s++) {
+        uint8_t complete_packet[segments[s].length + 1];
+        for (uint16_t i = 0; i < segments[s].length; i++) {
+            complete_packet[i + 1] = segments[s].data[i];
+        }
+        complete_packet[0] = segments[s].regaddr;
+
+        msg_t msg = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), complete_packet, segments[s].length + 1, 0, 0, TIME_MS2I(timeout));
+        status    = i2c_epilogue(msg);
+    }
+    I2C_HEALTH_END(devaddr, status);
+    return status;
 }
 
 i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    I2C_HEALTH_BEGIN();
+    i2cStart(&I2C_DRIVER, I2C_CONFIG_ACTIVE);
 
     uint8_t complete_packet[length + 2];
     for (uint16_t i = 0; i < length; i++) {
@@ -189,21 +325,29 @@ i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8
     complete_packet[0] = regaddr >> 8;
     complete_packet[1] = regaddr & 0xFF;
 
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), complete_packet, length + 2, 0, 0, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    msg_t        status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), complete_packet, length + 2, 0, 0, TIME_MS2I(timeout));
+    i2c_status_t result = i2c_epilogue(status);
+    I2C_HEALTH_END(devaddr, result);
+    return result;
 }
 
 i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), &regaddr, 1, data, length, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    I2C_HEALTH_BEGIN();
+    i2cStart(&I2C_DRIVER, I2C_CONFIG_ACTIVE);
+    msg_t        status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), &regaddr, 1, data, length, TIME_MS2I(timeout));
+    i2c_status_t result = i2c_epilogue(status);
+    I2C_HEALTH_END(devaddr, result);
+    return result;
 }
 
 i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    I2C_HEALTH_BEGIN();
+    i2cStart(&I2C_DRIVER, I2C_CONFIG_ACTIVE);
     uint8_t register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
     msg_t   status             = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), register_packet, 2, data, length, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    i2c_status_t result        = i2c_epilogue(status);
+    I2C_HEALTH_END(devaddr, result);
+    return result;
 }
 
 __attribute__((weak)) i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout) {
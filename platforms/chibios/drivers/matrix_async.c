@@ -0,0 +1,171 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include <ch.h>
+#include <hal.h>
+
+#include "matrix_async.h"
+#include "gpio.h"
+#include "util.h"
+
+#if !defined(MATRIX_ROW_PINS) || !defined(MATRIX_COL_PINS)
+#    error matrix_async requires MATRIX_ROW_PINS and MATRIX_COL_PINS
+#endif
+#if DIODE_DIRECTION != COL2ROW
+#    error matrix_async only supports COL2ROW matrices
+#endif
+
+#ifndef MATRIX_ASYNC_GPT_DRIVER
+#    define MATRIX_ASYNC_GPT_DRIVER GPTD6
+#endif
+
+#ifndef MATRIX_ASYNC_GPT_FREQUENCY
+#    define MATRIX_ASYNC_GPT_FREQUENCY 1000000 // 1MHz, 1us per tick
+#endif
+
+// Settle time between selecting a row and sampling its columns, in GPT ticks.
+#ifndef MATRIX_ASYNC_SETTLE_TICKS
+#    define MATRIX_ASYNC_SETTLE_TICKS 5
+#endif
+
+#ifndef MATRIX_INPUT_PRESSED_STATE
+#    define MATRIX_INPUT_PRESSED_STATE 0
+#endif
+
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+// Scan state machine, advanced from the GPT callback:
+// select the current row, let the lines settle for one timer period, sample
+// all columns into the back buffer, then move on. When the last row has been
+// sampled the back buffer is published and scanning restarts at row 0.
+typedef enum {
+    MATRIX_ASYNC_PHASE_SELECT,
+    MATRIX_ASYNC_PHASE_SAMPLE,
+} matrix_async_phase_t;
+
+static matrix_async_phase_t scan_phase  = MATRIX_ASYNC_PHASE_SELECT;
+static uint8_t              scan_row    = 0;
+static matrix_row_t         back_buffer[MATRIX_ROWS];
+static matrix_row_t         front_buffer[MATRIX_ROWS];
+static matrix_row_t         last_read[MATRIX_ROWS];
+
+static void select_row(uint8_t row) {
+    pin_t pin = row_pins[row];
+    if (pin != NO_PIN) {
+        gpio_set_pin_output(pin);
+        gpio_write_pin_low(pin);
+    }
+}
+
+static void unselect_row(uint8_t row) {
+    pin_t pin = row_pins[row];
+    if (pin != NO_PIN) {
+#ifdef MATRIX_UNSELECT_DRIVE_HIGH
+        gpio_set_pin_output(pin);
+        gpio_write_pin_high(pin);
+#else
+        gpio_set_pin_input_high(pin);
+#endif
+    }
+}
+
+static matrix_row_t sample_cols(void) {
+    matrix_row_t row_value   = 0;
+    matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+    for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
+        pin_t pin = col_pins[col_index];
+        if (pin == NO_PIN) {
+            continue;
+        }
+        if (gpio_read_pin(pin) == MATRIX_INPUT_PRESSED_STATE) {
+            row_value |= row_shifter;
+        }
+    }
+    return row_value;
+}
+
+static void matrix_async_gpt_callback(GPTDriver *gptp) {
+    (void)gptp;
+
+    switch (scan_phase) {
+        case MATRIX_ASYNC_PHASE_SELECT:
+            select_row(scan_row);
+            scan_phase = MATRIX_ASYNC_PHASE_SAMPLE;
+            break;
+
+        case MATRIX_ASYNC_PHASE_SAMPLE:
+            back_buffer[scan_row] = sample_cols();
+            unselect_row(scan_row);
+
+            if (++scan_row == MATRIX_ROWS) {
+                scan_row = 0;
+                // Publish the completed snapshot. The copy is short and runs
+                // at callback level, so readers in thread context only ever
+                // observe whole scans.
+                chSysLockFromISR();
+                memcpy(front_buffer, back_buffer, sizeof(front_buffer));
+                chSysUnlockFromISR();
+            }
+            scan_phase = MATRIX_ASYNC_PHASE_SELECT;
+            break;
+    }
+}
+
+static const GPTConfig matrix_async_gpt_config = {
+    .frequency = MATRIX_ASYNC_GPT_FREQUENCY,
+    .callback  = matrix_async_gpt_callback,
+};
+
+void matrix_async_start(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        unselect_row(row);
+    }
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        if (col_pins[col] != NO_PIN) {
+            gpio_set_pin_input_high(col_pins[col]);
+        }
+    }
+
+    scan_phase = MATRIX_ASYNC_PHASE_SELECT;
+    scan_row   = 0;
+
+    gptStart(&MATRIX_ASYNC_GPT_DRIVER, &matrix_async_gpt_config);
+    gptStartContinuous(&MATRIX_ASYNC_GPT_DRIVER, MATRIX_ASYNC_SETTLE_TICKS);
+}
+
+void matrix_async_stop(void) {
+    gptStopTimer(&MATRIX_ASYNC_GPT_DRIVER);
+    gptStop(&MATRIX_ASYNC_GPT_DRIVER);
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        unselect_row(row);
+    }
+}
+
+bool matrix_async_read(matrix_row_t current_matrix[]) {
+    matrix_row_t snapshot[MATRIX_ROWS];
+
+    chSysLock();
+    memcpy(snapshot, front_buffer, sizeof(snapshot));
+    chSysUnlock();
+
+    bool changed = memcmp(last_read, snapshot, sizeof(snapshot)) != 0;
+    if (changed) {
+        memcpy(last_read, snapshot, sizeof(snapshot));
+    }
+    memcpy(current_matrix, snapshot, MATRIX_ROWS * sizeof(matrix_row_t));
+    return changed;
+}
+
+// Default CUSTOM_MATRIX = lite bindings; keyboards needing extra init can
+// override these and call into matrix_async_* themselves.
+__attribute__((weak)) void matrix_init_custom(void) {
+    matrix_async_start();
+}
+
+__attribute__((weak)) bool matrix_scan_custom(matrix_row_t current_matrix[]) {
+    return matrix_async_read(current_matrix);
+}
@@ -0,0 +1,37 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "matrix.h"
+
+/**
+ * \brief Asynchronous matrix scanning engine for ChibiOS targets.
+ *
+ * Row selection and column capture are driven from a hardware timer instead
+ * of the synchronous select/wait/read loop in `quantum/matrix.c`. The settle
+ * time between selecting a row and sampling its columns is spent running the
+ * rest of the firmware rather than busy-waiting, and completed scans are
+ * published as double-buffered snapshots that `matrix_scan_custom()` consumes.
+ *
+ * Use it by setting `CUSTOM_MATRIX = lite` and `SRC += matrix_async.c` in
+ * rules.mk. Only COL2ROW matrices are supported. The timer instance can be
+ * chosen with `MATRIX_ASYNC_GPT_DRIVER` (default `GPTD6`), and the tick
+ * frequency with `MATRIX_ASYNC_GPT_FREQUENCY` (default 1MHz).
+ */
+
+/** \brief Start the timer-driven scan engine. Called from matrix_init_custom(). */
+void matrix_async_start(void);
+
+/** \brief Stop the scan engine, e.g. around suspend. */
+void matrix_async_stop(void);
+
+/**
+ * \brief Copy the most recently completed scan snapshot.
+ *
+ * \return true if the snapshot differs from the previous copy.
+ */
+bool matrix_async_read(matrix_row_t current_matrix[]);
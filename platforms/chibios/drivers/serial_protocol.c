@@ -127,6 +127,19 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
         return false;
     }
 
+#if defined(SERIAL_USART_FULL_DUPLEX)
+    /* With independent TX and RX lines the transaction buffer can be streamed out
+     * immediately behind the transaction id -- it queues up in the slave's receive
+     * path while the slave emits its handshake -- removing one line-turnaround wait
+     * from every transaction that carries a payload. */
+    if (transaction->initiator2target_buffer_size) {
+        if (unlikely(!serial_transport_send(split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
+            serial_dprintf("SPLIT: sending buffer failed\n");
+            return false;
+        }
+    }
+#endif
+
     uint8_t transaction_id_shake = 0xFF;
 
     /* Which we always read back first so that we can error out correctly.
@@ -138,13 +151,17 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
         return false;
     }
 
-    /* Send transaction buffer to the slave. If this transaction requires it. */
+#if !defined(SERIAL_USART_FULL_DUPLEX)
+    /* Send transaction buffer to the slave. If this transaction requires it.
+     * On the shared half-duplex wire this has to wait until the slave's handshake
+     * has been received, as both transfers would collide otherwise. */
     if (transaction->initiator2target_buffer_size) {
         if (unlikely(!serial_transport_send(split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
             serial_dprintf("SPLIT: sending buffer failed\n");
             return false;
         }
     }
+#endif
 
     /* Receive transaction buffer from the slave. If this transaction requires it. */
     if (transaction->target2initiator_buffer_size) {
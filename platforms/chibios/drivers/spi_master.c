@@ -455,6 +455,20 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_transmit_async_wait(void) {
+    // The end-of-transfer interrupt returns the driver to the ready state;
+    // poll for it rather than sleeping so this remains cheap for transfers
+    // that have already finished.
+    while (SPI_DRIVER.state == SPI_ACTIVE) {
+    }
+    return SPI_STATUS_SUCCESS;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
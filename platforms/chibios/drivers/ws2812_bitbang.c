@@ -1,5 +1,9 @@
 #include "ws2812.h"
 
+#include "compiler_support.h"
+
+#include <string.h>
+
 #include "gpio.h"
 #include "chibios_config.h"
 
@@ -55,7 +59,9 @@
         }                                           \
     } while (0)
 
-void sendByte(uint8_t byte) {
+// Run the bitbanged timing loop from RAM when FAST_CODE_IN_RAM is set, so
+// XIP cache misses cannot stretch the strict high/low pulse widths.
+FAST_CODE void sendByte(uint8_t byte) {
     // WS2812 protocol wants most significant bits first
     for (unsigned char bit = 0; bit < 8; bit++) {
         bool is_one = byte & (1 << (7 - bit));
@@ -77,18 +83,23 @@ void sendByte(uint8_t byte) {
 }
 
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
+// Transmit the first frame even if it is all black, in case the chain powered up with garbage.
+static bool ws2812_dirty = true;
 
 void ws2812_init(void) {
     palSetLineMode(WS2812_DI_PIN, WS2812_OUTPUT_MODE);
 }
 
 void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
-    ws2812_leds[index].r = red;
-    ws2812_leds[index].g = green;
-    ws2812_leds[index].b = blue;
+    ws2812_led_t led = {.r = red, .g = green, .b = blue};
 #if defined(WS2812_RGBW)
-    ws2812_rgb_to_rgbw(&ws2812_leds[index]);
+    ws2812_rgb_to_rgbw(&led);
 #endif
+    if (memcmp(&ws2812_leds[index], &led, sizeof(led)) == 0) {
+        return;
+    }
+    ws2812_leds[index] = led;
+    ws2812_dirty       = true;
 }
 
 void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -98,6 +109,14 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
+    // The LEDs latch their last value, so an unchanged frame need not be
+    // retransmitted; skipping it keeps interrupts enabled for the ~3ms the
+    // chain would otherwise take.
+    if (!ws2812_dirty) {
+        return;
+    }
+    ws2812_dirty = false;
+
     // this code is very time dependent, so we need to disable interrupts
     chSysLock();
 
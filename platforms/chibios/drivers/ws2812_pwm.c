@@ -1,4 +1,6 @@
 #include "ws2812.h"
+
+#include <string.h>
 #include "gpio.h"
 #include "chibios_config.h"
 
@@ -393,14 +395,19 @@ void ws2812_write_led_rgbw(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b,
 }
 
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
+// Encode the first frame unconditionally so the DMA buffer matches ws2812_leds.
+static bool ws2812_dirty = true;
 
 void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
-    ws2812_leds[index].r = red;
-    ws2812_leds[index].g = green;
-    ws2812_leds[index].b = blue;
+    ws2812_led_t led = {.r = red, .g = green, .b = blue};
 #if defined(WS2812_RGBW)
-    ws2812_rgb_to_rgbw(&ws2812_leds[index]);
+    ws2812_rgb_to_rgbw(&led);
 #endif
+    if (memcmp(&ws2812_leds[index], &led, sizeof(led)) == 0) {
+        return;
+    }
+    ws2812_leds[index] = led;
+    ws2812_dirty       = true;
 }
 
 void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -410,6 +417,13 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
+    // The DMA streams the frame buffer continuously; only re-encode it when
+    // a color actually changed since the last flush.
+    if (!ws2812_dirty) {
+        return;
+    }
+    ws2812_dirty = false;
+
     for (int i = 0; i < WS2812_LED_COUNT; i++) {
 #if defined(WS2812_RGBW)
         ws2812_write_led_rgbw(i, ws2812_leds[i].r, ws2812_leds[i].g, ws2812_leds[i].b, ws2812_leds[i].w);
@@ -3,6 +3,8 @@
 #include "util.h"
 #include "chibios_config.h"
 
+#include <string.h>
+
 /* Adapted from https://github.com/gamazeps/ws2812b-chibios-SPIDMA/ */
 
 // Define the spi your LEDs are plugged to here
@@ -117,50 +119,43 @@ static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
 
 /*
  * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
- * the ws2812b protocol, we use this helper function to translate bytes into
- * 0s and 1s for the LED (with the appropriate timing).
+ * the ws2812b protocol, each colour bit expands to four SPI bits (0b1110 for
+ * a 1, 0b1000 for a 0). The expansions of all 256 byte values are precomputed
+ * into a constant (flash-resident) lookup table, so encoding a colour byte is
+ * a 4-byte copy instead of per-bit shifting.
  */
-static uint8_t get_protocol_eq(uint8_t data, int pos) {
-    uint8_t eq = 0;
-    if (data & (1 << (2 * (3 - pos))))
-        eq = 0b1110;
-    else
-        eq = 0b1000;
-    if (data & (2 << (2 * (3 - pos))))
-        eq += 0b11100000;
-    else
-        eq += 0b10000000;
-    return eq;
-}
+#define WS2812_ENC_BIT(d, bit) (((d) & (1 << (bit))) ? 0b1110 : 0b1000)
+#define WS2812_ENC_PAIR(d, hi) (uint8_t)((WS2812_ENC_BIT(d, hi) << 4) | WS2812_ENC_BIT(d, (hi)-1))
+#define WS2812_ENC_BYTE(d) {WS2812_ENC_PAIR(d, 7), WS2812_ENC_PAIR(d, 5), WS2812_ENC_PAIR(d, 3), WS2812_ENC_PAIR(d, 1)}
+#define WS2812_ENC_ROW(d) WS2812_ENC_BYTE(d), WS2812_ENC_BYTE((d) + 1), WS2812_ENC_BYTE((d) + 2), WS2812_ENC_BYTE((d) + 3), WS2812_ENC_BYTE((d) + 4), WS2812_ENC_BYTE((d) + 5), WS2812_ENC_BYTE((d) + 6), WS2812_ENC_BYTE((d) + 7), WS2812_ENC_BYTE((d) + 8), WS2812_ENC_BYTE((d) + 9), WS2812_ENC_BYTE((d) + 10), WS2812_ENC_BYTE((d) + 11), WS2812_ENC_BYTE((d) + 12), WS2812_ENC_BYTE((d) + 13), WS2812_ENC_BYTE((d) + 14), WS2812_ENC_BYTE((d) + 15)
+
+// clang-format off
+static const uint8_t ws2812_encoding_lut[256][BYTES_FOR_LED_BYTE] = {
+    WS2812_ENC_ROW(0x00), WS2812_ENC_ROW(0x10), WS2812_ENC_ROW(0x20), WS2812_ENC_ROW(0x30),
+    WS2812_ENC_ROW(0x40), WS2812_ENC_ROW(0x50), WS2812_ENC_ROW(0x60), WS2812_ENC_ROW(0x70),
+    WS2812_ENC_ROW(0x80), WS2812_ENC_ROW(0x90), WS2812_ENC_ROW(0xA0), WS2812_ENC_ROW(0xB0),
+    WS2812_ENC_ROW(0xC0), WS2812_ENC_ROW(0xD0), WS2812_ENC_ROW(0xE0), WS2812_ENC_ROW(0xF0),
+};
+// clang-format on
 
 static void set_led_color_rgb(ws2812_led_t color, int pos) {
-    uint8_t* tx_start = &txbuf[PREAMBLE_SIZE];
+    uint8_t* tx_start = &txbuf[PREAMBLE_SIZE + BYTES_FOR_LED * pos];
 
 #if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
+    memcpy(tx_start, ws2812_encoding_lut[color.g], BYTES_FOR_LED_BYTE);
+    memcpy(tx_start + BYTES_FOR_LED_BYTE, ws2812_encoding_lut[color.r], BYTES_FOR_LED_BYTE);
+    memcpy(tx_start + BYTES_FOR_LED_BYTE * 2, ws2812_encoding_lut[color.b], BYTES_FOR_LED_BYTE);
 #elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
+    memcpy(tx_start, ws2812_encoding_lut[color.r], BYTES_FOR_LED_BYTE);
+    memcpy(tx_start + BYTES_FOR_LED_BYTE, ws2812_encoding_lut[color.g], BYTES_FOR_LED_BYTE);
+    memcpy(tx_start + BYTES_FOR_LED_BYTE * 2, ws2812_encoding_lut[color.b], BYTES_FOR_LED_BYTE);
 #elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.b, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.r, j);
+    memcpy(tx_start, ws2812_encoding_lut[color.b], BYTES_FOR_LED_BYTE);
+    memcpy(tx_start + BYTES_FOR_LED_BYTE, ws2812_encoding_lut[color.g], BYTES_FOR_LED_BYTE);
+    memcpy(tx_start + BYTES_FOR_LED_BYTE * 2, ws2812_encoding_lut[color.r], BYTES_FOR_LED_BYTE);
 #endif
 #ifdef WS2812_RGBW
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 3 + j] = get_protocol_eq(color.w, j);
+    memcpy(tx_start + BYTES_FOR_LED_BYTE * 3, ws2812_encoding_lut[color.w], BYTES_FOR_LED_BYTE);
 #endif
 }
 
@@ -215,6 +210,12 @@ void ws2812_init(void) {
 #endif
     };
 
+    // Encode the initial (all off) frame so the buffer always carries valid
+    // protocol data, then only changed LEDs are re-encoded afterwards
+    for (int i = 0; i < WS2812_LED_COUNT; i++) {
+        set_led_color_rgb(ws2812_leds[i], i);
+    }
+
     spiAcquireBus(&WS2812_SPI_DRIVER);     /* Acquire ownership of the bus.    */
     spiStart(&WS2812_SPI_DRIVER, &spicfg); /* Setup transfer parameters.       */
     spiSelect(&WS2812_SPI_DRIVER);         /* Slave Select assertion.          */
@@ -224,12 +225,17 @@ void ws2812_init(void) {
 }
 
 void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
-    ws2812_leds[index].r = red;
-    ws2812_leds[index].g = green;
-    ws2812_leds[index].b = blue;
+    ws2812_led_t new_color = {.r = red, .g = green, .b = blue};
 #if defined(WS2812_RGBW)
-    ws2812_rgb_to_rgbw(&ws2812_leds[index]);
+    ws2812_rgb_to_rgbw(&new_color);
 #endif
+    // Re-encode into the transmit buffer only if this LED actually changed;
+    // static frames then cost nothing beyond the comparison
+    if (memcmp(&new_color, &ws2812_leds[index], sizeof(ws2812_led_t)) == 0) {
+        return;
+    }
+    ws2812_leds[index] = new_color;
+    set_led_color_rgb(new_color, index);
 }
 
 void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -239,9 +245,8 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
-    for (int i = 0; i < WS2812_LED_COUNT; i++) {
-        set_led_color_rgb(ws2812_leds[i], i);
-    }
+    // Colours were already encoded incrementally by ws2812_set_color(), so
+    // the whole frame is ready to go out as-is.
 
     // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
     // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
@@ -43,3 +43,12 @@ typedef ioline_t pin_t;
 #define gpio_read_pin(pin) palReadLine(pin)
 
 #define gpio_toggle_pin(pin) palToggleLine(pin)
+
+/* Operation of GPIO by port. */
+
+typedef ioportid_t   port_id_t;
+typedef ioportmask_t port_data_t;
+
+#define gpio_pin_to_port(pin) PAL_PORT(pin)
+#define gpio_pin_to_port_bit(pin) ((port_data_t)1 << PAL_PAD(pin))
+#define gpio_read_port(port) palReadPort(port)
@@ -0,0 +1,112 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include <ch.h>
+#include <hal.h>
+
+#include "mem_transfer.h"
+
+/* Memory-to-memory DMA engine for STM32 targets. Opt-in: dedicate a stream in
+ * config.h, e.g.
+ *     #define MEM_TRANSFER_DMA_STREAM STM32_DMA2_STREAM7
+ * (memory-to-memory transfers are only supported on DMA2 for most families).
+ * Only asynchronous requests — those carrying a completion callback — are
+ * routed to the engine; synchronous requests and transfers below
+ * MEM_TRANSFER_DMA_MIN_LENGTH are cheaper on the CPU once stream setup is
+ * accounted for. Anything the engine cannot take falls back to the CPU path,
+ * matching the weak implementations in platforms/mem_transfer.c.
+ */
+#if defined(MEM_TRANSFER_DMA_STREAM) && defined(STM32_DMA_CR_DIR_M2M)
+
+#    if !defined(MEM_TRANSFER_DMA_MIN_LENGTH)
+#        define MEM_TRANSFER_DMA_MIN_LENGTH 64
+#    endif
+
+#    if !defined(MEM_TRANSFER_DMA_IRQ_PRIORITY)
+#        define MEM_TRANSFER_DMA_IRQ_PRIORITY 10
+#    endif
+
+static const stm32_dma_stream_t *mem_dma_stream = NULL;
+static volatile bool             mem_dma_busy   = false;
+static mem_transfer_callback_t   mem_dma_callback;
+static void                     *mem_dma_context;
+
+// Source byte for fills; the stream reads it with increment disabled.
+static volatile uint8_t mem_dma_fill_value;
+
+static void mem_transfer_dma_interrupt(void *unused, uint32_t flags) {
+    (void)unused;
+    (void)flags;
+    dmaStreamDisable(mem_dma_stream);
+    mem_transfer_callback_t callback = mem_dma_callback;
+    void                   *context  = mem_dma_context;
+    mem_dma_callback                 = NULL;
+    mem_dma_busy                     = false;
+    if (callback) {
+        callback(context);
+    }
+}
+
+static bool mem_transfer_dma_start(void *dst, const volatile void *src, size_t length, uint32_t source_mode, mem_transfer_callback_t callback, void *context) {
+    if (mem_dma_stream == NULL) {
+        mem_dma_stream = dmaStreamAlloc(MEM_TRANSFER_DMA_STREAM - STM32_DMA_STREAM(0), MEM_TRANSFER_DMA_IRQ_PRIORITY, mem_transfer_dma_interrupt, NULL);
+        if (mem_dma_stream == NULL) {
+            return false;
+        }
+    }
+
+    mem_dma_busy     = true;
+    mem_dma_callback = callback;
+    mem_dma_context  = context;
+
+    // In memory-to-memory mode the peripheral port is the source and the
+    // memory port the destination.
+    dmaStreamSetPeripheral(mem_dma_stream, src);
+    dmaStreamSetMemory0(mem_dma_stream, dst);
+    dmaStreamSetTransactionSize(mem_dma_stream, length);
+    dmaStreamSetMode(mem_dma_stream, STM32_DMA_CR_DIR_M2M | STM32_DMA_CR_PSIZE_BYTE | STM32_DMA_CR_MSIZE_BYTE | STM32_DMA_CR_MINC | source_mode | STM32_DMA_CR_TCIE | STM32_DMA_CR_PL(0));
+    dmaStreamEnable(mem_dma_stream);
+    return true;
+}
+
+static inline bool mem_transfer_dma_usable(size_t length, mem_transfer_callback_t callback) {
+    return callback != NULL && !mem_dma_busy && length >= MEM_TRANSFER_DMA_MIN_LENGTH && length <= 65535;
+}
+
+bool mem_transfer_copy(void *dst, const void *src, size_t length, mem_transfer_callback_t callback, void *context) {
+    if (mem_transfer_dma_usable(length, callback) && mem_transfer_dma_start(dst, src, length, STM32_DMA_CR_PINC, callback, context)) {
+        return true;
+    }
+    memcpy(dst, src, length);
+    if (callback) {
+        callback(context);
+    }
+    return false;
+}
+
+bool mem_transfer_fill(void *dst, uint8_t value, size_t length, mem_transfer_callback_t callback, void *context) {
+    if (mem_transfer_dma_usable(length, callback)) {
+        mem_dma_fill_value = value;
+        if (mem_transfer_dma_start(dst, &mem_dma_fill_value, length, 0, callback, context)) {
+            return true;
+        }
+    }
+    memset(dst, value, length);
+    if (callback) {
+        callback(context);
+    }
+    return false;
+}
+
+bool mem_transfer_busy(void) {
+    return mem_dma_busy;
+}
+
+void mem_transfer_wait(void) {
+    while (mem_dma_busy) {
+    }
+}
+
+#endif // defined(MEM_TRANSFER_DMA_STREAM) && defined(STM32_DMA_CR_DIR_M2M)
@@ -20,3 +20,21 @@ void platform_setup(void) {
     halInit();
     chSysInit();
 }
+
+#ifdef KEYBOARD_TASK_PACING_US
+#    ifndef MAIN_LOOP_PACING_SPIN_US
+#        define MAIN_LOOP_PACING_SPIN_US 100
+#    endif
+
+// Sleep on the OS virtual timer for the bulk of the pacing slack instead of
+// spinning; USB event handling and the split transport run in other threads,
+// and a busy-wait at the keyboard thread's priority would starve them for the
+// whole gap. The last MAIN_LOOP_PACING_SPIN_US is left for the caller to spin
+// out, so the tick edge keeps the high-resolution timer's precision rather
+// than the system tick's.
+void main_loop_pacing_wait_us(uint32_t us) {
+    if (us > MAIN_LOOP_PACING_SPIN_US) {
+        chThdSleepMicroseconds(us - MAIN_LOOP_PACING_SPIN_US);
+    }
+}
+#endif // KEYBOARD_TASK_PACING_US
@@ -282,8 +282,10 @@ PLATFORM_SRC = \
         $(CHIBIOS)/os/various/syscalls.c \
         $(PLATFORM_COMMON_DIR)/syscall-fallbacks.c \
         $(PLATFORM_COMMON_DIR)/wait.c \
+        $(PLATFORM_COMMON_DIR)/mem_transfer.c \
         $(PLATFORM_COMMON_DIR)/synchronization_util.c \
-        $(PLATFORM_COMMON_DIR)/interrupt_handlers.c
+        $(PLATFORM_COMMON_DIR)/interrupt_handlers.c \
+        $(PLATFORM_COMMON_DIR)/crc.c
 
 # Ensure the ASM files are not subjected to LTO -- it'll strip out interrupt handlers otherwise.
 QUANTUM_LIB_SRC += $(STARTUPASM) $(PORTASM) $(OSALASM) $(PLATFORMASM)
@@ -118,3 +118,23 @@ uint32_t timer_read32(void) {
 
     return (uint32_t)TIME_I2MS(ticks) + ms_offset_copy;
 }
+
+uint32_t timer_read_us(void) {
+    syssts_t sts   = chSysGetStatusAndLockX();
+    uint32_t ticks = get_system_time_ticks() - ticks_offset;
+    if (ticks < last_ticks) {
+        // Same overflow handling as in timer_read32(); OVERFLOW_ADJUST_TICKS corresponds to an integer number of
+        // seconds, so the adjustment is exact for the microsecond conversion as well.
+        ticks -= OVERFLOW_ADJUST_TICKS;
+        ticks_offset += OVERFLOW_ADJUST_TICKS;
+        ms_offset += OVERFLOW_ADJUST_MS;
+    }
+    last_ticks              = ticks;
+    uint32_t ms_offset_copy = ms_offset; // read while still holding the lock to ensure a consistent value
+    chSysRestoreStatusX(sts);
+
+    // Both the conversion and the offset are truncated to 32 bits, so the result simply wraps around every ~71.6
+    // minutes; TIMER_DIFF_32() in timer_elapsed_us() handles the wraparound.  The resolution is limited by
+    // CH_CFG_ST_FREQUENCY and therefore may be coarser than 1 us.
+    return (uint32_t)TIME_I2US(ticks) + ms_offset_copy * 1000U;
+}
@@ -1,6 +1,7 @@
 PLATFORM_COMMON_DIR = $(PLATFORM_PATH)/$(PLATFORM_KEY)
 
 SRC +=	\
+	$(PLATFORM_PATH)/mem_transfer.c \
 	$(PLATFORM_PATH)/suspend.c \
 	$(PLATFORM_PATH)/synchronization_util.c \
 	$(PLATFORM_PATH)/timer.c \
@@ -0,0 +1,31 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "mem_transfer.h"
+
+// CPU fallback used by platforms without a memory-to-memory DMA engine:
+// transfers complete synchronously and the callback fires before returning.
+
+__attribute__((weak)) bool mem_transfer_copy(void *dst, const void *src, size_t length, mem_transfer_callback_t callback, void *context) {
+    memcpy(dst, src, length);
+    if (callback) {
+        callback(context);
+    }
+    return false;
+}
+
+__attribute__((weak)) bool mem_transfer_fill(void *dst, uint8_t value, size_t length, mem_transfer_callback_t callback, void *context) {
+    memset(dst, value, length);
+    if (callback) {
+        callback(context);
+    }
+    return false;
+}
+
+__attribute__((weak)) bool mem_transfer_busy(void) {
+    return false;
+}
+
+__attribute__((weak)) void mem_transfer_wait(void) {}
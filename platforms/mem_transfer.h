@@ -0,0 +1,62 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * \file
+ *
+ * \defgroup mem_transfer Bulk Memory Transfer
+ *
+ * \brief Platform service for bulk RAM copies and fills.
+ *
+ * Frame-buffer consumers (painter, OLED, LED drivers) move buffers large
+ * enough that a platform DMA engine can do the work while the CPU carries on.
+ * Passing a completion callback requests an asynchronous transfer; platforms
+ * without a memory-to-memory engine (and requests issued while the engine is
+ * busy) fall back to an immediate CPU copy and invoke the callback before
+ * returning. Without a callback the transfer always completes synchronously
+ * on the CPU — there is nothing to overlap it with.
+ * \{
+ */
+
+/**
+ * \brief Completion callback for an asynchronous transfer.
+ *
+ * May be invoked from interrupt context; keep it short.
+ */
+typedef void (*mem_transfer_callback_t)(void *context);
+
+/**
+ * \brief Copy \p length bytes from \p src to \p dst. Regions must not overlap.
+ *
+ * \return true if the transfer was handed to a hardware engine, false if it
+ *         was completed synchronously on the CPU.
+ */
+bool mem_transfer_copy(void *dst, const void *src, size_t length, mem_transfer_callback_t callback, void *context);
+
+/**
+ * \brief Fill \p length bytes at \p dst with \p value.
+ *
+ * \return true if the transfer was handed to a hardware engine, false if it
+ *         was completed synchronously on the CPU.
+ */
+bool mem_transfer_fill(void *dst, uint8_t value, size_t length, mem_transfer_callback_t callback, void *context);
+
+/**
+ * \brief Whether an asynchronous transfer is still in flight.
+ */
+bool mem_transfer_busy(void);
+
+/**
+ * \brief Block until any in-flight asynchronous transfer has completed.
+ *
+ * Call before reading from or writing to a buffer handed to an asynchronous
+ * transfer.
+ */
+void mem_transfer_wait(void);
+
+/** \} */
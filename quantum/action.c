@@ -30,6 +30,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "wait.h"
 #include "keycode_config.h"
 #include "debug.h"
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
 #include "quantum.h"
 
 #ifdef BACKLIGHT_ENABLE
@@ -46,6 +49,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 int tp_buttons;
 
+#ifdef SWAP_HANDS_ENABLE
+// Number of keys/encoders currently held in a swapped position; lets
+// action_exec() skip the hand-swap path entirely while swapping is off.
+static uint8_t hand_swap_held_count = 0;
+#endif
+
 #if defined(RETRO_TAPPING) || defined(RETRO_TAPPING_PER_KEY) || (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
 bool     retro_tap_primed   = false;
 uint16_t retro_tap_curr_key = 0;
@@ -71,6 +80,27 @@ __attribute__((weak)) bool get_retro_tapping(uint16_t keycode, keyrecord_t *reco
 }
 #endif
 
+#ifdef COALESCE_MOD_KEY_REPORTS
+/** \brief Whether register_code()/unregister_code() always sends a keyboard report for this keycode.
+ *
+ * When it does, a preceding modifier change can ride along in that report
+ * instead of being flushed in a separate report of its own.
+ */
+static bool code_sends_own_report(uint8_t code) {
+#    ifdef LOCKING_SUPPORT_ENABLE
+    if (KC_LOCKING_CAPS_LOCK == code || KC_LOCKING_NUM_LOCK == code || KC_LOCKING_SCROLL_LOCK == code) {
+        return false; // may return without a report when resyncing
+    }
+#    endif
+#    ifdef COMMAND_ENABLE
+    if (IS_BASIC_KEYCODE(code)) {
+        return false; // command_proc() may consume the press without a report
+    }
+#    endif
+    return IS_BASIC_KEYCODE(code) || IS_MODIFIER_KEYCODE(code);
+}
+#endif
+
 /** \brief Called to execute an action.
  *
  * FIXME: Needs documentation.
@@ -99,7 +129,9 @@ void action_exec(keyevent_t event) {
 
 #ifdef SWAP_HANDS_ENABLE
     // Swap hands handles both keys and encoders, if ENCODER_MAP_ENABLE is defined.
-    if (IS_EVENT(event)) {
+    // With swapping off and no keys still held in a swapped position, the
+    // per-event table lookup and state bookkeeping reduce to this one test.
+    if (IS_EVENT(event) && (swap_hands || hand_swap_held_count > 0)) {
         process_hand_swap(&event);
     }
 #endif
@@ -167,8 +199,14 @@ void set_swap_hands_state(size_t index, uint8_t *swap_state, bool on) {
     size_t  bit_index   = index % (CHAR_BIT);
     uint8_t bit_val     = 1 << bit_index;
     if (on) {
+        if (!(swap_state[array_index] & bit_val)) {
+            hand_swap_held_count++;
+        }
         swap_state[array_index] |= bit_val;
     } else {
+        if (swap_state[array_index] & bit_val) {
+            hand_swap_held_count--;
+        }
         swap_state[array_index] &= ~bit_val;
     }
 }
@@ -200,8 +238,8 @@ void process_hand_swap(keyevent_t *event) {
         size_t         index   = (size_t)(pos.row * MATRIX_COLS) + pos.col;
         bool           do_swap = should_swap_hands(index, matrix_swap_state, event->pressed);
         if (do_swap) {
-            event->key.row = pgm_read_byte(&hand_swap_config[pos.row][pos.col].row);
-            event->key.col = pgm_read_byte(&hand_swap_config[pos.row][pos.col].col);
+            // the table is row-major in flash; fetch both coordinates in one read
+            memcpy_P(&event->key, &hand_swap_config[pos.row][pos.col], sizeof(keypos_t));
             set_swap_hands_state(index, matrix_swap_state, true);
         } else {
             set_swap_hands_state(index, matrix_swap_state, false);
@@ -281,6 +319,9 @@ void process_record(keyrecord_t *record) {
     if (IS_NOEVENT(record->event)) {
         return;
     }
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_stage(LATENCY_TRACE_PROCESS_RECORD);
+#endif
 #ifdef SPECULATIVE_HOLD
     if (record->event.pressed) {
         speculative_key_settled(record);
@@ -420,10 +461,33 @@ void process_action(keyrecord_t *record, action_t action) {
                     } else {
                         add_weak_mods(mods);
                     }
+#ifdef COALESCE_MOD_KEY_REPORTS
+                    // Flush now only if register_code() below won't send a
+                    // report itself; otherwise the mods ride along with it.
+                    if (!code_sends_own_report(action.key.code)) {
+                        send_keyboard_report();
+                    }
+#else
                     send_keyboard_report();
+#endif
                 }
                 register_code(action.key.code);
             } else {
+#ifdef COALESCE_MOD_KEY_REPORTS
+                // Drop the mods first so unregister_code()'s report carries
+                // the key release and the mod release together.
+                if (mods) {
+                    if (IS_MODIFIER_KEYCODE(action.key.code) || action.key.code == KC_NO) {
+                        del_mods(mods);
+                    } else {
+                        del_weak_mods(mods);
+                    }
+                }
+                unregister_code(action.key.code);
+                if (mods && !code_sends_own_report(action.key.code)) {
+                    send_keyboard_report();
+                }
+#else
                 unregister_code(action.key.code);
                 if (mods) {
                     if (IS_MODIFIER_KEYCODE(action.key.code) || action.key.code == KC_NO) {
@@ -433,6 +497,7 @@ void process_action(keyrecord_t *record, action_t action) {
                     }
                     send_keyboard_report();
                 }
+#endif
             }
         } break;
         case ACT_LMODS_TAP:
@@ -454,10 +519,29 @@ void process_action(keyrecord_t *record, action_t action) {
                                 } else {
                                     add_weak_mods(mods);
                                 }
+#        ifdef COALESCE_MOD_KEY_REPORTS
+                                if (!code_sends_own_report(action.key.code)) {
+                                    send_keyboard_report();
+                                }
+#        else
                                 send_keyboard_report();
+#        endif
                             }
                             register_code(action.key.code);
                         } else {
+#        ifdef COALESCE_MOD_KEY_REPORTS
+                            if (mods) {
+                                if (IS_MODIFIER_KEYCODE(action.key.code) || action.key.code == KC_NO) {
+                                    del_mods(mods);
+                                } else {
+                                    del_weak_mods(mods);
+                                }
+                            }
+                            unregister_code(action.key.code);
+                            if (mods && !code_sends_own_report(action.key.code)) {
+                                send_keyboard_report();
+                            }
+#        else
                             unregister_code(action.key.code);
                             if (mods) {
                                 if (IS_MODIFIER_KEYCODE(action.key.code) || action.key.code == KC_NO) {
@@ -467,6 +551,7 @@ void process_action(keyrecord_t *record, action_t action) {
                                 }
                                 send_keyboard_report();
                             }
+#        endif
                         }
                     } else {
                         if (event.pressed) {
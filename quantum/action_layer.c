@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
@@ -11,6 +12,15 @@
  */
 layer_state_t default_layer_state = 0;
 
+/* Layer transaction state: while the depth is non-zero, state changes are
+ * applied directly and the full state-change cascade (callbacks, debug output,
+ * stuck-key handling) is replayed once on commit with the final state. */
+static uint8_t layer_transaction_depth = 0;
+static bool    default_layer_txn_dirty = false;
+#ifndef NO_ACTION_LAYER
+static bool layer_txn_dirty = false;
+#endif
+
 /** \brief Default Layer State Set At user Level
  *
  * Run user code on default layer state change
@@ -40,6 +50,12 @@ __attribute__((weak)) layer_state_t default_layer_state_set_modules(layer_state_
  * Static function to set the default layer state, prints debug info and clears keys
  */
 static void default_layer_state_set(layer_state_t state) {
+    if (layer_transaction_depth > 0) {
+        default_layer_state     = state;
+        default_layer_txn_dirty = true;
+        invalidate_resolved_layer_cache();
+        return;
+    }
     state = default_layer_state_set_modules(state);
     state = default_layer_state_set_kb(state);
     ac_dprintf("default_layer_state: ");
@@ -48,6 +64,7 @@ static void default_layer_state_set(layer_state_t state) {
     default_layer_state = state;
     default_layer_debug();
     ac_dprintf("\n");
+    invalidate_resolved_layer_cache();
 #if defined(STRICT_LAYER_RELEASE)
     clear_keyboard_but_mods(); // To avoid stuck keys
 #elif defined(SEMI_STRICT_LAYER_RELEASE)
@@ -130,6 +147,12 @@ __attribute__((weak)) layer_state_t layer_state_set_modules(layer_state_t state)
  * Sets the layer to match the specified state (a bitmask)
  */
 void layer_state_set(layer_state_t state) {
+    if (layer_transaction_depth > 0) {
+        layer_state     = state;
+        layer_txn_dirty = true;
+        invalidate_resolved_layer_cache();
+        return;
+    }
     state = layer_state_set_modules(state);
     state = layer_state_set_kb(state);
     ac_dprintf("layer_state: ");
@@ -138,6 +161,7 @@ void layer_state_set(layer_state_t state) {
     layer_state = state;
     layer_debug();
     ac_dprintf("\n");
+    invalidate_resolved_layer_cache();
 #    if defined(STRICT_LAYER_RELEASE)
     clear_keyboard_but_mods(); // To avoid stuck keys
 #    elif defined(SEMI_STRICT_LAYER_RELEASE)
@@ -335,6 +359,76 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
+#ifndef NO_ACTION_LAYER
+/* Per-key cache of the layer each matrix position currently resolves to. The
+ * top-down transparency walk reads the keymap once per candidate layer, which
+ * on dynamic keymaps means repeated EEPROM fetches; the cache reduces
+ * steady-state typing to a single array read. It is invalidated wholesale
+ * whenever the layer masks or the keymap contents change. */
+#    define RESOLVED_LAYER_NONE 0xFF
+static uint8_t resolved_layer_cache[MATRIX_ROWS][MATRIX_COLS];
+static bool    resolved_layer_cache_valid = false;
+#endif
+
+#ifdef LAYER_CHANGE_NOTIFY
+/* Coalesced change notifications for display consumers: every layer or
+ * default-layer mutation marks a pending flag, and the housekeeping task
+ * delivers at most one notification per cycle with the old and new composite
+ * state. A state that flaps back within one cycle delivers nothing, so
+ * listeners redraw exactly when the rendered state differs, instead of
+ * polling layer_state every frame. */
+#    ifndef LAYER_CHANGE_LISTENERS_MAX
+#        define LAYER_CHANGE_LISTENERS_MAX 4
+#    endif
+
+static layer_change_listener_t layer_change_listeners[LAYER_CHANGE_LISTENERS_MAX];
+static uint8_t                 layer_change_listener_count = 0;
+static layer_state_t           layer_notified_state        = 0;
+static bool                    layer_notify_pending        = false;
+
+static layer_state_t layer_change_composite(void) {
+#    ifndef NO_ACTION_LAYER
+    return layer_state | default_layer_state;
+#    else
+    return default_layer_state;
+#    endif
+}
+
+bool layer_change_listener_register(layer_change_listener_t listener) {
+    if (listener == NULL || layer_change_listener_count >= LAYER_CHANGE_LISTENERS_MAX) {
+        return false;
+    }
+    layer_change_listeners[layer_change_listener_count++] = listener;
+    return true;
+}
+
+void layer_change_notify_task(void) {
+    if (!layer_notify_pending) {
+        return;
+    }
+    layer_notify_pending = false;
+
+    layer_state_t new_state = layer_change_composite();
+    if (new_state == layer_notified_state) {
+        return;
+    }
+    layer_state_t old_state = layer_notified_state;
+    layer_notified_state    = new_state;
+    for (uint8_t i = 0; i < layer_change_listener_count; i++) {
+        layer_change_listeners[i](old_state, new_state);
+    }
+}
+#endif // LAYER_CHANGE_NOTIFY
+
+void invalidate_resolved_layer_cache(void) {
+#ifndef NO_ACTION_LAYER
+    resolved_layer_cache_valid = false;
+#endif
+#ifdef LAYER_CHANGE_NOTIFY
+    layer_notify_pending = true;
+#endif
+}
+
 /** \brief Layer switch get layer
  *
  * Gets the layer based on key info
@@ -344,17 +438,34 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     action_t action;
     action.code = ACTION_TRANSPARENT;
 
+    /* Positions outside the matrix (combos, encoders) bypass the cache. */
+    const bool cacheable = key.row < MATRIX_ROWS && key.col < MATRIX_COLS;
+    if (cacheable) {
+        if (!resolved_layer_cache_valid) {
+            memset(resolved_layer_cache, RESOLVED_LAYER_NONE, sizeof(resolved_layer_cache));
+            resolved_layer_cache_valid = true;
+        } else if (resolved_layer_cache[key.row][key.col] != RESOLVED_LAYER_NONE) {
+            return resolved_layer_cache[key.row][key.col];
+        }
+    }
+
     layer_state_t layers = layer_state | default_layer_state;
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
             action = action_for_key(i, key);
             if (action.code != ACTION_TRANSPARENT) {
+                if (cacheable) {
+                    resolved_layer_cache[key.row][key.col] = i;
+                }
                 return i;
             }
         }
     }
     /* fall back to layer 0 */
+    if (cacheable) {
+        resolved_layer_cache[key.row][key.col] = 0;
+    }
     return 0;
 #else
     return get_highest_layer(default_layer_state);
@@ -369,6 +480,36 @@ action_t layer_switch_get_action(keypos_t key) {
     return action_for_key(layer_switch_get_layer(key), key);
 }
 
+/** \brief Open a layer transaction
+ *
+ * Subsequent layer and default-layer operations update the state directly
+ * without firing the state-change cascade. Transactions nest.
+ */
+void layer_begin_transaction(void) {
+    layer_transaction_depth++;
+}
+
+/** \brief Commit a layer transaction
+ *
+ * When the outermost transaction commits, the state-change cascade runs once
+ * per state that actually changed, with the final value.
+ */
+void layer_commit_transaction(void) {
+    if (layer_transaction_depth == 0 || --layer_transaction_depth > 0) {
+        return;
+    }
+    if (default_layer_txn_dirty) {
+        default_layer_txn_dirty = false;
+        default_layer_state_set(default_layer_state);
+    }
+#ifndef NO_ACTION_LAYER
+    if (layer_txn_dirty) {
+        layer_txn_dirty = false;
+        layer_state_set(layer_state);
+    }
+#endif
+}
+
 #ifndef NO_ACTION_LAYER
 layer_state_t update_tri_layer_state(layer_state_t state, uint8_t layer1, uint8_t layer2, uint8_t layer3) {
     layer_state_t mask12 = ((layer_state_t)1 << layer1) | ((layer_state_t)1 << layer2);
@@ -78,6 +78,17 @@ extern layer_state_t default_layer_state;
 void                 default_layer_debug(void);
 void                 default_layer_set(layer_state_t state);
 
+/*
+ * Layer transactions
+ *
+ * Batch several layer or default-layer operations into a single state-change
+ * cascade: between begin and commit, operations update the state directly and
+ * the callbacks, debug output and stuck-key handling run once on commit with
+ * the final state. Transactions nest; only the outermost commit fires.
+ */
+void layer_begin_transaction(void);
+void layer_commit_transaction(void);
+
 __attribute__((weak)) layer_state_t default_layer_state_set_modules(layer_state_t state);
 __attribute__((weak)) layer_state_t default_layer_state_set_kb(layer_state_t state);
 __attribute__((weak)) layer_state_t default_layer_state_set_user(layer_state_t state);
@@ -166,6 +177,21 @@ uint8_t read_source_layers_cache(keypos_t key);
 #endif
 action_t store_or_get_action(bool pressed, keypos_t key);
 
+/* drop the per-key resolved-layer cache, e.g. after rewriting the keymap */
+void invalidate_resolved_layer_cache(void);
+
+#ifdef LAYER_CHANGE_NOTIFY
+/* called with the previous and new composite (layer | default layer) state,
+ * at most once per task cycle, only when the composite actually changed */
+typedef void (*layer_change_listener_t)(layer_state_t old_state, layer_state_t new_state);
+
+/* register a listener; returns false once LAYER_CHANGE_LISTENERS_MAX are registered */
+bool layer_change_listener_register(layer_change_listener_t listener);
+
+/* deliver the pending coalesced notification, called from the housekeeping task */
+void layer_change_notify_task(void);
+#endif
+
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
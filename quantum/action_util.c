@@ -298,17 +298,34 @@ static uint8_t get_mods_for_report(void) {
     return mods;
 }
 
+#ifndef PROTOCOL_VUSB
+static report_keyboard_t last_6kro_report;
+static bool              last_6kro_report_valid = false;
+#endif
+#ifdef NKRO_ENABLE
+static report_nkro_t last_nkro_report;
+static bool          last_nkro_report_valid = false;
+#endif
+
+void keyboard_report_dedup_invalidate(void) {
+#ifndef PROTOCOL_VUSB
+    last_6kro_report_valid = false;
+#endif
+#ifdef NKRO_ENABLE
+    last_nkro_report_valid = false;
+#endif
+}
+
 void send_6kro_report(void) {
     keyboard_report->mods = get_mods_for_report();
 
 #ifdef PROTOCOL_VUSB
     host_keyboard_send(keyboard_report);
 #else
-    static report_keyboard_t last_report;
-
     /* Only send the report if there are changes to propagate to the host. */
-    if (memcmp(keyboard_report, &last_report, sizeof(report_keyboard_t)) != 0) {
-        memcpy(&last_report, keyboard_report, sizeof(report_keyboard_t));
+    if (!last_6kro_report_valid || memcmp(keyboard_report, &last_6kro_report, sizeof(report_keyboard_t)) != 0) {
+        memcpy(&last_6kro_report, keyboard_report, sizeof(report_keyboard_t));
+        last_6kro_report_valid = true;
         host_keyboard_send(keyboard_report);
     }
 #endif
@@ -318,21 +335,131 @@ void send_6kro_report(void) {
 void send_nkro_report(void) {
     nkro_report->mods = get_mods_for_report();
 
-    static report_nkro_t last_report;
-
     /* Only send the report if there are changes to propagate to the host. */
-    if (memcmp(nkro_report, &last_report, sizeof(report_nkro_t)) != 0) {
-        memcpy(&last_report, nkro_report, sizeof(report_nkro_t));
+    if (!last_nkro_report_valid || memcmp(nkro_report, &last_nkro_report, sizeof(report_nkro_t)) != 0) {
+        memcpy(&last_nkro_report, nkro_report, sizeof(report_nkro_t));
+        last_nkro_report_valid = true;
         host_nkro_send(nkro_report);
     }
 }
 #endif
 
+#ifdef REPORT_COALESCING
+/* A chord landing within one scan is processed one key event at a time, each
+ * generating its own report. Inside a coalescing window (opened around the
+ * matrix change loop) sends are captured instead of transmitted and the final
+ * state goes out as one report, so an N-key chord costs one report rather
+ * than N. A send that drops a key captured earlier in the same window (a tap
+ * generated by a macro, for instance) flushes the captured state first so
+ * both edges reach the host in order. */
+static bool              coalescing       = false;
+static bool              coalesce_pending = false;
+static report_keyboard_t pending_6kro;
+#    ifdef NKRO_ENABLE
+static report_nkro_t pending_nkro;
+static bool          pending_is_nkro = false;
+#    endif
+
+/* Transmit the captured report through the same change detection as the
+ * direct send paths; mods were resolved when the report was captured. */
+static void coalesce_transmit_pending(void) {
+    coalesce_pending = false;
+#    ifdef NKRO_ENABLE
+    if (pending_is_nkro) {
+        if (!last_nkro_report_valid || memcmp(&pending_nkro, &last_nkro_report, sizeof(report_nkro_t)) != 0) {
+            memcpy(&last_nkro_report, &pending_nkro, sizeof(report_nkro_t));
+            last_nkro_report_valid = true;
+            host_nkro_send(&pending_nkro);
+        }
+        return;
+    }
+#    endif
+#    ifdef PROTOCOL_VUSB
+    host_keyboard_send(&pending_6kro);
+#    else
+    if (!last_6kro_report_valid || memcmp(&pending_6kro, &last_6kro_report, sizeof(report_keyboard_t)) != 0) {
+        memcpy(&last_6kro_report, &pending_6kro, sizeof(report_keyboard_t));
+        last_6kro_report_valid = true;
+        host_keyboard_send(&pending_6kro);
+    }
+#    endif
+}
+
+/* Whether the live report still contains every key of the captured one; a
+ * missing key means something captured in this window has since been
+ * released, and collapsing the two states would lose the press. */
+static bool coalesce_pending_keys_held(void) {
+#    ifdef NKRO_ENABLE
+    if (pending_is_nkro) {
+        for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+            if (pending_nkro.bits[i] & ~nkro_report->bits[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+#    endif
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        uint8_t key = pending_6kro.keys[i];
+        if (!key) {
+            continue;
+        }
+        bool held = false;
+        for (uint8_t j = 0; j < KEYBOARD_REPORT_KEYS; j++) {
+            if (keyboard_report->keys[j] == key) {
+                held = true;
+                break;
+            }
+        }
+        if (!held) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void coalesce_capture(void) {
+#    ifdef NKRO_ENABLE
+    pending_is_nkro = host_can_send_nkro() && keymap_config.nkro;
+    if (pending_is_nkro) {
+        memcpy(&pending_nkro, nkro_report, sizeof(report_nkro_t));
+        pending_nkro.mods = get_mods_for_report();
+        coalesce_pending  = true;
+        return;
+    }
+#    endif
+    memcpy(&pending_6kro, keyboard_report, sizeof(report_keyboard_t));
+    pending_6kro.mods = get_mods_for_report();
+    coalesce_pending  = true;
+}
+
+void keyboard_report_coalesce_begin(void) {
+    coalescing       = true;
+    coalesce_pending = false;
+}
+
+void keyboard_report_coalesce_end(void) {
+    coalescing = false;
+    if (coalesce_pending) {
+        coalesce_transmit_pending();
+    }
+}
+#endif
+
 /** \brief Send keyboard report
  *
  * FIXME: needs doc
  */
 void send_keyboard_report(void) {
+#ifdef REPORT_COALESCING
+    if (coalescing) {
+        if (coalesce_pending && !coalesce_pending_keys_held()) {
+            coalesce_transmit_pending();
+        }
+        coalesce_capture();
+        return;
+    }
+#endif
 #ifdef NKRO_ENABLE
     if (host_can_send_nkro() && keymap_config.nkro) {
         send_nkro_report();
@@ -49,6 +49,21 @@ extern report_nkro_t *nkro_report;
 
 void send_keyboard_report(void);
 
+/* Invalidate the keyboard report deduplication caches, forcing the next send
+ * of each kind onto the wire. Called when the active transport changes, so a
+ * reinstated report is not mistaken for a duplicate of one already sent to
+ * the previous host. */
+void keyboard_report_dedup_invalidate(void);
+
+#ifdef REPORT_COALESCING
+/* Coalescing window: between begin and end, report sends are captured instead
+ * of transmitted, and the final state is sent as a single report at end. A
+ * send that releases a key pressed earlier in the same window flushes the
+ * captured state first, so taps generated inside the window keep both edges. */
+void keyboard_report_coalesce_begin(void);
+void keyboard_report_coalesce_end(void);
+#endif
+
 /* key */
 inline void add_key(uint8_t key) {
     add_key_to_report(key);
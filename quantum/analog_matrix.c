@@ -0,0 +1,150 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "analog_matrix.h"
+#include "util.h"
+
+#if ANALOG_MATRIX_RELEASE_TRAVEL >= ANALOG_MATRIX_ACTUATION_TRAVEL
+#    error "ANALOG_MATRIX_RELEASE_TRAVEL must be lower than ANALOG_MATRIX_ACTUATION_TRAVEL"
+#endif
+
+typedef struct {
+    uint16_t rest;    // resting ADC reading, sampled at init or restored from calibration
+    uint16_t range;   // largest deviation from rest seen so far, floored at the default range
+    uint8_t  travel;  // last normalized travel, 0..255
+    uint8_t  extreme; // rapid trigger turnaround point
+    bool     pressed;
+} analog_key_t;
+
+static analog_key_t analog_keys[MATRIX_ROWS][MATRIX_COLS];
+static uint16_t     analog_raw[MATRIX_ROWS][MATRIX_COLS];
+
+__attribute__((weak)) void analog_matrix_init_kb(void) {}
+
+__attribute__((weak)) void analog_matrix_sample_all(uint16_t raw[MATRIX_ROWS][MATRIX_COLS]) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            raw[row][col] = analog_matrix_sample(row, col);
+        }
+    }
+}
+
+uint16_t analog_matrix_get_raw(uint8_t row, uint8_t col) {
+    return analog_raw[row][col];
+}
+
+uint8_t analog_matrix_get_travel(uint8_t row, uint8_t col) {
+    return analog_keys[row][col].travel;
+}
+
+void analog_matrix_get_calibration(analog_matrix_calibration_t *calibration) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            calibration->rest[row][col]  = analog_keys[row][col].rest;
+            calibration->range[row][col] = analog_keys[row][col].range;
+        }
+    }
+}
+
+void analog_matrix_set_calibration(const analog_matrix_calibration_t *calibration) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            analog_keys[row][col].rest  = calibration->rest[row][col];
+            analog_keys[row][col].range = MAX(calibration->range[row][col], ANALOG_MATRIX_DEFAULT_RANGE);
+        }
+    }
+}
+
+void matrix_init_custom(void) {
+    analog_matrix_init_kb();
+
+    // Establish the resting value of every key by averaging a few readings.
+    // Keys must not be held during power-up, the same constraint every
+    // analog board in the wild has.
+    for (uint8_t i = 0; i < ANALOG_MATRIX_CALIBRATION_SAMPLES; i++) {
+        analog_matrix_sample_all(analog_raw);
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                analog_keys[row][col].rest += analog_raw[row][col] / ANALOG_MATRIX_CALIBRATION_SAMPLES;
+            }
+        }
+    }
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            analog_keys[row][col].range = ANALOG_MATRIX_DEFAULT_RANGE;
+        }
+    }
+}
+
+// Normalize a raw reading to 0..255 travel. The deviation from rest is used
+// so that sensors whose output rises on press and sensors whose output falls
+// on press both work without configuration.
+static uint8_t analog_matrix_travel(analog_key_t *key, uint16_t raw) {
+    uint16_t deviation = (raw > key->rest) ? (raw - key->rest) : (key->rest - raw);
+    if (deviation > key->range) {
+        key->range = deviation;
+    }
+    return (uint8_t)(((uint32_t)deviation * 255U) / key->range);
+}
+
+static bool analog_matrix_update_key(analog_key_t *key, uint16_t raw) {
+    uint8_t travel = analog_matrix_travel(key, raw);
+    key->travel    = travel;
+
+#ifdef ANALOG_MATRIX_RAPID_TRIGGER
+    if (travel < ANALOG_MATRIX_RELEASE_TRAVEL) {
+        // Out of the active zone - release unconditionally and re-arm.
+        key->pressed = false;
+        key->extreme = travel;
+    } else if (key->pressed) {
+        // Follow the key downwards, release once it backs off far enough
+        // from the deepest point.
+        if (travel > key->extreme) {
+            key->extreme = travel;
+        } else if (travel + ANALOG_MATRIX_RAPID_TRIGGER_TRAVEL <= key->extreme) {
+            key->pressed = false;
+            key->extreme = travel;
+        }
+    } else {
+        // Follow the key upwards, press once it advances far enough from the
+        // highest point. On the way in from rest the extreme sits just below
+        // the release travel, making that the effective initial deadzone.
+        if (travel < key->extreme) {
+            key->extreme = travel;
+        } else if (travel >= key->extreme + ANALOG_MATRIX_RAPID_TRIGGER_TRAVEL) {
+            key->pressed = true;
+            key->extreme = travel;
+        }
+    }
+#else
+    if (key->pressed) {
+        key->pressed = travel >= ANALOG_MATRIX_RELEASE_TRAVEL;
+    } else {
+        key->pressed = travel >= ANALOG_MATRIX_ACTUATION_TRAVEL;
+    }
+#endif
+
+    return key->pressed;
+}
+
+bool matrix_scan_custom(matrix_row_t current_matrix[]) {
+    bool changed = false;
+
+    analog_matrix_sample_all(analog_raw);
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t current_row = 0;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (analog_matrix_update_key(&analog_keys[row][col], analog_raw[row][col])) {
+                current_row |= MATRIX_ROW_SHIFTER << col;
+            }
+        }
+        if (current_matrix[row] != current_row) {
+            current_matrix[row] = current_row;
+            changed             = true;
+        }
+    }
+
+    return changed;
+}
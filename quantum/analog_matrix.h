@@ -0,0 +1,110 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "matrix.h"
+#include "util.h"
+
+/**
+ * \file
+ *
+ * \defgroup analog_matrix Analog Matrix
+ *
+ * Matrix implementation for analog (Hall effect, electrocapacitive, ...)
+ * switches. The keyboard provides raw ADC readings, this module owns
+ * calibration, travel normalization, actuation thresholds with hysteresis and
+ * optional rapid trigger, and produces standard `matrix_row_t` output through
+ * the custom matrix 'lite' interface.
+ * \{
+ */
+
+/**
+ * \brief Normalized travel at which a key registers as pressed, from 0 (rest)
+ * to 255 (bottom-out).
+ */
+#ifndef ANALOG_MATRIX_ACTUATION_TRAVEL
+#    define ANALOG_MATRIX_ACTUATION_TRAVEL 96
+#endif
+
+/**
+ * \brief Normalized travel below which a pressed key releases. Must be lower
+ * than the actuation travel; the gap provides the hysteresis that keeps noise
+ * around the actuation point from chattering.
+ */
+#ifndef ANALOG_MATRIX_RELEASE_TRAVEL
+#    define ANALOG_MATRIX_RELEASE_TRAVEL (ANALOG_MATRIX_ACTUATION_TRAVEL - 16)
+#endif
+
+/**
+ * \brief Normalized travel a key has to move against its last extreme to
+ * re-trigger or release when rapid trigger is enabled.
+ */
+#ifndef ANALOG_MATRIX_RAPID_TRIGGER_TRAVEL
+#    define ANALOG_MATRIX_RAPID_TRIGGER_TRAVEL 24
+#endif
+
+/**
+ * \brief Number of readings averaged per key at init to establish the resting
+ * value.
+ */
+#ifndef ANALOG_MATRIX_CALIBRATION_SAMPLES
+#    define ANALOG_MATRIX_CALIBRATION_SAMPLES 8
+#endif
+
+/**
+ * \brief Raw ADC deviation from rest that is assumed to correspond to full
+ * travel until a larger deviation is observed. The observed range grows
+ * automatically as keys are bottomed out.
+ */
+#ifndef ANALOG_MATRIX_DEFAULT_RANGE
+#    define ANALOG_MATRIX_DEFAULT_RANGE 512
+#endif
+
+/** \brief Per-key calibration data, in raw ADC units. */
+typedef struct PACKED {
+    uint16_t rest[MATRIX_ROWS][MATRIX_COLS];  /**< Resting reading per key. */
+    uint16_t range[MATRIX_ROWS][MATRIX_COLS]; /**< Rest-to-bottom-out deviation per key. */
+} analog_matrix_calibration_t;
+
+/**
+ * \brief Read the raw ADC value of a single key. Must be implemented by the
+ * keyboard, this is where multiplexer selection and ADC conversion happen.
+ */
+uint16_t analog_matrix_sample(uint8_t row, uint8_t col);
+
+/**
+ * \brief Acquire raw ADC values for the whole matrix. The default
+ * implementation calls `analog_matrix_sample()` per key; keyboards that scan
+ * the matrix in the background (e.g. DMA fed ADC conversions) can override it
+ * to copy their conversion buffers instead.
+ */
+void analog_matrix_sample_all(uint16_t raw[MATRIX_ROWS][MATRIX_COLS]);
+
+/**
+ * \brief Optional hardware setup hook, called before the resting values are
+ * sampled.
+ */
+void analog_matrix_init_kb(void);
+
+/** \brief Get the last raw ADC reading of a key. */
+uint16_t analog_matrix_get_raw(uint8_t row, uint8_t col);
+
+/** \brief Get the current normalized travel of a key, 0 (rest) to 255 (bottom-out). */
+uint8_t analog_matrix_get_travel(uint8_t row, uint8_t col);
+
+/**
+ * \brief Copy out the current calibration, e.g. for persisting it in the
+ * keyboard section of the EEPROM.
+ */
+void analog_matrix_get_calibration(analog_matrix_calibration_t *calibration);
+
+/**
+ * \brief Restore a previously saved calibration, replacing the values sampled
+ * at init.
+ */
+void analog_matrix_set_calibration(const analog_matrix_calibration_t *calibration);
+
+/** \} */
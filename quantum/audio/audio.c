@@ -254,8 +254,9 @@ void audio_on(void) {
 void audio_off(void) {
     PLAY_SONG(audio_off_song);
     audio_off_user();
-    wait_ms(100);
-    audio_stop_all();
+    // disabling the config immediately blocks any new notes/melodies; the
+    // already started off-song keeps playing in the background and the
+    // driver-triggered state updates stop the hardware once it has finished
     audio_config.enable = 0;
     eeconfig_update_audio(&audio_config);
 }
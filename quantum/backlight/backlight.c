@@ -64,6 +64,15 @@ void backlight_init(void) {
     backlight_set(backlight_config.enable ? backlight_config.level : 0);
 }
 
+/** \brief Restore the backlight after a suspend
+ *
+ * Warm counterpart of backlight_init: the configuration is still valid in
+ * RAM, so the level is restored without re-reading the EEPROM.
+ */
+void backlight_wakeup(void) {
+    backlight_set(backlight_config.enable ? backlight_config.level : 0);
+}
+
 /** \brief Backlight increase
  *
  * FIXME: needs doc
@@ -49,6 +49,7 @@ typedef union backlight_config_t {
 STATIC_ASSERT(sizeof(backlight_config_t) == sizeof(uint8_t), "Backlight EECONFIG out of spec.");
 
 void    backlight_init(void);
+void    backlight_wakeup(void);
 void    backlight_toggle(void);
 void    backlight_enable(void);
 void    backlight_disable(void);
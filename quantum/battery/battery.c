@@ -9,8 +9,21 @@
 #    define BATTERY_SAMPLE_INTERVAL 30000
 #endif
 
+#ifdef BATTERY_ADAPTIVE_SAMPLING
+#    ifndef BATTERY_SAMPLE_INTERVAL_MIN
+#        define BATTERY_SAMPLE_INTERVAL_MIN 5000
+#    endif
+#    ifndef BATTERY_SAMPLE_INTERVAL_MAX
+#        define BATTERY_SAMPLE_INTERVAL_MAX 120000
+#    endif
+#endif
+
 static uint8_t last_bat_level = 100;
 
+#ifdef BATTERY_ADAPTIVE_SAMPLING
+static uint32_t sample_interval = BATTERY_SAMPLE_INTERVAL_MIN;
+#endif
+
 void battery_init(void) {
     battery_driver_init();
 
@@ -27,6 +40,26 @@ static void handle_percent_changed(void) {
 
 void battery_task(void) {
     static uint32_t bat_timer = 0;
+#ifdef BATTERY_ADAPTIVE_SAMPLING
+    if (timer_elapsed32(bat_timer) > sample_interval) {
+        uint8_t level = battery_driver_sample_percent();
+        if (level != last_bat_level) {
+            // Level is moving - charging, or discharging under load - so keep
+            // sampling at the fast rate; hooks fire only when there is news.
+            last_bat_level  = level;
+            sample_interval = BATTERY_SAMPLE_INTERVAL_MIN;
+            handle_percent_changed();
+        } else if (sample_interval < BATTERY_SAMPLE_INTERVAL_MAX) {
+            // Stable level: back off exponentially up to minutes apart.
+            sample_interval *= 2;
+            if (sample_interval > BATTERY_SAMPLE_INTERVAL_MAX) {
+                sample_interval = BATTERY_SAMPLE_INTERVAL_MAX;
+            }
+        }
+
+        bat_timer = timer_read32();
+    }
+#else
     if (timer_elapsed32(bat_timer) > BATTERY_SAMPLE_INTERVAL) {
         last_bat_level = battery_driver_sample_percent();
 
@@ -34,6 +67,7 @@ void battery_task(void) {
 
         bat_timer = timer_read32();
     }
+#endif
 }
 
 uint8_t battery_get_percent(void) {
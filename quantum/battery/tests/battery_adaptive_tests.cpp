@@ -0,0 +1,109 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using testing::_;
+using testing::Return;
+
+class BatteryDriverMock {
+   public:
+    virtual ~BatteryDriverMock() {}
+
+    // mock methods
+    MOCK_METHOD0(battery_driver_init, void(void));
+    MOCK_METHOD0(battery_driver_sample_percent, uint8_t(void));
+    MOCK_METHOD1(battery_percent_changed_kb, void(uint8_t));
+};
+
+class BatteryAdaptiveTest : public ::testing::Test {
+   public:
+    BatteryAdaptiveTest() {
+        _batteryDriverMock.reset(new ::testing::NiceMock<BatteryDriverMock>());
+    }
+    virtual ~BatteryAdaptiveTest() {
+        _batteryDriverMock.reset();
+    }
+
+    static std::unique_ptr<BatteryDriverMock> _batteryDriverMock;
+};
+
+std::unique_ptr<BatteryDriverMock> BatteryAdaptiveTest::_batteryDriverMock;
+
+extern "C" {
+#include "quantum/battery/battery.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+
+void battery_driver_init(void) {
+    if (BatteryAdaptiveTest::_batteryDriverMock) {
+        BatteryAdaptiveTest::_batteryDriverMock->battery_driver_init();
+    }
+}
+
+uint8_t battery_driver_sample_percent(void) {
+    if (BatteryAdaptiveTest::_batteryDriverMock) {
+        return BatteryAdaptiveTest::_batteryDriverMock->battery_driver_sample_percent();
+    }
+    return 255;
+}
+
+void battery_percent_changed_kb(uint8_t level) {
+    if (BatteryAdaptiveTest::_batteryDriverMock) {
+        BatteryAdaptiveTest::_batteryDriverMock->battery_percent_changed_kb(level);
+    }
+}
+}
+
+// These tests run in order and share the module's state, like the stock
+// battery tests: the interval starts at BATTERY_SAMPLE_INTERVAL_MIN (5000)
+// and doubles per unchanged sample up to BATTERY_SAMPLE_INTERVAL_MAX.
+
+TEST_F(BatteryAdaptiveTest, TestInit) {
+    // init driver and initial sample
+    EXPECT_CALL(*_batteryDriverMock, battery_driver_init()).Times(1);
+    EXPECT_CALL(*_batteryDriverMock, battery_driver_sample_percent()).Times(1).WillOnce(Return(100));
+
+    battery_init();
+}
+
+TEST_F(BatteryAdaptiveTest, TestFastWhileChanging) {
+    // changing level keeps the interval at the minimum, hooks fire per change
+    EXPECT_CALL(*_batteryDriverMock, battery_driver_sample_percent()).WillOnce(Return(90)).WillOnce(Return(80));
+    EXPECT_CALL(*_batteryDriverMock, battery_percent_changed_kb(_)).Times(2);
+
+    advance_time(5001);
+    battery_task();
+    advance_time(5001);
+    battery_task();
+
+    EXPECT_EQ(battery_get_percent(), 80);
+}
+
+TEST_F(BatteryAdaptiveTest, TestBackoffWhenStable) {
+    // unchanged samples double the interval and fire no hooks
+    EXPECT_CALL(*_batteryDriverMock, battery_driver_sample_percent()).Times(2).WillRepeatedly(Return(80));
+    EXPECT_CALL(*_batteryDriverMock, battery_percent_changed_kb(_)).Times(0);
+
+    advance_time(5001);
+    battery_task(); // samples; interval becomes 10000
+    advance_time(5001);
+    battery_task(); // below the backed-off interval, no sample
+    advance_time(5001);
+    battery_task(); // past it, samples; interval becomes 20000
+}
+
+TEST_F(BatteryAdaptiveTest, TestResumesFastOnChange) {
+    // a change resets the interval to the minimum
+    EXPECT_CALL(*_batteryDriverMock, battery_driver_sample_percent()).WillOnce(Return(70)).WillOnce(Return(60));
+    EXPECT_CALL(*_batteryDriverMock, battery_percent_changed_kb(_)).Times(2);
+
+    advance_time(20001);
+    battery_task(); // change: back to the fast rate
+    advance_time(5001);
+    battery_task(); // fast rate applies again
+
+    EXPECT_EQ(battery_get_percent(), 60);
+}
@@ -5,3 +5,10 @@ battery_SRC := \
     $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
 	$(QUANTUM_PATH)/battery/battery.c \
 	$(QUANTUM_PATH)/battery/tests/battery_tests.cpp \
+
+battery_adaptive_DEFS := -DBATTERY_ADAPTIVE_SAMPLING
+battery_adaptive_SRC := \
+    $(PLATFORM_PATH)/timer.c \
+    $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/battery/battery.c \
+	$(QUANTUM_PATH)/battery/tests/battery_adaptive_tests.cpp \
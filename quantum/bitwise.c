@@ -18,29 +18,20 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "util.h"
 
 // bit population - return number of on-bit
+// Nibble lookup table makes the cost constant instead of one iteration per
+// on-bit, which matters for the wider variants on dense inputs.
+static const uint8_t bit_count[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+
 __attribute__((noinline)) uint8_t bitpop(uint8_t bits) {
-    uint8_t c;
-    for (c = 0; bits; c++)
-        bits &= bits - 1;
-    return c;
-    /*
-        const uint8_t bit_count[] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
-        return bit_count[bits>>4] + bit_count[bits&0x0F]
-    */
+    return bit_count[bits >> 4] + bit_count[bits & 0x0F];
 }
 
 uint8_t bitpop16(uint16_t bits) {
-    uint8_t c;
-    for (c = 0; bits; c++)
-        bits &= bits - 1;
-    return c;
+    return bitpop((uint8_t)(bits >> 8)) + bitpop((uint8_t)bits);
 }
 
 uint8_t bitpop32(uint32_t bits) {
-    uint8_t c;
-    for (c = 0; bits; c++)
-        bits &= bits - 1;
-    return c;
+    return bitpop16((uint16_t)(bits >> 16)) + bitpop16((uint16_t)bits);
 }
 
 // most significant on-bit - return highest location of on-bit
@@ -16,6 +16,7 @@
 #include "bootmagic.h"
 #include "matrix.h"
 #include "keyboard.h"
+#include "timer.h"
 #include "wait.h"
 #include "eeconfig.h"
 #include "bootloader.h"
@@ -74,6 +75,44 @@ __attribute__((weak)) void bootmagic_scan(void) {
     }
 }
 
+#ifdef BOOTMAGIC_FAST_SCAN
+
+void bootmagic(void) {
+    // Deferred to bootmagic_task(): the decision is taken from the first
+    // debounced results of the normal scan loop rather than a dedicated
+    // blocking scan, so cold start does not pay the settle delay.
+}
+
+void bootmagic_task(void) {
+    static bool     done = false;
+    static uint32_t window_start;
+    static bool     window_started = false;
+
+    if (done) {
+        return;
+    }
+    if (!window_started) {
+        window_start   = timer_read32();
+        window_started = true;
+    }
+    if (timer_elapsed32(window_start) > BOOTMAGIC_FAST_SCAN_TIMEOUT) {
+        done = true;
+        return;
+    }
+
+    if (bootmagic_should_reset()) {
+        done = true;
+        bootmagic_reset_eeprom();
+
+        // Jump to bootloader.
+        bootloader_jump();
+    }
+}
+
+#else
+
 void bootmagic(void) {
     bootmagic_scan();
 }
+
+#endif // BOOTMAGIC_FAST_SCAN
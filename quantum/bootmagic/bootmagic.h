@@ -37,4 +37,17 @@
 #    define BOOTMAGIC_ROW 0
 #endif
 
+/* With BOOTMAGIC_FAST_SCAN defined, the boot-time blocking scan (two full
+ * matrix scans separated by a BOOTMAGIC_DEBOUNCE wait) is skipped and the
+ * bootmagic key is instead checked against the debounced results of the
+ * normal scan loop for the first BOOTMAGIC_FAST_SCAN_TIMEOUT milliseconds,
+ * shaving the dedicated settle delay off every cold start. */
+#ifndef BOOTMAGIC_FAST_SCAN_TIMEOUT
+#    define BOOTMAGIC_FAST_SCAN_TIMEOUT 150
+#endif
+
 void bootmagic(void);
+
+#ifdef BOOTMAGIC_FAST_SCAN
+void bootmagic_task(void);
+#endif
@@ -18,6 +18,10 @@
 #include "action.h"
 #include "action_util.h"
 
+#ifdef DEFERRED_EXEC_ENABLE
+#    include "deferred_exec.h"
+#endif
+
 /** @brief True when Caps Word is active. */
 static bool caps_word_active = false;
 
@@ -28,6 +32,27 @@ static bool caps_word_active = false;
 #        error "CAPS_WORD_IDLE_TIMEOUT must be between 100 and 30000 ms"
 #    endif
 
+#    ifdef DEFERRED_EXEC_ENABLE
+// With the deferred executor available, the idle timeout is an exact
+// scheduled wake-up instead of a check on every main loop iteration.
+
+/** @brief Token for the scheduled idle timeout wake-up. */
+static deferred_token idle_token = INVALID_DEFERRED_TOKEN;
+
+static uint32_t caps_word_idle_callback(uint32_t trigger_time, void *cb_arg) {
+    idle_token = INVALID_DEFERRED_TOKEN;
+    caps_word_off();
+    return 0;
+}
+
+void caps_word_task(void) {}
+
+void caps_word_reset_idle_timer(void) {
+    if (idle_token == INVALID_DEFERRED_TOKEN || !extend_deferred_exec(idle_token, CAPS_WORD_IDLE_TIMEOUT)) {
+        idle_token = defer_exec(CAPS_WORD_IDLE_TIMEOUT, caps_word_idle_callback, NULL);
+    }
+}
+#    else
 /** @brief Deadline for idle timeout. */
 static uint16_t idle_timer = 0;
 
@@ -40,6 +65,7 @@ void caps_word_task(void) {
 void caps_word_reset_idle_timer(void) {
     idle_timer = timer_read() + CAPS_WORD_IDLE_TIMEOUT;
 }
+#    endif // DEFERRED_EXEC_ENABLE
 #else
 void caps_word_task(void) {}
 #endif // CAPS_WORD_IDLE_TIMEOUT > 0
@@ -66,6 +92,13 @@ void caps_word_off(void) {
         return;
     }
 
+#if CAPS_WORD_IDLE_TIMEOUT > 0 && defined(DEFERRED_EXEC_ENABLE)
+    if (idle_token != INVALID_DEFERRED_TOKEN) {
+        cancel_deferred_exec(idle_token);
+        idle_token = INVALID_DEFERRED_TOKEN;
+    }
+#endif // CAPS_WORD_IDLE_TIMEOUT > 0 && defined(DEFERRED_EXEC_ENABLE)
+
     unregister_weak_mods(MOD_MASK_SHIFT); // Make sure weak shift is off.
     caps_word_active = false;
     caps_word_set_user(false);
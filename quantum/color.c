@@ -19,6 +19,12 @@
 #include "progmem.h"
 #include "util.h"
 
+// Exact x / 255 for x < 65280, without the division. Keeps the hue-sector
+// math off the software-divide path on AVR and Cortex-M0.
+static inline uint8_t div255(uint16_t x) {
+    return (uint8_t)((x + 1 + (x >> 8)) >> 8);
+}
+
 rgb_t hsv_to_rgb_impl(hsv_t hsv, bool use_cie) {
     rgb_t    rgb;
     uint8_t  region, remainder, p, q, t;
@@ -53,7 +59,7 @@ rgb_t hsv_to_rgb_impl(hsv_t hsv, bool use_cie) {
     v = hsv.v;
 #endif
 
-    region    = h * 6 / 255;
+    region    = div255(h * 6);
     remainder = (h * 2 - region * 85) * 3;
 
     p = (v * (255 - s)) >> 8;
@@ -13,3 +13,23 @@
 #        define STATIC_ASSERT _Static_assert
 #    endif
 #endif
+
+/**
+ * @brief Place a hot function into RAM instead of flash.
+ *
+ * On flash-XIP controllers (notably RP2040, where cache misses during SPI
+ * flash traffic stall execution) running the scan-loop hot path from RAM
+ * removes multi-microsecond latency spikes. Opt in with
+ * `#define FAST_CODE_IN_RAM` in config.h on ChibiOS targets; the annotated
+ * functions are then emitted into `.ramtext`, which the ChibiOS linker rules
+ * copy to RAM alongside `.data` at startup. Expands to nothing elsewhere, so
+ * annotations are free on AVR and on targets that execute from zero-wait
+ * flash. Check placement in the linker map (or `util/size_ledger.py`).
+ */
+#if !defined(FAST_CODE)
+#    if defined(FAST_CODE_IN_RAM) && defined(PROTOCOL_CHIBIOS)
+#        define FAST_CODE __attribute__((section(".ramtext")))
+#    else
+#        define FAST_CODE
+#    endif
+#endif
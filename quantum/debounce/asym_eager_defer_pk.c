@@ -8,6 +8,7 @@
 // releasing a key, that state is pushed after no changes occur for DEBOUNCE milliseconds.
 
 #include "debounce.h"
+#include "compiler_support.h"
 #include "timer.h"
 #include "util.h"
 
@@ -40,7 +41,7 @@ static inline void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooke
 
 void debounce_init(void) {}
 
-bool debounce(matrix_row_t raw[], matrix_row_t cooked[], bool changed) {
+FAST_CODE bool debounce(matrix_row_t raw[], matrix_row_t cooked[], bool changed) {
     static fast_timer_t last_time;
     bool                updated_last = false;
     cooked_changed                   = false;
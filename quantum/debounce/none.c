@@ -15,11 +15,12 @@
  */
 
 #include "debounce.h"
+#include "compiler_support.h"
 #include <string.h>
 
 void debounce_init(void) {}
 
-bool debounce(matrix_row_t raw[], matrix_row_t cooked[], bool changed) {
+FAST_CODE bool debounce(matrix_row_t raw[], matrix_row_t cooked[], bool changed) {
     bool cooked_changed = false;
 
     if (changed) {
@@ -6,6 +6,7 @@
 // When no state changes have occured for DEBOUNCE milliseconds, we push the state.
 
 #include "debounce.h"
+#include "compiler_support.h"
 #include "timer.h"
 #include <string.h>
 #ifndef DEBOUNCE
@@ -22,7 +23,7 @@
 
 void debounce_init(void) {}
 
-bool debounce(matrix_row_t raw[], matrix_row_t cooked[], bool changed) {
+FAST_CODE bool debounce(matrix_row_t raw[], matrix_row_t cooked[], bool changed) {
     static fast_timer_t debouncing_time;
     static bool         debouncing     = false;
     bool                cooked_changed = false;
@@ -7,8 +7,10 @@
 // When no state changes have occured for DEBOUNCE milliseconds, we push the state.
 
 #include "debounce.h"
+#include "compiler_support.h"
 #include "timer.h"
 #include "util.h"
+#include <string.h>
 
 #ifndef DEBOUNCE
 #    define DEBOUNCE 5
@@ -28,13 +30,19 @@ typedef uint8_t debounce_counter_t;
 static debounce_counter_t debounce_counters[MATRIX_ROWS_PER_HAND * MATRIX_COLS] = {DEBOUNCE_ELAPSED};
 static bool               counters_need_update;
 static bool               cooked_changed;
+// Bitmap of rows with at least one running counter; idle rows are skipped
+// entirely instead of walking their per-key counters every scan.
+static uint32_t pending_rows;
+#    if MATRIX_ROWS_PER_HAND > 32
+#        error sym debounce row skipping supports at most 32 rows per hand
+#    endif
 
 static inline void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t elapsed_time);
 static inline void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[]);
 
 void debounce_init(void) {}
 
-bool debounce(matrix_row_t raw[], matrix_row_t cooked[], bool changed) {
+FAST_CODE bool debounce(matrix_row_t raw[], matrix_row_t cooked[], bool changed) {
     static fast_timer_t last_time;
     bool                updated_last = false;
     cooked_changed                   = false;
@@ -79,6 +87,11 @@ static inline void update_debounce_counters_and_transfer_if_expired(matrix_row_t
     for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
         uint16_t row_offset = row * MATRIX_COLS;
 
+        if (!(pending_rows & ((uint32_t)1 << row))) {
+            continue; // no running counters on this row
+        }
+        pending_rows &= ~((uint32_t)1 << row);
+
         for (uint8_t col = 0; col < MATRIX_COLS; col++) {
             uint16_t index = row_offset + col;
 
@@ -92,6 +105,7 @@ static inline void update_debounce_counters_and_transfer_if_expired(matrix_row_t
                 } else {
                     debounce_counters[index] -= elapsed_time;
                     counters_need_update = true;
+                    pending_rows |= (uint32_t)1 << row;
                 }
             }
         }
@@ -113,6 +127,15 @@ static inline void start_debounce_counters(matrix_row_t raw[], matrix_row_t cook
         uint16_t     row_offset = row * MATRIX_COLS;
         matrix_row_t delta      = raw[row] ^ cooked[row];
 
+        if (delta == 0) {
+            if (pending_rows & ((uint32_t)1 << row)) {
+                // Bounced back to the settled state; cancel the row's counters
+                memset(&debounce_counters[row_offset], DEBOUNCE_ELAPSED, MATRIX_COLS * sizeof(debounce_counter_t));
+                pending_rows &= ~((uint32_t)1 << row);
+            }
+            continue; // idle row
+        }
+
         for (uint8_t col = 0; col < MATRIX_COLS; col++) {
             uint16_t index = row_offset + col;
 
@@ -125,6 +148,9 @@ static inline void start_debounce_counters(matrix_row_t raw[], matrix_row_t cook
                 debounce_counters[index] = DEBOUNCE_ELAPSED;
             }
         }
+
+        // Every delta bit now has a running counter on this row
+        pending_rows |= (uint32_t)1 << row;
     }
 }
 
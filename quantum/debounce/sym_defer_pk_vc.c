@@ -0,0 +1,174 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// Symmetric per-key algorithm using vertical counters. Behaves like
+// sym_defer_pk, but instead of an 8-bit counter per key it keeps a few
+// matrix_row_t bit-plane words per row, so one debounce tick costs a handful
+// of word operations per row regardless of the column count.
+// When no state changes have occured for DEBOUNCE milliseconds, we push the state.
+
+#include "debounce.h"
+#include "compiler_support.h"
+#include "timer.h"
+#include "util.h"
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+#if DEBOUNCE > 0
+
+// Enough bit planes to count up to DEBOUNCE
+#    if DEBOUNCE < 2
+#        define DEBOUNCE_PLANES 1
+#    elif DEBOUNCE < 4
+#        define DEBOUNCE_PLANES 2
+#    elif DEBOUNCE < 8
+#        define DEBOUNCE_PLANES 3
+#    elif DEBOUNCE < 16
+#        define DEBOUNCE_PLANES 4
+#    elif DEBOUNCE < 32
+#        define DEBOUNCE_PLANES 5
+#    elif DEBOUNCE < 64
+#        define DEBOUNCE_PLANES 6
+#    elif DEBOUNCE < 128
+#        define DEBOUNCE_PLANES 7
+#    else
+#        define DEBOUNCE_PLANES 8
+#    endif
+
+// Uses MATRIX_ROWS_PER_HAND instead of MATRIX_ROWS to support split keyboards
+// Vertical counters: plane i holds bit i of every key counter on the row.
+static matrix_row_t counter_planes[MATRIX_ROWS_PER_HAND][DEBOUNCE_PLANES];
+// Keys currently being debounced, i.e. raw differs from cooked.
+static matrix_row_t active[MATRIX_ROWS_PER_HAND];
+static bool         counters_need_update;
+static bool         cooked_changed;
+
+static inline void tick_vertical_counters(matrix_row_t raw[], matrix_row_t cooked[]);
+static inline void start_vertical_counters(matrix_row_t raw[], matrix_row_t cooked[]);
+
+void debounce_init(void) {}
+
+FAST_CODE bool debounce(matrix_row_t raw[], matrix_row_t cooked[], bool changed) {
+    static fast_timer_t last_time;
+    bool                updated_last = false;
+    cooked_changed                   = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        updated_last = true;
+
+        if (elapsed_time > 0) {
+            last_time = now;
+
+            // One tick per elapsed millisecond; DEBOUNCE ticks are enough to
+            // expire every running counter, so larger jumps are clamped.
+            counters_need_update = false;
+            for (fast_timer_t tick = 0; tick < MIN(elapsed_time, DEBOUNCE); tick++) {
+                tick_vertical_counters(raw, cooked);
+            }
+        }
+    }
+
+    if (changed) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_vertical_counters(raw, cooked);
+    }
+
+    return cooked_changed;
+}
+
+/**
+ * @brief Advances every running vertical counter by one millisecond.
+ *
+ * For each row with active keys, increments the per-key counters held in the
+ * bit planes with word-wide boolean operations, then transfers the state of
+ * keys whose counter reached DEBOUNCE and retires their counters.
+ *
+ * @param raw The current raw key state matrix.
+ * @param cooked The debounced key state matrix to be updated.
+ */
+static inline void tick_vertical_counters(matrix_row_t raw[], matrix_row_t cooked[]) {
+    for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
+        matrix_row_t active_row = active[row];
+
+        if (active_row == 0) {
+            continue; // idle row
+        }
+
+        // Increment the counter of every active key
+        matrix_row_t carry = active_row;
+        for (uint8_t plane = 0; plane < DEBOUNCE_PLANES; plane++) {
+            matrix_row_t overflow = counter_planes[row][plane] & carry;
+            counter_planes[row][plane] ^= carry;
+            carry = overflow;
+        }
+
+        // Keys whose counter reached DEBOUNCE are stable; push their state
+        matrix_row_t expired = active_row;
+        for (uint8_t plane = 0; plane < DEBOUNCE_PLANES; plane++) {
+            expired &= ((DEBOUNCE >> plane) & 1) ? counter_planes[row][plane] : (matrix_row_t)~counter_planes[row][plane];
+        }
+
+        if (expired) {
+            matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+            cooked_changed |= cooked[row] != cooked_next;
+            cooked[row] = cooked_next;
+
+            active_row &= ~expired;
+            active[row] = active_row;
+            for (uint8_t plane = 0; plane < DEBOUNCE_PLANES; plane++) {
+                counter_planes[row][plane] &= ~expired;
+            }
+        }
+
+        if (active_row) {
+            counters_need_update = true;
+        }
+    }
+}
+
+/**
+ * @brief Refreshes the active-key masks after a raw matrix change.
+ *
+ * Keys that changed keep (or implicitly start) their counters; keys that
+ * bounced back to the debounced state have their counter bits cleared so a
+ * later change starts counting from zero again.
+ *
+ * @param raw The current raw key state matrix.
+ * @param cooked The debounced key state matrix.
+ */
+static inline void start_vertical_counters(matrix_row_t raw[], matrix_row_t cooked[]) {
+    for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
+        matrix_row_t delta = raw[row] ^ cooked[row];
+
+        if (delta == active[row]) {
+            continue; // no new changes on this row
+        }
+
+        for (uint8_t plane = 0; plane < DEBOUNCE_PLANES; plane++) {
+            counter_planes[row][plane] &= delta;
+        }
+        active[row] = delta;
+
+        if (delta) {
+            counters_need_update = true;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
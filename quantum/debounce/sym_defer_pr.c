@@ -8,6 +8,7 @@
 // When no state changes have occured for DEBOUNCE milliseconds, we push the state.
 
 #include "debounce.h"
+#include "compiler_support.h"
 #include "timer.h"
 #include "util.h"
 
@@ -35,7 +36,7 @@ static inline void start_debounce_counters(matrix_row_t raw[], matrix_row_t cook
 
 void debounce_init(void) {}
 
-bool debounce(matrix_row_t raw[], matrix_row_t cooked[], bool changed) {
+FAST_CODE bool debounce(matrix_row_t raw[], matrix_row_t cooked[], bool changed) {
     static fast_timer_t last_time;
     bool                updated_last = false;
     cooked_changed                   = false;
@@ -20,6 +20,7 @@ No further inputs are accepted until DEBOUNCE milliseconds have occurred.
 */
 
 #include "debounce.h"
+#include "compiler_support.h"
 #include "timer.h"
 #include "util.h"
 
@@ -42,13 +43,19 @@ static debounce_counter_t debounce_counters[MATRIX_ROWS_PER_HAND * MATRIX_COLS]
 static bool               counters_need_update;
 static bool               matrix_need_update;
 static bool               cooked_changed;
+// Bitmap of rows with at least one running counter; idle rows are skipped
+// entirely instead of walking their per-key counters every scan.
+static uint32_t pending_rows;
+#    if MATRIX_ROWS_PER_HAND > 32
+#        error sym debounce row skipping supports at most 32 rows per hand
+#    endif
 
 static inline void update_debounce_counters(uint8_t elapsed_time);
 static inline void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[]);
 
 void debounce_init(void) {}
 
-bool debounce(matrix_row_t raw[], matrix_row_t cooked[], bool changed) {
+FAST_CODE bool debounce(matrix_row_t raw[], matrix_row_t cooked[], bool changed) {
     static fast_timer_t last_time;
     bool                updated_last = false;
     cooked_changed                   = false;
@@ -93,6 +100,11 @@ static inline void update_debounce_counters(uint8_t elapsed_time) {
     for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
         uint16_t row_offset = row * MATRIX_COLS;
 
+        if (!(pending_rows & ((uint32_t)1 << row))) {
+            continue; // no running counters on this row
+        }
+        pending_rows &= ~((uint32_t)1 << row);
+
         for (uint8_t col = 0; col < MATRIX_COLS; col++) {
             uint16_t index = row_offset + col;
 
@@ -103,6 +115,7 @@ static inline void update_debounce_counters(uint8_t elapsed_time) {
                 } else {
                     debounce_counters[index] -= elapsed_time;
                     counters_need_update = true;
+                    pending_rows |= (uint32_t)1 << row;
                 }
             }
         }
@@ -127,6 +140,10 @@ static inline void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooke
         matrix_row_t delta        = raw[row] ^ cooked[row];
         matrix_row_t existing_row = cooked[row];
 
+        if (delta == 0) {
+            continue; // idle row
+        }
+
         for (uint8_t col = 0; col < MATRIX_COLS; col++) {
             uint16_t index = row_offset + col;
 
@@ -135,6 +152,7 @@ static inline void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooke
                 if (debounce_counters[index] == DEBOUNCE_ELAPSED) {
                     debounce_counters[index] = DEBOUNCE;
                     counters_need_update     = true;
+                    pending_rows |= (uint32_t)1 << row;
                     existing_row ^= col_mask; // flip the bit.
                     cooked_changed = true;
                 }
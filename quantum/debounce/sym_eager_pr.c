@@ -7,6 +7,7 @@
 // No further inputs are accepted until DEBOUNCE milliseconds have occurred.
 
 #include "debounce.h"
+#include "compiler_support.h"
 #include "timer.h"
 #include "util.h"
 
@@ -35,7 +36,7 @@ static inline void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooke
 
 void debounce_init(void) {}
 
-bool debounce(matrix_row_t raw[], matrix_row_t cooked[], bool changed) {
+FAST_CODE bool debounce(matrix_row_t raw[], matrix_row_t cooked[], bool changed) {
     static fast_timer_t last_time;
     bool                updated_last = false;
     cooked_changed                   = false;
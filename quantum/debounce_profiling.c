@@ -0,0 +1,150 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "debounce_profiling.h"
+#include "debug.h"
+#include "timer.h"
+#include "util.h"
+
+// A "burst" is the train of raw edges one key produces around a physical
+// press or release; its settle time spans from the first edge to the last. A
+// burst is considered settled once no further edge has arrived for
+// DEBOUNCE_PROFILING_SETTLE_MS, at which point it is folded into the
+// statistics. A summary with a recommended algorithm and DEBOUNCE value is
+// printed over the console every DEBOUNCE_PROFILING_REPORT_MS.
+
+#ifndef DEBOUNCE_PROFILING_SETTLE_MS
+#    define DEBOUNCE_PROFILING_SETTLE_MS 25
+#endif // DEBOUNCE_PROFILING_SETTLE_MS
+
+#ifndef DEBOUNCE_PROFILING_REPORT_MS
+#    define DEBOUNCE_PROFILING_REPORT_MS 10000
+#endif // DEBOUNCE_PROFILING_REPORT_MS
+
+static matrix_row_t prev_raw[MATRIX_ROWS];
+static matrix_row_t burst_active[MATRIX_ROWS];
+static matrix_row_t burst_is_press[MATRIX_ROWS];
+static uint16_t     burst_start[MATRIX_ROWS][MATRIX_COLS];
+static uint16_t     burst_last_edge[MATRIX_ROWS][MATRIX_COLS];
+static uint8_t      burst_edges[MATRIX_ROWS][MATRIX_COLS];
+static uint8_t      active_count = 0;
+
+// Settle time buckets: 0, 1, 2, 3, 4, 5-6, 7-8, >8 ms
+static uint16_t settle_histogram[8];
+static uint32_t bursts_total       = 0;
+static uint32_t bursts_bouncing    = 0;
+static uint8_t  press_max_settle   = 0;
+static uint8_t  release_max_settle = 0;
+static uint8_t  worst_settle       = 0;
+static uint8_t  worst_row          = 0;
+static uint8_t  worst_col          = 0;
+static uint32_t last_report        = 0;
+
+static uint8_t settle_bucket(uint8_t settle) {
+    if (settle <= 4) return settle;
+    if (settle <= 6) return 5;
+    if (settle <= 8) return 6;
+    return 7;
+}
+
+static void close_burst(uint8_t row, uint8_t col) {
+    uint16_t settle = TIMER_DIFF_16(burst_last_edge[row][col], burst_start[row][col]);
+    if (settle > UINT8_MAX) {
+        settle = UINT8_MAX;
+    }
+
+    settle_histogram[settle_bucket((uint8_t)settle)]++;
+    bursts_total++;
+    if (burst_edges[row][col] > 1) {
+        bursts_bouncing++;
+    }
+
+    if (burst_is_press[row] & (MATRIX_ROW_SHIFTER << col)) {
+        if (settle > press_max_settle) {
+            press_max_settle = (uint8_t)settle;
+        }
+    } else {
+        if (settle > release_max_settle) {
+            release_max_settle = (uint8_t)settle;
+        }
+    }
+    if (settle > worst_settle) {
+        worst_settle = (uint8_t)settle;
+        worst_row    = row;
+        worst_col    = col;
+    }
+
+    burst_active[row] &= ~(MATRIX_ROW_SHIFTER << col);
+    active_count--;
+}
+
+static void report(void) {
+    dprintf("debounce profile: %lu bursts, %lu with bounce\n", (unsigned long)bursts_total, (unsigned long)bursts_bouncing);
+    dprintf("settle ms: 0:%u 1:%u 2:%u 3:%u 4:%u 5-6:%u 7-8:%u >8:%u\n", settle_histogram[0], settle_histogram[1], settle_histogram[2], settle_histogram[3], settle_histogram[4], settle_histogram[5], settle_histogram[6], settle_histogram[7]);
+    dprintf("max settle: press %ums, release %ums, worst key (%u,%u)\n", press_max_settle, release_max_settle, worst_row, worst_col);
+
+    if (worst_settle == 0) {
+        dprintf("recommend: DEBOUNCE 1 and any eager algorithm -- no bounce observed yet\n");
+    } else if (press_max_settle == 0) {
+        dprintf("recommend: DEBOUNCE %u and asym_eager_defer_pk -- press edges are clean, bounce only on release\n", release_max_settle + 1);
+    } else {
+        dprintf("recommend: DEBOUNCE %u and sym_defer_pk -- bounce on press edges\n", worst_settle + 1);
+    }
+}
+
+void debounce_profiling_record(matrix_row_t raw[], bool changed) {
+    uint16_t now = timer_read();
+
+    if (changed) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            matrix_row_t diff = raw[row] ^ prev_raw[row];
+            if (!diff) {
+                continue;
+            }
+            matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+            for (uint8_t col = 0; col < MATRIX_COLS; col++, row_shifter <<= 1) {
+                if (!(diff & row_shifter)) {
+                    continue;
+                }
+                if (!(burst_active[row] & row_shifter)) {
+                    burst_active[row] |= row_shifter;
+                    // The first edge's direction classifies the burst
+                    if (raw[row] & row_shifter) {
+                        burst_is_press[row] |= row_shifter;
+                    } else {
+                        burst_is_press[row] &= ~row_shifter;
+                    }
+                    burst_start[row][col] = now;
+                    burst_edges[row][col] = 0;
+                    active_count++;
+                }
+                burst_last_edge[row][col] = now;
+                if (burst_edges[row][col] < UINT8_MAX) {
+                    burst_edges[row][col]++;
+                }
+            }
+            prev_raw[row] = raw[row];
+        }
+    }
+
+    if (active_count) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            if (!burst_active[row]) {
+                continue;
+            }
+            matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+            for (uint8_t col = 0; col < MATRIX_COLS; col++, row_shifter <<= 1) {
+                if ((burst_active[row] & row_shifter) && TIMER_DIFF_16(now, burst_last_edge[row][col]) >= DEBOUNCE_PROFILING_SETTLE_MS) {
+                    close_burst(row, col);
+                }
+            }
+        }
+    }
+
+    if (timer_elapsed32(last_report) >= DEBOUNCE_PROFILING_REPORT_MS) {
+        last_report = timer_read32();
+        if (bursts_total) {
+            report();
+        }
+    }
+}
@@ -0,0 +1,20 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include "matrix.h"
+
+/**
+ * @brief Record one raw matrix scan for bounce profiling.
+ *
+ * Called from matrix_scan() with the raw (pre-debounce) matrix state, before
+ * the debounce algorithm runs. Tracks contact bounce per key, and periodically
+ * prints a histogram of settle times plus a recommended debounce algorithm and
+ * DEBOUNCE value over the console.
+ *
+ * @param raw The current raw key state
+ * @param changed True if raw has changed since the last call
+ */
+void debounce_profiling_record(matrix_row_t raw[], bool changed);
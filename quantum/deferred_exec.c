@@ -163,15 +163,53 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
 static uint32_t            last_deferred_exec_check                = 0;
 static deferred_executor_t basic_executors[MAX_DEFERRED_EXECUTORS] = {0};
 
+// Cached earliest trigger time across basic_executors, so the per-scan task
+// is a single timer comparison when nothing is due. Recomputed on mutation
+// (queue/extend/cancel) and after any entry has fired; the table scan only
+// happens at those points rather than on every keyboard_task() pass.
+static bool     next_trigger_valid = false;
+static uint32_t next_trigger_time  = 0;
+
+static void recompute_next_trigger_time(void) {
+    next_trigger_valid = false;
+    for (int i = 0; i < MAX_DEFERRED_EXECUTORS; ++i) {
+        deferred_executor_t *entry = &basic_executors[i];
+        if (entry->token != INVALID_DEFERRED_TOKEN) {
+            if (!next_trigger_valid || ((int32_t)TIMER_DIFF_32(entry->trigger_time, next_trigger_time)) < 0) {
+                next_trigger_time = entry->trigger_time;
+            }
+            next_trigger_valid = true;
+        }
+    }
+}
+
 deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
-    return defer_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, delay_ms, callback, cb_arg);
+    deferred_token token = defer_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, delay_ms, callback, cb_arg);
+    if (token != INVALID_DEFERRED_TOKEN) {
+        recompute_next_trigger_time();
+    }
+    return token;
 }
 bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
-    return extend_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token, delay_ms);
+    bool extended = extend_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token, delay_ms);
+    if (extended) {
+        recompute_next_trigger_time();
+    }
+    return extended;
 }
 bool cancel_deferred_exec(deferred_token token) {
-    return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
+    bool cancelled = cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
+    if (cancelled) {
+        recompute_next_trigger_time();
+    }
+    return cancelled;
 }
 void deferred_exec_task(void) {
+    if (!next_trigger_valid || ((int32_t)TIMER_DIFF_32(next_trigger_time, timer_read32())) > 0) {
+        return;
+    }
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
+    // Entries may have fired, requeued themselves, or been cancelled from
+    // within callbacks.
+    recompute_next_trigger_time();
 }
@@ -15,6 +15,7 @@
  */
 
 #include "digitizer.h"
+#include "timer.h"
 
 digitizer_t digitizer_state = {
     .in_range = false,
@@ -25,13 +26,24 @@ digitizer_t digitizer_state = {
     .dirty    = false,
 };
 
+/* timestamp of the last report actually sent to the host */
+static uint16_t last_digitizer_send = 0;
+
 void digitizer_flush(void) {
-    if (digitizer_state.dirty) {
+    // Batch intermediate positions: the host only samples at its polling rate,
+    // so reports closer together than DIGITIZER_REPORT_INTERVAL_MS are merged
+    // into the state and the latest one is sent from digitizer_task().
+    if (digitizer_state.dirty && timer_elapsed(last_digitizer_send) >= DIGITIZER_REPORT_INTERVAL_MS) {
         host_digitizer_send(&digitizer_state);
         digitizer_state.dirty = false;
+        last_digitizer_send   = timer_read();
     }
 }
 
+void digitizer_task(void) {
+    digitizer_flush();
+}
+
 void digitizer_in_range_on(void) {
     digitizer_state.in_range = true;
     digitizer_state.dirty    = true;
@@ -74,3 +86,25 @@ void digitizer_set_position(float x, float y) {
     digitizer_state.dirty = true;
     digitizer_flush();
 }
+
+void digitizer_set_position_raw(uint16_t x, uint16_t y) {
+    // Rotation is selected at build time and fused with the normalization, so
+    // each axis costs a single multiply by a precomputed reciprocal.
+    static const float inv_x = 1.0f / (DIGITIZER_RESOLUTION_X);
+    static const float inv_y = 1.0f / (DIGITIZER_RESOLUTION_Y);
+#if DIGITIZER_ROTATION == 90
+    digitizer_state.x = ((DIGITIZER_RESOLUTION_Y) - y) * inv_y;
+    digitizer_state.y = x * inv_x;
+#elif DIGITIZER_ROTATION == 180
+    digitizer_state.x = ((DIGITIZER_RESOLUTION_X) - x) * inv_x;
+    digitizer_state.y = ((DIGITIZER_RESOLUTION_Y) - y) * inv_y;
+#elif DIGITIZER_ROTATION == 270
+    digitizer_state.x = y * inv_y;
+    digitizer_state.y = ((DIGITIZER_RESOLUTION_X) - x) * inv_x;
+#else
+    digitizer_state.x = x * inv_x;
+    digitizer_state.y = y * inv_y;
+#endif
+    digitizer_state.dirty = true;
+    digitizer_flush();
+}
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
 
 /**
  * \file
@@ -25,6 +26,27 @@
  * \{
  */
 
+/* Minimum time between reports sent to the host. Positions submitted faster
+ * than this are merged, and the latest state is flushed from digitizer_task().
+ * The default matches a 1 ms USB polling interval. */
+#ifndef DIGITIZER_REPORT_INTERVAL_MS
+#    define DIGITIZER_REPORT_INTERVAL_MS 1
+#endif
+
+/* Raw coordinate range of the digitizer surface, used by
+ * digitizer_set_position_raw(). The defaults suit 12-bit touch controllers. */
+#ifndef DIGITIZER_RESOLUTION_X
+#    define DIGITIZER_RESOLUTION_X 4095
+#endif
+#ifndef DIGITIZER_RESOLUTION_Y
+#    define DIGITIZER_RESOLUTION_Y 4095
+#endif
+
+/* Clockwise rotation of the digitizer surface: 0, 90, 180 or 270. */
+#ifndef DIGITIZER_ROTATION
+#    define DIGITIZER_ROTATION 0
+#endif
+
 typedef struct {
     bool  in_range : 1;
     bool  tip : 1;
@@ -37,10 +59,15 @@ typedef struct {
 extern digitizer_t digitizer_state;
 
 /**
- * \brief Send the digitizer report to the host if it is marked as dirty.
+ * \brief Send the digitizer report to the host if it is marked as dirty, at most once per `DIGITIZER_REPORT_INTERVAL_MS`.
  */
 void digitizer_flush(void);
 
+/**
+ * \brief Flush any state deferred by the report interval. Called from the main keyboard loop.
+ */
+void digitizer_task(void);
+
 /**
  * \brief Assert the "in range" indicator, and flush the report.
  */
@@ -79,6 +106,18 @@ void digitizer_barrel_switch_off(void);
  */
 void digitizer_set_position(float x, float y);
 
+/**
+ * \brief Set the contact position from raw digitizer coordinates, and flush the report.
+ *
+ * The rotation configured with `DIGITIZER_ROTATION` and the normalization by
+ * `DIGITIZER_RESOLUTION_X`/`DIGITIZER_RESOLUTION_Y` are fused into a single
+ * fixed multiply per axis at build time.
+ *
+ * \param x The raw X value of the contact position, from 0 to `DIGITIZER_RESOLUTION_X`.
+ * \param y The raw Y value of the contact position, from 0 to `DIGITIZER_RESOLUTION_Y`.
+ */
+void digitizer_set_position_raw(uint16_t x, uint16_t y);
+
 void host_digitizer_send(digitizer_t *digitizer);
 
 /** \} */
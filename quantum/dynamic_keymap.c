@@ -18,6 +18,7 @@
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "send_string.h"
 #include "keycodes.h"
 #include "nvm_dynamic_keymap.h"
@@ -36,12 +37,50 @@ uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
 
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+// RAM mirror of the dynamic keymap, so that keycode lookups during matrix
+// processing are plain array reads instead of per-key nvm accesses -- the
+// difference matters on boards whose EEPROM sits behind I2C/SPI or behind a
+// flash emulation layer. Costs 2 bytes of RAM per key per layer. The mirror
+// is populated lazily from nvm on first lookup and kept in sync on writes;
+// nvm remains the authoritative copy.
+static uint16_t keymap_cache[DYNAMIC_KEYMAP_LAYER_COUNT][MATRIX_ROWS][MATRIX_COLS];
+static bool     keymap_cache_valid = false;
+
+static void keymap_cache_load(void) {
+    if (keymap_cache_valid) {
+        return;
+    }
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                keymap_cache[layer][row][column] = nvm_dynamic_keymap_read_keycode(layer, row, column);
+            }
+        }
+    }
+    keymap_cache_valid = true;
+}
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
+
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+    keymap_cache_load();
+    return keymap_cache[layer][row][column];
+#else
     return nvm_dynamic_keymap_read_keycode(layer, row, column);
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    if (layer < DYNAMIC_KEYMAP_LAYER_COUNT && row < MATRIX_ROWS && column < MATRIX_COLS) {
+        keymap_cache_load();
+        keymap_cache[layer][row][column] = keycode;
+    }
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
     nvm_dynamic_keymap_update_keycode(layer, row, column, keycode);
+    invalidate_resolved_layer_cache();
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -79,7 +118,26 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 }
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    // Patch the affected bytes into the mirror; the raw buffer stores each
+    // keycode big endian, and a write may start or end mid-keycode
+    keymap_cache_load();
+    uint16_t *flat = &keymap_cache[0][0][0];
+    for (uint16_t i = 0; i < size; i++) {
+        uint32_t byte_offset = (uint32_t)offset + i;
+        uint32_t index       = byte_offset / 2;
+        if (index >= (uint32_t)DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS) {
+            break;
+        }
+        if (byte_offset % 2 == 0) {
+            flat[index] = (flat[index] & 0x00FF) | ((uint16_t)data[i] << 8);
+        } else {
+            flat[index] = (flat[index] & 0xFF00) | data[i];
+        }
+    }
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
     nvm_dynamic_keymap_update_buffer(offset, size, data);
+    invalidate_resolved_layer_cache();
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
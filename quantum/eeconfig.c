@@ -6,6 +6,11 @@
 #include "action_layer.h"
 #include "nvm_eeconfig.h"
 #include "keycode_config.h"
+#include "timer.h"
+
+#ifndef EECONFIG_FLUSH_TIMEOUT_MS
+#    define EECONFIG_FLUSH_TIMEOUT_MS 200
+#endif // EECONFIG_FLUSH_TIMEOUT_MS
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -68,6 +73,33 @@ __attribute__((weak)) void eeconfig_init_kb(void) {
 }
 
 void eeconfig_init_quantum(void) {
+    // Snapshot the kb/user datablocks before the erase. A block whose own
+    // version stamp still matches survives a core re-init unchanged; on a
+    // version mismatch the raw bytes are offered to the migration hooks so
+    // that keyboard-level data (e.g. calibration) need not be lost to a
+    // schema change.
+#if (EECONFIG_KB_DATA_SIZE) > 0
+    uint8_t kb_datablock[EECONFIG_KB_DATA_SIZE];
+    bool    kb_datablock_preserved = eeconfig_is_kb_datablock_valid();
+    if (kb_datablock_preserved) {
+        eeconfig_read_kb_datablock(kb_datablock, 0, (EECONFIG_KB_DATA_SIZE));
+    } else {
+        nvm_eeconfig_read_kb_datablock_raw(kb_datablock, (EECONFIG_KB_DATA_SIZE));
+        kb_datablock_preserved = eeconfig_migrate_kb_datablock(nvm_eeconfig_kb_datablock_version(), kb_datablock, (EECONFIG_KB_DATA_SIZE));
+    }
+#endif // (EECONFIG_KB_DATA_SIZE) > 0
+
+#if (EECONFIG_USER_DATA_SIZE) > 0
+    uint8_t user_datablock[EECONFIG_USER_DATA_SIZE];
+    bool    user_datablock_preserved = eeconfig_is_user_datablock_valid();
+    if (user_datablock_preserved) {
+        eeconfig_read_user_datablock(user_datablock, 0, (EECONFIG_USER_DATA_SIZE));
+    } else {
+        nvm_eeconfig_read_user_datablock_raw(user_datablock, (EECONFIG_USER_DATA_SIZE));
+        user_datablock_preserved = eeconfig_migrate_user_datablock(nvm_eeconfig_user_datablock_version(), user_datablock, (EECONFIG_USER_DATA_SIZE));
+    }
+#endif // (EECONFIG_USER_DATA_SIZE) > 0
+
     nvm_eeconfig_erase();
 
     eeconfig_enable();
@@ -140,12 +172,24 @@ void eeconfig_init_quantum(void) {
     eeconfig_update_connection_default();
 #endif // CONNECTION_ENABLE
 
+    // Restore (or initialise) the kb/user datablocks. The version stamp is
+    // held in the coalesced core block and only committed by the flush at the
+    // end of this function, after the data bytes have been written -- a power
+    // loss mid-restore leaves an unstamped block rather than a torn one.
 #if (EECONFIG_KB_DATA_SIZE) > 0
-    eeconfig_init_kb_datablock();
+    if (kb_datablock_preserved) {
+        eeconfig_update_kb_datablock(kb_datablock, 0, (EECONFIG_KB_DATA_SIZE));
+    } else {
+        eeconfig_init_kb_datablock();
+    }
 #endif // (EECONFIG_KB_DATA_SIZE) > 0
 
 #if (EECONFIG_USER_DATA_SIZE) > 0
-    eeconfig_init_user_datablock();
+    if (user_datablock_preserved) {
+        eeconfig_update_user_datablock(user_datablock, 0, (EECONFIG_USER_DATA_SIZE));
+    } else {
+        eeconfig_init_user_datablock();
+    }
 #endif // (EECONFIG_USER_DATA_SIZE) > 0
 
 #if defined(VIA_ENABLE)
@@ -167,12 +211,31 @@ void eeconfig_init_quantum(void) {
     extern void eeconfig_force_flush_led_matrix(void);
     eeconfig_force_flush_led_matrix();
 #endif // LED_MATRIX_ENABLE
+
+    // Commit the freshly-written defaults instead of leaving them pending
+    eeconfig_flush();
 }
 
 void eeconfig_init(void) {
     eeconfig_init_quantum();
 }
 
+void eeconfig_flush(void) {
+    nvm_eeconfig_flush();
+}
+
+void eeconfig_flush_task(void) {
+    static uint32_t flush_timer = 0;
+    if (!nvm_eeconfig_has_pending_write()) {
+        flush_timer = timer_read32();
+        return;
+    }
+    if (timer_elapsed32(flush_timer) >= EECONFIG_FLUSH_TIMEOUT_MS) {
+        eeconfig_flush();
+        flush_timer = timer_read32();
+    }
+}
+
 void eeconfig_enable(void) {
     nvm_eeconfig_enable();
 }
@@ -328,6 +391,13 @@ void eeconfig_update_handedness(bool val) {
     nvm_eeconfig_update_handedness(val);
 }
 
+bool eeconfig_read_split_role(bool *is_master) {
+    return nvm_eeconfig_read_split_role(is_master);
+}
+void eeconfig_update_split_role(bool is_master) {
+    nvm_eeconfig_update_split_role(is_master);
+}
+
 #if (EECONFIG_KB_DATA_SIZE) > 0
 bool eeconfig_is_kb_datablock_valid(void) {
     return nvm_eeconfig_is_kb_datablock_valid();
@@ -341,6 +411,12 @@ uint32_t eeconfig_update_kb_datablock(const void *data, uint32_t offset, uint32_
 __attribute__((weak)) void eeconfig_init_kb_datablock(void) {
     nvm_eeconfig_init_kb_datablock();
 }
+__attribute__((weak)) bool eeconfig_migrate_kb_datablock(uint32_t stored_version, void *data, uint32_t length) {
+    (void)stored_version;
+    (void)data;
+    (void)length;
+    return false;
+}
 #endif // (EECONFIG_KB_DATA_SIZE) > 0
 
 #if (EECONFIG_USER_DATA_SIZE) > 0
@@ -356,4 +432,10 @@ uint32_t eeconfig_update_user_datablock(const void *data, uint32_t offset, uint3
 __attribute__((weak)) void eeconfig_init_user_datablock(void) {
     nvm_eeconfig_init_user_datablock();
 }
+__attribute__((weak)) bool eeconfig_migrate_user_datablock(uint32_t stored_version, void *data, uint32_t length) {
+    (void)stored_version;
+    (void)data;
+    (void)length;
+    return false;
+}
 #endif // (EECONFIG_USER_DATA_SIZE) > 0
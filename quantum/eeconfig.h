@@ -57,6 +57,13 @@ bool eeconfig_is_disabled(void);
 
 void eeconfig_init(void);
 void eeconfig_init_quantum(void);
+
+// Deferred-commit support: updates are coalesced in RAM and written out by
+// eeconfig_flush_task() once the config has been stable for
+// EECONFIG_FLUSH_TIMEOUT_MS, or immediately via eeconfig_flush()
+void eeconfig_flush(void);
+void eeconfig_flush_task(void);
+
 void eeconfig_init_kb(void);
 void eeconfig_init_user(void);
 
@@ -140,11 +147,19 @@ void                              eeconfig_update_connection(const connection_co
 bool eeconfig_read_handedness(void);
 void eeconfig_update_handedness(bool val);
 
+/* Cached last-known split role; read returns false when no role is cached. */
+bool eeconfig_read_split_role(bool *is_master) __attribute__((nonnull));
+void eeconfig_update_split_role(bool is_master);
+
 #if (EECONFIG_KB_DATA_SIZE) > 0
 bool     eeconfig_is_kb_datablock_valid(void);
 uint32_t eeconfig_read_kb_datablock(void *data, uint32_t offset, uint32_t length) __attribute__((nonnull));
 uint32_t eeconfig_update_kb_datablock(const void *data, uint32_t offset, uint32_t length) __attribute__((nonnull));
 void     eeconfig_init_kb_datablock(void);
+// Optionally overridden by keyboard-level code: invoked during re-init when the stored datablock's version stamp does
+// not match EECONFIG_KB_DATA_VERSION. `data` holds the raw stored bytes; migrate them in place and return true to keep
+// them (they are re-written under the new version), or return false to fall back to eeconfig_init_kb_datablock().
+bool eeconfig_migrate_kb_datablock(uint32_t stored_version, void *data, uint32_t length);
 #    define eeconfig_read_kb_datablock_field(__object, __field) eeconfig_read_kb_datablock(&(__object.__field), offsetof(typeof(__object), __field), sizeof(__object.__field))
 #    define eeconfig_update_kb_datablock_field(__object, __field) eeconfig_update_kb_datablock(&(__object.__field), offsetof(typeof(__object), __field), sizeof(__object.__field))
 #endif // (EECONFIG_KB_DATA_SIZE) > 0
@@ -154,6 +169,8 @@ bool     eeconfig_is_user_datablock_valid(void);
 uint32_t eeconfig_read_user_datablock(void *data, uint32_t offset, uint32_t length) __attribute__((nonnull));
 uint32_t eeconfig_update_user_datablock(const void *data, uint32_t offset, uint32_t length) __attribute__((nonnull));
 void     eeconfig_init_user_datablock(void);
+// Optionally overridden by user-level code: same contract as eeconfig_migrate_kb_datablock().
+bool eeconfig_migrate_user_datablock(uint32_t stored_version, void *data, uint32_t length);
 #    define eeconfig_read_user_datablock_field(__object, __field) eeconfig_read_user_datablock(&(__object.__field), offsetof(typeof(__object), __field), sizeof(__object.__field))
 #    define eeconfig_update_user_datablock_field(__object, __field) eeconfig_update_user_datablock(&(__object.__field), offsetof(typeof(__object), __field), sizeof(__object.__field))
 #endif // (EECONFIG_USER_DATA_SIZE) > 0
@@ -4,6 +4,7 @@
 #include <string.h>
 #include "action.h"
 #include "encoder.h"
+#include "timer.h"
 #include "wait.h"
 
 #ifndef ENCODER_MAP_KEY_DELAY
@@ -17,11 +18,69 @@ __attribute__((weak)) bool should_process_encoder(void) {
 static encoder_events_t encoder_events;
 static bool             signal_queue_drain = false;
 
+// Per-encoder rotation rate tracking, fed from the event queue so it works
+// with any driver that enqueues events
+typedef struct encoder_velocity_t {
+    uint16_t last_event_time;
+    uint16_t avg_interval_ms; // smoothed interval between detents
+    bool     active;
+} encoder_velocity_t;
+
+static encoder_velocity_t encoder_velocity_state[NUM_ENCODERS];
+
 void encoder_init(void) {
     memset(&encoder_events, 0, sizeof(encoder_events));
+    memset(&encoder_velocity_state, 0, sizeof(encoder_velocity_state));
     encoder_driver_init();
 }
 
+static void encoder_velocity_record(uint8_t index) {
+    if (index >= NUM_ENCODERS) {
+        return;
+    }
+
+    encoder_velocity_t *vel = &encoder_velocity_state[index];
+    uint16_t            now = timer_read();
+
+    if (vel->active) {
+        uint16_t interval = TIMER_DIFF_16(now, vel->last_event_time);
+        if (interval >= ENCODER_VELOCITY_TIMEOUT_MS) {
+            // Fresh burst after idling; restart from the slow baseline
+            vel->avg_interval_ms = ENCODER_VELOCITY_TIMEOUT_MS;
+        } else {
+            // Exponential smoothing, weighted towards history
+            vel->avg_interval_ms = (vel->avg_interval_ms * 3 + interval) / 4;
+        }
+    } else {
+        vel->avg_interval_ms = ENCODER_VELOCITY_TIMEOUT_MS;
+        vel->active          = true;
+    }
+    vel->last_event_time = now;
+}
+
+uint16_t encoder_velocity(uint8_t index) {
+    if (index >= NUM_ENCODERS) {
+        return 0;
+    }
+
+    const encoder_velocity_t *vel = &encoder_velocity_state[index];
+    if (!vel->active) {
+        return 0;
+    }
+
+    uint16_t since = timer_elapsed(vel->last_event_time);
+    if (since >= ENCODER_VELOCITY_TIMEOUT_MS) {
+        return 0;
+    }
+
+    // Let the reported rate decay while no new events arrive
+    uint16_t interval = MAX(vel->avg_interval_ms, since);
+    if (interval == 0) {
+        interval = 1;
+    }
+    return 1000 / interval;
+}
+
 static void encoder_queue_drain(void) {
     encoder_events.tail     = encoder_events.head;
     encoder_events.dequeued = encoder_events.enqueued;
@@ -133,7 +192,11 @@ bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bo
 }
 
 bool encoder_queue_event(uint8_t index, bool clockwise) {
-    return encoder_queue_event_advanced(&encoder_events, index, clockwise);
+    bool queued = encoder_queue_event_advanced(&encoder_events, index, clockwise);
+    if (queued) {
+        encoder_velocity_record(index);
+    }
+    return queued;
 }
 
 bool encoder_dequeue_event(uint8_t *index, bool *clockwise) {
@@ -46,6 +46,16 @@ bool encoder_task(void);
 bool encoder_queue_event(uint8_t index, bool clockwise);
 bool encoder_dequeue_event(uint8_t *index, bool *clockwise);
 
+#    ifndef ENCODER_VELOCITY_TIMEOUT_MS
+#        define ENCODER_VELOCITY_TIMEOUT_MS 250
+#    endif
+
+// Rotation rate of the given encoder in detents per second, smoothed over
+// recent events. Decays as the encoder slows and reads 0 once no event has
+// arrived within ENCODER_VELOCITY_TIMEOUT_MS. Intended for acceleration-aware
+// handling in encoder callbacks.
+uint16_t encoder_velocity(uint8_t index);
+
 bool encoder_update_kb(uint8_t index, bool clockwise);
 bool encoder_update_user(uint8_t index, bool clockwise);
 
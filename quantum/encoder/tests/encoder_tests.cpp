@@ -23,6 +23,8 @@
 extern "C" {
 #include "encoder.h"
 #include "encoder/tests/mock.h"
+
+void advance_time(uint32_t ms);
 }
 
 struct update {
@@ -142,3 +144,36 @@ TEST_F(EncoderTest, TestHalfway) {
     EXPECT_EQ(updates[0].index, 0);
     EXPECT_EQ(updates[0].clockwise, true);
 }
+
+static void oneDetentClockwise(void) {
+    setAndRead(0, false);
+    setAndRead(1, false);
+    setAndRead(0, true);
+    setAndRead(1, true);
+}
+
+TEST_F(EncoderTest, TestVelocityTracksRotationRate) {
+    updates_array_idx = 0;
+    encoder_init();
+
+    EXPECT_EQ(encoder_velocity(0), 0);
+
+    // a fast spin, one detent every 5ms
+    for (int i = 0; i < 12; i++) {
+        oneDetentClockwise();
+        advance_time(5);
+    }
+    uint16_t fast = encoder_velocity(0);
+    EXPECT_GT(fast, 0);
+
+    // slowing down to one detent every 100ms must read back slower
+    for (int i = 0; i < 12; i++) {
+        oneDetentClockwise();
+        advance_time(100);
+    }
+    EXPECT_LT(encoder_velocity(0), fast);
+
+    // once no events arrive within the timeout, velocity decays to zero
+    advance_time(ENCODER_VELOCITY_TIMEOUT_MS);
+    EXPECT_EQ(encoder_velocity(0), 0);
+}
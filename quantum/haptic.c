@@ -28,6 +28,9 @@
 #ifdef HAPTIC_SOLENOID
 #    include "solenoid.h"
 #endif
+#ifdef HAPTIC_PATTERNS
+#    include "haptic_pattern.h"
+#endif
 
 #if defined(SPLIT_KEYBOARD) && defined(SPLIT_HAPTIC_ENABLE)
 extern uint8_t split_haptic_play;
@@ -109,7 +112,10 @@ void haptic_task(void) {
 #    if defined(SPLIT_KEYBOARD) && !defined(SPLIT_HAPTIC_ENABLE)
     if (!is_keyboard_master()) return;
 #    endif
-    solenoid_check();
+    // Skip the dwell scan entirely while no solenoid is energised
+    if (solenoid_active()) {
+        solenoid_check();
+    }
 #endif // HAPTIC_SOLENOID
 }
 
@@ -347,6 +353,9 @@ void haptic_play(void) {
 }
 
 void haptic_shutdown(void) {
+#ifdef HAPTIC_PATTERNS
+    haptic_pattern_stop();
+#endif
 #ifdef HAPTIC_SOLENOID
     solenoid_shutdown();
 #endif
@@ -0,0 +1,93 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "haptic_pattern.h"
+#include "haptic.h"
+#include "deferred_exec.h"
+#include "timer.h"
+
+#ifdef HAPTIC_DRV2605L
+#    include "drv2605l.h"
+#endif
+#ifdef HAPTIC_SOLENOID
+#    include "solenoid.h"
+#endif
+
+extern haptic_config_t haptic_config;
+
+static const haptic_pattern_segment_t *pattern_segments = NULL;
+static uint8_t                         pattern_length   = 0;
+static uint8_t                         pattern_index    = 0;
+static deferred_token                  pattern_token    = INVALID_DEFERRED_TOKEN;
+
+static void pattern_apply_level(uint8_t level) {
+#ifdef HAPTIC_DRV2605L
+    drv2605l_amplitude(level);
+#endif
+#ifdef HAPTIC_SOLENOID
+    solenoid_drive(level != 0);
+#endif
+}
+
+static void pattern_finish(void) {
+    pattern_apply_level(0);
+#ifdef HAPTIC_DRV2605L
+    if (haptic_config.cont) {
+        // Continuous mode keeps the driver in RTP mode at its own amplitude
+        drv2605l_amplitude(haptic_config.amplitude);
+    } else {
+        drv2605l_write(DRV2605L_REG_MODE, 0x00);
+    }
+#endif
+    pattern_segments = NULL;
+}
+
+static uint32_t pattern_step(uint32_t trigger_time, void *cb_arg) {
+    if (pattern_index >= pattern_length) {
+        pattern_finish();
+        pattern_token = INVALID_DEFERRED_TOKEN;
+        return 0;
+    }
+    const haptic_pattern_segment_t *segment = &pattern_segments[pattern_index++];
+    pattern_apply_level(segment->level);
+    // A zero-length segment still needs a wake-up to advance past it
+    return segment->duration_ms ? segment->duration_ms : 1;
+}
+
+void haptic_pattern_play(const haptic_pattern_segment_t *segments, uint8_t count) {
+    if (!segments || !count || !haptic_config.enable) {
+        return;
+    }
+    haptic_pattern_stop();
+
+    pattern_segments = segments;
+    pattern_length   = count;
+    pattern_index    = 0;
+#ifdef HAPTIC_DRV2605L
+    // Patterns drive the motor through RTP amplitudes rather than library effects
+    drv2605l_rtp_init();
+#endif
+
+    uint32_t first_delay = pattern_step(timer_read32(), NULL);
+    if (first_delay) {
+        pattern_token = defer_exec(first_delay, pattern_step, NULL);
+        if (pattern_token == INVALID_DEFERRED_TOKEN) {
+            // Executor table full; don't leave the transducer energised
+            pattern_finish();
+        }
+    }
+}
+
+bool haptic_pattern_active(void) {
+    return pattern_segments != NULL;
+}
+
+void haptic_pattern_stop(void) {
+    if (pattern_token != INVALID_DEFERRED_TOKEN) {
+        cancel_deferred_exec(pattern_token);
+        pattern_token = INVALID_DEFERRED_TOKEN;
+    }
+    if (pattern_segments != NULL) {
+        pattern_finish();
+    }
+}
@@ -0,0 +1,46 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Multi-segment haptic feedback. A pattern is an array of segments, each
+ * holding a drive level for a number of milliseconds; playback is stepped by
+ * the deferred executor, so between segment boundaries it costs nothing in
+ * the main loop. Available when both the haptic feature and the deferred
+ * executor are enabled.
+ */
+
+/* One step of a haptic pattern. */
+typedef struct haptic_pattern_segment_t {
+    uint8_t level;       /* 0 rests; nonzero energises the solenoid(s), or sets the DRV2605L RTP amplitude */
+    uint8_t duration_ms; /* how long the level is held */
+} haptic_pattern_segment_t;
+
+/* Segment shorthands for declaring patterns. */
+#define HAPTIC_PULSE(ms) {255, (ms)}
+#define HAPTIC_REST(ms) {0, (ms)}
+#define HAPTIC_LEVEL(level, ms) {(level), (ms)}
+
+/**
+ * @brief Starts playing a pattern, replacing any pattern already playing.
+ *
+ * The segment array must stay valid for the duration of playback, so declare
+ * patterns `static const`.
+ *
+ * @param segments pattern to play
+ * @param count number of segments in the pattern
+ */
+void haptic_pattern_play(const haptic_pattern_segment_t *segments, uint8_t count);
+
+/**
+ * @brief Whether a pattern is currently playing.
+ */
+bool haptic_pattern_active(void);
+
+/**
+ * @brief Stops any playing pattern and returns the transducer to rest.
+ */
+void haptic_pattern_stop(void);
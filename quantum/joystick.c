@@ -15,6 +15,7 @@
  */
 
 #include "joystick.h"
+#include "timer.h"
 #include "wait.h"
 
 #if defined(JOYSTICK_ANALOG)
@@ -65,6 +66,49 @@ static inline bool is_virtual_axis(uint8_t axis) {
     return joystick_axes[axis].input_pin == NO_PIN;
 }
 
+#if JOYSTICK_AXIS_COUNT > 0
+// per-axis sampling state: last filtered raw value, and sample scheduling
+typedef struct {
+    uint16_t filtered;
+    uint16_t last_sample_time;
+    bool     primed;
+    bool     sampled;
+} joystick_axis_state_t;
+
+static joystick_axis_state_t joystick_axis_states[JOYSTICK_AXIS_COUNT];
+
+// per-axis sample intervals, in milliseconds; 0 samples on every task pass
+__attribute__((weak)) const uint16_t joystick_axis_sample_intervals[JOYSTICK_AXIS_COUNT] = {[0 ...(JOYSTICK_AXIS_COUNT - 1)] = JOYSTICK_AXIS_SAMPLE_INTERVAL_MS};
+#endif
+
+static uint16_t joystick_axis_sample_filtered(uint8_t axis) {
+#if JOYSTICK_OVERSAMPLE > 1
+    // average several conversions to trade sample time for resolution;
+    // cheap decimation so deadzone tuning keeps the extra precision
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < JOYSTICK_OVERSAMPLE; ++i) {
+        sum += joystick_axis_sample(axis);
+    }
+    uint16_t raw = sum / JOYSTICK_OVERSAMPLE;
+#else
+    uint16_t raw = joystick_axis_sample(axis);
+#endif
+
+#if JOYSTICK_AXIS_COUNT > 0 && JOYSTICK_AXIS_FILTER_SHIFT > 0
+    joystick_axis_state_t *state = &joystick_axis_states[axis];
+    if (!state->primed) {
+        state->filtered = raw;
+        state->primed   = true;
+    } else {
+        // single-pole low-pass filter on the raw ADC value
+        state->filtered += (int16_t)(raw - state->filtered) / (1 << JOYSTICK_AXIS_FILTER_SHIFT);
+    }
+    return state->filtered;
+#else
+    return raw;
+#endif
+}
+
 void joystick_flush(void) {
     if (!joystick_state.dirty) return;
 
@@ -79,7 +123,6 @@ void register_joystick_button(uint8_t button) {
 
     joystick_state.buttons[button / 8] |= 1 << (button % 8);
     joystick_state.dirty = true;
-    joystick_flush();
 }
 
 void unregister_joystick_button(uint8_t button) {
@@ -87,13 +130,12 @@ void unregister_joystick_button(uint8_t button) {
 
     joystick_state.buttons[button / 8] &= ~(1 << (button % 8));
     joystick_state.dirty = true;
-    joystick_flush();
 }
 
 int16_t joystick_read_axis(uint8_t axis) {
     if (axis >= JOYSTICK_AXIS_COUNT) return 0;
 
-    int16_t axis_val = joystick_axis_sample(axis);
+    int16_t axis_val = joystick_axis_sample_filtered(axis);
 
     // test the converted value against the lower range
     int32_t ref        = joystick_axes[axis].mid_digit;
@@ -132,20 +174,39 @@ void joystick_read_axes(void) {
             continue;
         }
 
+        // honor the per-axis sample rate, if one is configured
+        if (joystick_axis_sample_intervals[i] > 0) {
+            if (joystick_axis_states[i].sampled && timer_elapsed(joystick_axis_states[i].last_sample_time) < joystick_axis_sample_intervals[i]) {
+                continue;
+            }
+            joystick_axis_states[i].last_sample_time = timer_read();
+            joystick_axis_states[i].sampled          = true;
+        }
+
         joystick_set_axis(i, joystick_read_axis(i));
     }
-
-    joystick_flush();
 #endif
 }
 
 void joystick_set_axis(uint8_t axis, int16_t value) {
     if (axis >= JOYSTICK_AXIS_COUNT) return;
 
-    if (value != joystick_state.axes[axis]) {
-        joystick_state.axes[axis] = value;
-        joystick_state.dirty      = true;
+    int16_t delta = value - joystick_state.axes[axis];
+    if (delta == 0) return;
+
+#if JOYSTICK_AXIS_DELTA > 1
+    // Suppress changes inside the hysteresis band - residual ADC noise after
+    // filtering - unless the axis settles on the center or an extreme, which
+    // must always be reported exactly.
+    if (delta < JOYSTICK_AXIS_DELTA && delta > -JOYSTICK_AXIS_DELTA) {
+        if (value != 0 && value != JOYSTICK_MAX_VALUE && value != -JOYSTICK_MAX_VALUE) {
+            return;
+        }
     }
+#endif
+
+    joystick_state.axes[axis] = value;
+    joystick_state.dirty      = true;
 }
 
 #ifdef JOYSTICK_HAS_HAT
@@ -161,4 +222,9 @@ void joystick_init(void) {
 
 void joystick_task(void) {
     joystick_read_axes();
+
+    // Axis movement and button changes from this pass are batched into a
+    // single report. Button handling runs earlier in the same keyboard_task()
+    // pass, so coalescing here adds no latency.
+    joystick_flush();
 }
@@ -52,6 +52,31 @@
 
 #define JOYSTICK_MAX_VALUE ((1L << (JOYSTICK_AXIS_RESOLUTION - 1)) - 1)
 
+#ifndef JOYSTICK_OVERSAMPLE
+#    define JOYSTICK_OVERSAMPLE 1
+#elif JOYSTICK_OVERSAMPLE < 1 || JOYSTICK_OVERSAMPLE > 64
+#    error JOYSTICK_OVERSAMPLE must be between 1 and 64
+#endif
+
+#ifndef JOYSTICK_AXIS_FILTER_SHIFT
+#    define JOYSTICK_AXIS_FILTER_SHIFT 0
+#elif JOYSTICK_AXIS_FILTER_SHIFT > 8
+#    error JOYSTICK_AXIS_FILTER_SHIFT must be between 0 and 8
+#endif
+
+#ifndef JOYSTICK_AXIS_SAMPLE_INTERVAL_MS
+#    define JOYSTICK_AXIS_SAMPLE_INTERVAL_MS 0
+#endif
+
+// Minimum change of a scaled axis value, against the last reported one, that
+// is worth a new report. Values settling on the center or an extreme always
+// get through. 1 keeps every change, matching the historical behavior.
+#ifndef JOYSTICK_AXIS_DELTA
+#    define JOYSTICK_AXIS_DELTA 1
+#elif JOYSTICK_AXIS_DELTA < 1
+#    error JOYSTICK_AXIS_DELTA must be at least 1
+#endif
+
 #define JOYSTICK_HAT_CENTER -1
 #define JOYSTICK_HAT_NORTH 0
 #define JOYSTICK_HAT_NORTHEAST 1
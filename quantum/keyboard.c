@@ -36,6 +36,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
+#ifdef WEAR_LEVELING_ENABLE
+#    include "wear_leveling.h"
+#endif
+#ifdef EEPROM_LEGACY_EMULATED_FLASH
+#    include "eeprom_legacy_emulated_flash.h"
+#endif
+#ifdef FLASH_DRIVER_SPI
+#    include "flash.h"
+#endif
 #ifdef AUDIO_ENABLE
 #    include "audio.h"
 #endif
@@ -93,6 +102,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef JOYSTICK_ENABLE
 #    include "joystick.h"
 #endif
+#ifdef DYNAMIC_MACRO_ENABLE
+#    include "process_dynamic_macro.h"
+#endif
+#ifdef DIGITIZER_ENABLE
+#    include "digitizer.h"
+#endif
+#ifdef PROGRAMMABLE_BUTTON_ENABLE
+#    include "programmable_button.h"
+#endif
 #ifdef HD44780_ENABLE
 #    include "hd44780.h"
 #endif
@@ -150,6 +168,43 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef CONNECTION_ENABLE
 #    include "connection.h"
 #endif
+#ifdef SCAN_HISTOGRAM_ENABLE
+#    include "scan_histogram.h"
+#endif
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+#ifdef LATENCY_TEST_RIG_ENABLE
+#    include "latency_test_rig.h"
+#endif
+#ifdef TASK_STATS_ENABLE
+#    include "task_stats.h"
+#else
+// compile the accounting markers out without ifdef'ing every call site
+#    define task_stats_begin(task)
+#    define task_stats_end(task)
+#endif
+#ifdef USAGE_STATS_ENABLE
+#    include "usage_stats.h"
+#endif
+#ifdef REPORT_COALESCING
+#    include "action_util.h"
+#endif
+#ifdef RAW_HID_CHANNELS_ENABLE
+#    include "raw_hid_channels.h"
+#endif
+#ifdef NVM_SNAPSHOT_ENABLE
+#    include "nvm_snapshot.h"
+#endif
+#ifdef NUM_TRACED_VARIABLES
+#    include "variable_trace.h"
+#endif
+#ifdef I2C_ASYNC_ENABLE
+#    include "i2c_master_async.h"
+#endif
+#ifdef SPI_ASYNC_ENABLE
+#    include "spi_master_async.h"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -227,16 +282,32 @@ uint32_t get_matrix_scan_rate(void) {
 #endif
 
 #ifdef MATRIX_HAS_GHOST
-static matrix_row_t get_real_keys(uint8_t row, matrix_row_t rowdata) {
-    matrix_row_t out = 0;
-    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-        // read each key in the row data and check if the keymap defines it as a real key
-        if (keycode_at_keymap_location(0, row, col) && (rowdata & (((matrix_row_t)1) << col))) {
-            // this creates new row data, if a key is defined in the keymap, it will be set here
-            out |= ((matrix_row_t)1) << col;
+// Columns with real (non-KC_NO) keys per row; derived from the keymap once,
+// since "active" blanks can't be pressed by the user and never ghost.
+static matrix_row_t real_key_mask[MATRIX_ROWS];
+static bool         real_key_mask_valid = false;
+
+// Currently pressed real keys per row, refreshed on row changes, plus a
+// bitmap of rows holding two or more of them. Only those rows can take part
+// in a ghost, so idle rows cost nothing to check.
+static matrix_row_t real_keys_down[MATRIX_ROWS];
+static uint32_t     multi_key_rows;
+#    if MATRIX_ROWS > 32
+#        error ghost detection row tracking supports at most 32 rows
+#    endif
+
+static void init_real_key_mask(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t out = 0;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            // check if the keymap defines the location as a real key
+            if (keycode_at_keymap_location(0, row, col)) {
+                out |= ((matrix_row_t)1) << col;
+            }
         }
+        real_key_mask[row] = out;
     }
-    return out;
+    real_key_mask_valid = true;
 }
 
 static inline bool popcount_more_than_one(matrix_row_t rowdata) {
@@ -245,12 +316,22 @@ static inline bool popcount_more_than_one(matrix_row_t rowdata) {
 }
 
 static inline bool has_ghost_in_row(uint8_t row, matrix_row_t rowdata) {
+    if (!real_key_mask_valid) {
+        init_real_key_mask();
+    }
+
     /* No ghost exists when less than 2 keys are down on the row.
     If there are "active" blanks in the matrix, the key can't be pressed by the user,
     there is no doubt as to which keys are really being pressed.
     The ghosts will be ignored, they are KC_NO.   */
-    rowdata = get_real_keys(row, rowdata);
-    if ((popcount_more_than_one(rowdata)) == 0) {
+    rowdata &= real_key_mask[row];
+
+    // keep the incremental per-row state current for later checks
+    real_keys_down[row] = rowdata;
+    if (popcount_more_than_one(rowdata)) {
+        multi_key_rows |= (uint32_t)1 << row;
+    } else {
+        multi_key_rows &= ~((uint32_t)1 << row);
         return false;
     }
     /* Ghost occurs when the row shares a column line with other row,
@@ -259,9 +340,11 @@ static inline bool has_ghost_in_row(uint8_t row, matrix_row_t rowdata) {
     If there are two or more real keys pressed and they match columns with
     at least two of another row's real keys, the row will be ignored. Keep in mind,
     we are checking one row at a time, not all of them at once.
-    */
-    for (uint8_t i = 0; i < MATRIX_ROWS; i++) {
-        if (i != row && popcount_more_than_one(get_real_keys(i, matrix_get_row(i)) & rowdata)) {
+    Only rows with two or more real keys down can form a ghost, so only those
+    are examined. */
+    uint32_t candidate_rows = multi_key_rows & ~((uint32_t)1 << row);
+    for (uint8_t i = 0; candidate_rows != 0; i++, candidate_rows >>= 1) {
+        if ((candidate_rows & 1) && popcount_more_than_one(real_keys_down[i] & rowdata)) {
             return true;
         }
     }
@@ -352,6 +435,77 @@ __attribute__((weak)) bool matrix_can_read(void) {
     return true;
 }
 
+#ifdef MATRIX_IDLE_SCAN_TIMEOUT
+
+#    ifndef MATRIX_IDLE_SCAN_INTERVAL
+#        define MATRIX_IDLE_SCAN_INTERVAL 10
+#    endif
+
+/** \brief matrix_idle_enter_user
+ *
+ * Called when the idle scan governor starts throttling matrix scans.
+ */
+__attribute__((weak)) void matrix_idle_enter_user(void) {}
+
+/** \brief matrix_idle_enter_kb
+ *
+ * Called when the idle scan governor starts throttling matrix scans, e.g. to
+ * drop clocks or arm pin-change wakeup on boards that support it.
+ */
+__attribute__((weak)) void matrix_idle_enter_kb(void) {
+    matrix_idle_enter_user();
+}
+
+/** \brief matrix_idle_exit_user
+ *
+ * Called when input activity resumes and full-rate scanning is restored.
+ */
+__attribute__((weak)) void matrix_idle_exit_user(void) {}
+
+/** \brief matrix_idle_exit_kb
+ *
+ * Called when input activity resumes and full-rate scanning is restored.
+ */
+__attribute__((weak)) void matrix_idle_exit_kb(void) {
+    matrix_idle_exit_user();
+}
+
+/** \brief Idle scan governor.
+ *
+ * After MATRIX_IDLE_SCAN_TIMEOUT milliseconds without input activity, matrix
+ * scans are throttled to one every MATRIX_IDLE_SCAN_INTERVAL milliseconds so
+ * the main loop stops burning power on a matrix that is not changing. Any
+ * input activity restores full-rate scanning on the next pass.
+ *
+ * \return true if the matrix should be scanned this iteration.
+ */
+static bool matrix_idle_task(void) {
+    static bool     throttled      = false;
+    static uint32_t last_idle_scan = 0;
+
+    bool idle = last_input_activity_elapsed() > MATRIX_IDLE_SCAN_TIMEOUT;
+    if (idle != throttled) {
+        throttled = idle;
+        if (idle) {
+            matrix_idle_enter_kb();
+        } else {
+            matrix_idle_exit_kb();
+        }
+    }
+
+    if (!throttled) {
+        return true;
+    }
+
+    if (timer_elapsed32(last_idle_scan) < MATRIX_IDLE_SCAN_INTERVAL) {
+        return false;
+    }
+    last_idle_scan = timer_read32();
+    return true;
+}
+
+#endif // MATRIX_IDLE_SCAN_TIMEOUT
+
 /** \brief keyboard_setup
  *
  * FIXME: needs doc
@@ -420,9 +574,61 @@ __attribute__((weak)) void housekeeping_task_user(void) {}
  * Invokes hooks for executing code after QMK is done after each loop iteration.
  */
 void housekeeping_task(void) {
+    task_stats_begin(TASK_STATS_HOUSEKEEPING_TASK);
     housekeeping_task_modules();
     housekeeping_task_kb();
     housekeeping_task_user();
+
+#ifdef WEAR_LEVELING_ENABLE
+    // Consolidate the emulated-EEPROM write log while idle, rather than
+    // stalling inside whichever write would otherwise have filled it
+    wear_leveling_task();
+#endif
+
+#ifdef EEPROM_LEGACY_EMULATED_FLASH
+    // Flush deferred EEPROM writes and compact the write log while idle
+    eeprom_legacy_emulated_flash_task();
+#endif
+
+#ifdef FLASH_DRIVER_SPI
+    // Progress any in-flight background flash erase without blocking scanning
+    flash_async_task();
+#endif
+
+#ifdef USAGE_STATS_ENABLE
+    usage_stats_task();
+#endif
+
+#ifdef I2C_ASYNC_ENABLE
+    // Execute at most one queued I2C transaction per pass, highest priority first
+    i2c_async_task();
+#endif
+
+#ifdef SPI_ASYNC_ENABLE
+    // Collect or start at most one queued SPI transaction per pass
+    spi_async_task();
+#endif
+
+#ifdef RAW_HID_CHANNELS_ENABLE
+    // Dispatch a bounded number of queued raw HID reports, priority first
+    raw_hid_channels_task();
+#endif
+
+#ifdef NVM_SNAPSHOT_ENABLE
+    // Progress any in-flight NVM checksum or verify scan
+    nvm_snapshot_task();
+#endif
+
+#ifdef LAYER_CHANGE_NOTIFY
+    // Deliver at most one coalesced layer-change notification per cycle
+    layer_change_notify_task();
+#endif
+
+#ifdef NUM_TRACED_VARIABLES
+    // Capture changes to watched variables into the trace ring
+    VERIFY_TRACED_VARIABLES();
+#endif
+    task_stats_end(TASK_STATS_HOUSEKEEPING_TASK);
 }
 
 /** \brief quantum_init
@@ -477,13 +683,13 @@ void keyboard_init(void) {
 #ifdef BACKLIGHT_ENABLE
     backlight_init_ports();
 #endif
-#ifdef AUDIO_ENABLE
+#if defined(AUDIO_ENABLE) && !defined(DEFER_NONINPUT_INIT)
     audio_init();
 #endif
-#ifdef LED_MATRIX_ENABLE
+#if defined(LED_MATRIX_ENABLE) && !defined(DEFER_NONINPUT_INIT)
     led_matrix_init();
 #endif
-#ifdef RGB_MATRIX_ENABLE
+#if defined(RGB_MATRIX_ENABLE) && !defined(DEFER_NONINPUT_INIT)
     rgb_matrix_init();
 #endif
 #if defined(UNICODE_COMMON_ENABLE)
@@ -492,10 +698,22 @@ void keyboard_init(void) {
 #if defined(CRC_ENABLE)
     crc_init();
 #endif
-#ifdef OLED_ENABLE
+#ifdef USAGE_STATS_ENABLE
+    usage_stats_init();
+#endif
+#ifdef LATENCY_TEST_RIG_ENABLE
+    latency_test_rig_init();
+#endif
+#ifdef NVM_SNAPSHOT_ENABLE
+    nvm_snapshot_init();
+#endif
+#ifdef NUM_TRACED_VARIABLES
+    variable_trace_init();
+#endif
+#if defined(OLED_ENABLE) && !defined(DEFER_NONINPUT_INIT)
     oled_init(OLED_ROTATION_0);
 #endif
-#ifdef ST7565_ENABLE
+#if defined(ST7565_ENABLE) && !defined(DEFER_NONINPUT_INIT)
     st7565_init(DISPLAY_ROTATION_0);
 #endif
 #ifdef PS2_MOUSE_ENABLE
@@ -504,7 +722,7 @@ void keyboard_init(void) {
 #ifdef BACKLIGHT_ENABLE
     backlight_init();
 #endif
-#ifdef RGBLIGHT_ENABLE
+#if defined(RGBLIGHT_ENABLE) && !defined(DEFER_NONINPUT_INIT)
     rgblight_init();
 #endif
 #ifdef STENO_ENABLE_ALL
@@ -521,6 +739,9 @@ void keyboard_init(void) {
 #ifdef JOYSTICK_ENABLE
     joystick_init();
 #endif
+#ifdef DYNAMIC_MACRO_ENABLE
+    dynamic_macro_init();
+#endif
 #ifdef SLEEP_LED_ENABLE
     sleep_led_init();
 #endif
@@ -564,6 +785,11 @@ void switch_events(uint8_t row, uint8_t col, bool pressed) {
     rgb_matrix_handle_key_event(row, col, pressed);
 #endif
     wakeup_matrix_handle_key_event(row, col, pressed);
+#if defined(USAGE_STATS_ENABLE)
+    if (pressed) {
+        usage_stats_record_keypress(row, col);
+    }
+#endif
 }
 
 /**
@@ -581,6 +807,16 @@ static inline void generate_tick_event(void) {
 
 matrix_row_t matrix_previous[MATRIX_ROWS];
 
+/** Matrix rows as seen by matrix_task(): the real matrix, with the latency
+ * test rig's synthetic key overlay OR'd in when that mode is compiled in. */
+static inline matrix_row_t matrix_task_get_row(uint8_t row) {
+#ifdef LATENCY_TEST_RIG_ENABLE
+    return matrix_get_row(row) | latency_test_rig_row_overlay(row);
+#else
+    return matrix_get_row(row);
+#endif
+}
+
 /**
  * @brief This task scans the keyboards matrix and processes any key presses
  * that occur.
@@ -594,10 +830,23 @@ static bool matrix_task(void) {
         return false;
     }
 
+#ifdef MATRIX_IDLE_SCAN_TIMEOUT
+    if (!matrix_idle_task()) {
+        generate_tick_event();
+        return false;
+    }
+#endif
+
+#ifdef SCAN_HISTOGRAM_ENABLE
+    scan_histogram_begin(SCAN_HISTOGRAM_MATRIX_SCAN);
+#endif
     matrix_scan();
+#ifdef SCAN_HISTOGRAM_ENABLE
+    scan_histogram_end(SCAN_HISTOGRAM_MATRIX_SCAN);
+#endif
     bool matrix_changed = false;
     for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_changed; row++) {
-        matrix_changed |= matrix_previous[row] ^ matrix_get_row(row);
+        matrix_changed |= matrix_previous[row] ^ matrix_task_get_row(row);
     }
 
     matrix_scan_perf_task();
@@ -614,8 +863,14 @@ static bool matrix_task(void) {
 
     const bool process_keypress = should_process_keypress();
 
+#ifdef REPORT_COALESCING
+    // All key events from this scan collapse into one report per protocol;
+    // see the coalescing window in action_util.c.
+    keyboard_report_coalesce_begin();
+#endif
+
     for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
-        const matrix_row_t current_row = matrix_get_row(row);
+        const matrix_row_t current_row = matrix_task_get_row(row);
         const matrix_row_t row_changes = current_row ^ matrix_previous[row];
 
         if (!row_changes || has_ghost_in_row(row, current_row)) {
@@ -628,6 +883,9 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress && !keypress_is_wakeup_key(row, col)) {
+#ifdef LATENCY_TRACE_ENABLE
+                    latency_trace_stage(LATENCY_TRACE_KEY_EVENT);
+#endif
                     action_exec(MAKE_KEYEVENT(row, col, key_pressed));
                 }
 
@@ -638,6 +896,10 @@ static bool matrix_task(void) {
         matrix_previous[row] = current_row;
     }
 
+#ifdef REPORT_COALESCING
+    keyboard_report_coalesce_end();
+#endif
+
     return matrix_changed;
 }
 
@@ -675,7 +937,9 @@ void quantum_task(void) {
     combo_task();
 #endif
 
-#ifdef LEADER_ENABLE
+#if defined(LEADER_ENABLE) && !defined(DEFERRED_EXEC_ENABLE)
+    // With the deferred executor enabled, the sequence timeout is a
+    // scheduled wake-up instead of a per-iteration check.
     leader_task();
 #endif
 
@@ -687,11 +951,13 @@ void quantum_task(void) {
     dip_switch_task();
 #endif
 
-#ifdef AUTO_SHIFT_ENABLE
+#if defined(AUTO_SHIFT_ENABLE) && !defined(DEFERRED_EXEC_ENABLE)
+    // Likewise a scheduled wake-up when the deferred executor is enabled.
     autoshift_matrix_scan();
 #endif
 
-#ifdef CAPS_WORD_ENABLE
+#if defined(CAPS_WORD_ENABLE) && !defined(DEFERRED_EXEC_ENABLE)
+    // Likewise a scheduled wake-up when the deferred executor is enabled.
     caps_word_task();
 #endif
 
@@ -706,29 +972,115 @@ void quantum_task(void) {
     host_task();
 }
 
+#ifdef DEFER_NONINPUT_INIT
+/** \brief Runs the non-input inits deferred out of keyboard_init().
+ *
+ * One init per scan-loop pass: the matrix is live from the very first pass
+ * and USB enumeration progresses on interrupts between stages, so a slow
+ * display or LED controller bring-up (with its mandated settle delays) no
+ * longer gates time-to-first-report.
+ *
+ * @return true while stages remain.
+ */
+static bool deferred_noninput_init(void) {
+    static uint8_t stage = 0;
+    switch (stage) {
+        case 0:
+#    ifdef AUDIO_ENABLE
+            audio_init();
+#    endif
+            break;
+        case 1:
+#    ifdef LED_MATRIX_ENABLE
+            led_matrix_init();
+#    endif
+            break;
+        case 2:
+#    ifdef RGB_MATRIX_ENABLE
+            rgb_matrix_init();
+#    endif
+            break;
+        case 3:
+#    ifdef RGBLIGHT_ENABLE
+            rgblight_init();
+#    endif
+            break;
+        case 4:
+#    ifdef OLED_ENABLE
+            oled_init(OLED_ROTATION_0);
+#    endif
+            break;
+        case 5:
+#    ifdef ST7565_ENABLE
+            st7565_init(DISPLAY_ROTATION_0);
+#    endif
+            break;
+        default:
+            return false;
+    }
+    stage++;
+    return true;
+}
+#endif // DEFER_NONINPUT_INIT
+
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
+#ifdef SCAN_HISTOGRAM_ENABLE
+    scan_histogram_begin(SCAN_HISTOGRAM_KEYBOARD_TASK);
+#endif
+#ifdef LATENCY_TEST_RIG_ENABLE
+    // advance the injected pattern before the matrix is processed, so new
+    // synthetic transitions are picked up in this scan
+    latency_test_rig_task();
+#endif
+    task_stats_begin(TASK_STATS_MATRIX_TASK);
     if (matrix_task()) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
+    task_stats_end(TASK_STATS_MATRIX_TASK);
+
+#if defined(BOOTMAGIC_ENABLE) && defined(BOOTMAGIC_FAST_SCAN)
+    // check the bootmagic key against the first debounced scan results
+    bootmagic_task();
+#endif
 
+#ifdef DEFER_NONINPUT_INIT
+    // While deferred init stages remain, skip the feature tasks below: their
+    // drivers may not be initialised yet, and key events are already flowing.
+    if (deferred_noninput_init()) {
+        return;
+    }
+#endif
+
+    task_stats_begin(TASK_STATS_QUANTUM_TASK);
     quantum_task();
+    task_stats_end(TASK_STATS_QUANTUM_TASK);
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
     split_watchdog_task();
 #endif
 
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_ROLE_CACHE)
+    split_role_cache_task();
+#endif
+
 #if defined(RGBLIGHT_ENABLE)
+    task_stats_begin(TASK_STATS_RGBLIGHT_TASK);
     rgblight_task();
+    task_stats_end(TASK_STATS_RGBLIGHT_TASK);
 #endif
 
 #ifdef LED_MATRIX_ENABLE
+    task_stats_begin(TASK_STATS_LED_MATRIX_TASK);
     led_matrix_task();
+    task_stats_end(TASK_STATS_LED_MATRIX_TASK);
 #endif
 #ifdef RGB_MATRIX_ENABLE
+    task_stats_begin(TASK_STATS_RGB_MATRIX_TASK);
     rgb_matrix_task();
+    task_stats_end(TASK_STATS_RGB_MATRIX_TASK);
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
@@ -745,14 +1097,18 @@ void keyboard_task(void) {
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
+    task_stats_begin(TASK_STATS_POINTING_DEVICE_TASK);
     if (pointing_device_task()) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
+    task_stats_end(TASK_STATS_POINTING_DEVICE_TASK);
 #endif
 
 #ifdef OLED_ENABLE
+    task_stats_begin(TASK_STATS_OLED_TASK);
     oled_task();
+    task_stats_end(TASK_STATS_OLED_TASK);
 #    if OLED_TIMEOUT > 0
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) oled_on();
@@ -784,6 +1140,15 @@ void keyboard_task(void) {
     joystick_task();
 #endif
 
+#ifdef DIGITIZER_ENABLE
+    digitizer_task();
+#endif
+
+#ifdef PROGRAMMABLE_BUTTON_ENABLE
+    // commit any programmable button changes made during this tick
+    programmable_button_flush();
+#endif
+
 #ifdef BATTERY_ENABLE
     battery_task();
 #endif
@@ -798,7 +1163,13 @@ void keyboard_task(void) {
 
     led_task();
 
+    eeconfig_flush_task();
+
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+
+#ifdef SCAN_HISTOGRAM_ENABLE
+    scan_histogram_end(SCAN_HISTOGRAM_KEYBOARD_TASK);
+#endif
 }
@@ -123,6 +123,13 @@ void housekeeping_task(void);      // To be executed by the main loop in each ba
 void housekeeping_task_kb(void);   // To be overridden by keyboard-level code
 void housekeeping_task_user(void); // To be overridden by user/keymap-level code
 
+#ifdef MATRIX_IDLE_SCAN_TIMEOUT
+void matrix_idle_enter_kb(void);   // Called when the idle scan governor starts throttling matrix scans
+void matrix_idle_enter_user(void); // To be overridden by user/keymap-level code
+void matrix_idle_exit_kb(void);    // Called when input activity restores full-rate scanning
+void matrix_idle_exit_user(void);  // To be overridden by user/keymap-level code
+#endif
+
 uint32_t last_input_activity_time(void);    // Timestamp of the last matrix or encoder or pointing device activity
 uint32_t last_input_activity_elapsed(void); // Number of milliseconds since the last matrix or encoder or pointing device activity
 
@@ -139,6 +146,9 @@ void set_activity_timestamps(uint32_t matrix_timestamp, uint32_t encoder_timesta
 
 uint32_t get_matrix_scan_rate(void);
 
+uint32_t main_loop_overrun_count(void);      // Number of paced main loop cycles that missed their KEYBOARD_TASK_PACING_US deadline
+void     main_loop_pacing_wait_us(uint32_t); // Platform hook for burning the pacing slack; defaults to returning immediately so the loop spins
+
 #ifdef __cplusplus
 }
 #endif
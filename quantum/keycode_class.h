@@ -0,0 +1,51 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "progmem.h"
+
+/**
+ * \file
+ *
+ * \brief Bitset-based classification of 8-bit keycodes.
+ *
+ * Several features answer an "is this keycode one of ours?" question on
+ * every key press with a switch over keycode ranges. These helpers express
+ * the same classification as a 32-byte bitset built in flash at compile
+ * time, so the per-press answer becomes a single table lookup and the
+ * ranges stay encoded in one predicate macro instead of a cascade of case
+ * labels.
+ *
+ * A class is described by a predicate macro `P(k)` that evaluates to
+ * nonzero for every 8-bit keycode `k` in the class, for example:
+ *
+ *     #define MY_CLASS(k) ((k) >= KC_A && (k) <= KC_Z)
+ *     static const uint8_t my_class[32] PROGMEM = KEYCODE_CLASS_TABLE(MY_CLASS);
+ *
+ * The predicate is evaluated entirely by the compiler; none of it survives
+ * into the generated code.
+ */
+
+#define KEYCODE_CLASS_BYTE(P, b) ((uint8_t)((!!(P((b)*8 + 0)) << 0) | (!!(P((b)*8 + 1)) << 1) | (!!(P((b)*8 + 2)) << 2) | (!!(P((b)*8 + 3)) << 3) | (!!(P((b)*8 + 4)) << 4) | (!!(P((b)*8 + 5)) << 5) | (!!(P((b)*8 + 6)) << 6) | (!!(P((b)*8 + 7)) << 7)))
+
+// clang-format off
+#define KEYCODE_CLASS_TABLE(P)                                                                                    \
+    {                                                                                                             \
+        KEYCODE_CLASS_BYTE(P, 0), KEYCODE_CLASS_BYTE(P, 1), KEYCODE_CLASS_BYTE(P, 2), KEYCODE_CLASS_BYTE(P, 3),   \
+        KEYCODE_CLASS_BYTE(P, 4), KEYCODE_CLASS_BYTE(P, 5), KEYCODE_CLASS_BYTE(P, 6), KEYCODE_CLASS_BYTE(P, 7),   \
+        KEYCODE_CLASS_BYTE(P, 8), KEYCODE_CLASS_BYTE(P, 9), KEYCODE_CLASS_BYTE(P, 10), KEYCODE_CLASS_BYTE(P, 11), \
+        KEYCODE_CLASS_BYTE(P, 12), KEYCODE_CLASS_BYTE(P, 13), KEYCODE_CLASS_BYTE(P, 14), KEYCODE_CLASS_BYTE(P, 15), \
+        KEYCODE_CLASS_BYTE(P, 16), KEYCODE_CLASS_BYTE(P, 17), KEYCODE_CLASS_BYTE(P, 18), KEYCODE_CLASS_BYTE(P, 19), \
+        KEYCODE_CLASS_BYTE(P, 20), KEYCODE_CLASS_BYTE(P, 21), KEYCODE_CLASS_BYTE(P, 22), KEYCODE_CLASS_BYTE(P, 23), \
+        KEYCODE_CLASS_BYTE(P, 24), KEYCODE_CLASS_BYTE(P, 25), KEYCODE_CLASS_BYTE(P, 26), KEYCODE_CLASS_BYTE(P, 27), \
+        KEYCODE_CLASS_BYTE(P, 28), KEYCODE_CLASS_BYTE(P, 29), KEYCODE_CLASS_BYTE(P, 30), KEYCODE_CLASS_BYTE(P, 31), \
+    }
+// clang-format on
+
+/** \brief Tests whether \p keycode belongs to the class held in \p class_bits, a 32-byte bitset in flash. Keycodes outside the 8-bit range are never in a class. */
+static inline bool keycode_class_test(const uint8_t *class_bits, uint16_t keycode) {
+    return keycode < 256 && (pgm_read_byte(&class_bits[keycode >> 3]) & (1 << (keycode & 7))) != 0;
+}
@@ -153,6 +153,15 @@ static char buffer[32];
 #define BUFFER_MAX_LEN (sizeof(buffer) - 1)
 static index_t buffer_len;
 
+/**
+ * Last keycode rendered into `buffer`. Debug paths typically stringify the
+ * same keycode twice in a row (press then release), so remembering the
+ * previous render skips the table walk and formatting work for the repeat
+ * call.
+ */
+static uint16_t cached_keycode;
+static bool     cached_keycode_valid = false;
+
 /** Finds the name of a keycode in `common_names` or returns NULL. */
 static const char* search_common_names(uint16_t keycode) {
     static uint8_t buffer[8];
@@ -557,8 +566,13 @@ static void append_keycode(uint16_t keycode) {
 }
 
 const char* get_keycode_string(uint16_t keycode) {
+    if (cached_keycode_valid && keycode == cached_keycode) {
+        return buffer; // Same keycode as last time; the render is still in the buffer.
+    }
     buffer_len = 0;
     buffer[0]  = '\0';
     append_keycode(keycode);
+    cached_keycode       = keycode;
+    cached_keycode_valid = true;
     return buffer;
 }
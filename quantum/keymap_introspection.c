@@ -15,6 +15,7 @@
 
 #include "compiler_support.h"
 #include "keymap_introspection.h"
+#include "progmem.h"
 #include "util.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -47,6 +48,30 @@ __attribute__((weak)) uint16_t keycode_at_keymap_location(uint8_t layer_num, uin
     return keycode_at_keymap_location_raw(layer_num, row, column);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Sparse key mapping
+
+#if defined(SPARSE_KEYMAP_ENABLE)
+
+#    include "sparse_keymap.h"
+
+#    define NUM_SPARSE_KEYMAP_LAYERS ((uint8_t)ARRAY_SIZE(sparse_keymap_layers))
+
+uint8_t sparse_keymap_layer_count(void) {
+    return NUM_SPARSE_KEYMAP_LAYERS;
+}
+
+STATIC_ASSERT(NUM_KEYMAP_LAYERS_RAW + NUM_SPARSE_KEYMAP_LAYERS <= MAX_LAYER, "Combined number of keymap and sparse keymap layers exceeds maximum set by LAYER_STATE_(8|16|32)BIT");
+
+const sparse_keymap_layer_t* sparse_keymap_layer_get(uint8_t sparse_layer_num) {
+    if (sparse_layer_num >= NUM_SPARSE_KEYMAP_LAYERS) {
+        return NULL;
+    }
+    return &sparse_keymap_layers[sparse_layer_num];
+}
+
+#endif // defined(SPARSE_KEYMAP_ENABLE)
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Encoder mapping
 
@@ -137,10 +162,15 @@ __attribute__((weak)) uint16_t tap_dance_count(void) {
 STATIC_ASSERT(ARRAY_SIZE(tap_dance_actions) <= (QK_TAP_DANCE_MAX - QK_TAP_DANCE), "Number of tap dance actions exceeds maximum. Are you using SAFE_RANGE in tap dance enum?");
 
 tap_dance_action_t* tap_dance_get_raw(uint16_t tap_dance_idx) {
+    // The action table lives in flash; the entry is copied into a scratch
+    // buffer so that callers keep dereferencing a plain pointer. The returned
+    // pointer is only valid until the next call.
+    static tap_dance_action_t tap_dance_scratch;
     if (tap_dance_idx >= tap_dance_count_raw()) {
         return NULL;
     }
-    return &tap_dance_actions[tap_dance_idx];
+    memcpy_P(&tap_dance_scratch, &tap_dance_actions[tap_dance_idx], sizeof(tap_dance_scratch));
+    return &tap_dance_scratch;
 }
 
 __attribute__((weak)) tap_dance_action_t* tap_dance_get(uint16_t tap_dance_idx) {
@@ -168,7 +198,9 @@ const key_override_t* key_override_get_raw(uint16_t key_override_idx) {
     if (key_override_idx >= key_override_count_raw()) {
         return NULL;
     }
-    return key_overrides[key_override_idx];
+    // The pointer table lives in flash; the overrides themselves stay
+    // addressable directly.
+    return (const key_override_t*)pgm_read_ptr(&key_overrides[key_override_idx]);
 }
 
 __attribute__((weak)) const key_override_t* key_override_get(uint16_t key_override_idx) {
@@ -177,6 +209,124 @@ __attribute__((weak)) const key_override_t* key_override_get(uint16_t key_overri
 
 #endif // defined(KEY_OVERRIDE_ENABLE)
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Leader sequences
+
+#if defined(LEADER_ENABLE) && defined(LEADER_MAP_ENABLE)
+
+uint16_t leader_map_count_raw(void) {
+    return ARRAY_SIZE(leader_map);
+}
+
+__attribute__((weak)) uint16_t leader_map_count(void) {
+    return leader_map_count_raw();
+}
+
+const leader_map_entry_t* leader_map_entry_get_raw(uint16_t leader_map_idx) {
+    // Same scratch-copy scheme as tap_dance_get_raw(): the map lives in flash
+    // and the returned pointer is only valid until the next call.
+    static leader_map_entry_t leader_map_scratch;
+    if (leader_map_idx >= leader_map_count_raw()) {
+        return NULL;
+    }
+    memcpy_P(&leader_map_scratch, &leader_map[leader_map_idx], sizeof(leader_map_scratch));
+    return &leader_map_scratch;
+}
+
+__attribute__((weak)) const leader_map_entry_t* leader_map_entry_get(uint16_t leader_map_idx) {
+    return leader_map_entry_get_raw(leader_map_idx);
+}
+
+#endif // defined(LEADER_ENABLE) && defined(LEADER_MAP_ENABLE)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// UCIS
+
+#if defined(UCIS_ENABLE)
+
+#    include "ucis.h"
+
+#    define NUM_UCIS_SYMBOLS ((uint16_t)(ARRAY_SIZE(ucis_symbol_table) - 1)) // excluding the NULL terminator
+
+uint16_t ucis_symbol_count_raw(void) {
+    return NUM_UCIS_SYMBOLS;
+}
+
+__attribute__((weak)) uint16_t ucis_symbol_count(void) {
+    return ucis_symbol_count_raw();
+}
+
+// First character of every mnemonic, packed into one dense array so the match
+// loop in ucis_finish() can reject almost all entries with a single byte
+// compare instead of chasing each entry's mnemonic pointer. Filled on first
+// use; the symbol table cannot change at runtime.
+static char ucis_symbol_first_chars_cache[NUM_UCIS_SYMBOLS > 0 ? NUM_UCIS_SYMBOLS : 1];
+static bool ucis_symbol_first_chars_cached = false;
+
+const char* ucis_symbol_first_chars(void) {
+    if (!ucis_symbol_first_chars_cached) {
+        for (uint16_t i = 0; i < NUM_UCIS_SYMBOLS; i++) {
+            ucis_symbol_first_chars_cache[i] = ucis_symbol_table[i].mnemonic[0];
+        }
+        ucis_symbol_first_chars_cached = true;
+    }
+    return ucis_symbol_first_chars_cache;
+}
+
+#endif // defined(UCIS_ENABLE)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// RGB Matrix indicator rules
+
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_INDICATOR_RULES)
+
+#    include "rgb_matrix_indicator_rules.h"
+
+uint16_t rgb_matrix_indicator_rule_count_raw(void) {
+    return ARRAY_SIZE(rgb_matrix_indicator_rules);
+}
+__attribute__((weak)) uint16_t rgb_matrix_indicator_rule_count(void) {
+    return rgb_matrix_indicator_rule_count_raw();
+}
+
+const rgb_matrix_indicator_rule_t* rgb_matrix_indicator_rule_get_raw(uint16_t rule_idx) {
+    if (rule_idx >= rgb_matrix_indicator_rule_count_raw()) {
+        return NULL;
+    }
+    return &rgb_matrix_indicator_rules[rule_idx];
+}
+__attribute__((weak)) const rgb_matrix_indicator_rule_t* rgb_matrix_indicator_rule_get(uint16_t rule_idx) {
+    return rgb_matrix_indicator_rule_get_raw(rule_idx);
+}
+
+#endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_INDICATOR_RULES)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// PMW33XX sensor profiles
+
+#if defined(PMW33XX_PROFILES) && (defined(POINTING_DEVICE_DRIVER_pmw3360) || defined(POINTING_DEVICE_DRIVER_pmw3389))
+
+#    include "pmw33xx_profiles.h"
+
+uint8_t pmw33xx_profile_count_raw(void) {
+    return ARRAY_SIZE(pmw33xx_profiles);
+}
+__attribute__((weak)) uint8_t pmw33xx_profile_count(void) {
+    return pmw33xx_profile_count_raw();
+}
+
+const pmw33xx_profile_t* pmw33xx_profile_get_raw(uint8_t profile_idx) {
+    if (profile_idx >= pmw33xx_profile_count_raw()) {
+        return NULL;
+    }
+    return &pmw33xx_profiles[profile_idx];
+}
+__attribute__((weak)) const pmw33xx_profile_t* pmw33xx_profile_get(uint8_t profile_idx) {
+    return pmw33xx_profile_get_raw(profile_idx);
+}
+
+#endif // defined(PMW33XX_PROFILES) && (defined(POINTING_DEVICE_DRIVER_pmw3360) || defined(POINTING_DEVICE_DRIVER_pmw3389))
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Community modules (must be last in this file!)
 
@@ -18,6 +18,23 @@ uint16_t keycode_at_keymap_location_raw(uint8_t layer_num, uint8_t row, uint8_t
 // Get the keycode for the keymap location, potentially stored dynamically
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column);
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Sparse key mapping
+
+#if defined(SPARSE_KEYMAP_ENABLE)
+
+// Forward declaration of sparse_keymap_layer_t so we don't need to deal with header reordering
+struct sparse_keymap_layer_t;
+typedef struct sparse_keymap_layer_t sparse_keymap_layer_t;
+
+// Get the number of sparse layers defined in the keymap, stored in firmware rather than any other persistent storage
+uint8_t sparse_keymap_layer_count(void);
+
+// Get the sparse layer definition, stored in firmware rather than any other persistent storage
+const sparse_keymap_layer_t* sparse_keymap_layer_get(uint8_t sparse_layer_num);
+
+#endif // defined(SPARSE_KEYMAP_ENABLE)
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Encoder mapping
 
@@ -82,7 +99,8 @@ uint16_t tap_dance_count_raw(void);
 // Get the number of tap dances defined in the user's keymap, potentially stored dynamically
 uint16_t tap_dance_count(void);
 
-// Get the tap dance definitions, stored in firmware rather than any other persistent storage
+// Get the tap dance definitions, stored in firmware rather than any other persistent storage.
+// The table resides in flash; the returned pointer is a scratch copy, only valid until the next call.
 tap_dance_action_t* tap_dance_get_raw(uint16_t tap_dance_idx);
 // Get the tap dance definitions, potentially stored dynamically
 tap_dance_action_t* tap_dance_get(uint16_t tap_dance_idx);
@@ -109,3 +127,82 @@ const key_override_t* key_override_get_raw(uint16_t key_override_idx);
 const key_override_t* key_override_get(uint16_t key_override_idx);
 
 #endif // defined(KEY_OVERRIDE_ENABLE)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Leader sequences
+
+#if defined(LEADER_ENABLE) && defined(LEADER_MAP_ENABLE)
+
+// Forward declaration of leader_map_entry_t so we don't need to deal with header reordering
+struct leader_map_entry_t;
+typedef struct leader_map_entry_t leader_map_entry_t;
+
+// Get the number of leader sequences defined in the user's keymap, stored in firmware rather than any other persistent storage
+uint16_t leader_map_count_raw(void);
+// Get the number of leader sequences defined in the user's keymap, potentially stored dynamically
+uint16_t leader_map_count(void);
+
+// Get the leader sequence definition, stored in firmware rather than any other persistent storage.
+// The map resides in flash; the returned pointer is a scratch copy, only valid until the next call.
+const leader_map_entry_t* leader_map_entry_get_raw(uint16_t leader_map_idx);
+// Get the leader sequence definition, potentially stored dynamically
+const leader_map_entry_t* leader_map_entry_get(uint16_t leader_map_idx);
+
+#endif // defined(LEADER_ENABLE) && defined(LEADER_MAP_ENABLE)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// UCIS
+
+#if defined(UCIS_ENABLE)
+
+// Get the number of UCIS symbols defined in the user's keymap, excluding the NULL terminator entry
+uint16_t ucis_symbol_count_raw(void);
+// Get the number of UCIS symbols defined in the user's keymap, potentially stored dynamically
+uint16_t ucis_symbol_count(void);
+
+// Get the first character of every mnemonic, packed into one array indexed by symbol -- used to prefilter the match scan
+const char* ucis_symbol_first_chars(void);
+
+#endif // defined(UCIS_ENABLE)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// RGB Matrix indicator rules
+
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_INDICATOR_RULES)
+
+// Forward declaration so we don't need to deal with header reordering
+struct rgb_matrix_indicator_rule_t;
+typedef struct rgb_matrix_indicator_rule_t rgb_matrix_indicator_rule_t;
+
+// Get the number of indicator rules defined in the user's keymap, stored in firmware rather than any other persistent storage
+uint16_t rgb_matrix_indicator_rule_count_raw(void);
+// Get the number of indicator rules defined in the user's keymap, potentially stored dynamically
+uint16_t rgb_matrix_indicator_rule_count(void);
+
+// Get the indicator rule definition, stored in firmware rather than any other persistent storage
+const rgb_matrix_indicator_rule_t* rgb_matrix_indicator_rule_get_raw(uint16_t rule_idx);
+// Get the indicator rule definition, potentially stored dynamically
+const rgb_matrix_indicator_rule_t* rgb_matrix_indicator_rule_get(uint16_t rule_idx);
+
+#endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_INDICATOR_RULES)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// PMW33XX sensor profiles
+
+#if defined(PMW33XX_PROFILES) && (defined(POINTING_DEVICE_DRIVER_pmw3360) || defined(POINTING_DEVICE_DRIVER_pmw3389))
+
+// Forward declaration so we don't need to deal with header reordering
+struct pmw33xx_profile_t;
+typedef struct pmw33xx_profile_t pmw33xx_profile_t;
+
+// Get the number of sensor profiles defined in the user's keymap, stored in firmware rather than any other persistent storage
+uint8_t pmw33xx_profile_count_raw(void);
+// Get the number of sensor profiles defined in the user's keymap, potentially stored dynamically
+uint8_t pmw33xx_profile_count(void);
+
+// Get the sensor profile definition, stored in firmware rather than any other persistent storage
+const pmw33xx_profile_t* pmw33xx_profile_get_raw(uint8_t profile_idx);
+// Get the sensor profile definition, potentially stored dynamically
+const pmw33xx_profile_t* pmw33xx_profile_get(uint8_t profile_idx);
+
+#endif // defined(PMW33XX_PROFILES) && (defined(POINTING_DEVICE_DRIVER_pmw3360) || defined(POINTING_DEVICE_DRIVER_pmw3389))
@@ -0,0 +1,126 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "latency_test_rig.h"
+#include "gpio.h"
+#include "timer.h"
+
+#if !defined(LATENCY_TEST_RIG_TRIGGER_PIN) || !defined(LATENCY_TEST_RIG_REPORT_PIN)
+#    error "LATENCY_TEST_RIG_ENABLE requires LATENCY_TEST_RIG_TRIGGER_PIN and LATENCY_TEST_RIG_REPORT_PIN to be defined"
+#endif
+
+typedef enum rig_phase_t {
+    RIG_IDLE,      // armed, waiting for a rising edge on the trigger pin
+    RIG_PRESSING,  // roll only: pressing one additional key per interval
+    RIG_HOLDING,   // full pattern pressed, waiting out the hold time
+    RIG_RELEASING, // roll only: releasing one key per interval, press order
+    RIG_REARM,     // pattern finished, waiting for the trigger to return low
+} rig_phase_t;
+
+static rig_phase_t  phase   = RIG_IDLE;
+static matrix_row_t overlay = 0;
+static uint8_t      step    = 0;
+static uint32_t     phase_timer;
+static bool         awaiting_report = false;
+
+/** Number of keys the configured pattern actually uses. */
+static uint8_t pattern_key_count(void) {
+    return (LATENCY_TEST_RIG_PATTERN == LATENCY_TEST_RIG_PATTERN_SINGLE) ? 1 : LATENCY_TEST_RIG_KEY_COUNT;
+}
+
+/** Mask of the first `count` injected keys in the configured row. */
+static matrix_row_t keys_mask(uint8_t count) {
+    matrix_row_t mask = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        mask |= (matrix_row_t)1 << (LATENCY_TEST_RIG_KEY_COL + i);
+    }
+    return mask;
+}
+
+/** Applies a new overlay; every change opens a fresh measurement window. */
+static void set_overlay(matrix_row_t new_overlay) {
+    if (new_overlay == overlay) {
+        return;
+    }
+    overlay = new_overlay;
+    gpio_write_pin_low(LATENCY_TEST_RIG_REPORT_PIN);
+    awaiting_report = true;
+}
+
+void latency_test_rig_init(void) {
+    gpio_set_pin_input_low(LATENCY_TEST_RIG_TRIGGER_PIN);
+    gpio_set_pin_output(LATENCY_TEST_RIG_REPORT_PIN);
+    gpio_write_pin_low(LATENCY_TEST_RIG_REPORT_PIN);
+}
+
+matrix_row_t latency_test_rig_row_overlay(uint8_t row) {
+    return (row == LATENCY_TEST_RIG_KEY_ROW) ? overlay : 0;
+}
+
+void latency_test_rig_task(void) {
+    const bool trigger = gpio_read_pin(LATENCY_TEST_RIG_TRIGGER_PIN);
+
+    switch (phase) {
+        case RIG_IDLE:
+            if (trigger) {
+                phase_timer = timer_read32();
+                if (LATENCY_TEST_RIG_PATTERN == LATENCY_TEST_RIG_PATTERN_CHORD) {
+                    set_overlay(keys_mask(pattern_key_count()));
+                    phase = RIG_HOLDING;
+                } else {
+                    step = 1;
+                    set_overlay(keys_mask(1));
+                    phase = (pattern_key_count() == 1) ? RIG_HOLDING : RIG_PRESSING;
+                }
+            }
+            break;
+
+        case RIG_PRESSING:
+            if (timer_elapsed32(phase_timer) >= LATENCY_TEST_RIG_ROLL_INTERVAL_MS) {
+                phase_timer = timer_read32();
+                set_overlay(keys_mask(++step));
+                if (step == pattern_key_count()) {
+                    phase = RIG_HOLDING;
+                }
+            }
+            break;
+
+        case RIG_HOLDING:
+            if (timer_elapsed32(phase_timer) >= LATENCY_TEST_RIG_HOLD_MS) {
+                phase_timer = timer_read32();
+                if (LATENCY_TEST_RIG_PATTERN == LATENCY_TEST_RIG_PATTERN_ROLL && pattern_key_count() > 1) {
+                    step = 1;
+                    set_overlay(keys_mask(pattern_key_count()) & ~keys_mask(1));
+                    phase = RIG_RELEASING;
+                } else {
+                    set_overlay(0);
+                    phase = RIG_REARM;
+                }
+            }
+            break;
+
+        case RIG_RELEASING:
+            if (timer_elapsed32(phase_timer) >= LATENCY_TEST_RIG_ROLL_INTERVAL_MS) {
+                phase_timer = timer_read32();
+                step++;
+                set_overlay(keys_mask(pattern_key_count()) & ~keys_mask(step));
+                if (step == pattern_key_count()) {
+                    phase = RIG_REARM;
+                }
+            }
+            break;
+
+        case RIG_REARM:
+            if (!trigger) {
+                phase = RIG_IDLE;
+            }
+            break;
+    }
+}
+
+void latency_test_rig_report_sent(void) {
+    if (awaiting_report) {
+        awaiting_report = false;
+        gpio_write_pin_high(LATENCY_TEST_RIG_REPORT_PIN);
+    }
+}
@@ -0,0 +1,96 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "matrix.h"
+
+/**
+ * \file
+ *
+ * \defgroup latency_test_rig Deterministic latency test rig
+ *
+ * Compile-time test-rig mode for unattended end-to-end latency measurement
+ * with external equipment. A rising edge on a designated trigger input pin
+ * starts a synthetic key event pattern that is injected into the rows seen
+ * by `matrix_task()`, and the firmware raises a report output pin once the
+ * resulting HID report has been handed to the host driver. A logic analyzer
+ * or scope across the two pins then captures the full in-firmware path —
+ * change detection, action processing, report build and driver hand-off —
+ * per injected transition, without anyone at the keyboard.
+ *
+ * Enable with `LATENCY_TEST_RIG_ENABLE = yes` in rules.mk and define the
+ * pins in config.h:
+ *
+ *     #define LATENCY_TEST_RIG_TRIGGER_PIN B0 // driven by the test equipment
+ *     #define LATENCY_TEST_RIG_REPORT_PIN B1  // observed by the test equipment
+ *
+ * Each injected transition lowers the report pin and the next report sent to
+ * the host raises it again, so every press and release step of a pattern
+ * yields its own measurable edge pair. The rig re-arms once the trigger pin
+ * returns low.
+ *
+ * Injected events bypass the matrix driver and debounce, so the measured
+ * interval deliberately excludes switch bounce and debounce latency; it
+ * isolates the firmware processing path. Run the rig on an otherwise idle
+ * keyboard so unrelated reports cannot raise the pin early.
+ */
+
+/** \brief Synthetic event patterns the rig can replay per trigger. */
+typedef enum latency_test_rig_pattern_t {
+    LATENCY_TEST_RIG_PATTERN_SINGLE, /**< One key pressed, held, released. */
+    LATENCY_TEST_RIG_PATTERN_ROLL,   /**< Keys pressed one per interval, then released in press order. */
+    LATENCY_TEST_RIG_PATTERN_CHORD,  /**< All keys pressed in one scan, held, released together. */
+} latency_test_rig_pattern_t;
+
+#ifndef LATENCY_TEST_RIG_PATTERN
+#    define LATENCY_TEST_RIG_PATTERN LATENCY_TEST_RIG_PATTERN_SINGLE
+#endif
+
+/** Matrix position of the first injected key. */
+#ifndef LATENCY_TEST_RIG_KEY_ROW
+#    define LATENCY_TEST_RIG_KEY_ROW 0
+#endif
+#ifndef LATENCY_TEST_RIG_KEY_COL
+#    define LATENCY_TEST_RIG_KEY_COL 0
+#endif
+
+/** Number of keys used by roll and chord patterns, in consecutive columns. */
+#ifndef LATENCY_TEST_RIG_KEY_COUNT
+#    define LATENCY_TEST_RIG_KEY_COUNT 4
+#endif
+
+/** Milliseconds between the steps of a roll. */
+#ifndef LATENCY_TEST_RIG_ROLL_INTERVAL_MS
+#    define LATENCY_TEST_RIG_ROLL_INTERVAL_MS 8
+#endif
+
+/** Milliseconds the fully pressed pattern is held before release. */
+#ifndef LATENCY_TEST_RIG_HOLD_MS
+#    define LATENCY_TEST_RIG_HOLD_MS 25
+#endif
+
+/** \brief Configures the trigger and report pins. Called by keyboard_init(). */
+void latency_test_rig_init(void);
+
+/**
+ * \brief Advances the pattern state machine.
+ *
+ * Called by keyboard_task() before the matrix is processed, so that new
+ * synthetic transitions are picked up in the same scan.
+ */
+void latency_test_rig_task(void);
+
+/** \brief Synthetic key bits to OR into `row` as seen by matrix_task(). */
+matrix_row_t latency_test_rig_row_overlay(uint8_t row);
+
+/**
+ * \brief Raises the report pin for the pending measurement, if any.
+ *
+ * Called from the host_*_send() paths after the report is handed to the
+ * host driver.
+ */
+void latency_test_rig_report_sent(void);
@@ -0,0 +1,70 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "latency_trace.h"
+#include "basic_profiling.h" // for TIMESTAMP_GETTER
+#include "print.h"
+
+static latency_trace_t traces[LATENCY_TRACE_COUNT];
+static uint8_t         trace_head  = 0; // next slot to write
+static uint8_t         trace_count = 0;
+
+static uint32_t open_trace_start = 0;
+static uint32_t open_trace_ticks[LATENCY_TRACE_STAGE_COUNT];
+static bool     trace_open = false;
+
+void latency_trace_stage(latency_trace_stage_t stage) {
+    uint32_t now = (uint32_t)TIMESTAMP_GETTER;
+
+    if (stage == LATENCY_TRACE_KEY_EVENT) {
+        // A key event before the previous report went out replaces the open
+        // trace; the dropped one would not be attributable anyway.
+        memset(open_trace_ticks, 0, sizeof(open_trace_ticks));
+        open_trace_start = now;
+        trace_open       = true;
+        return;
+    }
+
+    if (!trace_open) {
+        return; // report not caused by a traced key event
+    }
+
+    open_trace_ticks[stage] = now - open_trace_start;
+
+    if (stage == LATENCY_TRACE_REPORT_SENT) {
+        memcpy(traces[trace_head].stage_ticks, open_trace_ticks, sizeof(open_trace_ticks));
+        trace_head = (trace_head + 1) % LATENCY_TRACE_COUNT;
+        if (trace_count < LATENCY_TRACE_COUNT) {
+            trace_count++;
+        }
+        trace_open = false;
+    }
+}
+
+bool latency_trace_get(uint8_t index, latency_trace_t *trace) {
+    if (index >= trace_count) {
+        return false;
+    }
+    uint8_t slot = (uint8_t)((trace_head + LATENCY_TRACE_COUNT - 1 - index) % LATENCY_TRACE_COUNT);
+    *trace       = traces[slot];
+    return true;
+}
+
+uint8_t latency_trace_count(void) {
+    return trace_count;
+}
+
+void latency_trace_reset(void) {
+    trace_head  = 0;
+    trace_count = 0;
+    trace_open  = false;
+}
+
+void latency_trace_print(void) {
+    latency_trace_t trace;
+    for (uint8_t i = 0; latency_trace_get(i, &trace); i++) {
+        dprintf("trace %u: process_record=+%lu report_sent=+%lu ticks\n", i, (unsigned long)trace.stage_ticks[LATENCY_TRACE_PROCESS_RECORD], (unsigned long)trace.stage_ticks[LATENCY_TRACE_REPORT_SENT]);
+    }
+}
@@ -0,0 +1,61 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \defgroup latency_trace Scan-to-report latency tracing
+ *
+ * Attributes end-to-end latency between debounce acceptance of a key event
+ * and submission of the resulting HID report by timestamping fixed stages of
+ * the pipeline. The last \ref LATENCY_TRACE_COUNT traces are kept in a ring
+ * buffer and can be printed to console or serialized for raw HID.
+ *
+ * Enable with `LATENCY_TRACE_ENABLE = yes` in rules.mk. Timestamps use the
+ * raw timestamp counter from `basic_profiling.h`; values are deltas in ticks
+ * relative to the key-event stage.
+ */
+
+#ifndef LATENCY_TRACE_COUNT
+#    define LATENCY_TRACE_COUNT 16
+#endif
+
+/** \brief Pipeline stages recorded per trace, in order. */
+typedef enum latency_trace_stage_t {
+    LATENCY_TRACE_KEY_EVENT,      /**< Debounced key event accepted by matrix_task() */
+    LATENCY_TRACE_PROCESS_RECORD, /**< Event entered process_record() */
+    LATENCY_TRACE_REPORT_SENT,    /**< HID report handed to the host driver */
+    LATENCY_TRACE_STAGE_COUNT
+} latency_trace_stage_t;
+
+/** \brief One trace: tick deltas of each stage relative to the key event. */
+typedef struct latency_trace_t {
+    uint32_t stage_ticks[LATENCY_TRACE_STAGE_COUNT];
+} latency_trace_t;
+
+/**
+ * \brief Records a stage timestamp.
+ *
+ * \ref LATENCY_TRACE_KEY_EVENT opens a new trace; later stages accumulate
+ * into the open trace and \ref LATENCY_TRACE_REPORT_SENT closes it. Stages
+ * arriving without an open trace (e.g. reports caused by mousekeys) are
+ * ignored.
+ */
+void latency_trace_stage(latency_trace_stage_t stage);
+
+/** \brief Gets one of the last recorded traces; index 0 is the most recent. */
+bool latency_trace_get(uint8_t index, latency_trace_t *trace);
+
+/** \brief Number of completed traces currently held (up to LATENCY_TRACE_COUNT). */
+uint8_t latency_trace_count(void);
+
+/** \brief Clears all recorded traces. */
+void latency_trace_reset(void);
+
+/** \brief Prints the recorded traces to console, most recent first. */
+void latency_trace_print(void);
@@ -5,6 +5,14 @@
 #include "timer.h"
 #include "util.h"
 
+#ifdef DEFERRED_EXEC_ENABLE
+#    include "deferred_exec.h"
+#endif
+
+#ifdef LEADER_MAP_ENABLE
+#    include "keymap_introspection.h"
+#endif
+
 #include <string.h>
 
 #ifndef LEADER_TIMEOUT
@@ -17,6 +25,30 @@ uint16_t leader_time          = 0;
 uint16_t leader_sequence[5]   = {0, 0, 0, 0, 0};
 uint8_t  leader_sequence_size = 0;
 
+#ifdef LEADER_MAP_ENABLE
+// Index of the map entry completed by the sequence typed so far, or -1
+static int16_t leader_map_match = -1;
+#endif
+
+#ifdef DEFERRED_EXEC_ENABLE
+// With the deferred executor available, the sequence timeout is an exact
+// scheduled wake-up instead of a check on every main loop iteration.
+static deferred_token leader_timeout_token = INVALID_DEFERRED_TOKEN;
+
+static uint32_t leader_timeout_callback(uint32_t trigger_time, void *cb_arg) {
+    leader_timeout_token = INVALID_DEFERRED_TOKEN;
+    leader_task();
+    return 0;
+}
+
+// The timeout comparison is strict, so wake up one millisecond after it.
+static void leader_schedule_timeout(void) {
+    if (leader_timeout_token == INVALID_DEFERRED_TOKEN || !extend_deferred_exec(leader_timeout_token, LEADER_TIMEOUT + 1)) {
+        leader_timeout_token = defer_exec(LEADER_TIMEOUT + 1, leader_timeout_callback, NULL);
+    }
+}
+#endif
+
 __attribute__((weak)) void leader_start_user(void) {}
 
 __attribute__((weak)) void leader_end_user(void) {}
@@ -34,15 +66,79 @@ void leader_start(void) {
     leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+#if defined(DEFERRED_EXEC_ENABLE) && !defined(LEADER_NO_TIMEOUT)
+    // With LEADER_NO_TIMEOUT the timeout only starts counting from the first
+    // key of the sequence, scheduled from leader_reset_timer.
+    leader_schedule_timeout();
+#endif
+#ifdef LEADER_MAP_ENABLE
+    leader_map_match = -1;
+#endif
 }
 
 void leader_end(void) {
     leading = false;
+#ifdef DEFERRED_EXEC_ENABLE
+    if (leader_timeout_token != INVALID_DEFERRED_TOKEN) {
+        cancel_deferred_exec(leader_timeout_token);
+        leader_timeout_token = INVALID_DEFERRED_TOKEN;
+    }
+#endif
     leader_end_user();
 }
 
+#ifdef LEADER_MAP_ENABLE
+static void leader_map_fire(void) {
+    const leader_map_entry_t *entry = leader_map_entry_get(leader_map_match);
+
+    leader_map_match = -1;
+    leader_end();
+    entry->action();
+}
+
+// Narrow the leader map against the sequence buffer after each key: dispatch
+// immediately once the matched sequence has no longer continuation, and abort
+// as soon as no declared sequence starts with the current prefix, instead of
+// always waiting out LEADER_TIMEOUT.
+static void leader_map_advance(void) {
+    bool extendable = false;
+
+    leader_map_match = -1;
+    for (uint16_t i = 0; i < leader_map_count(); i++) {
+        const leader_map_entry_t *entry     = leader_map_entry_get(i);
+        bool                      is_prefix = true;
+        for (uint8_t j = 0; j < leader_sequence_size; j++) {
+            if (entry->sequence[j] != leader_sequence[j]) {
+                is_prefix = false;
+                break;
+            }
+        }
+        if (!is_prefix) {
+            continue;
+        }
+        if (leader_sequence_size == ARRAY_SIZE(leader_sequence) || entry->sequence[leader_sequence_size] == 0) {
+            leader_map_match = i;
+        } else {
+            extendable = true;
+        }
+    }
+
+    if (leader_map_match >= 0 && !extendable) {
+        leader_map_fire();
+    } else if (leader_map_match < 0 && !extendable) {
+        leader_end();
+    }
+}
+#endif // LEADER_MAP_ENABLE
+
 void leader_task(void) {
     if (leader_sequence_active() && leader_sequence_timed_out()) {
+#ifdef LEADER_MAP_ENABLE
+        if (leader_map_match >= 0) {
+            leader_map_fire();
+            return;
+        }
+#endif
         leader_end();
     }
 }
@@ -68,6 +164,11 @@ bool leader_sequence_add(uint16_t keycode) {
     if (leader_add_user(keycode)) {
         leader_end();
     }
+#ifdef LEADER_MAP_ENABLE
+    if (leading) {
+        leader_map_advance();
+    }
+#endif
     return true;
 }
 
@@ -81,6 +182,11 @@ bool leader_sequence_timed_out(void) {
 
 void leader_reset_timer(void) {
     leader_time = timer_read();
+#ifdef DEFERRED_EXEC_ENABLE
+    if (leader_sequence_active()) {
+        leader_schedule_timeout();
+    }
+#endif
 }
 
 bool leader_sequence_is(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
@@ -11,6 +11,22 @@
  * \{
  */
 
+/**
+ * \brief A single leader map entry: a sequence of up to five keycodes, padded
+ * with zeroes, and the function invoked when the sequence completes.
+ *
+ * Define `LEADER_MAP_ENABLE` and declare `const leader_map_entry_t leader_map[]
+ * PROGMEM` in the keymap to use the map instead of checking the sequence buffer in
+ * `leader_end_user()`. The map is matched incrementally against each key: a
+ * completed sequence with no longer continuation fires immediately, and the
+ * sequence is aborted as soon as no entry starts with the current prefix,
+ * instead of always waiting out `LEADER_TIMEOUT`.
+ */
+typedef struct leader_map_entry_t {
+    uint16_t sequence[5];
+    void (*action)(void);
+} leader_map_entry_t;
+
 /**
  * \brief User callback, invoked when the leader sequence begins.
  */
@@ -4,6 +4,55 @@
 
 typedef uint8_t (*reactive_f)(uint8_t val, uint16_t offset);
 
+#    ifdef LED_MATRIX_REACTIVE_FAST
+
+// Hit-driven runner: instead of scanning the hit tracker once per LED per
+// frame, the frame keeps its previous contents and only the LEDs named by a
+// recorded hit are recomputed, so single-key reactivity costs one effect
+// evaluation per live hit rather than one per LED. A full base repaint runs
+// when the effect (re)starts or val/speed/flags change under it, since those
+// invalidate every previously written value.
+bool effect_runner_reactive(effect_params_t* params, reactive_f effect_func) {
+    LED_MATRIX_USE_LIMITS(led_min, led_max);
+
+    static uint8_t last_val;
+    static uint8_t last_speed;
+    static uint8_t last_flags;
+    static bool    repaint = true;
+
+    if (led_min == 0) {
+        repaint    = params->init || last_val != led_matrix_eeconfig.val || last_speed != led_matrix_eeconfig.speed || last_flags != params->flags;
+        last_val   = led_matrix_eeconfig.val;
+        last_speed = led_matrix_eeconfig.speed;
+        last_flags = params->flags;
+    }
+
+    uint16_t max_tick = 65535 / led_matrix_eeconfig.speed;
+    if (repaint) {
+        uint8_t base = effect_func(led_matrix_eeconfig.val, scale16by8(max_tick, led_matrix_eeconfig.speed));
+        for (uint8_t i = led_min; i < led_max; i++) {
+            LED_MATRIX_TEST_LED_FLAGS();
+            led_matrix_set_value(i, base);
+        }
+    }
+
+    // Hits are appended in press order, so for an LED hit more than once the
+    // last write wins and matches the most recent hit, as the scanning runner
+    // picks. Expired hits keep rewriting the base value until the tracker
+    // recycles them, which is bounded by LED_HITS_TO_REMEMBER.
+    for (uint8_t j = 0; j < g_last_hit_tracker.count; j++) {
+        uint8_t i = g_last_hit_tracker.index[j];
+        if (i < led_min || i >= led_max) continue;
+        LED_MATRIX_TEST_LED_FLAGS();
+        uint16_t tick = g_last_hit_tracker.tick[j];
+        if (tick > max_tick) tick = max_tick;
+        led_matrix_set_value(i, effect_func(led_matrix_eeconfig.val, scale16by8(tick, led_matrix_eeconfig.speed)));
+    }
+    return led_matrix_check_finished_leds(led_max);
+}
+
+#    else
+
 bool effect_runner_reactive(effect_params_t* params, reactive_f effect_func) {
     LED_MATRIX_USE_LIMITS(led_min, led_max);
 
@@ -25,4 +74,6 @@ bool effect_runner_reactive(effect_params_t* params, reactive_f effect_func) {
     return led_matrix_check_finished_leds(led_max);
 }
 
+#    endif // LED_MATRIX_REACTIVE_FAST
+
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
@@ -12,9 +12,13 @@ bool effect_runner_reactive_splash(uint8_t start, effect_params_t* params, react
         LED_MATRIX_TEST_LED_FLAGS();
         uint8_t val = 0;
         for (uint8_t j = start; j < count; j++) {
-            int16_t  dx   = g_led_config.point[i].x - g_last_hit_tracker.x[j];
-            int16_t  dy   = g_led_config.point[i].y - g_last_hit_tracker.y[j];
-            uint8_t  dist = sqrt16(dx * dx + dy * dy);
+            int16_t dx = g_led_config.point[i].x - g_last_hit_tracker.x[j];
+            int16_t dy = g_led_config.point[i].y - g_last_hit_tracker.y[j];
+#    ifdef LED_MATRIX_DISTANCE_TABLE
+            uint8_t dist = led_matrix_led_distance(i, g_last_hit_tracker.index[j]);
+#    else
+            uint8_t dist = sqrt16(dx * dx + dy * dy);
+#    endif
             uint16_t tick = scale16by8(g_last_hit_tracker.tick[j], led_matrix_eeconfig.speed);
             val           = effect_func(val, dx, dy, dist, tick);
         }
@@ -283,44 +283,29 @@ static void led_task_start(void) {
     led_task_state = RENDERING;
 }
 
-static void led_task_render(uint8_t effect) {
-    bool rendering         = false;
-    led_effect_params.init = (effect != led_last_effect) || (led_matrix_eeconfig.enable != led_last_enable);
-    if (led_effect_params.flags != led_matrix_eeconfig.flags) {
-        led_effect_params.flags = led_matrix_eeconfig.flags;
-        led_matrix_set_value_all(0);
-    }
+typedef bool (*led_matrix_effect_fn_t)(effect_params_t *params);
 
-    // each effect can opt to do calculations
-    // and/or request PWM buffer updates.
-    switch (effect) {
-        case LED_MATRIX_NONE:
-            rendering = led_matrix_none(&led_effect_params);
-            break;
+// Dense dispatch table indexed by the led_matrix_effects enum, mirroring the
+// rgb_matrix render core. The entries line up because both are generated from
+// the same .inc includes, and only enabled effects occupy slots.
+// clang-format off
+static const led_matrix_effect_fn_t effect_funcs[LED_MATRIX_EFFECT_MAX] PROGMEM = {
+    [LED_MATRIX_NONE] = led_matrix_none,
 
 // ---------------------------------------------
-// -----Begin led effect switch case macros-----
-#define LED_MATRIX_EFFECT(name, ...)          \
-    case LED_MATRIX_##name:                   \
-        rendering = name(&led_effect_params); \
-        break;
+// -----Begin led effect table entry macros-----
+#define LED_MATRIX_EFFECT(name, ...) [LED_MATRIX_##name] = name,
 #include "led_matrix_effects.inc"
 #undef LED_MATRIX_EFFECT
 
 #ifdef COMMUNITY_MODULES_ENABLE
-#    define LED_MATRIX_EFFECT(name, ...)          \
-        case LED_MATRIX_COMMUNITY_MODULE_##name:  \
-            rendering = name(&led_effect_params); \
-            break;
+#    define LED_MATRIX_EFFECT(name, ...) [LED_MATRIX_COMMUNITY_MODULE_##name] = name,
 #    include "led_matrix_community_modules.inc"
 #    undef LED_MATRIX_EFFECT
 #endif
 
 #if defined(LED_MATRIX_CUSTOM_KB) || defined(LED_MATRIX_CUSTOM_USER)
-#    define LED_MATRIX_EFFECT(name, ...)          \
-        case LED_MATRIX_CUSTOM_##name:            \
-            rendering = name(&led_effect_params); \
-            break;
+#    define LED_MATRIX_EFFECT(name, ...) [LED_MATRIX_CUSTOM_##name] = name,
 #    ifdef LED_MATRIX_CUSTOM_KB
 #        include "led_matrix_kb.inc"
 #    endif
@@ -329,8 +314,23 @@ static void led_task_render(uint8_t effect) {
 #    endif
 #    undef LED_MATRIX_EFFECT
 #endif
-            // -----End led effect switch case macros-------
-            // ---------------------------------------------
+    // -----End led effect table entry macros-------
+    // ---------------------------------------------
+};
+// clang-format on
+
+static void led_task_render(uint8_t effect) {
+    bool rendering         = false;
+    led_effect_params.init = (effect != led_last_effect) || (led_matrix_eeconfig.enable != led_last_enable);
+    if (led_effect_params.flags != led_matrix_eeconfig.flags) {
+        led_effect_params.flags = led_matrix_eeconfig.flags;
+        led_matrix_set_value_all(0);
+    }
+
+    // each effect can opt to do calculations
+    // and/or request PWM buffer updates.
+    if (effect < LED_MATRIX_EFFECT_MAX) {
+        rendering = ((led_matrix_effect_fn_t)pgm_read_ptr(&effect_funcs[effect]))(&led_effect_params);
     }
 
     led_effect_params.iter++;
@@ -357,6 +357,16 @@ static void led_task_flush(uint8_t effect) {
     led_task_state = SYNCING;
 }
 
+static void led_task_render_step(uint8_t effect) {
+    led_task_render(effect);
+    if (effect) {
+        if (led_task_state == FLUSHING) {
+            led_matrix_indicators(); // ensure we only draw basic indicators once rendering is finished
+        }
+        led_matrix_indicators_advanced(&led_effect_params);
+    }
+}
+
 void led_matrix_task(void) {
     led_task_timers();
 
@@ -367,13 +377,16 @@ void led_matrix_task(void) {
             led_task_start();
             break;
         case RENDERING:
-            led_task_render(effect);
-            if (effect) {
-                if (led_task_state == FLUSHING) {
-                    led_matrix_indicators(); // ensure we only draw basic indicators once rendering is finished
-                }
-                led_matrix_indicators_advanced(&led_effect_params);
+            led_task_render_step(effect);
+#if defined(LED_MATRIX_RENDER_BUDGET_MS) && LED_MATRIX_RENDER_BUDGET_MS > 0
+            // Keep rendering further LED_MATRIX_LED_PROCESS_LIMIT slices of
+            // the frame while this invocation is within its time budget, so
+            // small slices no longer stretch a frame across many scan loops.
+            // The iter cursor inside led_effect_params carries across calls.
+            while (led_task_state == RENDERING && sync_timer_elapsed32(led_timer_buffer) < LED_MATRIX_RENDER_BUDGET_MS) {
+                led_task_render_step(effect);
             }
+#endif
             break;
         case FLUSHING:
             led_task_flush(effect);
@@ -452,10 +465,37 @@ struct led_matrix_limits_t led_matrix_get_limits(uint8_t iter) {
     return limits;
 }
 
+#if defined(LED_MATRIX_KEYREACTIVE_ENABLED) && defined(LED_MATRIX_DISTANCE_TABLE)
+// Pairwise LED distances from g_led_config.point[], computed once at init so
+// splash effects look distances up instead of taking a square root per LED per
+// hit per frame. Costs LED_MATRIX_LED_COUNT^2 bytes of RAM.
+static uint8_t led_distance_table[LED_MATRIX_LED_COUNT][LED_MATRIX_LED_COUNT];
+
+uint8_t led_matrix_led_distance(uint8_t a, uint8_t b) {
+    return led_distance_table[a][b];
+}
+
+static void led_matrix_build_distance_table(void) {
+    for (uint8_t i = 0; i < LED_MATRIX_LED_COUNT; i++) {
+        led_distance_table[i][i] = 0;
+        for (uint8_t j = i + 1; j < LED_MATRIX_LED_COUNT; j++) {
+            int16_t dx               = g_led_config.point[i].x - g_led_config.point[j].x;
+            int16_t dy               = g_led_config.point[i].y - g_led_config.point[j].y;
+            uint8_t dist             = sqrt16(dx * dx + dy * dy);
+            led_distance_table[i][j] = dist;
+            led_distance_table[j][i] = dist;
+        }
+    }
+}
+#endif // defined(LED_MATRIX_KEYREACTIVE_ENABLED) && defined(LED_MATRIX_DISTANCE_TABLE)
+
 void led_matrix_init(void) {
     led_matrix_driver.init();
 
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
+#    ifdef LED_MATRIX_DISTANCE_TABLE
+    led_matrix_build_distance_table();
+#    endif
     g_last_hit_tracker.count = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
         g_last_hit_tracker.tick[i] = UINT16_MAX;
@@ -148,6 +148,10 @@ bool led_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
 void led_matrix_init(void);
 
+#if defined(LED_MATRIX_KEYREACTIVE_ENABLED) && defined(LED_MATRIX_DISTANCE_TABLE)
+uint8_t led_matrix_led_distance(uint8_t a, uint8_t b);
+#endif
+
 void led_matrix_reload_from_eeprom(void);
 
 void        led_matrix_set_suspend_state(bool state);
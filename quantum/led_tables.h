@@ -21,3 +21,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef USE_CIE1931_CURVE
 extern const uint8_t CIE1931_CURVE[] PROGMEM;
 #endif
+
+#ifdef USE_GAMMA_CURVE
+extern const uint8_t GAMMA_CURVE[] PROGMEM;
+#endif
@@ -66,3 +66,33 @@ extern debug_config_t debug_config;
 #define dprint(s) dprintf(s)
 #define dprintln(s) dprintf(s "\r\n")
 #define dmsg(s) dprintf("%s at %d: %s\n", __FILE__, __LINE__, s)
+
+/*
+ * Per-module debug domains
+ *
+ * dprintf() is runtime-gated by debug_config.enable, but every call site and
+ * format string is compiled in whenever the console is. Domain-scoped
+ * variants are additionally elided at compile time unless their module's
+ * debug switch is defined, so a build can carry one module's diagnostics
+ * without paying flash and formatting cost for all the others. Error-level
+ * messages stay on plain dprintf(); only per-event chatter belongs in a
+ * domain. ACTION_DEBUG (ac_dprintf, action.h) and POINTING_DEVICE_DEBUG
+ * (pd_dprintf, pointing_device_internal.h) follow the same scheme at module
+ * level. On AVR the xprintf layer wraps format strings in PSTR(), so whatever
+ * is compiled in formats straight from flash either way.
+ */
+#ifdef SPLIT_DEBUG
+#    define sp_dprintf(...) dprintf(__VA_ARGS__)
+#else
+#    define sp_dprintf(...) \
+        do {                \
+        } while (0)
+#endif
+
+#ifdef RGB_DEBUG
+#    define rgb_dprintf(...) dprintf(__VA_ARGS__)
+#else
+#    define rgb_dprintf(...) \
+        do {                 \
+        } while (0)
+#endif
@@ -15,6 +15,7 @@
  */
 
 #include "keyboard.h"
+#include "timer.h"
 
 void platform_setup(void);
 
@@ -30,6 +31,21 @@ void protocol_keyboard_task(void) {
     keyboard_task();
 }
 
+static uint32_t pacing_overrun_count = 0;
+
+uint32_t main_loop_overrun_count(void) {
+    return pacing_overrun_count;
+}
+
+// How the pacing slack is burned is platform-dependent: the default spins,
+// which is all bare-metal builds can do, while RTOS-backed platforms override
+// this to sleep so lower-priority threads get the CPU during the gap. The
+// caller always spins out the final stretch against the timer, so the hook may
+// return early without hurting the tick edge.
+__attribute__((weak)) void main_loop_pacing_wait_us(uint32_t us) {
+    (void)us;
+}
+
 /** \brief Main
  *
  * FIXME: Needs doc
@@ -73,5 +89,34 @@ int main(void) {
 #endif // DEFERRED_EXEC_ENABLE
 
         housekeeping_task();
+
+#ifdef KEYBOARD_TASK_PACING_US
+        // Pace the main loop on a fixed microsecond cadence, so that each
+        // scan cycle - and any report it produces - lines up with the USB
+        // polling interval instead of landing at a data-dependent point
+        // within the frame.
+        static uint32_t cycle_start_us = 0;
+        static bool     cycle_started  = false;
+        if (!cycle_started) {
+            // First pass through the loop; anchor the cadence rather than
+            // treating the whole init sequence as an overrun.
+            cycle_started  = true;
+            cycle_start_us = timer_read_us();
+        }
+        uint32_t elapsed_us = timer_elapsed_us(cycle_start_us);
+        if (elapsed_us < KEYBOARD_TASK_PACING_US) {
+            // Hand the slack to the platform first so it can sleep instead of
+            // spinning, then spin out whatever remains for a precise edge.
+            main_loop_pacing_wait_us(KEYBOARD_TASK_PACING_US - elapsed_us);
+            while (timer_elapsed_us(cycle_start_us) < KEYBOARD_TASK_PACING_US) {
+            }
+            cycle_start_us += KEYBOARD_TASK_PACING_US;
+        } else {
+            // The cycle overran its deadline; restart the cadence from now
+            // instead of bursting to catch up, and record the miss.
+            pacing_overrun_count++;
+            cycle_start_us = timer_read_us();
+        }
+#endif // KEYBOARD_TASK_PACING_US
     }
 }
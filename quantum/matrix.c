@@ -20,7 +20,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "util.h"
 #include "matrix.h"
 #include "debounce.h"
+#ifdef DEBOUNCE_PROFILING
+#    include "debounce_profiling.h"
+#endif
 #include "atomic_util.h"
+#include "compiler_support.h"
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -47,6 +51,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define MATRIX_INPUT_PRESSED_STATE 0
 #endif
 
+#ifdef MATRIX_UNROLLED
+// Fully unroll the per-pin loops. The pin tables are constant on non-split
+// boards, so each unrolled iteration constant-folds down to an immediate
+// port/mask access instead of an indexed table load.
+#    define MATRIX_PIN_LOOP _Pragma("GCC unroll 64")
+#else
+#    define MATRIX_PIN_LOOP
+#endif
+
 #ifdef DIRECT_PINS
 static SPLIT_MUTABLE pin_t direct_pins[MATRIX_ROWS_PER_HAND][MATRIX_COLS] = DIRECT_PINS;
 #elif (DIODE_DIRECTION == ROW2COL) || (DIODE_DIRECTION == COL2ROW)
@@ -115,11 +128,87 @@ __attribute__((weak)) void matrix_init_pins(void) {
     }
 }
 
+#    ifdef MATRIX_READ_PORT_BATCHED
+
+// Port-batched reads: there is no row selection for direct pins, so each GPIO
+// port referenced by the matrix is sampled exactly once per scan and every
+// row is assembled from the same snapshots via precomputed per-key bit-gather
+// tables, giving O(ports) instead of O(keys) register accesses.
+
+#        ifndef MATRIX_PORT_COUNT_MAX
+#            define MATRIX_PORT_COUNT_MAX 8
+#        endif
+
+static port_id_t matrix_ports[MATRIX_PORT_COUNT_MAX];
+static uint8_t   matrix_port_count = 0;
+
+static uint8_t     key_port_index[MATRIX_ROWS_PER_HAND][MATRIX_COLS];
+static port_data_t key_port_bit[MATRIX_ROWS_PER_HAND][MATRIX_COLS];
+
+static void matrix_init_port_tables(void) {
+    matrix_port_count = 0;
+    for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            pin_t pin = direct_pins[row][col];
+            if (pin == NO_PIN) {
+                continue;
+            }
+
+            port_id_t port       = gpio_pin_to_port(pin);
+            uint8_t   port_index = 0;
+            while (port_index < matrix_port_count && matrix_ports[port_index] != port) {
+                port_index++;
+            }
+            if (port_index == matrix_port_count) {
+                if (matrix_port_count == MATRIX_PORT_COUNT_MAX) {
+                    // Too many distinct ports for the snapshot buffer; raise
+                    // MATRIX_PORT_COUNT_MAX in config.h if this ever triggers.
+                    continue;
+                }
+                matrix_ports[matrix_port_count++] = port;
+            }
+
+            key_port_index[row][col] = port_index;
+            key_port_bit[row][col]   = gpio_pin_to_port_bit(pin);
+        }
+    }
+}
+
+__attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row) {
+    static port_data_t port_snapshots[MATRIX_PORT_COUNT_MAX];
+
+    // All rows share the same snapshots; refresh them once per scan
+    if (current_row == 0) {
+        for (uint8_t port_index = 0; port_index < matrix_port_count; port_index++) {
+            port_snapshots[port_index] = gpio_read_port(matrix_ports[port_index]);
+        }
+    }
+
+    // Start with a clear matrix row
+    matrix_row_t current_row_value = 0;
+
+    matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+    MATRIX_PIN_LOOP
+    for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
+        if (direct_pins[current_row][col_index] == NO_PIN) {
+            continue;
+        }
+        uint8_t pin_state = (port_snapshots[key_port_index[current_row][col_index]] & key_port_bit[current_row][col_index]) ? 1 : 0;
+        current_row_value |= (pin_state == MATRIX_INPUT_PRESSED_STATE) ? row_shifter : 0;
+    }
+
+    // Update the matrix
+    current_matrix[current_row] = current_row_value;
+}
+
+#    else // MATRIX_READ_PORT_BATCHED
+
 __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row) {
     // Start with a clear matrix row
     matrix_row_t current_row_value = 0;
 
     matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+    MATRIX_PIN_LOOP
     for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
         pin_t pin = direct_pins[current_row][col_index];
         current_row_value |= readMatrixPin(pin) ? 0 : row_shifter;
@@ -129,6 +218,8 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     current_matrix[current_row] = current_row_value;
 }
 
+#    endif // MATRIX_READ_PORT_BATCHED
+
 #elif defined(DIODE_DIRECTION)
 #    if defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
 #        if (DIODE_DIRECTION == COL2ROW)
@@ -168,6 +259,86 @@ __attribute__((weak)) void matrix_init_pins(void) {
     }
 }
 
+#            ifdef MATRIX_READ_PORT_BATCHED
+
+// Port-batched reads: sample each GPIO port referenced by the column pins once
+// per row and demultiplex the column bits from the snapshots, instead of one
+// register access per pin. The per-column port/bit tables are precomputed by
+// matrix_init_port_tables() at init time.
+
+#                ifndef MATRIX_PORT_COUNT_MAX
+#                    define MATRIX_PORT_COUNT_MAX 8
+#                endif
+
+static port_id_t matrix_ports[MATRIX_PORT_COUNT_MAX];
+static uint8_t   matrix_port_count = 0;
+
+static uint8_t     col_port_index[MATRIX_COLS];
+static port_data_t col_port_bit[MATRIX_COLS];
+
+static void matrix_init_port_tables(void) {
+    matrix_port_count = 0;
+    for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++) {
+        pin_t pin = col_pins[col_index];
+        if (pin == NO_PIN) {
+            continue;
+        }
+
+        port_id_t port        = gpio_pin_to_port(pin);
+        uint8_t   port_index  = 0;
+        while (port_index < matrix_port_count && matrix_ports[port_index] != port) {
+            port_index++;
+        }
+        if (port_index == matrix_port_count) {
+            if (matrix_port_count == MATRIX_PORT_COUNT_MAX) {
+                // Too many distinct ports for the snapshot buffer; raise
+                // MATRIX_PORT_COUNT_MAX in config.h if this ever triggers.
+                continue;
+            }
+            matrix_ports[matrix_port_count++] = port;
+        }
+
+        col_port_index[col_index] = port_index;
+        col_port_bit[col_index]   = gpio_pin_to_port_bit(pin);
+    }
+}
+
+__attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row) {
+    // Start with a clear matrix row
+    matrix_row_t current_row_value = 0;
+
+    if (!select_row(current_row)) { // Select row
+        return;                     // skip NO_PIN row
+    }
+    matrix_output_select_delay();
+
+    // One register access per port instead of one per column
+    port_data_t port_snapshots[MATRIX_PORT_COUNT_MAX];
+    for (uint8_t port_index = 0; port_index < matrix_port_count; port_index++) {
+        port_snapshots[port_index] = gpio_read_port(matrix_ports[port_index]);
+    }
+
+    // Demultiplex the column bits from the port snapshots
+    matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+    MATRIX_PIN_LOOP
+    for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
+        if (col_pins[col_index] == NO_PIN) {
+            continue;
+        }
+        uint8_t pin_state = (port_snapshots[col_port_index[col_index]] & col_port_bit[col_index]) ? 1 : 0;
+        current_row_value |= (pin_state == MATRIX_INPUT_PRESSED_STATE) ? row_shifter : 0;
+    }
+
+    // Unselect row
+    unselect_row(current_row);
+    matrix_output_unselect_delay(current_row, current_row_value != 0); // wait for all Col signals to go HIGH
+
+    // Update the matrix
+    current_matrix[current_row] = current_row_value;
+}
+
+#            else // MATRIX_READ_PORT_BATCHED
+
 __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row) {
     // Start with a clear matrix row
     matrix_row_t current_row_value = 0;
@@ -179,6 +350,7 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
 
     // For each col...
     matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+    MATRIX_PIN_LOOP
     for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
         uint8_t pin_state = readMatrixPin(col_pins[col_index]);
 
@@ -194,7 +366,12 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     current_matrix[current_row] = current_row_value;
 }
 
+#            endif // MATRIX_READ_PORT_BATCHED
+
 #        elif (DIODE_DIRECTION == ROW2COL)
+#            ifdef MATRIX_READ_PORT_BATCHED
+#                error MATRIX_READ_MODE = port_batched is only supported with COL2ROW or DIRECT_PINS matrices
+#            endif
 
 static bool select_col(uint8_t col) {
     pin_t pin = col_pins[col];
@@ -241,6 +418,7 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
     matrix_output_select_delay();
 
     // For each row...
+    MATRIX_PIN_LOOP
     for (uint8_t row_index = 0; row_index < MATRIX_ROWS_PER_HAND; row_index++) {
         // Check row pin state
         if (readMatrixPin(row_pins[row_index]) == 0) {
@@ -299,6 +477,11 @@ void matrix_init(void) {
     // initialize key pins
     matrix_init_pins();
 
+#ifdef MATRIX_READ_PORT_BATCHED
+    // precompute the per-port demultiplexing tables
+    matrix_init_port_tables();
+#endif
+
     // initialize matrix state: all keys off
     memset(matrix, 0, sizeof(matrix));
     memset(raw_matrix, 0, sizeof(raw_matrix));
@@ -316,7 +499,7 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 }
 #endif
 
-uint8_t matrix_scan(void) {
+FAST_CODE uint8_t matrix_scan(void) {
     matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
 
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
@@ -335,6 +518,10 @@ uint8_t matrix_scan(void) {
     bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
 
+#ifdef DEBOUNCE_PROFILING
+    debounce_profiling_record(raw_matrix, changed);
+#endif
+
 #ifdef SPLIT_KEYBOARD
     changed = debounce(raw_matrix, matrix + thisHand, changed) | matrix_post_scan();
 #else
@@ -1,5 +1,8 @@
 #include "matrix.h"
 #include "debounce.h"
+#ifdef DEBOUNCE_PROFILING
+#    include "debounce_profiling.h"
+#endif
 #include "wait.h"
 #include "print.h"
 #include "debug.h"
@@ -164,6 +167,10 @@ __attribute__((weak)) void matrix_init(void) {
 __attribute__((weak)) uint8_t matrix_scan(void) {
     bool changed = matrix_scan_custom(raw_matrix);
 
+#ifdef DEBOUNCE_PROFILING
+    debounce_profiling_record(raw_matrix, changed);
+#endif
+
 #ifdef SPLIT_KEYBOARD
     changed = debounce(raw_matrix, matrix + thisHand, changed) | matrix_post_scan();
 #else
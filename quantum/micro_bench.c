@@ -0,0 +1,89 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "micro_bench.h"
+#include "basic_profiling.h" // for TIMESTAMP_GETTER
+#include "matrix.h"
+#include "eeprom.h"
+
+#if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
+#    include "color.h"
+#endif
+
+// Discourage the compiler from deleting a kernel whose result is unused.
+static volatile uint8_t bench_sink;
+
+static void run_matrix_scan(uint16_t iterations) {
+    for (uint16_t i = 0; i < iterations; i++) {
+        bench_sink = matrix_scan();
+    }
+}
+
+#if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
+static void run_hsv_to_rgb(uint16_t iterations) {
+    for (uint16_t i = 0; i < iterations; i++) {
+        rgb_t rgb  = hsv_to_rgb((hsv_t){(uint8_t)i, 255, 255});
+        bench_sink = rgb.r ^ rgb.g ^ rgb.b;
+    }
+}
+#endif
+
+static void run_eeprom_read(uint16_t iterations) {
+    for (uint16_t i = 0; i < iterations; i++) {
+        bench_sink = eeprom_read_byte((const uint8_t *)0);
+    }
+}
+
+bool micro_bench_run(micro_bench_kernel_t kernel, uint16_t iterations, micro_bench_result_t *result) {
+    result->total_ticks = 0;
+    result->iterations  = 0;
+
+    void (*run)(uint16_t) = NULL;
+    switch (kernel) {
+        case MICRO_BENCH_MATRIX_SCAN:
+            run = run_matrix_scan;
+            break;
+#if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
+        case MICRO_BENCH_HSV_TO_RGB:
+            run = run_hsv_to_rgb;
+            break;
+#endif
+        case MICRO_BENCH_EEPROM_READ:
+            run = run_eeprom_read;
+            break;
+        default:
+            break;
+    }
+    if (run == NULL || iterations == 0) {
+        return false;
+    }
+
+    uint32_t start = (uint32_t)TIMESTAMP_GETTER;
+    run(iterations);
+    result->total_ticks = (uint32_t)TIMESTAMP_GETTER - start;
+    result->iterations  = iterations;
+    return true;
+}
+
+bool micro_bench_raw_hid_report(micro_bench_kernel_t kernel, uint16_t iterations, uint8_t *data, uint8_t length) {
+    if (length < 7) {
+        return false;
+    }
+
+    micro_bench_result_t result;
+    if (!micro_bench_run(kernel, iterations, &result)) {
+        return false;
+    }
+
+    memset(data, 0, length);
+    data[0] = (uint8_t)kernel;
+    data[1] = (uint8_t)(result.iterations & 0xFF);
+    data[2] = (uint8_t)((result.iterations >> 8) & 0xFF);
+    data[3] = (uint8_t)(result.total_ticks & 0xFF);
+    data[4] = (uint8_t)((result.total_ticks >> 8) & 0xFF);
+    data[5] = (uint8_t)((result.total_ticks >> 16) & 0xFF);
+    data[6] = (uint8_t)((result.total_ticks >> 24) & 0xFF);
+    return true;
+}
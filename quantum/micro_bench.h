@@ -0,0 +1,57 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \defgroup micro_bench On-device microbenchmarks
+ *
+ * Runs small timed kernels on the keyboard itself and reports their cost in
+ * raw timestamp-counter ticks, so the same hot paths can be compared across
+ * controllers and across firmware builds without attaching a debugger.
+ *
+ * Enable with `MICRO_BENCH_ENABLE = yes` in rules.mk. Ticks come from the
+ * same clock as `basic_profiling.h` and \ref scan_histogram, so results are
+ * comparable between the three.
+ *
+ * To trigger a run over raw HID, call \ref micro_bench_raw_hid_report from
+ * your `raw_hid_receive()` implementation and send the resulting buffer back
+ * with `raw_hid_send()`. Kernels run synchronously and block the main loop
+ * for the duration of the run, so keep iteration counts modest.
+ */
+
+/** \brief Available kernels. Kernels for disabled features report no data. */
+typedef enum micro_bench_kernel_t {
+    MICRO_BENCH_MATRIX_SCAN, /**< One matrix_scan() call, including debounce */
+    MICRO_BENCH_HSV_TO_RGB,  /**< One hsv_to_rgb() conversion (RGB features only) */
+    MICRO_BENCH_EEPROM_READ, /**< One eeprom_read_byte() of the eeconfig magic */
+    MICRO_BENCH_KERNEL_COUNT
+} micro_bench_kernel_t;
+
+/** \brief Result of one benchmark run. */
+typedef struct micro_bench_result_t {
+    uint32_t total_ticks; /**< Summed duration of all iterations */
+    uint16_t iterations;  /**< Iterations actually executed, 0 if the kernel is unavailable */
+} micro_bench_result_t;
+
+/**
+ * \brief Runs one kernel for the given number of iterations.
+ *
+ * \return false if the kernel is out of range or unavailable in this build.
+ */
+bool micro_bench_run(micro_bench_kernel_t kernel, uint16_t iterations, micro_bench_result_t *result);
+
+/**
+ * \brief Runs one kernel and serializes the result into a raw HID response buffer.
+ *
+ * Layout: `data[0]` = kernel, `data[1..2]` = iterations as little-endian
+ * uint16_t, `data[3..6]` = total ticks as little-endian uint32_t.
+ *
+ * \return false if the kernel is unavailable or the buffer is too short.
+ */
+bool micro_bench_raw_hid_report(micro_bench_kernel_t kernel, uint16_t iterations, uint8_t *data, uint8_t length);
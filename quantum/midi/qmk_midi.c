@@ -10,6 +10,10 @@
 #    include <math.h>
 #endif
 
+#ifdef SEQUENCER_ENABLE
+#    include "sequencer.h"
+#endif
+
 /*******************************************************************************
  * MIDI
  ******************************************************************************/
@@ -103,6 +107,11 @@ static void usb_get_midi(MidiDevice* device) {
     }
 }
 
+/* no-op by default; protocol implementations that batch outgoing events into
+ * endpoint-sized packets override this to push out any partially filled batch
+ * once per scan (LUFA already flushes its endpoint bank in its USB task) */
+__attribute__((weak)) void flush_midi_packets(void) {}
+
 static void fallthrough_callback(MidiDevice* device, uint16_t cnt, uint8_t byte0, uint8_t byte1, uint8_t byte2) {
 #ifdef AUDIO_ENABLE
     if (cnt == 3) {
@@ -121,6 +130,25 @@ static void fallthrough_callback(MidiDevice* device, uint16_t cnt, uint8_t byte0
 #endif
 }
 
+#ifdef SEQUENCER_ENABLE
+static void realtime_callback(MidiDevice* device, uint8_t interface_byte) {
+    switch (interface_byte) {
+        case MIDI_CLOCK:
+            sequencer_midi_clock_tick();
+            break;
+        case MIDI_START:
+            sequencer_midi_clock_start();
+            break;
+        case MIDI_CONTINUE:
+            sequencer_midi_clock_continue();
+            break;
+        case MIDI_STOP:
+            sequencer_midi_clock_stop();
+            break;
+    }
+}
+#endif
+
 static void cc_callback(MidiDevice* device, uint8_t chan, uint8_t num, uint8_t val) {
     // sending it back on the next channel
     // midi_send_cc(device, (chan + 1) % 16, num, val);
@@ -137,4 +165,7 @@ void setup_midi(void) {
     midi_device_set_pre_input_process_func(&midi_device, usb_get_midi);
     midi_register_fallthrough_callback(&midi_device, fallthrough_callback);
     midi_register_cc_callback(&midi_device, cc_callback);
+#ifdef SEQUENCER_ENABLE
+    midi_register_realtime_callback(&midi_device, realtime_callback);
+#endif
 }
@@ -7,4 +7,5 @@ extern MidiDevice midi_device;
 void              setup_midi(void);
 void              send_midi_packet(MIDI_EventPacket_t* event);
 bool              recv_midi_packet(MIDI_EventPacket_t* const event);
+void              flush_midi_packets(void);
 #endif
@@ -58,6 +58,20 @@ static uint16_t mouse_timer = 0;
 static uint16_t last_timer_c = 0;
 static uint16_t last_timer_w = 0;
 
+#    ifndef MOUSEKEY_INERTIA
+/* 8.8 fixed-point fractional cursor motion carried between task invocations,
+ * and the time accumulated towards the next acceleration curve step */
+static uint16_t move_frac_x = 0;
+static uint16_t move_frac_y = 0;
+static uint16_t repeat_frac = 0;
+#        ifndef MK_KINETIC_SPEED
+/* per-interval movement unit, cached against the curve position and
+ * acceleration modifiers that determine it */
+static uint8_t  move_unit_cache     = 0;
+static uint16_t move_unit_cache_key = UINT16_MAX;
+#        endif
+#    endif
+
 /*
  * Mouse keys acceleration algorithm
  *  http://en.wikipedia.org/wiki/Mouse_keys
@@ -339,21 +353,92 @@ void mousekey_task(void) {
 
 #    else // default acceleration
 
-    if ((tmpmr.x || tmpmr.y) && timer_elapsed(last_timer_c) > (mousekey_repeat ? mk_interval : mk_delay * 10)) {
-        if (mousekey_repeat != UINT8_MAX) mousekey_repeat++;
-        if (tmpmr.x != 0) mouse_report.x = move_unit() * ((tmpmr.x > 0) ? 1 : -1);
-        if (tmpmr.y != 0) mouse_report.y = move_unit() * ((tmpmr.y > 0) ? 1 : -1);
+    if (tmpmr.x || tmpmr.y) {
+        uint16_t now     = timer_read();
+        uint16_t elapsed = TIMER_DIFF_16(now, last_timer_c);
+        if (mousekey_repeat == 0) {
+            /* initial delay before the first repeated motion event */
+            if (elapsed > mk_delay * 10) {
+                mousekey_repeat = 1;
+                if (tmpmr.x != 0) mouse_report.x = move_unit() * ((tmpmr.x > 0) ? 1 : -1);
+                if (tmpmr.y != 0) mouse_report.y = move_unit() * ((tmpmr.y > 0) ? 1 : -1);
+
+                /* diagonal move [1/sqrt(2)] */
+                if (mouse_report.x && mouse_report.y) {
+                    mouse_report.x = times_inv_sqrt2(mouse_report.x);
+                    if (mouse_report.x == 0) {
+                        mouse_report.x = 1;
+                    }
+                    mouse_report.y = times_inv_sqrt2(mouse_report.y);
+                    if (mouse_report.y == 0) {
+                        mouse_report.y = 1;
+                    }
+                }
+                move_frac_x = 0;
+                move_frac_y = 0;
+                repeat_frac = 0;
+            }
+        } else if (elapsed) {
+            /* Advance the acceleration curve by the time actually elapsed
+             * instead of once per emitted event. */
+            repeat_frac += elapsed;
+            while (repeat_frac >= mk_interval) {
+                repeat_frac -= mk_interval;
+                if (mousekey_repeat != UINT8_MAX) mousekey_repeat++;
+            }
 
-        /* diagonal move [1/sqrt(2)] */
-        if (mouse_report.x && mouse_report.y) {
-            mouse_report.x = times_inv_sqrt2(mouse_report.x);
-            if (mouse_report.x == 0) {
-                mouse_report.x = 1;
+            /* The per-interval unit only changes when the curve advances or an
+             * acceleration modifier is toggled, so cache it instead of redoing
+             * the division on every scan. Kinetic mode derives the unit from
+             * the elapsed time itself and cannot be cached. */
+#        ifdef MK_KINETIC_SPEED
+            uint16_t unit = move_unit();
+#        else
+            uint16_t key = ((uint16_t)mousekey_accel << 8) | mousekey_repeat;
+            if (key != move_unit_cache_key) {
+                move_unit_cache_key = key;
+                move_unit_cache     = move_unit();
+            }
+            uint16_t unit = move_unit_cache;
+#        endif
+
+            /* diagonal move [1/sqrt(2)] */
+            if (tmpmr.x && tmpmr.y) {
+                unit = times_inv_sqrt2(unit > INT8_MAX ? INT8_MAX : unit);
+                if (unit == 0) {
+                    unit = 1;
+                }
+            }
+
+            /* Emit motion proportional to the elapsed time in 8.8 fixed point,
+             * carrying the remainder, so a late task invocation produces a
+             * proportionally larger delta instead of dropped motion. This is
+             * what keeps the average velocity stable under main-loop jitter
+             * and lets fast scan loops move the cursor every millisecond. */
+            if (tmpmr.x) {
+                uint32_t total = move_frac_x + ((uint32_t)unit * elapsed * 256) / mk_interval;
+                uint16_t step  = total >> 8;
+                if (step > MOUSEKEY_MOVE_MAX) {
+                    step  = MOUSEKEY_MOVE_MAX;
+                    total = (uint32_t)MOUSEKEY_MOVE_MAX << 8;
+                }
+                move_frac_x    = total - ((uint32_t)step << 8);
+                mouse_report.x = (tmpmr.x > 0) ? step : -step;
             }
-            mouse_report.y = times_inv_sqrt2(mouse_report.y);
-            if (mouse_report.y == 0) {
-                mouse_report.y = 1;
+            if (tmpmr.y) {
+                uint32_t total = move_frac_y + ((uint32_t)unit * elapsed * 256) / mk_interval;
+                uint16_t step  = total >> 8;
+                if (step > MOUSEKEY_MOVE_MAX) {
+                    step  = MOUSEKEY_MOVE_MAX;
+                    total = (uint32_t)MOUSEKEY_MOVE_MAX << 8;
+                }
+                move_frac_y    = total - ((uint32_t)step << 8);
+                mouse_report.y = (tmpmr.y > 0) ? step : -step;
             }
+            /* The fractional remainders already account for this scan, so the
+             * reference timestamp moves regardless of whether a whole pixel
+             * was emitted. */
+            last_timer_c = now;
         }
     }
 
@@ -45,40 +45,150 @@
 #    include "connection.h"
 #endif
 
+/* RAM shadow of the core eeconfig block.
+ *
+ * Reads of core fields are served from this copy and updates are coalesced
+ * into it with per-byte dirty tracking; the EEPROM itself is only written
+ * from nvm_eeconfig_flush(). A burst of interactive changes - e.g. VIA
+ * dragging an RGB slider - thus collapses into one flush of the bytes that
+ * actually changed, instead of one blocking write cycle per step. The
+ * kb/user datablocks are not shadowed; they are bulk-written and rare.
+ */
+static eeprom_core_t core_shadow;
+static uint64_t      core_dirty  = 0;
+static bool          core_loaded = false;
+
+STATIC_ASSERT(sizeof(eeprom_core_t) <= 64, "eeprom_core_t must fit the per-byte dirty bitmask");
+
+static void core_shadow_load(void) {
+    if (!core_loaded) {
+        eeprom_read_block(&core_shadow, (const void *)0, sizeof(core_shadow));
+        core_dirty  = 0;
+        core_loaded = true;
+    }
+}
+
+// The EECONFIG_* "addresses" are offsets into eeprom_core_t cast to pointers,
+// so they double as offsets into the shadow.
+static void core_shadow_read(void *data, const void *addr, size_t len) {
+    core_shadow_load();
+    memcpy(data, (const uint8_t *)&core_shadow + (uintptr_t)addr, len);
+}
+
+static void core_shadow_update(const void *data, void *addr, size_t len) {
+    core_shadow_load();
+    uintptr_t offset = (uintptr_t)addr;
+    if (memcmp((uint8_t *)&core_shadow + offset, data, len) != 0) {
+        memcpy((uint8_t *)&core_shadow + offset, data, len);
+        for (size_t i = 0; i < len; i++) {
+            core_dirty |= (uint64_t)1 << (offset + i);
+        }
+    }
+}
+
+static uint8_t core_shadow_read_byte(const void *addr) {
+    uint8_t val;
+    core_shadow_read(&val, addr, sizeof(val));
+    return val;
+}
+
+static uint16_t core_shadow_read_word(const void *addr) {
+    uint16_t val;
+    core_shadow_read(&val, addr, sizeof(val));
+    return val;
+}
+
+static uint32_t core_shadow_read_dword(const void *addr) {
+    uint32_t val;
+    core_shadow_read(&val, addr, sizeof(val));
+    return val;
+}
+
+static void core_shadow_update_byte(void *addr, uint8_t val) {
+    core_shadow_update(&val, addr, sizeof(val));
+}
+
+static void core_shadow_update_word(void *addr, uint16_t val) {
+    core_shadow_update(&val, addr, sizeof(val));
+}
+
+static void core_shadow_update_dword(void *addr, uint32_t val) {
+    core_shadow_update(&val, addr, sizeof(val));
+}
+
+void nvm_eeconfig_flush(void) {
+    if (!core_loaded || core_dirty == 0) {
+        return;
+    }
+
+    // Write out each contiguous dirty run in a single block update;
+    // eeprom_update_block performs its own compare-before-write per byte.
+    uint8_t offset = 0;
+    while (offset < sizeof(eeprom_core_t)) {
+        if (!(core_dirty & ((uint64_t)1 << offset))) {
+            offset++;
+            continue;
+        }
+        uint8_t end = offset;
+        while (end < sizeof(eeprom_core_t) && (core_dirty & ((uint64_t)1 << end))) {
+            end++;
+        }
+        eeprom_update_block((const uint8_t *)&core_shadow + offset, (void *)(uintptr_t)offset, end - offset);
+        offset = end;
+    }
+
+    core_dirty = 0;
+}
+
+bool nvm_eeconfig_has_pending_write(void) {
+    return core_dirty != 0;
+}
+
 void nvm_eeconfig_erase(void) {
 #ifdef EEPROM_DRIVER
     eeprom_driver_format(false);
 #endif // EEPROM_DRIVER
+
+    // The backing store was reset behind the shadow's back; reload it before
+    // the next access instead of flushing stale data over the formatted area.
+    core_loaded = false;
+    core_dirty  = 0;
 }
 
 bool nvm_eeconfig_is_enabled(void) {
-    return eeprom_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER;
+    return core_shadow_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER;
 }
 
 bool nvm_eeconfig_is_disabled(void) {
-    return eeprom_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER_OFF;
+    return core_shadow_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER_OFF;
 }
 
 void nvm_eeconfig_enable(void) {
-    eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
+    core_shadow_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
+    // The magic decides whether the whole config is trusted on the next
+    // boot - commit it immediately rather than deferring.
+    nvm_eeconfig_flush();
 }
 
 void nvm_eeconfig_disable(void) {
 #if defined(EEPROM_DRIVER)
     eeprom_driver_format(false);
 #endif
-    eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
+    core_loaded = false;
+    core_dirty  = 0;
+    core_shadow_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
+    nvm_eeconfig_flush();
 }
 
 void nvm_eeconfig_read_debug(debug_config_t *debug_config) {
-    debug_config->raw = eeprom_read_byte(EECONFIG_DEBUG);
+    debug_config->raw = core_shadow_read_byte(EECONFIG_DEBUG);
 }
 void nvm_eeconfig_update_debug(const debug_config_t *debug_config) {
-    eeprom_update_byte(EECONFIG_DEBUG, debug_config->raw);
+    core_shadow_update_byte(EECONFIG_DEBUG, debug_config->raw);
 }
 
 layer_state_t nvm_eeconfig_read_default_layer(void) {
-    uint8_t val = eeprom_read_byte(EECONFIG_DEFAULT_LAYER);
+    uint8_t val = core_shadow_read_byte(EECONFIG_DEFAULT_LAYER);
 #ifdef DEFAULT_LAYER_STATE_IS_VALUE_NOT_BITMASK
     // stored as a layer number, so convert back to bitmask
     return (layer_state_t)1 << val;
@@ -95,49 +205,49 @@ void nvm_eeconfig_update_default_layer(layer_state_t state) {
     // stored as 8-bit-wide bitmask, so write the value directly - handling truncation from 16/32 bit layer_state_t
     uint8_t val = (uint8_t)state;
 #endif
-    eeprom_update_byte(EECONFIG_DEFAULT_LAYER, val);
+    core_shadow_update_byte(EECONFIG_DEFAULT_LAYER, val);
 }
 
 void nvm_eeconfig_read_keymap(keymap_config_t *keymap_config) {
-    keymap_config->raw = eeprom_read_word(EECONFIG_KEYMAP);
+    keymap_config->raw = core_shadow_read_word(EECONFIG_KEYMAP);
 }
 void nvm_eeconfig_update_keymap(const keymap_config_t *keymap_config) {
-    eeprom_update_word(EECONFIG_KEYMAP, keymap_config->raw);
+    core_shadow_update_word(EECONFIG_KEYMAP, keymap_config->raw);
 }
 
 #ifdef AUDIO_ENABLE
 void nvm_eeconfig_read_audio(audio_config_t *audio_config) {
-    audio_config->raw = eeprom_read_byte(EECONFIG_AUDIO);
+    audio_config->raw = core_shadow_read_byte(EECONFIG_AUDIO);
 }
 void nvm_eeconfig_update_audio(const audio_config_t *audio_config) {
-    eeprom_update_byte(EECONFIG_AUDIO, audio_config->raw);
+    core_shadow_update_byte(EECONFIG_AUDIO, audio_config->raw);
 }
 #endif // AUDIO_ENABLE
 
 #ifdef UNICODE_COMMON_ENABLE
 void nvm_eeconfig_read_unicode_mode(unicode_config_t *unicode_config) {
-    unicode_config->raw = eeprom_read_byte(EECONFIG_UNICODEMODE);
+    unicode_config->raw = core_shadow_read_byte(EECONFIG_UNICODEMODE);
 }
 void nvm_eeconfig_update_unicode_mode(const unicode_config_t *unicode_config) {
-    eeprom_update_byte(EECONFIG_UNICODEMODE, unicode_config->raw);
+    core_shadow_update_byte(EECONFIG_UNICODEMODE, unicode_config->raw);
 }
 #endif // UNICODE_COMMON_ENABLE
 
 #ifdef BACKLIGHT_ENABLE
 void nvm_eeconfig_read_backlight(backlight_config_t *backlight_config) {
-    backlight_config->raw = eeprom_read_byte(EECONFIG_BACKLIGHT);
+    backlight_config->raw = core_shadow_read_byte(EECONFIG_BACKLIGHT);
 }
 void nvm_eeconfig_update_backlight(const backlight_config_t *backlight_config) {
-    eeprom_update_byte(EECONFIG_BACKLIGHT, backlight_config->raw);
+    core_shadow_update_byte(EECONFIG_BACKLIGHT, backlight_config->raw);
 }
 #endif // BACKLIGHT_ENABLE
 
 #ifdef STENO_ENABLE
 uint8_t nvm_eeconfig_read_steno_mode(void) {
-    return eeprom_read_byte(EECONFIG_STENOMODE);
+    return core_shadow_read_byte(EECONFIG_STENOMODE);
 }
 void nvm_eeconfig_update_steno_mode(uint8_t val) {
-    eeprom_update_byte(EECONFIG_STENOMODE, val);
+    core_shadow_update_byte(EECONFIG_STENOMODE, val);
 }
 #endif // STENO_ENABLE
 
@@ -146,80 +256,113 @@ void nvm_eeconfig_update_steno_mode(uint8_t val) {
 
 #ifdef RGB_MATRIX_ENABLE
 void nvm_eeconfig_read_rgb_matrix(rgb_config_t *rgb_matrix_config) {
-    eeprom_read_block(rgb_matrix_config, EECONFIG_RGB_MATRIX, sizeof(rgb_config_t));
+    core_shadow_read(rgb_matrix_config, EECONFIG_RGB_MATRIX, sizeof(rgb_config_t));
 }
 void nvm_eeconfig_update_rgb_matrix(const rgb_config_t *rgb_matrix_config) {
-    eeprom_update_block(rgb_matrix_config, EECONFIG_RGB_MATRIX, sizeof(rgb_config_t));
+    core_shadow_update(rgb_matrix_config, EECONFIG_RGB_MATRIX, sizeof(rgb_config_t));
 }
 #endif // RGB_MATRIX_ENABLE
 
 #ifdef LED_MATRIX_ENABLE
 void nvm_eeconfig_read_led_matrix(led_eeconfig_t *led_matrix_config) {
-    eeprom_read_block(led_matrix_config, EECONFIG_LED_MATRIX, sizeof(led_eeconfig_t));
+    core_shadow_read(led_matrix_config, EECONFIG_LED_MATRIX, sizeof(led_eeconfig_t));
 }
 void nvm_eeconfig_update_led_matrix(const led_eeconfig_t *led_matrix_config) {
-    eeprom_update_block(led_matrix_config, EECONFIG_LED_MATRIX, sizeof(led_eeconfig_t));
+    core_shadow_update(led_matrix_config, EECONFIG_LED_MATRIX, sizeof(led_eeconfig_t));
 }
 #endif // LED_MATRIX_ENABLE
 
 #ifdef RGBLIGHT_ENABLE
 void nvm_eeconfig_read_rgblight(rgblight_config_t *rgblight_config) {
-    rgblight_config->raw = eeprom_read_dword(EECONFIG_RGBLIGHT);
-    rgblight_config->raw |= ((uint64_t)eeprom_read_byte(EECONFIG_RGBLIGHT_EXTENDED) << 32);
+    rgblight_config->raw = core_shadow_read_dword(EECONFIG_RGBLIGHT);
+    rgblight_config->raw |= ((uint64_t)core_shadow_read_byte(EECONFIG_RGBLIGHT_EXTENDED) << 32);
 }
 void nvm_eeconfig_update_rgblight(const rgblight_config_t *rgblight_config) {
-    eeprom_update_dword(EECONFIG_RGBLIGHT, rgblight_config->raw & 0xFFFFFFFF);
-    eeprom_update_byte(EECONFIG_RGBLIGHT_EXTENDED, (rgblight_config->raw >> 32) & 0xFF);
+    core_shadow_update_dword(EECONFIG_RGBLIGHT, rgblight_config->raw & 0xFFFFFFFF);
+    core_shadow_update_byte(EECONFIG_RGBLIGHT_EXTENDED, (rgblight_config->raw >> 32) & 0xFF);
 }
 #endif // RGBLIGHT_ENABLE
 
 #if (EECONFIG_KB_DATA_SIZE) == 0
 uint32_t nvm_eeconfig_read_kb(void) {
-    return eeprom_read_dword(EECONFIG_KEYBOARD);
+    return core_shadow_read_dword(EECONFIG_KEYBOARD);
 }
 void nvm_eeconfig_update_kb(uint32_t val) {
-    eeprom_update_dword(EECONFIG_KEYBOARD, val);
+    core_shadow_update_dword(EECONFIG_KEYBOARD, val);
 }
 #endif // (EECONFIG_KB_DATA_SIZE) == 0
 
 #if (EECONFIG_USER_DATA_SIZE) == 0
 uint32_t nvm_eeconfig_read_user(void) {
-    return eeprom_read_dword(EECONFIG_USER);
+    return core_shadow_read_dword(EECONFIG_USER);
 }
 void nvm_eeconfig_update_user(uint32_t val) {
-    eeprom_update_dword(EECONFIG_USER, val);
+    core_shadow_update_dword(EECONFIG_USER, val);
 }
 #endif // (EECONFIG_USER_DATA_SIZE) == 0
 
 #ifdef HAPTIC_ENABLE
 void nvm_eeconfig_read_haptic(haptic_config_t *haptic_config) {
-    haptic_config->raw = eeprom_read_dword(EECONFIG_HAPTIC);
+    haptic_config->raw = core_shadow_read_dword(EECONFIG_HAPTIC);
 }
 void nvm_eeconfig_update_haptic(const haptic_config_t *haptic_config) {
-    eeprom_update_dword(EECONFIG_HAPTIC, haptic_config->raw);
+    core_shadow_update_dword(EECONFIG_HAPTIC, haptic_config->raw);
 }
 #endif // HAPTIC_ENABLE
 
 #ifdef CONNECTION_ENABLE
 void nvm_eeconfig_read_connection(connection_config_t *config) {
-    config->raw = eeprom_read_byte(EECONFIG_CONNECTION);
+    config->raw = core_shadow_read_byte(EECONFIG_CONNECTION);
 }
 void nvm_eeconfig_update_connection(const connection_config_t *config) {
-    eeprom_update_byte(EECONFIG_CONNECTION, config->raw);
+    core_shadow_update_byte(EECONFIG_CONNECTION, config->raw);
 }
 #endif // CONNECTION_ENABLE
 
 bool nvm_eeconfig_read_handedness(void) {
-    return !!eeprom_read_byte(EECONFIG_HANDEDNESS);
+    // Only bit 0 holds the handedness; the upper bits carry the split-role
+    // cache below and must not bleed into the result.
+    return !!(core_shadow_read_byte(EECONFIG_HANDEDNESS) & 0x01);
 }
 void nvm_eeconfig_update_handedness(bool val) {
-    eeprom_update_byte(EECONFIG_HANDEDNESS, !!val);
+    core_shadow_update_byte(EECONFIG_HANDEDNESS, !!val);
+}
+
+// The handedness byte only ever holds 0 or 1, so its upper bits are free to
+// cache the last-known split role without growing the core block: bit 1
+// flags the cache as valid, bit 2 holds the role. A handedness update
+// rewrites the whole byte, which merely invalidates the cache and makes the
+// next boot fall back to full role detection.
+#define SPLIT_ROLE_CACHE_VALID 0x02
+#define SPLIT_ROLE_CACHE_MASTER 0x04
+
+bool nvm_eeconfig_read_split_role(bool *is_master) {
+    const uint8_t value = core_shadow_read_byte(EECONFIG_HANDEDNESS);
+    if (!(value & SPLIT_ROLE_CACHE_VALID)) {
+        return false;
+    }
+    *is_master = !!(value & SPLIT_ROLE_CACHE_MASTER);
+    return true;
+}
+void nvm_eeconfig_update_split_role(bool is_master) {
+    uint8_t value = core_shadow_read_byte(EECONFIG_HANDEDNESS) & 0x01;
+    value |= SPLIT_ROLE_CACHE_VALID | (is_master ? SPLIT_ROLE_CACHE_MASTER : 0);
+    core_shadow_update_byte(EECONFIG_HANDEDNESS, value);
 }
 
 #if (EECONFIG_KB_DATA_SIZE) > 0
 
 bool nvm_eeconfig_is_kb_datablock_valid(void) {
-    return eeprom_read_dword(EECONFIG_KEYBOARD) == (EECONFIG_KB_DATA_VERSION);
+    return core_shadow_read_dword(EECONFIG_KEYBOARD) == (EECONFIG_KB_DATA_VERSION);
+}
+
+uint32_t nvm_eeconfig_kb_datablock_version(void) {
+    return core_shadow_read_dword(EECONFIG_KEYBOARD);
+}
+
+void nvm_eeconfig_read_kb_datablock_raw(void *data, uint32_t length) {
+    // Unconditional read of the stored bytes, regardless of the version stamp - used for schema migration
+    eeprom_read_block(data, (void *)(uintptr_t)(EECONFIG_KB_DATABLOCK), MIN(EECONFIG_KB_DATA_SIZE, length));
 }
 
 uint32_t nvm_eeconfig_read_kb_datablock(void *data, uint32_t offset, uint32_t length) {
@@ -235,7 +378,7 @@ uint32_t nvm_eeconfig_read_kb_datablock(void *data, uint32_t offset, uint32_t le
 }
 
 uint32_t nvm_eeconfig_update_kb_datablock(const void *data, uint32_t offset, uint32_t length) {
-    eeprom_update_dword(EECONFIG_KEYBOARD, (EECONFIG_KB_DATA_VERSION));
+    core_shadow_update_dword(EECONFIG_KEYBOARD, (EECONFIG_KB_DATA_VERSION));
 
     void *ee_start = (void *)(uintptr_t)(EECONFIG_KB_DATABLOCK + offset);
     void *ee_end   = (void *)(uintptr_t)(EECONFIG_KB_DATABLOCK + MIN(EECONFIG_KB_DATA_SIZE, offset + length));
@@ -244,7 +387,7 @@ uint32_t nvm_eeconfig_update_kb_datablock(const void *data, uint32_t offset, uin
 }
 
 void nvm_eeconfig_init_kb_datablock(void) {
-    eeprom_update_dword(EECONFIG_KEYBOARD, (EECONFIG_KB_DATA_VERSION));
+    core_shadow_update_dword(EECONFIG_KEYBOARD, (EECONFIG_KB_DATA_VERSION));
 
     void   *start     = (void *)(uintptr_t)(EECONFIG_KB_DATABLOCK);
     void   *end       = (void *)(uintptr_t)(EECONFIG_KB_DATABLOCK + EECONFIG_KB_DATA_SIZE);
@@ -263,7 +406,16 @@ void nvm_eeconfig_init_kb_datablock(void) {
 #if (EECONFIG_USER_DATA_SIZE) > 0
 
 bool nvm_eeconfig_is_user_datablock_valid(void) {
-    return eeprom_read_dword(EECONFIG_USER) == (EECONFIG_USER_DATA_VERSION);
+    return core_shadow_read_dword(EECONFIG_USER) == (EECONFIG_USER_DATA_VERSION);
+}
+
+uint32_t nvm_eeconfig_user_datablock_version(void) {
+    return core_shadow_read_dword(EECONFIG_USER);
+}
+
+void nvm_eeconfig_read_user_datablock_raw(void *data, uint32_t length) {
+    // Unconditional read of the stored bytes, regardless of the version stamp - used for schema migration
+    eeprom_read_block(data, (void *)(uintptr_t)(EECONFIG_USER_DATABLOCK), MIN(EECONFIG_USER_DATA_SIZE, length));
 }
 
 uint32_t nvm_eeconfig_read_user_datablock(void *data, uint32_t offset, uint32_t length) {
@@ -279,7 +431,7 @@ uint32_t nvm_eeconfig_read_user_datablock(void *data, uint32_t offset, uint32_t
 }
 
 uint32_t nvm_eeconfig_update_user_datablock(const void *data, uint32_t offset, uint32_t length) {
-    eeprom_update_dword(EECONFIG_USER, (EECONFIG_USER_DATA_VERSION));
+    core_shadow_update_dword(EECONFIG_USER, (EECONFIG_USER_DATA_VERSION));
 
     void *ee_start = (void *)(uintptr_t)(EECONFIG_USER_DATABLOCK + offset);
     void *ee_end   = (void *)(uintptr_t)(EECONFIG_USER_DATABLOCK + MIN(EECONFIG_USER_DATA_SIZE, offset + length));
@@ -288,7 +440,7 @@ uint32_t nvm_eeconfig_update_user_datablock(const void *data, uint32_t offset, u
 }
 
 void nvm_eeconfig_init_user_datablock(void) {
-    eeprom_update_dword(EECONFIG_USER, (EECONFIG_USER_DATA_VERSION));
+    core_shadow_update_dword(EECONFIG_USER, (EECONFIG_USER_DATA_VERSION));
 
     void   *start     = (void *)(uintptr_t)(EECONFIG_USER_DATABLOCK);
     void   *end       = (void *)(uintptr_t)(EECONFIG_USER_DATABLOCK + EECONFIG_USER_DATA_SIZE);
@@ -0,0 +1,57 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <string.h>
+
+#include "nvm_stats.h"
+#include "nvm_eeprom_eeconfig_internal.h"
+
+#ifdef VIA_ENABLE
+#    include "via.h"
+#    include "nvm_eeprom_via_internal.h"
+#endif // VIA_ENABLE
+
+static nvm_stats_t nvm_stats[NVM_STATS_DOMAIN_COUNT];
+
+static nvm_stats_domain_t nvm_stats_classify(uint32_t addr) {
+    if (addr < (uint32_t)(EECONFIG_BASE_SIZE)) {
+        return NVM_STATS_DOMAIN_EECONFIG;
+    }
+    if (addr < (uint32_t)(EECONFIG_SIZE)) {
+        return NVM_STATS_DOMAIN_DATABLOCK;
+    }
+#ifdef VIA_ENABLE
+    if (addr < (uint32_t)(VIA_EEPROM_CONFIG_END)) {
+        return NVM_STATS_DOMAIN_VIA;
+    }
+#endif // VIA_ENABLE
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    // Everything beyond the config blocks is keymap/encoder/macro storage
+    return NVM_STATS_DOMAIN_DYNAMIC_KEYMAP;
+#else
+    return NVM_STATS_DOMAIN_OTHER;
+#endif // DYNAMIC_KEYMAP_ENABLE
+}
+
+void nvm_stats_get(nvm_stats_domain_t domain, nvm_stats_t *stats) {
+    if (domain >= NVM_STATS_DOMAIN_COUNT) {
+        memset(stats, 0, sizeof(nvm_stats_t));
+        return;
+    }
+    memcpy(stats, &nvm_stats[domain], sizeof(nvm_stats_t));
+}
+
+void nvm_stats_reset(void) {
+    memset(nvm_stats, 0, sizeof(nvm_stats));
+}
+
+void nvm_stats_record_read(uint32_t addr, uint32_t stall_us) {
+    nvm_stats_t *stats = &nvm_stats[nvm_stats_classify(addr)];
+    stats->read_count++;
+    stats->stall_us += stall_us;
+}
+
+void nvm_stats_record_write(uint32_t addr, uint32_t stall_us) {
+    nvm_stats_t *stats = &nvm_stats[nvm_stats_classify(addr)];
+    stats->write_count++;
+    stats->stall_us += stall_us;
+}
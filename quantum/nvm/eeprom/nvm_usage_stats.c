@@ -0,0 +1,110 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <string.h>
+
+#include "eeprom.h"
+#include "util.h"
+#include "usage_stats.h"
+#include "nvm_usage_stats.h"
+
+// The journal lives outside the regions managed by eeconfig, VIA and dynamic
+// keymaps, so its placement has to be supplied by the keyboard -- typically
+// carved out by lowering DYNAMIC_KEYMAP_EEPROM_MAX_ADDR or placed in space
+// left over on a large external EEPROM.
+#ifndef USAGE_STATS_EEPROM_ADDR
+#    error "USAGE_STATS_EEPROM_ADDR must be defined to place the usage stats journal"
+#endif
+
+// Number of journal slots written round-robin; more slots spread the write
+// load across more cells on backends without wear leveling
+#ifndef USAGE_STATS_RING_SLOTS
+#    define USAGE_STATS_RING_SLOTS 2
+#endif
+
+#define NVM_USAGE_STATS_SEQ_UNUSED 0xFFFF
+
+typedef struct PACKED nvm_usage_stats_header_t {
+    uint16_t seq;      // monotonically increasing, NVM_USAGE_STATS_SEQ_UNUSED when the slot is empty
+    uint16_t checksum; // 16-bit additive checksum over the payload bytes
+} nvm_usage_stats_header_t;
+
+#define NVM_USAGE_STATS_SLOT_SIZE (sizeof(nvm_usage_stats_header_t) + sizeof(usage_stats_t))
+
+static uint8_t  current_slot = 0;
+static uint16_t current_seq  = NVM_USAGE_STATS_SEQ_UNUSED;
+
+static void *slot_address(uint8_t slot) {
+    return (void *)((uintptr_t)(USAGE_STATS_EEPROM_ADDR) + (uintptr_t)slot * NVM_USAGE_STATS_SLOT_SIZE);
+}
+
+static uint16_t payload_checksum(const usage_stats_t *stats) {
+    const uint8_t *bytes    = (const uint8_t *)stats;
+    uint16_t       checksum = 0;
+    for (size_t i = 0; i < sizeof(usage_stats_t); i++) {
+        checksum += bytes[i];
+    }
+    return checksum;
+}
+
+bool nvm_usage_stats_load(usage_stats_t *stats) {
+    nvm_usage_stats_header_t header;
+    bool                     found = false;
+
+    // Pick the slot holding the newest journal entry; sequence numbers are
+    // compared with wraparound-safe arithmetic
+    for (uint8_t slot = 0; slot < (USAGE_STATS_RING_SLOTS); slot++) {
+        eeprom_read_block(&header, slot_address(slot), sizeof(header));
+        if (header.seq == NVM_USAGE_STATS_SEQ_UNUSED) {
+            continue;
+        }
+        if (!found || (int16_t)(header.seq - current_seq) > 0) {
+            current_slot = slot;
+            current_seq  = header.seq;
+            found        = true;
+        }
+    }
+
+    if (!found) {
+        return false;
+    }
+
+    eeprom_read_block(&header, slot_address(current_slot), sizeof(header));
+    eeprom_read_block(stats, (uint8_t *)slot_address(current_slot) + sizeof(header), sizeof(usage_stats_t));
+    if (payload_checksum(stats) != header.checksum) {
+        return false;
+    }
+    return true;
+}
+
+void nvm_usage_stats_save(const usage_stats_t *stats) {
+    uint8_t slot = current_seq == NVM_USAGE_STATS_SEQ_UNUSED ? 0 : (current_slot + 1) % (USAGE_STATS_RING_SLOTS);
+    uint16_t seq = current_seq + 1; // NVM_USAGE_STATS_SEQ_UNUSED wraps to 0 for the first entry
+    if (seq == NVM_USAGE_STATS_SEQ_UNUSED) {
+        seq = 0;
+    }
+
+    nvm_usage_stats_header_t header = {
+        .seq      = seq,
+        .checksum = payload_checksum(stats),
+    };
+
+    // Payload first, header last: a power failure mid-write leaves the slot's
+    // old header in place, so the previous entry is what gets loaded
+    eeprom_update_block(stats, (uint8_t *)slot_address(slot) + sizeof(header), sizeof(usage_stats_t));
+    eeprom_update_block(&header, slot_address(slot), sizeof(header));
+
+    current_slot = slot;
+    current_seq  = seq;
+}
+
+void nvm_usage_stats_erase(void) {
+    nvm_usage_stats_header_t header = {
+        .seq      = NVM_USAGE_STATS_SEQ_UNUSED,
+        .checksum = 0,
+    };
+    for (uint8_t slot = 0; slot < (USAGE_STATS_RING_SLOTS); slot++) {
+        eeprom_update_block(&header, slot_address(slot), sizeof(header));
+    }
+    current_slot = 0;
+    current_seq  = NVM_USAGE_STATS_SEQ_UNUSED;
+}
@@ -13,6 +13,11 @@
 
 void nvm_eeconfig_erase(void);
 
+// Write any coalesced core-block updates out to the backing store
+void nvm_eeconfig_flush(void);
+// Whether any coalesced updates are still awaiting a flush
+bool nvm_eeconfig_has_pending_write(void);
+
 bool nvm_eeconfig_is_enabled(void);
 bool nvm_eeconfig_is_disabled(void);
 
@@ -96,16 +101,23 @@ void                              nvm_eeconfig_update_connection(const connectio
 bool nvm_eeconfig_read_handedness(void);
 void nvm_eeconfig_update_handedness(bool val);
 
+bool nvm_eeconfig_read_split_role(bool *is_master);
+void nvm_eeconfig_update_split_role(bool is_master);
+
 #if (EECONFIG_KB_DATA_SIZE) > 0
 bool     nvm_eeconfig_is_kb_datablock_valid(void);
+uint32_t nvm_eeconfig_kb_datablock_version(void);
 uint32_t nvm_eeconfig_read_kb_datablock(void *data, uint32_t offset, uint32_t length);
+void     nvm_eeconfig_read_kb_datablock_raw(void *data, uint32_t length);
 uint32_t nvm_eeconfig_update_kb_datablock(const void *data, uint32_t offset, uint32_t length);
 void     nvm_eeconfig_init_kb_datablock(void);
 #endif // (EECONFIG_KB_DATA_SIZE) > 0
 
 #if (EECONFIG_USER_DATA_SIZE) > 0
 bool     nvm_eeconfig_is_user_datablock_valid(void);
+uint32_t nvm_eeconfig_user_datablock_version(void);
 uint32_t nvm_eeconfig_read_user_datablock(void *data, uint32_t offset, uint32_t length);
+void     nvm_eeconfig_read_user_datablock_raw(void *data, uint32_t length);
 uint32_t nvm_eeconfig_update_user_datablock(const void *data, uint32_t offset, uint32_t length);
 void     nvm_eeconfig_init_user_datablock(void);
 #endif // (EECONFIG_USER_DATA_SIZE) > 0
@@ -0,0 +1,34 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+
+// Per-domain NVM access statistics, enabled with `NVM_STATS_ENABLE = yes`.
+// Every read/write transaction hitting the backing store is attributed to the
+// subsystem owning the target address range, so runaway writers can be
+// identified in the field through the corresponding raw HID query.
+
+typedef enum nvm_stats_domain_t {
+    NVM_STATS_DOMAIN_EECONFIG,       // core eeconfig block
+    NVM_STATS_DOMAIN_DATABLOCK,      // keyboard-/user-level datablocks
+    NVM_STATS_DOMAIN_VIA,            // VIA magic, layout options, custom config
+    NVM_STATS_DOMAIN_DYNAMIC_KEYMAP, // dynamic keymap, encoders, macros
+    NVM_STATS_DOMAIN_OTHER,
+    NVM_STATS_DOMAIN_COUNT
+} nvm_stats_domain_t;
+
+typedef struct nvm_stats_t {
+    uint32_t read_count;  // number of read transactions
+    uint32_t write_count; // number of write transactions
+    uint32_t stall_us;    // cumulative time spent blocked on the backing store
+} nvm_stats_t;
+
+// Retrieve the counters for a single domain; out-of-range domains read as zero
+void nvm_stats_get(nvm_stats_domain_t domain, nvm_stats_t *stats);
+// Zero all counters
+void nvm_stats_reset(void);
+
+// Recording hooks, invoked by the backing driver around each transaction
+void nvm_stats_record_read(uint32_t addr, uint32_t stall_us);
+void nvm_stats_record_write(uint32_t addr, uint32_t stall_us);
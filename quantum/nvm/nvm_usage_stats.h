@@ -0,0 +1,16 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdbool.h>
+
+typedef struct usage_stats_t usage_stats_t;
+
+// Load the most recent valid journal entry; returns false if none exists
+bool nvm_usage_stats_load(usage_stats_t *stats);
+
+// Append the counters to the journal
+void nvm_usage_stats_save(const usage_stats_t *stats);
+
+// Invalidate all journal entries
+void nvm_usage_stats_erase(void);
@@ -28,4 +28,13 @@ else
 
     QUANTUM_SRC += nvm_eeconfig.c
 
+    NVM_STATS_ENABLE ?= no
+    ifeq ($(strip $(NVM_STATS_ENABLE)), yes)
+        ifneq ($(NVM_DRIVER),eeprom)
+            $(call CATASTROPHIC_ERROR,Invalid NVM_STATS_ENABLE,NVM statistics require the eeprom NVM driver)
+        endif
+        OPT_DEFS += -DNVM_STATS_ENABLE
+        QUANTUM_SRC += nvm_stats.c
+    endif
+
 endif
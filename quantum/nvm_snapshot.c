@@ -0,0 +1,216 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <string.h>
+
+#include "nvm_snapshot.h"
+#include "raw_hid_channels.h"
+#include "eeprom.h"
+#include "quantum.h"
+#include "util.h"
+
+#ifdef SECURE_ENABLE
+#    include "secure.h"
+#endif
+
+#ifndef RAW_HID_CHANNELS_ENABLE
+#    error "NVM_SNAPSHOT requires RAW_HID_CHANNELS_ENABLE for its transport"
+#endif
+
+typedef enum snapshot_state_t {
+    SNAPSHOT_IDLE,
+    SNAPSHOT_RESTORING,   // between RESTORE_BEGIN and RESTORE_COMMIT
+    SNAPSHOT_SCAN_DIGEST, // background checksum of the live image
+    SNAPSHOT_SCAN_VERIFY, // background checksum after a restore
+} snapshot_state_t;
+
+static snapshot_state_t snapshot_state = SNAPSHOT_IDLE;
+static uint32_t         scan_pos;
+static uint32_t         restore_size;
+static uint8_t          expected_crc;
+static uint8_t          running_crc;
+static bool             reboot_after_verify;
+
+// Same CRC-8 (polynomial 0x31, init 0xff) as quantum/crc.c, in an incremental
+// form so the scan can span housekeeping passes; crc8() there only works on a
+// complete in-RAM buffer, and the image never exists in RAM all at once.
+static uint8_t snapshot_crc8_update(uint8_t crc, const uint8_t *data, uint32_t length) {
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static uint32_t read_le32(const uint8_t *data) {
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+static void write_le32(uint8_t *data, uint32_t value) {
+    data[0] = (uint8_t)(value >> 0);
+    data[1] = (uint8_t)(value >> 8);
+    data[2] = (uint8_t)(value >> 16);
+    data[3] = (uint8_t)(value >> 24);
+}
+
+static void snapshot_respond(uint8_t cmd, uint8_t status) {
+    uint8_t response[2] = {cmd, status};
+    raw_hid_channel_send(NVM_SNAPSHOT_CHANNEL, response, sizeof(response));
+}
+
+static bool snapshot_restore_locked(void) {
+#ifdef SECURE_ENABLE
+    return !secure_is_unlocked();
+#else
+    return false;
+#endif
+}
+
+static void snapshot_handler(uint8_t channel, const uint8_t *data, uint8_t length) {
+    (void)channel;
+    (void)length;
+
+    uint8_t cmd = data[0];
+    switch (cmd) {
+        case NVM_SNAPSHOT_CMD_INFO: {
+            uint8_t response[8] = {cmd, NVM_SNAPSHOT_STATUS_OK};
+            write_le32(&response[2], TOTAL_EEPROM_BYTE_COUNT);
+            response[6] = NVM_SNAPSHOT_CHUNK_SIZE;
+            response[7] = NVM_SNAPSHOT_PROTOCOL_VERSION;
+            raw_hid_channel_send(NVM_SNAPSHOT_CHANNEL, response, sizeof(response));
+        } break;
+
+        case NVM_SNAPSHOT_CMD_READ: {
+            uint32_t offset = read_le32(&data[1]);
+            if (offset >= TOTAL_EEPROM_BYTE_COUNT) {
+                snapshot_respond(cmd, NVM_SNAPSHOT_STATUS_RANGE);
+                break;
+            }
+            uint8_t chunk                                         = (uint8_t)MIN((uint32_t)NVM_SNAPSHOT_CHUNK_SIZE, TOTAL_EEPROM_BYTE_COUNT - offset);
+            uint8_t response[7 + NVM_SNAPSHOT_CHUNK_SIZE]         = {cmd, NVM_SNAPSHOT_STATUS_OK};
+            write_le32(&response[2], offset);
+            response[6] = chunk;
+            eeprom_read_block(&response[7], (const void *)(uintptr_t)offset, chunk);
+            raw_hid_channel_send(NVM_SNAPSHOT_CHANNEL, response, 7 + chunk);
+        } break;
+
+        case NVM_SNAPSHOT_CMD_DIGEST:
+            if (snapshot_state != SNAPSHOT_IDLE) {
+                snapshot_respond(cmd, NVM_SNAPSHOT_STATUS_BUSY);
+                break;
+            }
+            snapshot_state = SNAPSHOT_SCAN_DIGEST;
+            scan_pos       = 0;
+            running_crc    = 0xff;
+            snapshot_respond(cmd, NVM_SNAPSHOT_STATUS_OK);
+            break;
+
+        case NVM_SNAPSHOT_CMD_RESTORE_BEGIN: {
+            if (snapshot_restore_locked()) {
+                snapshot_respond(cmd, NVM_SNAPSHOT_STATUS_LOCKED);
+                break;
+            }
+            if (snapshot_state != SNAPSHOT_IDLE && snapshot_state != SNAPSHOT_RESTORING) {
+                snapshot_respond(cmd, NVM_SNAPSHOT_STATUS_BUSY);
+                break;
+            }
+            uint32_t size = read_le32(&data[1]);
+            if (size == 0 || size > TOTAL_EEPROM_BYTE_COUNT) {
+                snapshot_respond(cmd, NVM_SNAPSHOT_STATUS_RANGE);
+                break;
+            }
+            restore_size   = size;
+            expected_crc   = data[5];
+            snapshot_state = SNAPSHOT_RESTORING;
+            snapshot_respond(cmd, NVM_SNAPSHOT_STATUS_OK);
+        } break;
+
+        case NVM_SNAPSHOT_CMD_RESTORE_DATA: {
+            if (snapshot_restore_locked()) {
+                snapshot_respond(cmd, NVM_SNAPSHOT_STATUS_LOCKED);
+                break;
+            }
+            if (snapshot_state != SNAPSHOT_RESTORING) {
+                snapshot_respond(cmd, NVM_SNAPSHOT_STATUS_STATE);
+                break;
+            }
+            uint32_t offset = read_le32(&data[1]);
+            uint8_t  chunk  = data[5];
+            if (chunk > NVM_SNAPSHOT_CHUNK_SIZE || offset + chunk > restore_size) {
+                snapshot_respond(cmd, NVM_SNAPSHOT_STATUS_RANGE);
+                break;
+            }
+            // update, not write: bytes that already match cost no write cycle,
+            // so re-provisioning an almost-identical board touches only the
+            // bytes that actually differ
+            eeprom_update_block(&data[6], (void *)(uintptr_t)offset, chunk);
+            snapshot_respond(cmd, NVM_SNAPSHOT_STATUS_OK);
+        } break;
+
+        case NVM_SNAPSHOT_CMD_RESTORE_COMMIT:
+            if (snapshot_restore_locked()) {
+                snapshot_respond(cmd, NVM_SNAPSHOT_STATUS_LOCKED);
+                break;
+            }
+            if (snapshot_state != SNAPSHOT_RESTORING) {
+                snapshot_respond(cmd, NVM_SNAPSHOT_STATUS_STATE);
+                break;
+            }
+            reboot_after_verify = data[1] != 0;
+            snapshot_state      = SNAPSHOT_SCAN_VERIFY;
+            scan_pos            = 0;
+            running_crc         = 0xff;
+            snapshot_respond(cmd, NVM_SNAPSHOT_STATUS_OK);
+            break;
+
+        default:
+            snapshot_respond(cmd, NVM_SNAPSHOT_STATUS_STATE);
+            break;
+    }
+}
+
+void nvm_snapshot_init(void) {
+    raw_hid_channel_register(NVM_SNAPSHOT_CHANNEL, snapshot_handler, NVM_SNAPSHOT_CHANNEL_PRIORITY);
+}
+
+void nvm_snapshot_task(void) {
+    if (snapshot_state != SNAPSHOT_SCAN_DIGEST && snapshot_state != SNAPSHOT_SCAN_VERIFY) {
+        return;
+    }
+
+    uint32_t limit  = (snapshot_state == SNAPSHOT_SCAN_VERIFY) ? restore_size : TOTAL_EEPROM_BYTE_COUNT;
+    uint32_t budget = NVM_SNAPSHOT_SCAN_BYTES_PER_TASK;
+    uint8_t  buffer[32];
+
+    while (budget > 0 && scan_pos < limit) {
+        uint32_t count = MIN((uint32_t)sizeof(buffer), MIN(budget, limit - scan_pos));
+        eeprom_read_block(buffer, (const void *)(uintptr_t)scan_pos, count);
+        running_crc = snapshot_crc8_update(running_crc, buffer, count);
+        scan_pos += count;
+        budget -= count;
+    }
+
+    if (scan_pos < limit) {
+        return;
+    }
+
+    if (snapshot_state == SNAPSHOT_SCAN_DIGEST) {
+        uint8_t response[3] = {NVM_SNAPSHOT_CMD_DIGEST, NVM_SNAPSHOT_STATUS_OK, running_crc};
+        raw_hid_channel_send(NVM_SNAPSHOT_CHANNEL, response, sizeof(response));
+        snapshot_state = SNAPSHOT_IDLE;
+        return;
+    }
+
+    bool    verified    = running_crc == expected_crc;
+    uint8_t response[3] = {NVM_SNAPSHOT_CMD_RESTORE_COMMIT, verified ? NVM_SNAPSHOT_STATUS_OK : NVM_SNAPSHOT_STATUS_CRC_MISMATCH, running_crc};
+    raw_hid_channel_send(NVM_SNAPSHOT_CHANNEL, response, sizeof(response));
+    snapshot_state = SNAPSHOT_IDLE;
+
+    if (verified && reboot_after_verify) {
+        // Restart so every subsystem rereads its settings from the restored
+        // image; the completion response above has already gone out on the
+        // wire at this point
+        soft_reset_keyboard();
+    }
+}
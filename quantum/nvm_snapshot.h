@@ -0,0 +1,75 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * \file
+ *
+ * \defgroup nvm_snapshot NVM snapshot and restore
+ *
+ * Image-based settings transfer over a raw HID channel: the host reads the
+ * whole emulated EEPROM (eeconfig block, dynamic keymap, macros - everything
+ * below `TOTAL_EEPROM_BYTE_COUNT`) as a single checksummed image, and can
+ * later restore it in one pass. Restores go through `eeprom_update_block()`,
+ * so bytes that already match are never rewritten and a restore costs at most
+ * one write per changed byte. Checksum and verify scans walk the NVM a bounded
+ * number of bytes per housekeeping pass rather than stalling the main loop.
+ *
+ * With `SECURE_ENABLE`, restore commands are rejected while the keyboard is
+ * locked; reads are always allowed.
+ * \{
+ */
+
+// Raw HID channel the snapshot protocol listens on
+#ifndef NVM_SNAPSHOT_CHANNEL
+#    define NVM_SNAPSHOT_CHANNEL 3
+#endif
+
+// Dispatch priority for the channel; bulk traffic defers to interactive ones
+#ifndef NVM_SNAPSHOT_CHANNEL_PRIORITY
+#    define NVM_SNAPSHOT_CHANNEL_PRIORITY 200
+#endif
+
+// Bytes scanned per housekeeping pass during checksum/verify
+#ifndef NVM_SNAPSHOT_SCAN_BYTES_PER_TASK
+#    define NVM_SNAPSHOT_SCAN_BYTES_PER_TASK 256
+#endif
+
+// Image bytes carried per report in both directions
+#define NVM_SNAPSHOT_CHUNK_SIZE 24
+
+// Protocol commands, first payload byte of every request; responses echo the
+// command byte followed by a status byte
+#define NVM_SNAPSHOT_CMD_INFO 0x01           // -> status, size (LE32), chunk size, protocol version
+#define NVM_SNAPSHOT_CMD_READ 0x02           // offset (LE32) -> status, offset (LE32), length, data
+#define NVM_SNAPSHOT_CMD_DIGEST 0x03         // -> status; completion response carries the CRC8
+#define NVM_SNAPSHOT_CMD_RESTORE_BEGIN 0x10  // size (LE32), expected CRC8 -> status
+#define NVM_SNAPSHOT_CMD_RESTORE_DATA 0x11   // offset (LE32), length, data -> status
+#define NVM_SNAPSHOT_CMD_RESTORE_COMMIT 0x12 // reboot flag -> status; completion response after verify
+
+// Status codes
+#define NVM_SNAPSHOT_STATUS_OK 0x00
+#define NVM_SNAPSHOT_STATUS_BUSY 0x01         // a checksum/verify scan is still running
+#define NVM_SNAPSHOT_STATUS_RANGE 0x02        // offset/length outside the NVM image
+#define NVM_SNAPSHOT_STATUS_CRC_MISMATCH 0x03 // verify after restore did not match the staged CRC
+#define NVM_SNAPSHOT_STATUS_STATE 0x04        // command not valid in the current state
+#define NVM_SNAPSHOT_STATUS_LOCKED 0x05       // restore rejected while secured
+
+#define NVM_SNAPSHOT_PROTOCOL_VERSION 0x01
+
+/**
+ * \brief Register the snapshot handler on its raw HID channel. Called from
+ * `keyboard_init()`.
+ */
+void nvm_snapshot_init(void);
+
+/**
+ * \brief Progress any in-flight checksum or verify scan. Called from the
+ * housekeeping task; scans at most \ref NVM_SNAPSHOT_SCAN_BYTES_PER_TASK
+ * bytes per pass and sends the completion response when done.
+ */
+void nvm_snapshot_task(void);
+
+/** \} */
@@ -102,16 +102,25 @@ void os_detection_task(void) {
         return;
     }
 #endif
+    // nothing is pending once the verdict has settled, so the task is a single
+    // load and branch per tick until the next USB event starts a new debounce
+    if (!debouncing) {
+        return;
+    }
     if (current_usb_device_state.configure_state == USB_DEVICE_STATE_CONFIGURED) {
         // debouncing goes for both the detected OS as well as the USB state
-        if (debouncing && timer_elapsed_fast(last_time) >= OS_DETECTION_DEBOUNCE) {
+        if (timer_elapsed_fast(last_time) >= OS_DETECTION_DEBOUNCE) {
             debouncing = false;
             last_time  = 0;
             if (detected_os != reported_os || first_report) {
+                bool initial = first_report;
                 first_report = false;
                 reported_os  = detected_os;
                 process_detected_host_os_modules(detected_os);
                 process_detected_host_os_kb(detected_os);
+                if (initial) {
+                    os_detection_stable_kb(detected_os);
+                }
             }
         }
     }
@@ -129,6 +138,12 @@ __attribute__((weak)) bool process_detected_host_os_user(os_variant_t detected_o
     return true;
 }
 
+__attribute__((weak)) void os_detection_stable_kb(os_variant_t detected_os) {
+    os_detection_stable_user(detected_os);
+}
+
+__attribute__((weak)) void os_detection_stable_user(os_variant_t detected_os) {}
+
 // Some collected sequences of wLength can be found in tests.
 void process_wlength(const uint16_t w_length) {
 #ifdef OS_DETECTION_DEBUG_ENABLE
@@ -180,6 +195,10 @@ os_variant_t detected_host_os(void) {
     return detected_os;
 }
 
+bool os_detection_is_stable(void) {
+    return !first_report;
+}
+
 void erase_wlength_data(void) {
     memset(&setups_data, 0, sizeof(setups_data));
     detected_os                              = OS_UNSURE;
@@ -38,6 +38,13 @@ void os_detection_task(void);
 bool process_detected_host_os_kb(os_variant_t os);
 bool process_detected_host_os_user(os_variant_t os);
 
+// invoked exactly once per connection, when the first debounced verdict is declared
+void os_detection_stable_kb(os_variant_t os);
+void os_detection_stable_user(os_variant_t os);
+
+// whether a stable verdict has been declared since the last (re)connect
+bool os_detection_is_stable(void);
+
 #if defined(SPLIT_KEYBOARD) && defined(SPLIT_DETECTED_OS_ENABLE)
 void slave_update_detected_host_os(os_variant_t os);
 #endif
@@ -25,6 +25,8 @@ void advance_time(uint32_t ms);
 
 static uint32_t     reported_count;
 static os_variant_t reported_os;
+static uint32_t     stable_count;
+static os_variant_t stable_os;
 
 class OsDetectionTest : public ::testing::Test {
    protected:
@@ -32,6 +34,8 @@ class OsDetectionTest : public ::testing::Test {
         erase_wlength_data();
         reported_count = 0;
         reported_os    = OS_UNSURE;
+        stable_count   = 0;
+        stable_os      = OS_UNSURE;
     }
 };
 
@@ -49,6 +53,11 @@ bool process_detected_host_os_kb(os_variant_t os) {
     return true;
 }
 
+void os_detection_stable_kb(os_variant_t os) {
+    stable_count = stable_count + 1;
+    stable_os    = os;
+}
+
 void assert_not_reported(void) {
     // check that it does not report the result, nor any intermediate results
     EXPECT_EQ(reported_count, 0);
@@ -442,3 +451,29 @@ TEST_F(OsDetectionTest, TestDoNotGoBackToUnsure) {
     os_detection_task();
     assert_not_reported();
 }
+
+TEST_F(OsDetectionTest, TestStableCallbackFiresOnlyOnce) {
+    EXPECT_FALSE(os_detection_is_stable());
+
+    EXPECT_EQ(check_sequence({0xFF, 0xFF, 0xFF}), OS_LINUX);
+    os_detection_notify_usb_device_state_change(usb_device_state_configured);
+    advance_time(OS_DETECTION_DEBOUNCE + 1);
+    os_detection_task();
+    assert_reported(OS_LINUX);
+    EXPECT_TRUE(os_detection_is_stable());
+    EXPECT_EQ(stable_count, 1);
+    EXPECT_EQ(stable_os, OS_LINUX);
+
+    // a later change of verdict is reported, but does not re-fire the stable event
+    EXPECT_EQ(check_sequence({0x4}), OS_WINDOWS);
+    os_detection_notify_usb_device_state_change(usb_device_state_configured);
+    advance_time(OS_DETECTION_DEBOUNCE + 1);
+    os_detection_task();
+    EXPECT_EQ(reported_count, 2);
+    EXPECT_EQ(reported_os, OS_WINDOWS);
+    EXPECT_EQ(stable_count, 1);
+
+    // a reconnect starts over
+    erase_wlength_data();
+    EXPECT_FALSE(os_detection_is_stable());
+}
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "qp_lvgl.h"
+#include "qp_comms.h"
 #include "timer.h"
 #include "deferred_exec.h"
 #include "lvgl.h"
@@ -24,10 +25,19 @@ void            *color_buffer     = NULL;
 
 void qp_lvgl_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
     if (selected_display) {
-        uint32_t number_pixels = (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
-        qp_viewport(selected_display, area->x1, area->y1, area->x2, area->y2);
-        qp_pixdata(selected_display, (void *)color_p, number_pixels);
-        qp_flush(selected_display);
+        painter_driver_t *driver        = (painter_driver_t *)selected_display;
+        uint32_t          number_pixels = (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
+        // Stream the area inside a single comms session, rather than starting/stopping comms around the viewport and
+        // pixel data calls individually
+        if (qp_comms_start(selected_display)) {
+            driver->driver_vtable->viewport(selected_display, area->x1, area->y1, area->x2, area->y2);
+            driver->driver_vtable->pixdata(selected_display, (void *)color_p, number_pixels);
+            qp_comms_stop(selected_display);
+        }
+        // A single refresh may arrive as several areas -- only flush the display once the last one has been streamed
+        if (lv_disp_flush_is_last(disp)) {
+            qp_flush(selected_display);
+        }
         lv_disp_flush_ready(disp);
     }
 }
@@ -56,6 +56,24 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the amount of RAM (in bytes) dedicated to caching glyphs that have already been converted to a
+ *      display's native pixel format. Repeatedly-drawn text, such as clock or WPM digits, becomes a direct blit
+ *      instead of a per-pixel decode. Set to `0` (the default) to disable the cache entirely.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_SIZE 0
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+/**
+ * @def This controls the maximum number of glyphs that can be held in the glyph cache at any one time, assuming
+ *      \ref QUANTUM_PAINTER_GLYPH_CACHE_SIZE is non-zero. Each entry requires a small amount of RAM for metadata on
+ *      top of the cache size itself.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES 16
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
@@ -353,6 +371,57 @@ bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native
  */
 painter_image_handle_t qp_load_image_mem(const void *buffer);
 
+/**
+ * Callback for reading data out of a buffered stream's backing store, such as external SPI flash.
+ *
+ * @param handle[in] the opaque handle supplied when the stream was created
+ * @param offset[in] the offset within the backing store to read from
+ * @param buffer[out] the location to read into
+ * @param length[in] the number of bytes to read
+ * @return the number of bytes actually read
+ */
+typedef uint32_t (*qp_buffered_reader_func)(void *handle, uint32_t offset, void *buffer, uint32_t length);
+
+/**
+ * Loads an image from a backing store accessed through a reader callback, serving reads through a RAM window.
+ *
+ * Intended for assets kept in external storage such as SPI flash: instead of each byte being its own transaction, the
+ * window is refilled with bulk reads of up to `window_size` bytes ahead of the current position. Larger windows mean
+ * fewer transactions at the cost of RAM; for animations, a window large enough for a frame's compressed data allows
+ * each frame to be fetched with a single read. The window buffer must remain valid until the image is closed.
+ *
+ * @note Images can be unloaded by calling \ref qp_close_image.
+ *
+ * @param reader[in] the callback used to read from the backing store
+ * @param handle[in] an opaque handle passed through to the reader callback
+ * @param length[in] an upper bound for the length of the image data; refined to the actual image size during load
+ * @param window_buffer[in] a caller-allocated RAM window used to serve reads
+ * @param window_size[in] the size of `window_buffer`, in bytes
+ * @return an image handle usable with \ref qp_drawimage, \ref qp_drawimage_recolor, \ref qp_animate, and
+ *         \ref qp_animate_recolor.
+ * @return NULL if loading the image failed
+ */
+painter_image_handle_t qp_load_image_buffered(qp_buffered_reader_func reader, void *handle, uint32_t length, void *window_buffer, uint32_t window_size);
+
+#ifdef FLASH_ENABLE
+/**
+ * Loads an image from external flash accessed through the flash driver, serving reads through a RAM window.
+ *
+ * Convenience wrapper around \ref qp_load_image_buffered using `flash_read_range`. On MCUs whose external flash is
+ * memory-mapped for execute-in-place (such as the RP2040), assets placed in the mapped region can instead be loaded
+ * with \ref qp_load_image_mem at the mapped address, which needs no RAM window at all.
+ *
+ * @param flash_addr[in] the address of the image data within the flash
+ * @param length[in] an upper bound for the length of the image data; refined to the actual image size during load
+ * @param window_buffer[in] a caller-allocated RAM window used to serve reads
+ * @param window_size[in] the size of `window_buffer`, in bytes
+ * @return an image handle usable with \ref qp_drawimage, \ref qp_drawimage_recolor, \ref qp_animate, and
+ *         \ref qp_animate_recolor.
+ * @return NULL if loading the image failed
+ */
+painter_image_handle_t qp_load_image_flash(uint32_t flash_addr, uint32_t length, void *window_buffer, uint32_t window_size);
+#endif // FLASH_ENABLE
+
 /**
  * Closes an image handle when no longer in use.
  *
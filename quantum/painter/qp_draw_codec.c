@@ -2,10 +2,14 @@
 // Copyright 2023 Pablo Martinez (@elpekenin) <elpekenin@elpekenin.dev>
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
+
 #include "qp_internal.h"
 #include "qp_draw.h"
 #include "qp_comms.h"
 
+static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Palette / Monochrome-format decoder
 
@@ -39,13 +43,80 @@ bool qp_internal_decode_palette(painter_device_t device, uint32_t pixel_count, u
             return false;
         }
         uint8_t loop_pixels = remaining_pixels < pixels_per_byte ? remaining_pixels : pixels_per_byte;
-        for (uint8_t q = 0; q < loop_pixels; ++q) {
-            if (!output_callback(palette, byteval & pixel_bitmask, output_arg)) {
-                return false;
+        if (output_callback == qp_internal_pixel_appender) {
+            // Hot path: unpack the whole byte into palette indices up front and append them through a single
+            // append_pixels driver call, rather than paying an indirect call (and a vtable call inside it) per pixel.
+            uint8_t indices[8];
+            for (uint8_t q = 0; q < loop_pixels; ++q) {
+                indices[q] = byteval & pixel_bitmask;
+                byteval >>= bits_per_pixel;
+            }
+
+            qp_internal_pixel_output_state_t* output_state = (qp_internal_pixel_output_state_t*)output_arg;
+            painter_driver_t*                 driver       = (painter_driver_t*)output_state->device;
+            uint8_t                           appended     = 0;
+            while (appended < loop_pixels) {
+                // Split the batch if it would straddle the end of the pixdata buffer
+                uint32_t batch = loop_pixels - appended;
+                if (batch > output_state->max_pixels - output_state->pixel_write_pos) {
+                    batch = output_state->max_pixels - output_state->pixel_write_pos;
+                }
+
+                if (!driver->driver_vtable->append_pixels(output_state->device, qp_internal_global_pixdata_buffer, palette, output_state->pixel_write_pos, batch, &indices[appended])) {
+                    return false;
+                }
+                output_state->pixel_write_pos += batch;
+                appended += batch;
+
+                // If we've hit the transmit limit, send out the entire buffer and reset the write position
+                if (output_state->pixel_write_pos == output_state->max_pixels) {
+                    if (!driver->driver_vtable->pixdata(output_state->device, qp_internal_global_pixdata_buffer, output_state->pixel_write_pos)) {
+                        return false;
+                    }
+                    output_state->pixel_write_pos = 0;
+                }
+            }
+        } else {
+            for (uint8_t q = 0; q < loop_pixels; ++q) {
+                if (!output_callback(palette, byteval & pixel_bitmask, output_arg)) {
+                    return false;
+                }
+                byteval >>= bits_per_pixel;
             }
-            byteval >>= bits_per_pixel;
         }
         remaining_pixels -= loop_pixels;
+
+        // Fast path for RLE repeating runs: every remaining byte in the run is identical to the byte just decoded, so
+        // its native-format pixels can be replicated in the pixdata buffer with a memcpy instead of re-entering the
+        // decode callbacks for every pixel.
+        if (input_callback == qp_drawimage_byte_rle_decoder && output_callback == qp_internal_pixel_appender) {
+            qp_internal_byte_input_state_t*   input_state  = (qp_internal_byte_input_state_t*)input_arg;
+            qp_internal_pixel_output_state_t* output_state = (qp_internal_pixel_output_state_t*)output_arg;
+            painter_driver_t*                 driver       = (painter_driver_t*)output_state->device;
+            uint32_t                          chunk_bits   = (uint32_t)pixels_per_byte * driver->native_bits_per_pixel;
+            // The replicated chunk must consist of whole, byte-aligned bytes in the pixdata buffer, and the source
+            // pixels must not have been split across a transmit.
+            if (input_state->rle.mode == REPEATING_RUN && input_state->rle.remain > 0 && (chunk_bits % 8) == 0 && output_state->pixel_write_pos >= pixels_per_byte && (((output_state->pixel_write_pos - pixels_per_byte) * driver->native_bits_per_pixel) % 8) == 0) {
+                uint32_t       chunk_bytes = chunk_bits / 8;
+                const uint8_t* chunk_src   = &qp_internal_global_pixdata_buffer[(output_state->pixel_write_pos - pixels_per_byte) * driver->native_bits_per_pixel / 8];
+                while (input_state->rle.remain > 0 && remaining_pixels >= pixels_per_byte && output_state->pixel_write_pos + pixels_per_byte <= output_state->max_pixels) {
+                    memcpy(&qp_internal_global_pixdata_buffer[output_state->pixel_write_pos * driver->native_bits_per_pixel / 8], chunk_src, chunk_bytes);
+                    output_state->pixel_write_pos += pixels_per_byte;
+                    remaining_pixels -= pixels_per_byte;
+                    if (--input_state->rle.remain == 0) {
+                        input_state->rle.mode = MARKER_BYTE;
+                    }
+                    if (output_state->pixel_write_pos == output_state->max_pixels) {
+                        if (!driver->driver_vtable->pixdata(output_state->device, qp_internal_global_pixdata_buffer, output_state->pixel_write_pos)) {
+                            return false;
+                        }
+                        output_state->pixel_write_pos = 0;
+                        // The source chunk is no longer in the buffer; re-prime it via the normal path.
+                        break;
+                    }
+                }
+            }
+        }
     }
     return true;
 }
@@ -77,6 +148,21 @@ bool qp_internal_send_bytes(painter_device_t device, uint32_t byte_count, qp_int
             return false;
         }
         remaining_bytes -= 1;
+
+        // Fast path for RLE repeating runs: replay the byte just sent instead of pulling every repeat through the
+        // input callback. This keeps native-format assets streaming at buffer-append speed.
+        if (input_callback == qp_drawimage_byte_rle_decoder) {
+            qp_internal_byte_input_state_t* input_state = (qp_internal_byte_input_state_t*)input_arg;
+            while (input_state->rle.mode == REPEATING_RUN && input_state->rle.remain > 0 && remaining_bytes > 0) {
+                if (!output_callback((uint8_t)byteval, output_arg)) {
+                    return false;
+                }
+                remaining_bytes -= 1;
+                if (--input_state->rle.remain == 0) {
+                    input_state->rle.mode = MARKER_BYTE;
+                }
+            }
+        }
     }
     return true;
 }
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "compiler_support.h"
+#include "mem_transfer.h"
 #include "qp_internal.h"
 #include "qp_comms.h"
 #include "qp_draw.h"
@@ -58,10 +59,29 @@ void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint
     qp_pixel_t color = {.hsv888 = {.h = hue, .s = sat, .v = val}};
     driver->driver_vtable->palette_convert(device, 1, &color);
 
+    if (num_pixels == 0) {
+        return;
+    }
+
     // Append the required number of pixels
     uint8_t palette_idx = 0;
-    for (uint32_t i = 0; i < num_pixels; ++i) {
-        driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, &color, i, 1, &palette_idx);
+    if ((driver->native_bits_per_pixel % 8) == 0) {
+        // Whole-byte pixel formats: append one pixel, then double the filled
+        // region until the buffer is full, rather than paying an append_pixels
+        // call per pixel. The bulk copies go through the platform transfer
+        // service, which uses a DMA engine where one is configured.
+        uint32_t bytes_per_pixel = driver->native_bits_per_pixel / 8;
+        driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, &color, 0, 1, &palette_idx);
+        uint32_t filled = 1;
+        while (filled < num_pixels) {
+            uint32_t chunk = MIN(filled, num_pixels - filled);
+            mem_transfer_copy(&qp_internal_global_pixdata_buffer[filled * bytes_per_pixel], qp_internal_global_pixdata_buffer, chunk * bytes_per_pixel, NULL, NULL);
+            filled += chunk;
+        }
+    } else {
+        for (uint32_t i = 0; i < num_pixels; ++i) {
+            driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, &color, i, 1, &palette_idx);
+        }
     }
 }
 
@@ -7,6 +7,10 @@
 #include "qgf.h"
 #include "deferred_exec.h"
 
+#ifdef FLASH_ENABLE
+#    include "flash.h"
+#endif // FLASH_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QGF image handles
 
@@ -14,8 +18,9 @@ typedef struct qgf_image_handle_t {
     painter_image_desc_t base;
     bool                 validate_ok;
     union {
-        qp_stream_t        stream;
-        qp_memory_stream_t mem_stream;
+        qp_stream_t          stream;
+        qp_memory_stream_t   mem_stream;
+        qp_buffered_stream_t buffered_stream;
 #ifdef QP_STREAM_HAS_FILE_IO
         qp_file_stream_t file_stream;
 #endif // QP_STREAM_HAS_FILE_IO
@@ -85,6 +90,54 @@ painter_image_handle_t qp_load_image_mem(const void *buffer) {
     return qp_load_image_internal(image_mem_stream_factory, (void *)buffer);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_load_image_buffered
+
+typedef struct image_buffered_stream_factory_args_t {
+    qp_buffered_reader_func reader;
+    void                   *handle;
+    uint32_t                length;
+    void                   *window_buffer;
+    uint32_t                window_size;
+} image_buffered_stream_factory_args_t;
+
+static inline bool image_buffered_stream_factory(qgf_image_handle_t *image, void *arg) {
+    image_buffered_stream_factory_args_t *args = (image_buffered_stream_factory_args_t *)arg;
+
+    // Assume we can read the graphics descriptor
+    image->buffered_stream = qp_make_buffered_stream(args->reader, args->handle, (int32_t)args->length, args->window_buffer, args->window_size);
+
+    // Update the length of the stream to match, and rewind to the start
+    image->buffered_stream.length   = qgf_get_total_size(&image->stream);
+    image->buffered_stream.position = 0;
+
+    return true;
+}
+
+painter_image_handle_t qp_load_image_buffered(qp_buffered_reader_func reader, void *handle, uint32_t length, void *window_buffer, uint32_t window_size) {
+    image_buffered_stream_factory_args_t args = {.reader = reader, .handle = handle, .length = length, .window_buffer = window_buffer, .window_size = window_size};
+    return qp_load_image_internal(image_buffered_stream_factory, &args);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_load_image_flash
+
+#ifdef FLASH_ENABLE
+
+static uint32_t qp_flash_reader(void *handle, uint32_t offset, void *buffer, uint32_t length) {
+    uint32_t base = (uint32_t)(uintptr_t)handle;
+    if (flash_read_range(base + offset, buffer, length) != FLASH_STATUS_SUCCESS) {
+        return 0;
+    }
+    return length;
+}
+
+painter_image_handle_t qp_load_image_flash(uint32_t flash_addr, uint32_t length, void *window_buffer, uint32_t window_size) {
+    return qp_load_image_buffered(qp_flash_reader, (void *)(uintptr_t)flash_addr, length, window_buffer, window_size);
+}
+
+#endif // FLASH_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_close_image
 
@@ -16,6 +16,7 @@ typedef struct qff_font_handle_t {
     painter_font_desc_t   base;
     bool                  validate_ok;
     bool                  has_ascii_table;
+    bool                  unicode_table_sorted;
     uint16_t              num_unicode_glyphs;
     uint8_t               bpp;
     bool                  has_palette;
@@ -36,6 +37,96 @@ typedef struct qff_font_handle_t {
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Glyph cache
+
+#if (QUANTUM_PAINTER_GLYPH_CACHE_SIZE) > 0
+
+typedef struct qp_glyph_cache_entry_t {
+    painter_device_t      device;
+    painter_font_handle_t font;
+    uint32_t              code_point;
+    qp_pixel_t            fg_hsv888;
+    qp_pixel_t            bg_hsv888;
+    uint16_t              offset; // offset of the native pixel data within the arena
+    uint16_t              length; // length of the native pixel data, in bytes
+    uint32_t              last_used;
+    bool                  valid;
+} qp_glyph_cache_entry_t;
+
+static uint8_t                glyph_cache_arena[QUANTUM_PAINTER_GLYPH_CACHE_SIZE];
+static qp_glyph_cache_entry_t glyph_cache_entries[QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES] = {0};
+static uint16_t               glyph_cache_used                                         = 0;
+static uint32_t               glyph_cache_tick                                         = 0;
+
+static qp_glyph_cache_entry_t *qp_glyph_cache_find(painter_device_t device, painter_font_handle_t font, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        qp_glyph_cache_entry_t *entry = &glyph_cache_entries[i];
+        if (entry->valid && entry->device == device && entry->font == font && entry->code_point == code_point                                                               //
+            && entry->fg_hsv888.hsv888.h == fg_hsv888.hsv888.h && entry->fg_hsv888.hsv888.s == fg_hsv888.hsv888.s && entry->fg_hsv888.hsv888.v == fg_hsv888.hsv888.v       //
+            && entry->bg_hsv888.hsv888.h == bg_hsv888.hsv888.h && entry->bg_hsv888.hsv888.s == bg_hsv888.hsv888.s && entry->bg_hsv888.hsv888.v == bg_hsv888.hsv888.v) {
+            entry->last_used = ++glyph_cache_tick;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static qp_glyph_cache_entry_t *qp_glyph_cache_lru(void) {
+    qp_glyph_cache_entry_t *lru = NULL;
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        qp_glyph_cache_entry_t *entry = &glyph_cache_entries[i];
+        if (entry->valid && (!lru || entry->last_used < lru->last_used)) {
+            lru = entry;
+        }
+    }
+    return lru;
+}
+
+static void qp_glyph_cache_evict(qp_glyph_cache_entry_t *entry) {
+    // Compact the arena, fixing up the offsets of any entries stored after the evicted one
+    memmove(&glyph_cache_arena[entry->offset], &glyph_cache_arena[entry->offset + entry->length], glyph_cache_used - entry->offset - entry->length);
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (glyph_cache_entries[i].valid && glyph_cache_entries[i].offset > entry->offset) {
+            glyph_cache_entries[i].offset -= entry->length;
+        }
+    }
+    glyph_cache_used -= entry->length;
+    entry->valid = false;
+}
+
+static qp_glyph_cache_entry_t *qp_glyph_cache_reserve(uint16_t length) {
+    if (length > QUANTUM_PAINTER_GLYPH_CACHE_SIZE) {
+        return NULL;
+    }
+
+    // Make room in the arena, evicting least-recently-used glyphs as required
+    while (glyph_cache_used + length > QUANTUM_PAINTER_GLYPH_CACHE_SIZE) {
+        qp_glyph_cache_evict(qp_glyph_cache_lru());
+    }
+
+    // Find a free slot, evicting the least-recently-used glyph if all are in use
+    qp_glyph_cache_entry_t *entry = NULL;
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (!glyph_cache_entries[i].valid) {
+            entry = &glyph_cache_entries[i];
+            break;
+        }
+    }
+    if (!entry) {
+        entry = qp_glyph_cache_lru();
+        qp_glyph_cache_evict(entry);
+    }
+
+    entry->offset = glyph_cache_used;
+    entry->length = length;
+    entry->valid  = true;
+    glyph_cache_used += length;
+    return entry;
+}
+
+#endif // (QUANTUM_PAINTER_GLYPH_CACHE_SIZE) > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -106,6 +197,32 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
         return NULL;
     }
 
+    // Determine whether the unicode glyph table is sorted by codepoint (the QMK CLI always emits it sorted),
+    // permitting binary search during glyph lookups instead of a linear scan
+    font->unicode_table_sorted = false;
+    if (font->num_unicode_glyphs > 0) {
+        uint32_t glyph_info_offset = sizeof(qff_font_descriptor_v1_t)                                  // Skip the font descriptor
+                                     + (font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
+                                     + sizeof(qgf_block_header_v1_t);                                   // Skip the unicode block header
+        if (qp_stream_setpos(&font->stream, glyph_info_offset) >= 0) {
+            qff_unicode_glyph_v1_t glyph_info;
+            uint32_t               previous_code_point = 0;
+            bool                   sorted              = true;
+            for (uint16_t i = 0; i < font->num_unicode_glyphs; ++i) {
+                if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &font->stream) != 1) {
+                    sorted = false;
+                    break;
+                }
+                if (i > 0 && glyph_info.code_point <= previous_code_point) {
+                    sorted = false;
+                    break;
+                }
+                previous_code_point = glyph_info.code_point;
+            }
+            font->unicode_table_sorted = sorted;
+        }
+    }
+
     // Validation success, we can return the handle
     font->validate_ok = true;
     qp_dprintf("qp_load_font: ok\n");
@@ -151,6 +268,15 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if (QUANTUM_PAINTER_GLYPH_CACHE_SIZE) > 0
+    // Drop any cached glyphs for this font -- the slot may be reused by a different font later
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (glyph_cache_entries[i].valid && glyph_cache_entries[i].font == font) {
+            qp_glyph_cache_evict(&glyph_cache_entries[i]);
+        }
+    }
+#endif // (QUANTUM_PAINTER_GLYPH_CACHE_SIZE) > 0
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -253,41 +379,72 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
                                      + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
                                      + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
 
-        if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing glyph data\n");
-            return false;
-        }
-
         qff_unicode_glyph_v1_t glyph_info;
-        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
-            if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
-                qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
+        bool                   found = false;
+        if (qff_font->unicode_table_sorted) {
+            // The table was detected as sorted by codepoint during load (the QMK CLI always emits it that way), so
+            // it can be binary searched instead of walked linearly
+            uint16_t lo = 0;
+            uint16_t hi = qff_font->num_unicode_glyphs;
+            while (lo < hi) {
+                uint16_t mid = lo + (hi - lo) / 2;
+                if (qp_stream_setpos(&qff_font->stream, glyph_info_offset + (mid * sizeof(qff_unicode_glyph_v1_t))) < 0) {
+                    qp_dprintf("Failed to set stream position while preparing glyph data\n");
+                    return false;
+                }
+                if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
+                    qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
+                    return false;
+                }
+                if (glyph_info.code_point == code_point) {
+                    found = true;
+                    break;
+                } else if (glyph_info.code_point < code_point) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+        } else {
+            if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
+                qp_dprintf("Failed to set stream position while preparing glyph data\n");
                 return false;
             }
 
-            if (glyph_info.code_point == code_point) {
-                uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-                uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-                uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                                       + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                                       + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                                       + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                                       + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                                       + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-                if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-                    qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
+            for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
+                if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
+                    qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
                     return false;
                 }
 
-                *width = glyph_width;
-                return true;
+                if (glyph_info.code_point == code_point) {
+                    found = true;
+                    break;
+                }
             }
         }
 
-        // Not found
-        qp_dprintf("Failed to find unicode glyph info\n");
-        return false;
+        if (!found) {
+            qp_dprintf("Failed to find unicode glyph info\n");
+            return false;
+        }
+
+        uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
+        uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
+        uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
+                               + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
+                               + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
+                               + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
+                               + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
+                               + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
+
+        if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
+            qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
+            return false;
+        }
+
+        *width = glyph_width;
+        return true;
     }
     return false;
 }
@@ -345,13 +502,65 @@ typedef struct code_point_iter_drawglyph_state_t {
     qp_internal_byte_input_callback   input_callback;
     qp_internal_byte_input_state_t   *input_state;
     qp_internal_pixel_output_state_t *output_state;
+#if (QUANTUM_PAINTER_GLYPH_CACHE_SIZE) > 0
+    qp_pixel_t fg_hsv888;
+    qp_pixel_t bg_hsv888;
+#endif // (QUANTUM_PAINTER_GLYPH_CACHE_SIZE) > 0
 } code_point_iter_drawglyph_state_t;
 
+#if (QUANTUM_PAINTER_GLYPH_CACHE_SIZE) > 0
+// Codepoint handler callback helper: draw via the glyph cache, converting and storing on a miss
+static bool qp_font_code_point_handler_drawglyph_cached(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, code_point_iter_drawglyph_state_t *state) {
+    painter_driver_t *driver      = (painter_driver_t *)state->device;
+    uint32_t          pixel_count = ((uint32_t)width) * height;
+
+    // Set up the viewport and advance the x-position for the next glyph
+    driver->driver_vtable->viewport(state->device, state->xpos, state->ypos, state->xpos + width - 1, state->ypos + height - 1);
+    state->xpos += width;
+
+    // If this glyph has already been converted to native format, blit it directly
+    qp_glyph_cache_entry_t *entry = qp_glyph_cache_find(state->device, (painter_font_handle_t)qff_font, code_point, state->fg_hsv888, state->bg_hsv888);
+    if (entry) {
+        return driver->driver_vtable->pixdata(state->device, &glyph_cache_arena[entry->offset], pixel_count);
+    }
+
+    // Decode the entire glyph into the pixdata buffer -- it fits, so no transmission occurs during the decode
+    state->input_state->rle.mode         = MARKER_BYTE; // ignored if not using RLE
+    state->output_state->pixel_write_pos = 0;
+    if (!qp_internal_decode_palette(state->device, pixel_count, qff_font->bpp, state->input_callback, state->input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, state->output_state)) {
+        return false;
+    }
+
+    // Keep a copy of the converted glyph for next time, evicting older glyphs if required
+    uint16_t byte_length = (uint16_t)((pixel_count * driver->native_bits_per_pixel + 7) / 8);
+    entry                = qp_glyph_cache_reserve(byte_length);
+    if (entry) {
+        memcpy(&glyph_cache_arena[entry->offset], qp_internal_global_pixdata_buffer, byte_length);
+        entry->device     = state->device;
+        entry->font       = (painter_font_handle_t)qff_font;
+        entry->code_point = code_point;
+        entry->fg_hsv888  = state->fg_hsv888;
+        entry->bg_hsv888  = state->bg_hsv888;
+        entry->last_used  = ++glyph_cache_tick;
+    }
+
+    // Stream the converted glyph to the display
+    return driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, pixel_count);
+}
+#endif // (QUANTUM_PAINTER_GLYPH_CACHE_SIZE) > 0
+
 // Codepoint handler callback: drawing
 static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
     code_point_iter_drawglyph_state_t *state  = (code_point_iter_drawglyph_state_t *)cb_arg;
     painter_driver_t                  *driver = (painter_driver_t *)state->device;
 
+#if (QUANTUM_PAINTER_GLYPH_CACHE_SIZE) > 0
+    // The cache only handles palette-based glyphs small enough to be fully decoded into the pixdata buffer
+    if (qff_font->bpp <= 8 && ((uint32_t)width) * height < state->output_state->max_pixels) {
+        return qp_font_code_point_handler_drawglyph_cached(qff_font, code_point, width, height, state);
+    }
+#endif // (QUANTUM_PAINTER_GLYPH_CACHE_SIZE) > 0
+
     // Reset the input state's RLE mode -- the stream should already be correctly positioned by qp_iterate_code_points()
     state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
 
@@ -441,6 +650,10 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
 
     qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
+#if (QUANTUM_PAINTER_GLYPH_CACHE_SIZE) > 0
+    state.fg_hsv888 = fg_hsv888;
+    state.bg_hsv888 = bg_hsv888;
+#endif // (QUANTUM_PAINTER_GLYPH_CACHE_SIZE) > 0
     uint32_t   data_offset;
     if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
         qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
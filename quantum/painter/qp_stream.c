@@ -119,6 +119,97 @@ qp_memory_stream_t qp_make_memory_stream(void *buffer, int32_t length) {
     return stream;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Buffered streams
+
+static inline int16_t buffered_get(qp_stream_t *stream) {
+    qp_buffered_stream_t *s = (qp_buffered_stream_t *)stream;
+    if (s->position >= s->length) {
+        s->is_eof = true;
+        return STREAM_EOF;
+    }
+
+    // Refill the window with a single bulk read whenever the position falls outside it
+    if (s->position < s->window_start || s->position >= s->window_start + (int32_t)s->window_valid) {
+        uint32_t read_length = s->buffer_size;
+        if ((uint32_t)(s->length - s->position) < read_length) {
+            read_length = (uint32_t)(s->length - s->position);
+        }
+        s->window_start = s->position;
+        s->window_valid = s->reader(s->handle, (uint32_t)s->position, s->buffer, read_length);
+        if (s->window_valid == 0) {
+            s->is_eof = true;
+            return STREAM_EOF;
+        }
+    }
+
+    return s->buffer[s->position++ - s->window_start];
+}
+
+static inline bool buffered_put(qp_stream_t *stream, uint8_t c) {
+    // Read-only.
+    return false;
+}
+
+static inline int buffered_seek(qp_stream_t *stream, int32_t offset, int origin) {
+    qp_buffered_stream_t *s = (qp_buffered_stream_t *)stream;
+
+    // Handle as per fseek
+    int32_t position = s->position;
+    switch (origin) {
+        case SEEK_SET:
+            position = offset;
+            break;
+        case SEEK_CUR:
+            position += offset;
+            break;
+        case SEEK_END:
+            position = s->length + offset;
+            break;
+        default:
+            return -1;
+    }
+
+    if (position < 0 || position > s->length) {
+        return -1;
+    }
+
+    // Update the offset -- the window is kept, so seeking within it costs nothing
+    s->position = position;
+    s->is_eof   = false;
+
+    return 0;
+}
+
+static inline int32_t buffered_tell(qp_stream_t *stream) {
+    qp_buffered_stream_t *s = (qp_buffered_stream_t *)stream;
+    return s->position;
+}
+
+static inline bool buffered_is_eof(qp_stream_t *stream) {
+    qp_buffered_stream_t *s = (qp_buffered_stream_t *)stream;
+    return s->is_eof;
+}
+
+static inline void buffered_close(qp_stream_t *stream) {
+    // No-op.
+}
+
+qp_buffered_stream_t qp_make_buffered_stream(qp_buffered_reader_func reader, void *handle, int32_t length, void *buffer, uint32_t buffer_size) {
+    qp_buffered_stream_t stream = {
+        .base         = {.get = buffered_get, .put = buffered_put, .seek = buffered_seek, .tell = buffered_tell, .is_eof = buffered_is_eof, .close = buffered_close},
+        .reader       = reader,
+        .handle       = handle,
+        .buffer       = (uint8_t *)buffer,
+        .buffer_size  = buffer_size,
+        .window_start = 0,
+        .window_valid = 0,
+        .length       = length,
+        .position     = 0,
+    };
+    return stream;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // FILE streams
 
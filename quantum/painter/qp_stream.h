@@ -70,6 +70,28 @@ typedef struct qp_memory_stream_t {
 
 qp_memory_stream_t qp_make_memory_stream(void *buffer, int32_t length);
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Buffered streams
+//
+// Serves reads from a RAM window over a backing store accessed through a reader callback, refilling the window with
+// bulk reads ahead of the current position instead of fetching each byte individually. Intended for assets kept in
+// external storage such as SPI flash.
+
+typedef struct qp_buffered_stream_t {
+    qp_stream_t             base;
+    qp_buffered_reader_func reader;
+    void                   *handle;
+    uint8_t                *buffer;       // RAM window used to serve reads
+    uint32_t                buffer_size;  // size of the RAM window
+    int32_t                 window_start; // offset within the backing store of the first buffered byte
+    uint32_t                window_valid; // number of valid bytes currently in the window
+    int32_t                 length;
+    int32_t                 position;
+    bool                    is_eof;
+} qp_buffered_stream_t;
+
+qp_buffered_stream_t qp_make_buffered_stream(qp_buffered_reader_func reader, void *handle, int32_t length, void *buffer, uint32_t buffer_size);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // FILE streams
 
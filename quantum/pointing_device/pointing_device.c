@@ -21,6 +21,11 @@
 #include "timer.h"
 #include "gpio.h"
 
+#ifdef POINTING_DEVICE_ACCELERATION
+#    include "progmem.h"
+#    include "util.h"
+#endif
+
 #ifdef MOUSEKEY_ENABLE
 #    include "mousekey.h"
 #endif
@@ -113,6 +118,15 @@ const pointing_device_driver_t custom_pointing_device_driver = {
 
 const pointing_device_driver_t *pointing_device_driver = &POINTING_DEVICE_DRIVER(POINTING_DEVICE_DRIVER_NAME);
 
+#ifdef POINTING_DEVICE_SECONDARY_DRIVER_NAME
+#    if defined(SPLIT_POINTING_ENABLE)
+#        error "POINTING_DEVICE_SECONDARY_DRIVER is not supported together with SPLIT_POINTING_ENABLE"
+#    endif
+const pointing_device_driver_t *pointing_device_secondary_driver = &POINTING_DEVICE_DRIVER(POINTING_DEVICE_SECONDARY_DRIVER_NAME);
+
+static bool secondary_device_ok = false;
+#endif // POINTING_DEVICE_SECONDARY_DRIVER_NAME
+
 __attribute__((weak)) void           pointing_device_init_modules(void) {}
 __attribute__((weak)) report_mouse_t pointing_device_task_modules(report_mouse_t mouse_report) {
     return mouse_report;
@@ -196,6 +210,9 @@ __attribute__((weak)) void pointing_device_init(void) {
 #    endif
 #endif
     }
+#ifdef POINTING_DEVICE_SECONDARY_DRIVER_NAME
+    secondary_device_ok = pointing_device_secondary_driver->init();
+#endif
 #ifdef POINTING_DEVICE_HIRES_SCROLL_ENABLE
     hires_scroll_resolution = POINTING_DEVICE_HIRES_SCROLL_MULTIPLIER;
     for (int i = 0; i < POINTING_DEVICE_HIRES_SCROLL_EXPONENT; i++) {
@@ -230,19 +247,58 @@ void pointing_device_set_status(pointing_device_status_t status) {
     pointing_device_status = status;
 }
 
+#ifdef POINTING_DEVICE_REPORT_BATCHING
+#    ifndef POINTING_DEVICE_REPORT_BATCHING_INTERVAL_MS
+#        define POINTING_DEVICE_REPORT_BATCHING_INTERVAL_MS 1 // matches the 1ms polling interval (bInterval) of the mouse endpoint
+#    endif
+#endif
+
 /**
  * @brief Sends processed mouse report to host
  *
  * This sends the mouse report generated by pointing_device_task if changed since the last report. Once send zeros mouse report except buttons.
  *
+ * With POINTING_DEVICE_REPORT_BATCHING motion deltas are instead accumulated
+ * across task runs and fused into a single report per host poll interval, so a
+ * sensor sampled faster than the host polls doesn't queue up stale reports.
+ * Button changes are always sent immediately.
  */
 __attribute__((weak)) bool pointing_device_send(void) {
-    static report_mouse_t old_report         = {};
-    bool                  should_send_report = has_mouse_report_changed(&local_mouse_report, &old_report);
+    static report_mouse_t old_report = {};
+#ifdef POINTING_DEVICE_REPORT_BATCHING
+    static xy_clamp_range_t accum_x = 0, accum_y = 0;
+    static hv_clamp_range_t accum_h = 0, accum_v = 0;
+    static uint32_t         last_send = 0;
+
+    accum_x += local_mouse_report.x;
+    accum_y += local_mouse_report.y;
+    accum_h += local_mouse_report.h;
+    accum_v += local_mouse_report.v;
+
+    bool buttons_changed    = local_mouse_report.buttons != old_report.buttons;
+    bool interval_elapsed   = timer_elapsed32(last_send) >= POINTING_DEVICE_REPORT_BATCHING_INTERVAL_MS;
+    bool should_send_report = buttons_changed || (interval_elapsed && (accum_x || accum_y || accum_h || accum_v));
 
     if (should_send_report) {
+        local_mouse_report.x = CONSTRAIN_HID_XY(accum_x);
+        local_mouse_report.y = CONSTRAIN_HID_XY(accum_y);
+        local_mouse_report.h = CONSTRAIN_HID_HV(accum_h);
+        local_mouse_report.v = CONSTRAIN_HID_HV(accum_v);
         host_mouse_send(&local_mouse_report);
+        // keep any clamped remainder so fast motion isn't lost, only deferred
+        accum_x -= local_mouse_report.x;
+        accum_y -= local_mouse_report.y;
+        accum_h -= local_mouse_report.h;
+        accum_v -= local_mouse_report.v;
+        last_send = timer_read32();
     }
+#else
+    bool should_send_report = has_mouse_report_changed(&local_mouse_report, &old_report);
+
+    if (should_send_report) {
+        host_mouse_send(&local_mouse_report);
+    }
+#endif
     // send it and 0 it out except for buttons, so those stay until they are explicity over-ridden using update_pointing_device
     uint8_t buttons = local_mouse_report.buttons;
     memset(&local_mouse_report, 0, sizeof(local_mouse_report));
@@ -252,10 +308,36 @@ __attribute__((weak)) bool pointing_device_send(void) {
     return should_send_report || buttons;
 }
 
+#ifdef POINTING_DEVICE_ACCELERATION
+/**
+ * @brief Apply the fixed-point acceleration curve to a mouse report
+ *
+ * The report's speed (|x| + |y|) selects a Q8.8 multiplier from the
+ * compile-time POINTING_DEVICE_ACCEL_LUT, integer-only per report.
+ *
+ * @param mouse_report[in] takes a report_mouse_t to be accelerated
+ * @return report_mouse_t with accelerated x/y deltas
+ */
+static report_mouse_t pointing_device_apply_acceleration(report_mouse_t mouse_report) {
+    static const uint16_t accel_lut[] PROGMEM = POINTING_DEVICE_ACCEL_LUT;
+
+    uint32_t speed  = (uint32_t)(mouse_report.x < 0 ? -mouse_report.x : mouse_report.x) + (uint32_t)(mouse_report.y < 0 ? -mouse_report.y : mouse_report.y);
+    uint32_t bucket = speed >> POINTING_DEVICE_ACCEL_BUCKET_SHIFT;
+    if (bucket >= ARRAY_SIZE(accel_lut)) {
+        bucket = ARRAY_SIZE(accel_lut) - 1;
+    }
+    uint16_t multiplier = pgm_read_word(&accel_lut[bucket]);
+
+    mouse_report.x = (mouse_xy_report_t)(((int32_t)mouse_report.x * multiplier) >> 8);
+    mouse_report.y = (mouse_xy_report_t)(((int32_t)mouse_report.y * multiplier) >> 8);
+    return mouse_report;
+}
+#endif // POINTING_DEVICE_ACCELERATION
+
 /**
  * @brief Adjust mouse report by any optional common pointing configuration defines
  *
- * This applies rotation or inversion to the mouse report as selected by the pointing device common configuration defines.
+ * This applies rotation, inversion and the acceleration curve to the mouse report as selected by the pointing device common configuration defines.
  *
  * @param mouse_report[in] takes a report_mouse_t to be adjusted
  * @return report_mouse_t with adjusted values
@@ -284,10 +366,40 @@ report_mouse_t pointing_device_adjust_by_defines(report_mouse_t mouse_report) {
 #endif
 #if defined(POINTING_DEVICE_INVERT_Y)
     mouse_report.y = -mouse_report.y;
+#endif
+#ifdef POINTING_DEVICE_ACCELERATION
+    mouse_report = pointing_device_apply_acceleration(mouse_report);
 #endif
     return mouse_report;
 }
 
+#ifdef POINTING_DEVICE_SECONDARY_DRIVER_NAME
+/**
+ * @brief Polls the secondary sensor and fuses its report into the primary's.
+ *
+ * The secondary device is polled on its own cadence (POINTING_DEVICE_SECONDARY_THROTTLE_MS),
+ * so a slow trackpad does not drag a fast trackball down to its rate. Button
+ * state from the last secondary poll is held between polls; the fused result
+ * comes from pointing_device_task_fusion_kb(), which defaults to clamped
+ * delta summation and OR'd buttons.
+ */
+static report_mouse_t pointing_device_task_fuse_secondary(report_mouse_t primary_report) {
+    static uint32_t last_poll         = 0;
+    static uint8_t  secondary_buttons = 0;
+    report_mouse_t  secondary_report  = {0};
+
+    if (secondary_device_ok && timer_elapsed32(last_poll) >= (POINTING_DEVICE_SECONDARY_THROTTLE_MS)) {
+        last_poll                = timer_read32();
+        secondary_report.buttons = secondary_buttons;
+        secondary_report         = pointing_device_secondary_driver->get_report(secondary_report);
+        secondary_buttons        = secondary_report.buttons;
+    } else {
+        secondary_report.buttons = secondary_buttons;
+    }
+    return pointing_device_task_fusion_kb(primary_report, secondary_report);
+}
+#endif // POINTING_DEVICE_SECONDARY_DRIVER_NAME
+
 /**
  * @brief Retrieves and processes pointing device data.
  *
@@ -341,6 +453,9 @@ __attribute__((weak)) bool pointing_device_task(void) {
 #    endif
 #else
     local_mouse_report = pointing_device_driver->get_report(local_mouse_report);
+#    ifdef POINTING_DEVICE_SECONDARY_DRIVER_NAME
+    local_mouse_report = pointing_device_task_fuse_secondary(local_mouse_report);
+#    endif
 #endif // defined(SPLIT_POINTING_ENABLE)
 
 #ifdef POINTING_DEVICE_MOTION_PIN
@@ -450,7 +565,9 @@ void pointing_device_set_cpi_on_side(bool left, uint16_t cpi) {
         shared_cpi = cpi;
     }
 }
+#endif // defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
 
+#if (defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)) || defined(POINTING_DEVICE_SECONDARY_DRIVER_NAME)
 /**
  * @brief clamps int16_t to int8_t, or int32_t to int16_t
  *
@@ -487,7 +604,7 @@ static inline mouse_xy_report_t pointing_device_xy_clamp(xy_clamp_range_t value)
  *
  * Combines 2 report_mouse_t structs, clamping movement values to int8_t and ignores report_id then returns the resulting report_mouse_t struct.
  *
- * NOTE: Only available when using SPLIT_POINTING_ENABLE and POINTING_DEVICE_COMBINED
+ * NOTE: Only available when using SPLIT_POINTING_ENABLE and POINTING_DEVICE_COMBINED, or a secondary pointing device driver
  *
  * @param[in] left_report left report_mouse_t
  * @param[in] right_report right report_mouse_t
@@ -501,7 +618,9 @@ report_mouse_t pointing_device_combine_reports(report_mouse_t left_report, repor
     left_report.buttons |= right_report.buttons;
     return left_report;
 }
+#endif // (defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)) || defined(POINTING_DEVICE_SECONDARY_DRIVER_NAME)
 
+#if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
 /**
  * @brief Adjust mouse report by any optional right pointing configuration defines
  *
@@ -536,6 +655,9 @@ report_mouse_t pointing_device_adjust_by_defines_right(report_mouse_t mouse_repo
 #    endif
 #    if defined(POINTING_DEVICE_INVERT_Y_RIGHT)
     mouse_report.y = -mouse_report.y;
+#    endif
+#    ifdef POINTING_DEVICE_ACCELERATION
+    mouse_report = pointing_device_apply_acceleration(mouse_report);
 #    endif
     return mouse_report;
 }
@@ -571,6 +693,38 @@ __attribute__((weak)) report_mouse_t pointing_device_task_combined_user(report_m
 }
 #endif
 
+#ifdef POINTING_DEVICE_SECONDARY_DRIVER_NAME
+/**
+ * @brief Weak function allowing keyboard level fusion of the two sensors' reports
+ *
+ * Takes the primary and secondary report_mouse_t structs, allowing a keyboard to implement
+ * its own fusion rule (e.g. let trackball velocity gate trackpad input) before the combined
+ * report continues through the pointing device pipeline.
+ *
+ * NOTE: Only available when using POINTING_DEVICE_SECONDARY_DRIVER
+ *
+ * @param[in] primary_report report_mouse_t
+ * @param[in] secondary_report report_mouse_t
+ * @return pointing_device_task_fusion_user(primary_report, secondary_report) by default
+ */
+__attribute__((weak)) report_mouse_t pointing_device_task_fusion_kb(report_mouse_t primary_report, report_mouse_t secondary_report) {
+    return pointing_device_task_fusion_user(primary_report, secondary_report);
+}
+
+/**
+ * @brief Weak function allowing user level fusion of the two sensors' reports
+ *
+ * NOTE: Only available when using POINTING_DEVICE_SECONDARY_DRIVER
+ *
+ * @param[in] primary_report report_mouse_t
+ * @param[in] secondary_report report_mouse_t
+ * @return pointing_device_combine_reports(primary_report, secondary_report) by default
+ */
+__attribute__((weak)) report_mouse_t pointing_device_task_fusion_user(report_mouse_t primary_report, report_mouse_t secondary_report) {
+    return pointing_device_combine_reports(primary_report, secondary_report);
+}
+#endif // POINTING_DEVICE_SECONDARY_DRIVER_NAME
+
 __attribute__((weak)) void pointing_device_keycode_handler(uint16_t keycode, bool pressed) {
     if IS_MOUSEKEY_BUTTON (keycode) {
         local_mouse_report.buttons = pointing_device_handle_buttons(local_mouse_report.buttons, pressed, keycode - QK_MOUSE_BUTTON_1);
@@ -115,8 +115,24 @@ typedef int32_t hv_clamp_range_t;
 typedef int16_t hv_clamp_range_t;
 #endif
 
+#if defined(POINTING_DEVICE_ACCELERATION)
+// Fixed-point (Q8.8) acceleration: the per-report speed (|x| + |y|) selects a
+// multiplier from a compile-time lookup table, so curves cost one integer
+// multiply per axis instead of emulated floating point on FPU-less targets.
+// 256 = 1.0x; the last entry applies to all higher speeds.
+#    if !defined(POINTING_DEVICE_ACCEL_LUT)
+#        define POINTING_DEVICE_ACCEL_LUT \
+            { 256, 256, 288, 320, 384, 448, 512, 640 }
+#    endif
+// Speed is divided by 2^shift to pick the table bucket
+#    if !defined(POINTING_DEVICE_ACCEL_BUCKET_SHIFT)
+#        define POINTING_DEVICE_ACCEL_BUCKET_SHIFT 2
+#    endif
+#endif // defined(POINTING_DEVICE_ACCELERATION)
+
 #define CONSTRAIN_HID(amt) ((amt) < INT8_MIN ? INT8_MIN : ((amt) > INT8_MAX ? INT8_MAX : (amt)))
 #define CONSTRAIN_HID_XY(amt) ((amt) < MOUSE_REPORT_XY_MIN ? MOUSE_REPORT_XY_MIN : ((amt) > MOUSE_REPORT_XY_MAX ? MOUSE_REPORT_XY_MAX : (amt)))
+#define CONSTRAIN_HID_HV(amt) ((amt) < MOUSE_REPORT_HV_MIN ? MOUSE_REPORT_HV_MIN : ((amt) > MOUSE_REPORT_HV_MAX ? MOUSE_REPORT_HV_MAX : (amt)))
 
 void                     pointing_device_init(void);
 bool                     pointing_device_task(void);
@@ -154,3 +170,14 @@ report_mouse_t pointing_device_task_combined_user(report_mouse_t left_report, re
 report_mouse_t pointing_device_adjust_by_defines_right(report_mouse_t mouse_report);
 #    endif // defined(POINTING_DEVICE_COMBINED)
 #endif     // defined(SPLIT_POINTING_ENABLE)
+
+#if defined(POINTING_DEVICE_SECONDARY_DRIVER_NAME)
+// How often the secondary sensor is polled; the primary polls at the main
+// task rate, so a slower secondary no longer drags both down to its rate
+#    if !defined(POINTING_DEVICE_SECONDARY_THROTTLE_MS)
+#        define POINTING_DEVICE_SECONDARY_THROTTLE_MS 5
+#    endif
+report_mouse_t pointing_device_combine_reports(report_mouse_t left_report, report_mouse_t right_report);
+report_mouse_t pointing_device_task_fusion_kb(report_mouse_t primary_report, report_mouse_t secondary_report);
+report_mouse_t pointing_device_task_fusion_user(report_mouse_t primary_report, report_mouse_t secondary_report);
+#endif // defined(POINTING_DEVICE_SECONDARY_DRIVER_NAME)
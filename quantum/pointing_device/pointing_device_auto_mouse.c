@@ -26,9 +26,10 @@
 
 /* local data structure for tracking auto mouse */
 static auto_mouse_context_t auto_mouse_context = {
-    .config.layer    = (uint8_t)(AUTO_MOUSE_DEFAULT_LAYER),
-    .config.timeout  = (uint16_t)(AUTO_MOUSE_TIME),
-    .config.debounce = (uint8_t)(AUTO_MOUSE_DEBOUNCE),
+    .config.layer      = (uint8_t)(AUTO_MOUSE_DEFAULT_LAYER),
+    .config.layer_mask = (layer_state_t)1 << (uint8_t)(AUTO_MOUSE_DEFAULT_LAYER),
+    .config.timeout    = (uint16_t)(AUTO_MOUSE_TIME),
+    .config.debounce   = (uint8_t)(AUTO_MOUSE_DEBOUNCE),
 };
 
 /* local functions */
@@ -146,7 +147,8 @@ void set_auto_mouse_enable(bool enable) {
 void set_auto_mouse_layer(uint8_t layer) {
     // skip if unchanged
     if (auto_mouse_context.config.layer == layer) return;
-    auto_mouse_context.config.layer = layer;
+    auto_mouse_context.config.layer      = layer;
+    auto_mouse_context.config.layer_mask = (layer_state_t)1 << layer;
     auto_mouse_reset();
 }
 
@@ -207,7 +209,7 @@ void auto_mouse_toggle(void) {
  */
 layer_state_t remove_auto_mouse_layer(layer_state_t state, bool force) {
     if (force || ((AUTO_MOUSE_ENABLED) && !layer_hold_check())) {
-        state &= ~((layer_state_t)1 << (AUTO_MOUSE_TARGET_LAYER));
+        state &= ~auto_mouse_context.config.layer_mask;
     }
     return state;
 }
@@ -248,6 +250,12 @@ __attribute__((weak)) bool auto_mouse_activation(report_mouse_t mouse_report) {
  *
  * Handel activation/deactivation of target layer based on auto_mouse_activation and state timers and local key/layer tracking data
  *
+ * Activation is hysteretic: entering requires the accumulated movement to cross
+ * AUTO_MOUSE_THRESHOLD (via auto_mouse_activation), but once active any motion
+ * outside AUTO_MOUSE_DEADBAND refreshes the timeout, so slow continuous motion
+ * that never crosses the threshold in a single report no longer flaps the layer.
+ * Reports inside the dead band skip trigger evaluation entirely.
+ *
  * @param[in] mouse_report report_mouse_t
  */
 void pointing_device_task_auto_mouse(report_mouse_t mouse_report) {
@@ -255,16 +263,29 @@ void pointing_device_task_auto_mouse(report_mouse_t mouse_report) {
     if (!(AUTO_MOUSE_ENABLED) || timer_elapsed(auto_mouse_context.timer.active) <= auto_mouse_context.config.debounce || timer_elapsed(auto_mouse_context.timer.delay) <= AUTO_MOUSE_DELAY) {
         return;
     }
-    // update activation and reset debounce
-    auto_mouse_context.status.is_activated = auto_mouse_activation(mouse_report);
+    // dead band gate: does this report carry any qualifying input?
+    const bool outside_deadband = abs(mouse_report.x) > (AUTO_MOUSE_DEADBAND) || abs(mouse_report.y) > (AUTO_MOUSE_DEADBAND) || abs(mouse_report.h) > (AUTO_MOUSE_DEADBAND) || abs(mouse_report.v) > (AUTO_MOUSE_DEADBAND) || mouse_report.buttons;
+
+    if (!auto_mouse_context.status.is_activated) {
+        // enter: accumulate towards the activation threshold
+        if (outside_deadband) {
+            auto_mouse_context.status.is_activated = auto_mouse_activation(mouse_report);
+        }
+    } else if (!outside_deadband && !auto_mouse_context.status.mouse_key_tracker && !layer_hold_check() && timer_elapsed(auto_mouse_context.timer.active) > auto_mouse_context.config.timeout) {
+        // exit: nothing has refreshed the hold for the full timeout
+        auto_mouse_context.status.is_activated = false;
+    }
+
     if (is_auto_mouse_active()) {
-        auto_mouse_context.total_mouse_movement = (total_mouse_movement_t){.x = 0, .y = 0, .h = 0, .v = 0};
-        auto_mouse_context.timer.active         = timer_read();
-        auto_mouse_context.timer.delay          = 0;
-        if (!layer_state_is((AUTO_MOUSE_TARGET_LAYER))) {
+        if (outside_deadband || auto_mouse_context.status.mouse_key_tracker || layer_hold_check()) {
+            auto_mouse_context.total_mouse_movement = (total_mouse_movement_t){.x = 0, .y = 0, .h = 0, .v = 0};
+            auto_mouse_context.timer.active         = timer_read();
+            auto_mouse_context.timer.delay          = 0;
+        }
+        if (!(layer_state & auto_mouse_context.config.layer_mask)) {
             layer_on((AUTO_MOUSE_TARGET_LAYER));
         }
-    } else if (layer_state_is((AUTO_MOUSE_TARGET_LAYER)) && timer_elapsed(auto_mouse_context.timer.active) > auto_mouse_context.config.timeout) {
+    } else if ((layer_state & auto_mouse_context.config.layer_mask) && timer_elapsed(auto_mouse_context.timer.active) > auto_mouse_context.config.timeout) {
         layer_off((AUTO_MOUSE_TARGET_LAYER));
         auto_mouse_context.timer.active         = 0;
         auto_mouse_context.total_mouse_movement = (total_mouse_movement_t){.x = 0, .y = 0, .h = 0, .v = 0};
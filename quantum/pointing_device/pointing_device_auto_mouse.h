@@ -45,6 +45,9 @@
 #ifndef AUTO_MOUSE_THRESHOLD
 #    define AUTO_MOUSE_THRESHOLD 10
 #endif
+#ifndef AUTO_MOUSE_DEADBAND
+#    define AUTO_MOUSE_DEADBAND 0
+#endif
 
 /* data structure */
 typedef struct {
@@ -55,10 +58,11 @@ typedef struct {
 } total_mouse_movement_t;
 typedef struct {
     struct {
-        bool     is_enabled;
-        uint8_t  layer;
-        uint16_t timeout;
-        uint8_t  debounce;
+        bool          is_enabled;
+        uint8_t       layer;
+        layer_state_t layer_mask; // precomputed 1 << layer, kept in sync by set_auto_mouse_layer
+        uint16_t      timeout;
+        uint8_t       debounce;
     } config;
     struct {
         uint16_t active;
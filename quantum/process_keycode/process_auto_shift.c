@@ -14,12 +14,19 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
+
 #include "process_auto_shift.h"
 #include "quantum.h"
 #include "action_util.h"
 #include "timer.h"
+#include "keycode_class.h"
 #include "keycodes.h"
 
+#ifdef DEFERRED_EXEC_ENABLE
+#    include "deferred_exec.h"
+#endif
+
 #ifndef AUTO_SHIFT_DISABLED_AT_STARTUP
 #    define AUTO_SHIFT_STARTUP_STATE true /* enabled */
 #else
@@ -61,32 +68,115 @@ static struct {
 } autoshift_flags = {AUTO_SHIFT_STARTUP_STATE, false, false, false, false, false};
 // clang-format on
 
+#ifdef AUTO_SHIFT_ADAPTIVE
+// Per-key moving average of tap hold times, in Q12.4 fixed-point
+// milliseconds. Keys share the 8-bit space used by autoshift_shift_states;
+// 0 means no sample has been folded in yet.
+static uint16_t autoshift_tap_ewma[1 << 8];
+
+/** \brief Folds a resolved tap's hold time into the per-key statistics */
+static void autoshift_adapt(uint16_t keycode, uint16_t duration) {
+    uint16_t *ewma = &autoshift_tap_ewma[keycode & 0xFF];
+
+    // Keep the Q12.4 sample within uint16_t; taps can't realistically
+    // approach 2 seconds anyway as the timeout would resolve them as holds.
+    if (duration > 2047) {
+        duration = 2047;
+    }
+    const uint16_t sample = duration << 4;
+
+    if (*ewma == 0) {
+        *ewma = sample;
+    } else {
+        *ewma += (int16_t)(sample - *ewma) / (1 << AUTO_SHIFT_ADAPT_SHIFT);
+    }
+}
+#endif
+
+static void autoshift_end(uint16_t keycode, uint16_t now, bool matrix_trigger, keyrecord_t *record);
+
+#ifdef DEFERRED_EXEC_ENABLE
+// With the deferred executor available, the hold timeout is an exact
+// scheduled wake-up armed on press instead of a check on every main loop
+// iteration; autoshift_matrix_scan() then has nothing left to poll.
+static deferred_token autoshift_expire_token = INVALID_DEFERRED_TOKEN;
+
+static uint32_t autoshift_expire_callback(uint32_t trigger_time, void *cb_arg) {
+    if (autoshift_flags.in_progress) {
+        const uint16_t now = timer_read();
+        // Re-evaluate the timeout: a per-key or adaptive implementation may
+        // have moved it since the wake-up was armed.
+        const uint16_t timeout =
+#    ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
+            get_autoshift_timeout(autoshift_lastkey, &autoshift_lastrecord)
+#    else
+            autoshift_timeout
+#    endif
+            ;
+        if (TIMER_DIFF_16(now, autoshift_time) < timeout) {
+            // Not expired yet, sleep out the remainder under the same token.
+            return timeout - TIMER_DIFF_16(now, autoshift_time);
+        }
+        autoshift_end(autoshift_lastkey, now, true, &autoshift_lastrecord);
+    }
+    autoshift_expire_token = INVALID_DEFERRED_TOKEN;
+    return 0;
+}
+
+static void autoshift_schedule_expiry(uint16_t timeout) {
+    if (autoshift_expire_token == INVALID_DEFERRED_TOKEN || !extend_deferred_exec(autoshift_expire_token, timeout)) {
+        autoshift_expire_token = defer_exec(timeout, autoshift_expire_callback, NULL);
+    }
+}
+
+static void autoshift_cancel_expiry(void) {
+    if (autoshift_expire_token != INVALID_DEFERRED_TOKEN) {
+        cancel_deferred_exec(autoshift_expire_token);
+        autoshift_expire_token = INVALID_DEFERRED_TOKEN;
+    }
+}
+#endif
+
 /** \brief Called on physical press, returns whether key should be added to Auto Shift */
 __attribute__((weak)) bool get_custom_auto_shifted_key(uint16_t keycode, keyrecord_t *record) {
     return false;
 }
 
-/** \brief Called on physical press, returns whether key is an Auto Shift key */
-__attribute__((weak)) bool get_auto_shifted_key(uint16_t keycode, keyrecord_t *record) {
-    switch (keycode) {
+// Expression forms of the AUTO_SHIFT_* case ranges, assembled into one flash
+// bitset from the NO_AUTO_SHIFT_* options in effect for this build.
 #ifndef NO_AUTO_SHIFT_ALPHA
-        case AUTO_SHIFT_ALPHA:
+#    define AUTO_SHIFT_CLASS_ALPHA(k) ((k) >= KC_A && (k) <= KC_Z)
+#else
+#    define AUTO_SHIFT_CLASS_ALPHA(k) 0
 #endif
 #ifndef NO_AUTO_SHIFT_NUMERIC
-        case AUTO_SHIFT_NUMERIC:
+#    define AUTO_SHIFT_CLASS_NUMERIC(k) ((k) >= KC_1 && (k) <= KC_0)
+#else
+#    define AUTO_SHIFT_CLASS_NUMERIC(k) 0
 #endif
-#ifndef NO_AUTO_SHIFT_SPECIAL
-#    ifndef NO_AUTO_SHIFT_TAB
-        case KC_TAB:
-#    endif
-#    ifndef NO_AUTO_SHIFT_SYMBOLS
-        case AUTO_SHIFT_SYMBOLS:
-#    endif
+#if !defined(NO_AUTO_SHIFT_SPECIAL) && !defined(NO_AUTO_SHIFT_TAB)
+#    define AUTO_SHIFT_CLASS_TAB(k) ((k) == KC_TAB)
+#else
+#    define AUTO_SHIFT_CLASS_TAB(k) 0
+#endif
+#if !defined(NO_AUTO_SHIFT_SPECIAL) && !defined(NO_AUTO_SHIFT_SYMBOLS)
+#    define AUTO_SHIFT_CLASS_SYMBOLS(k) (((k) >= KC_MINUS && (k) <= KC_SLASH) || (k) == KC_NONUS_BACKSLASH)
+#else
+#    define AUTO_SHIFT_CLASS_SYMBOLS(k) 0
 #endif
 #ifdef AUTO_SHIFT_ENTER
-        case KC_ENT:
+#    define AUTO_SHIFT_CLASS_ENTER(k) ((k) == KC_ENT)
+#else
+#    define AUTO_SHIFT_CLASS_ENTER(k) 0
 #endif
-            return true;
+#define AUTO_SHIFT_DEFAULT_CLASS(k) (AUTO_SHIFT_CLASS_ALPHA(k) || AUTO_SHIFT_CLASS_NUMERIC(k) || AUTO_SHIFT_CLASS_TAB(k) || AUTO_SHIFT_CLASS_SYMBOLS(k) || AUTO_SHIFT_CLASS_ENTER(k))
+
+static const uint8_t auto_shift_default_keys[32] PROGMEM = KEYCODE_CLASS_TABLE(AUTO_SHIFT_DEFAULT_CLASS);
+
+/** \brief Called on physical press, returns whether key is an Auto Shift key */
+__attribute__((weak)) bool get_auto_shifted_key(uint16_t keycode, keyrecord_t *record) {
+    if (keycode_class_test(auto_shift_default_keys, keycode)) {
+        return true;
     }
     return get_custom_auto_shifted_key(keycode, record);
 }
@@ -224,6 +314,18 @@ static bool autoshift_press(uint16_t keycode, uint16_t now, keyrecord_t *record)
     autoshift_time              = now;
     autoshift_flags.in_progress = true;
 
+#ifdef DEFERRED_EXEC_ENABLE
+    // clang-format off
+    autoshift_schedule_expiry(
+#    ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
+        get_autoshift_timeout(keycode, record)
+#    else
+        autoshift_timeout
+#    endif
+    );
+    // clang-format on
+#endif
+
 #if !defined(NO_ACTION_ONESHOT) && !defined(NO_ACTION_TAPPING)
     clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
 #endif
@@ -243,6 +345,13 @@ static void autoshift_end(uint16_t keycode, uint16_t now, bool matrix_trigger, k
     if (autoshift_flags.in_progress && (keycode == autoshift_lastkey || keycode == KC_NO)) {
         // Process the auto-shiftable key.
         autoshift_flags.in_progress = false;
+#ifdef DEFERRED_EXEC_ENABLE
+        if (!matrix_trigger) {
+            // A real key event resolved the hold before the scheduled
+            // wake-up; the expiry callback cleans up after itself.
+            autoshift_cancel_expiry();
+        }
+#endif
         // clang-format off
         autoshift_flags.lastshifted =
             autoshift_flags.lastshifted
@@ -254,6 +363,14 @@ static void autoshift_end(uint16_t keycode, uint16_t now, bool matrix_trigger, k
 #endif
         ;
         // clang-format on
+#ifdef AUTO_SHIFT_ADAPTIVE
+        // Only a real release of the same key that resolved as a tap is a
+        // clean sample of the user's tap duration; rolls (KC_NO) and timeout
+        // triggers say nothing about how long the tap would have lasted.
+        if (!matrix_trigger && keycode == autoshift_lastkey && !autoshift_flags.lastshifted) {
+            autoshift_adapt(autoshift_lastkey, TIMER_DIFF_16(now, autoshift_time));
+        }
+#endif
         set_autoshift_shift_state(autoshift_lastkey, autoshift_flags.lastshifted);
         if (get_mods() & MOD_BIT(KC_LSFT)) {
             autoshift_flags.cancelling_lshift = true;
@@ -355,8 +472,37 @@ bool get_autoshift_state(void) {
 uint16_t get_generic_autoshift_timeout(void) {
     return autoshift_timeout;
 }
+
+#ifdef AUTO_SHIFT_ADAPTIVE
+uint16_t get_adaptive_autoshift_timeout(uint16_t keycode) {
+    const uint16_t ewma = autoshift_tap_ewma[keycode & 0xFF];
+    if (ewma == 0) {
+        // No samples yet, fall back to the configured timeout.
+        return autoshift_timeout;
+    }
+
+    // Q12.4 average times Q4.4 ratio, shifted back to whole milliseconds.
+    uint16_t timeout = ((uint32_t)ewma * AUTO_SHIFT_ADAPT_RATIO) >> 8;
+    if (timeout < AUTO_SHIFT_ADAPT_MIN) {
+        timeout = AUTO_SHIFT_ADAPT_MIN;
+    }
+    if (timeout > AUTO_SHIFT_ADAPT_MAX) {
+        timeout = AUTO_SHIFT_ADAPT_MAX;
+    }
+    return timeout;
+}
+
+void autoshift_adaptive_reset(void) {
+    memset(autoshift_tap_ewma, 0, sizeof(autoshift_tap_ewma));
+}
+#endif
+
 __attribute__((weak)) uint16_t get_autoshift_timeout(uint16_t keycode, keyrecord_t *record) {
+#ifdef AUTO_SHIFT_ADAPTIVE
+    return get_adaptive_autoshift_timeout(keycode);
+#else
     return autoshift_timeout;
+#endif
 }
 
 void set_autoshift_timeout(uint16_t timeout) {
@@ -26,6 +26,31 @@
 #    define AUTO_SHIFT_TIMEOUT 175
 #endif
 
+#ifdef AUTO_SHIFT_ADAPTIVE
+// The adaptive timeout is evaluated through the per-key timeout plumbing.
+#    ifndef AUTO_SHIFT_TIMEOUT_PER_KEY
+#        define AUTO_SHIFT_TIMEOUT_PER_KEY
+#    endif
+// Weight of each new tap sample in the per-key average: 1/2^shift.
+#    ifndef AUTO_SHIFT_ADAPT_SHIFT
+#        define AUTO_SHIFT_ADAPT_SHIFT 3
+#    elif AUTO_SHIFT_ADAPT_SHIFT < 1 || AUTO_SHIFT_ADAPT_SHIFT > 7
+#        error AUTO_SHIFT_ADAPT_SHIFT must be between 1 and 7
+#    endif
+// The timeout is the average tap duration scaled by ratio/16; 24 is 1.5x.
+#    ifndef AUTO_SHIFT_ADAPT_RATIO
+#        define AUTO_SHIFT_ADAPT_RATIO 24
+#    endif
+// Bounds the adapted timeout so a run of unusual taps cannot make holds
+// unreachable or taps indistinguishable from them.
+#    ifndef AUTO_SHIFT_ADAPT_MIN
+#        define AUTO_SHIFT_ADAPT_MIN 50
+#    endif
+#    ifndef AUTO_SHIFT_ADAPT_MAX
+#        define AUTO_SHIFT_ADAPT_MAX AUTO_SHIFT_TIMEOUT
+#    endif
+#endif
+
 #define IS_RETRO(kc) (IS_QK_MOD_TAP(kc) || IS_QK_LAYER_TAP(kc))
 
 #define DO_GET_AUTOSHIFT_TIMEOUT(keycode, record, ...) record
@@ -58,3 +83,8 @@ void     autoshift_matrix_scan(void);
 bool     get_custom_auto_shifted_key(uint16_t keycode, keyrecord_t *record);
 bool     get_auto_shifted_key(uint16_t keycode, keyrecord_t *record);
 // clang-format on
+
+#ifdef AUTO_SHIFT_ADAPTIVE
+uint16_t get_adaptive_autoshift_timeout(uint16_t keycode);
+void     autoshift_adaptive_reset(void);
+#endif
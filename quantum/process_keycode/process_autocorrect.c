@@ -19,9 +19,177 @@
 #    include "autocorrect_data_default.h"
 #endif
 
+#ifdef AUTOCORRECT_DICTIONARY_NVM
+#    include "eeprom.h"
+
+#    ifndef AUTOCORRECT_EEPROM_ADDR
+#        error "AUTOCORRECT_DICTIONARY_NVM requires AUTOCORRECT_EEPROM_ADDR to point at a reserved EEPROM region"
+#    endif
+#    ifndef AUTOCORRECT_EEPROM_MAX_SIZE
+#        define AUTOCORRECT_EEPROM_MAX_SIZE 1024
+#    endif
+
+/* The NVM dictionary region holds a 4 byte header (u16 magic, u16 blob size)
+ * followed by a trie blob in exactly the format of `autocorrect_data[]`. When
+ * the magic is valid, lookups read the blob instead of the built-in flash
+ * dictionary; otherwise the compiled-in data is used unchanged. The magic is
+ * cleared before an upload starts, so a half-written blob never goes live. */
+#    define AUTOCORRECT_NVM_MAGIC 0x4143 // 'AC'
+#    define AUTOCORRECT_NVM_HEADER_SIZE 4
+#    define AUTOCORRECT_NVM_BLOB_MAX (AUTOCORRECT_EEPROM_MAX_SIZE - AUTOCORRECT_NVM_HEADER_SIZE)
+
+static bool     nvm_dict_checked = false;
+static bool     nvm_dict_active  = false;
+static uint16_t nvm_dict_size    = 0;
+
+static void autocorrect_nvm_validate(void) {
+    nvm_dict_active = false;
+    nvm_dict_size   = 0;
+    if (eeprom_read_word((const uint16_t *)AUTOCORRECT_EEPROM_ADDR) == AUTOCORRECT_NVM_MAGIC) {
+        uint16_t size = eeprom_read_word((const uint16_t *)(AUTOCORRECT_EEPROM_ADDR + 2));
+        if (size > 0 && size <= AUTOCORRECT_NVM_BLOB_MAX) {
+            nvm_dict_active = true;
+            nvm_dict_size   = size;
+        }
+    }
+    nvm_dict_checked = true;
+}
+
+static uint8_t autocorrect_data_read(uint16_t offset) {
+    if (nvm_dict_active) {
+        return eeprom_read_byte((const uint8_t *)(AUTOCORRECT_EEPROM_ADDR + AUTOCORRECT_NVM_HEADER_SIZE + offset));
+    }
+    return pgm_read_byte(autocorrect_data + offset);
+}
+
+static uint16_t autocorrect_dictionary_size(void) {
+    return nvm_dict_active ? nvm_dict_size : DICTIONARY_SIZE;
+}
+
+// With an NVM dictionary the correction string may live in EEPROM, so it is
+// materialized into a RAM buffer and handled with the non-PROGMEM helpers.
+static const char *autocorrect_changes_str(uint16_t offset) {
+    static char buffer[AUTOCORRECT_MAX_LENGTH + 10];
+    uint8_t     i = 0;
+    do {
+        buffer[i] = (char)autocorrect_data_read(offset + i);
+    } while (buffer[i] != '\0' && ++i < sizeof(buffer) - 1);
+    buffer[sizeof(buffer) - 1] = '\0';
+    return buffer;
+}
+
+#    define autocorrect_str_copy(dst, src) strcpy((dst), (src))
+#    define autocorrect_str_send(str) send_string(str)
+#else
+static inline uint8_t autocorrect_data_read(uint16_t offset) {
+    return pgm_read_byte(autocorrect_data + offset);
+}
+
+#    define autocorrect_dictionary_size() ((uint16_t)DICTIONARY_SIZE)
+#    define autocorrect_str_copy(dst, src) strcpy_P((dst), (src))
+#    define autocorrect_str_send(str) send_string_P(str)
+#endif
+
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
 static uint8_t typo_buffer_size                    = 1;
 
+/* The trie stores words reversed, so every search starts at the root with the
+ * key just typed; with a large dictionary the root has a child per letter and
+ * its sibling list is the longest in the trie. Precompute the root's
+ * transitions once so each keypress starts with a table lookup instead of a
+ * linear sibling scan, and keys with no root edge bail out immediately. */
+static uint16_t root_child_state[64];
+static bool     root_index_built = false;
+
+static void build_autocorrect_root_index(void) {
+#ifdef AUTOCORRECT_DICTIONARY_NVM
+    if (!nvm_dict_checked) {
+        autocorrect_nvm_validate();
+    }
+#endif
+    uint16_t state = 0;
+    uint8_t  code  = autocorrect_data_read(state);
+
+    memset(root_child_state, 0, sizeof(root_child_state));
+    if (code & 64) { // Multiple children: walk the sibling triplet list.
+        code &= 63;
+        while (code) {
+            root_child_state[code] = (uint16_t)(autocorrect_data_read(state + 1) | autocorrect_data_read(state + 2) << 8);
+            state += 3;
+            code = autocorrect_data_read(state);
+        }
+    } else if (code) { // Single child: the node follows inline.
+        root_child_state[code & 63] = autocorrect_data_read(state + 1) ? state + 1 : state + 2;
+    }
+    root_index_built = true;
+}
+
+#ifdef AUTOCORRECT_DICTIONARY_NVM
+/**
+ * @brief Whether lookups are currently served from the NVM dictionary
+ *
+ * @return true if a valid uploaded dictionary is active
+ * @return false if the built-in flash dictionary is in use
+ */
+bool autocorrect_dictionary_nvm_active(void) {
+    if (!nvm_dict_checked) {
+        autocorrect_nvm_validate();
+    }
+    return nvm_dict_active;
+}
+
+/**
+ * @brief Start a dictionary upload
+ *
+ * Invalidates any stored dictionary so a partially written blob can never be
+ * used, and falls back to the built-in dictionary until the upload commits.
+ */
+void autocorrect_dictionary_nvm_begin_update(void) {
+    eeprom_update_word((uint16_t *)AUTOCORRECT_EEPROM_ADDR, 0);
+    nvm_dict_active  = false;
+    nvm_dict_size    = 0;
+    nvm_dict_checked = true;
+    root_index_built = false;
+}
+
+/**
+ * @brief Write a chunk of trie data at `offset` within the dictionary blob
+ *
+ * @return false if the chunk would overrun the reserved region
+ */
+bool autocorrect_dictionary_nvm_write_chunk(uint16_t offset, const uint8_t *data, uint16_t length) {
+    if (offset + length > AUTOCORRECT_NVM_BLOB_MAX || offset + length < offset) {
+        return false;
+    }
+    eeprom_update_block(data, (uint8_t *)(AUTOCORRECT_EEPROM_ADDR + AUTOCORRECT_NVM_HEADER_SIZE + offset), length);
+    return true;
+}
+
+/**
+ * @brief Finish a dictionary upload and make it live
+ *
+ * @param size total size of the uploaded trie blob in bytes
+ * @return false if `size` does not fit the reserved region
+ */
+bool autocorrect_dictionary_nvm_commit(uint16_t size) {
+    if (size == 0 || size > AUTOCORRECT_NVM_BLOB_MAX) {
+        return false;
+    }
+    eeprom_update_word((uint16_t *)(AUTOCORRECT_EEPROM_ADDR + 2), size);
+    eeprom_update_word((uint16_t *)AUTOCORRECT_EEPROM_ADDR, AUTOCORRECT_NVM_MAGIC);
+    autocorrect_nvm_validate();
+    root_index_built = false;
+    return nvm_dict_active;
+}
+
+/**
+ * @brief Discard the stored dictionary and return to the built-in one
+ */
+void autocorrect_dictionary_nvm_reset(void) {
+    autocorrect_dictionary_nvm_begin_update();
+}
+#endif // AUTOCORRECT_DICTIONARY_NVM
+
 /**
  * @brief function for querying the enabled state of autocorrect
  *
@@ -280,36 +448,25 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
     }
 
     // Check for typo in buffer using a trie stored in `autocorrect_data`.
-    uint16_t state = 0;
-    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
-    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
-        uint8_t const key_i = typo_buffer[i];
-
-        if (code & 64) { // Check for match in node with multiple children.
-            code &= 63;
-            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
-                if (!code) return true;
-            }
-            // Follow link to child node.
-            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
-            // Check for match in node with single child.
-        } else if (code != key_i) {
-            return true;
-        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
-            ++state;
-        }
-
-        // Stop if `state` becomes an invalid index. This should not normally
-        // happen, it is a safeguard in case of a bug, data corruption, etc.
-        if (state >= DICTIONARY_SIZE) {
-            return true;
-        }
-
-        code = pgm_read_byte(autocorrect_data + state);
-
+    // The first transition (on the key just typed) comes from the root index.
+    if (!root_index_built) {
+        build_autocorrect_root_index();
+    }
+    uint16_t state = root_child_state[typo_buffer[typo_buffer_size - 1] & 63];
+    if (state == 0 || state >= autocorrect_dictionary_size()) {
+        return true;
+    }
+    uint8_t code = autocorrect_data_read(state);
+    // The extra i == -1 pass checks for a completed entry after the final
+    // transition without duplicating the apply block.
+    for (int8_t i = typo_buffer_size - 2; i >= -1; --i) {
         if (code & 128) { // A typo was found! Apply autocorrect.
             const uint8_t backspaces = (code & 63) + !record->event.pressed;
-            const char   *changes    = (const char *)(autocorrect_data + state + 1);
+#ifdef AUTOCORRECT_DICTIONARY_NVM
+            const char *changes = autocorrect_changes_str(state + 1);
+#else
+            const char *changes = (const char *)(autocorrect_data + state + 1);
+#endif
 
             /* Gather info about the typo'd word
              *
@@ -353,13 +510,13 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
 
             uint8_t offset = space_last ? backspaces : backspaces + 1;
             strcpy(correct, typo);
-            strcpy_P(correct + typo_len - offset, changes);
+            autocorrect_str_copy(correct + typo_len - offset, changes);
 
             if (apply_autocorrect(backspaces, changes, typo, correct)) {
                 for (uint8_t i = 0; i < backspaces; ++i) {
                     tap_code(KC_BSPC);
                 }
-                send_string_P(changes);
+                autocorrect_str_send(changes);
             }
 
             if (keycode == KC_SPC) {
@@ -371,6 +528,34 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
                 return false;
             }
         }
+
+        if (i < 0) {
+            break;
+        }
+
+        uint8_t const key_i = typo_buffer[i];
+
+        if (code & 64) { // Check for match in node with multiple children.
+            code &= 63;
+            for (; code != key_i; code = autocorrect_data_read(state += 3)) {
+                if (!code) return true;
+            }
+            // Follow link to child node.
+            state = (autocorrect_data_read(state + 1) | autocorrect_data_read(state + 2) << 8);
+            // Check for match in node with single child.
+        } else if (code != key_i) {
+            return true;
+        } else if (!(code = autocorrect_data_read(++state))) {
+            ++state;
+        }
+
+        // Stop if `state` becomes an invalid index. This should not normally
+        // happen, it is a safeguard in case of a bug, data corruption, etc.
+        if (state >= autocorrect_dictionary_size()) {
+            return true;
+        }
+
+        code = autocorrect_data_read(state);
     }
     return true;
 }
@@ -19,3 +19,14 @@ bool autocorrect_is_enabled(void);
 void autocorrect_enable(void);
 void autocorrect_disable(void);
 void autocorrect_toggle(void);
+
+#ifdef AUTOCORRECT_DICTIONARY_NVM
+// Chunked dictionary upload, intended to be driven from `raw_hid_receive()`.
+// A new trie blob is staged with `begin_update`, written with `write_chunk`,
+// and made live with `commit`; `reset` returns to the built-in dictionary.
+bool autocorrect_dictionary_nvm_active(void);
+void autocorrect_dictionary_nvm_begin_update(void);
+bool autocorrect_dictionary_nvm_write_chunk(uint16_t offset, const uint8_t *data, uint16_t length);
+bool autocorrect_dictionary_nvm_commit(uint16_t size);
+void autocorrect_dictionary_nvm_reset(void);
+#endif
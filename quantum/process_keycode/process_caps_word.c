@@ -16,6 +16,7 @@
 #include "process_auto_shift.h"
 #include "process_space_cadet.h"
 #include "caps_word.h"
+#include "keycode_class.h"
 #include "keycodes.h"
 #include "quantum_keycodes.h"
 #include "modifiers.h"
@@ -256,22 +257,22 @@ bool process_caps_word(uint16_t keycode, keyrecord_t* record) {
     return true;
 }
 
-__attribute__((weak)) bool caps_word_press_user(uint16_t keycode) {
-    switch (keycode) {
-        // Keycodes that continue Caps Word, with shift applied.
-        case KC_A ... KC_Z:
-        case KC_MINS:
-            add_weak_mods(MOD_BIT(KC_LSFT)); // Apply shift to next key.
-            return true;
+// Keycodes that continue Caps Word, with shift applied.
+#define CAPS_WORD_SHIFTED_CLASS(k) (((k) >= KC_A && (k) <= KC_Z) || (k) == KC_MINS)
+// Keycodes that continue Caps Word, without shifting.
+#define CAPS_WORD_CONTINUE_CLASS(k) (((k) >= KC_1 && (k) <= KC_0) || (k) == KC_BSPC || (k) == KC_DEL)
 
-        // Keycodes that continue Caps Word, without shifting.
-        case KC_1 ... KC_0:
-        case KC_BSPC:
-        case KC_DEL:
-        case KC_UNDS:
-            return true;
+static const uint8_t caps_word_shifted_keys[32] PROGMEM  = KEYCODE_CLASS_TABLE(CAPS_WORD_SHIFTED_CLASS);
+static const uint8_t caps_word_continue_keys[32] PROGMEM = KEYCODE_CLASS_TABLE(CAPS_WORD_CONTINUE_CLASS);
 
-        default:
-            return false; // Deactivate Caps Word.
+__attribute__((weak)) bool caps_word_press_user(uint16_t keycode) {
+    if (keycode_class_test(caps_word_shifted_keys, keycode)) {
+        add_weak_mods(MOD_BIT(KC_LSFT)); // Apply shift to next key.
+        return true;
+    }
+    // KC_UNDS is shifted KC_MINS and falls outside the 8-bit tables.
+    if (keycode == KC_UNDS || keycode_class_test(caps_word_continue_keys, keycode)) {
+        return true;
     }
+    return false; // Deactivate Caps Word.
 }
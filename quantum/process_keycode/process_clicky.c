@@ -23,12 +23,20 @@
 #    ifndef AUDIO_CLICKY_FREQ_RANDOMNESS
 #        define AUDIO_CLICKY_FREQ_RANDOMNESS 0.05f
 #    endif // !AUDIO_CLICKY_FREQ_RANDOMNESS
+#    ifndef AUDIO_CLICKY_POOL_SIZE
+#        define AUDIO_CLICKY_POOL_SIZE 4
+#    endif // !AUDIO_CLICKY_POOL_SIZE
 
 float clicky_freq = AUDIO_CLICKY_FREQ_DEFAULT;
 float clicky_rand = AUDIO_CLICKY_FREQ_RANDOMNESS;
 
-// the first "note" is an intentional delay; the 2nd and 3rd notes are the "clicky"
-float clicky_song[][2] = {{0.0f, AUDIO_CLICKY_DELAY_DURATION}, {AUDIO_CLICKY_FREQ_DEFAULT, 3}, {AUDIO_CLICKY_FREQ_DEFAULT, 1}}; // 3 and 1 --> durations
+// Click variants are rendered ahead of time into a small pool, so the
+// per-keystroke path is a table pick instead of float math -- the random pitch
+// wobble is baked into the variants when the pool is (re)rendered. The first
+// "note" of each variant is an intentional delay; the 2nd and 3rd notes are
+// the "clicky" (3 and 1 --> durations).
+static float clicky_pool[AUDIO_CLICKY_POOL_SIZE][3][2];
+static bool  clicky_pool_rendered = false;
 
 extern audio_config_t audio_config;
 
@@ -37,31 +45,47 @@ extern bool music_activated;
 extern bool midi_activated;
 #    endif // !NO_MUSIC_MODE
 
+static void clicky_pool_render(void) {
+    for (uint8_t i = 0; i < AUDIO_CLICKY_POOL_SIZE; i++) {
+        clicky_pool[i][0][0] = 0.0f;
+        clicky_pool[i][0][1] = AUDIO_CLICKY_DELAY_DURATION;
+        clicky_pool[i][1][0] = 2.0f * clicky_freq * (1.0f + clicky_rand * (((float)rand()) / ((float)(RAND_MAX))));
+        clicky_pool[i][1][1] = 3;
+        clicky_pool[i][2][0] = clicky_freq * (1.0f + clicky_rand * (((float)rand()) / ((float)(RAND_MAX))));
+        clicky_pool[i][2][1] = 1;
+    }
+    clicky_pool_rendered = true;
+}
+
 void clicky_play(void) {
 #    ifndef NO_MUSIC_MODE
     if (music_activated || midi_activated || !audio_config.enable) return;
 #    endif // !NO_MUSIC_MODE
-    clicky_song[1][0] = 2.0f * clicky_freq * (1.0f + clicky_rand * (((float)rand()) / ((float)(RAND_MAX))));
-    clicky_song[2][0] = clicky_freq * (1.0f + clicky_rand * (((float)rand()) / ((float)(RAND_MAX))));
-    PLAY_SONG(clicky_song);
+    if (!clicky_pool_rendered) {
+        clicky_pool_render();
+    }
+    PLAY_SONG(clicky_pool[rand() % AUDIO_CLICKY_POOL_SIZE]);
 }
 
 void clicky_freq_up(void) {
     float new_freq = clicky_freq * AUDIO_CLICKY_FREQ_FACTOR;
     if (new_freq < AUDIO_CLICKY_FREQ_MAX) {
-        clicky_freq = new_freq;
+        clicky_freq          = new_freq;
+        clicky_pool_rendered = false;
     }
 }
 
 void clicky_freq_down(void) {
     float new_freq = clicky_freq / AUDIO_CLICKY_FREQ_FACTOR;
     if (new_freq > AUDIO_CLICKY_FREQ_MIN) {
-        clicky_freq = new_freq;
+        clicky_freq          = new_freq;
+        clicky_pool_rendered = false;
     }
 }
 
 void clicky_freq_reset(void) {
-    clicky_freq = AUDIO_CLICKY_FREQ_DEFAULT;
+    clicky_freq          = AUDIO_CLICKY_FREQ_DEFAULT;
+    clicky_pool_rendered = false;
 }
 
 void clicky_toggle(void) {
@@ -27,6 +27,10 @@
 #include "action_util.h"
 #include "keymap_introspection.h"
 
+#if defined(KEY_OVERRIDE_ENABLE) && !defined(COMBO_NO_KEY_OVERRIDE_PRERESOLVE)
+#    include "process_key_override.h"
+#endif
+
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
 #ifndef COMBO_ONLY_FROM_LAYER
@@ -149,12 +153,60 @@ static queued_combo_t combo_buffer[COMBO_BUFFER_LENGTH];
         } while (0)
 #endif
 
+#if defined(KEY_OVERRIDE_ENABLE) && !defined(COMBO_NO_KEY_OVERRIDE_PRERESOLVE)
+#    ifndef COMBO_PRERESOLVE_SLOTS
+#        define COMBO_PRERESOLVE_SLOTS 4
+#    endif
+
+// Combo outputs resolved through the key override table at fire time. The
+// resolved keycode must be replayed verbatim on release even if layer state
+// changed while the combo was held, so active substitutions are pinned here;
+// a free slot has keycode KC_NO, which the resolver never produces.
+typedef struct preresolve_slot_t {
+    uint16_t combo_index;
+    uint16_t keycode;
+} preresolve_slot_t;
+
+static preresolve_slot_t preresolve_slots[COMBO_PRERESOLVE_SLOTS];
+
+static uint16_t combo_preresolve_press(uint16_t combo_index, uint16_t keycode) {
+    uint16_t resolved = key_override_preresolve(keycode);
+    if (resolved == keycode) {
+        return keycode;
+    }
+    for (uint8_t i = 0; i < COMBO_PRERESOLVE_SLOTS; i++) {
+        if (preresolve_slots[i].keycode == KC_NO) {
+            preresolve_slots[i].combo_index = combo_index;
+            preresolve_slots[i].keycode     = resolved;
+            return resolved;
+        }
+    }
+    // No slot to remember the substitution for release; take the normal path
+    // so press and release stay consistent.
+    return keycode;
+}
+
+static uint16_t combo_preresolve_release(uint16_t combo_index, uint16_t keycode) {
+    for (uint8_t i = 0; i < COMBO_PRERESOLVE_SLOTS; i++) {
+        if (preresolve_slots[i].keycode != KC_NO && preresolve_slots[i].combo_index == combo_index) {
+            uint16_t resolved           = preresolve_slots[i].keycode;
+            preresolve_slots[i].keycode = KC_NO;
+            return resolved;
+        }
+    }
+    return keycode;
+}
+#endif // defined(KEY_OVERRIDE_ENABLE) && !defined(COMBO_NO_KEY_OVERRIDE_PRERESOLVE)
+
 static inline void release_combo(uint16_t combo_index, combo_t *combo) {
     if (combo->keycode) {
         keyrecord_t record = {
             .event   = MAKE_COMBOEVENT(false),
             .keycode = combo->keycode,
         };
+#if defined(KEY_OVERRIDE_ENABLE) && !defined(COMBO_NO_KEY_OVERRIDE_PRERESOLVE)
+        record.keycode = combo_preresolve_release(combo_index, combo->keycode);
+#endif
 #ifndef NO_ACTION_TAPPING
         action_tapping_process(record);
 #else
@@ -264,6 +316,65 @@ static inline void dump_key_buffer(void) {
     key_buffer_next = key_buffer_size = 0;
 }
 
+/* A key can only start or advance a combo if some combo's key list contains
+ * it. Each combo caches an 8-bit Bloom-style filter of its keys, and the
+ * union of all filters lets process_combo() skip the scan entirely for keys
+ * that appear in no combo. False positives merely fall through to the usual
+ * key-list scan; there are no false negatives. */
+static uint8_t combo_all_keys_filter = 0;
+static bool    combo_filters_built   = false;
+
+static inline uint8_t combo_key_filter_bit(uint16_t keycode) {
+    return 1 << ((keycode ^ (keycode >> 3) ^ (keycode >> 8)) & 7);
+}
+
+static uint8_t build_combo_key_filter(combo_t *combo) {
+    uint8_t  filter = 0;
+    uint8_t  idx    = 0;
+    uint16_t key;
+    while ((key = pgm_read_word(&combo->keys[idx])) != COMBO_END) {
+        filter |= combo_key_filter_bit(key);
+        idx++;
+    }
+    combo->key_filter = filter;
+    return filter;
+}
+
+static void build_combo_filters(void) {
+    combo_all_keys_filter = 0;
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        combo_all_keys_filter |= build_combo_key_filter(combo_get(idx));
+    }
+    combo_filters_built = true;
+}
+
+#ifdef COMBO_LAYER_MASKS
+__attribute__((weak)) layer_state_t combo_layer_mask(uint16_t combo_index, combo_t *combo) {
+    return ~(layer_state_t)0;
+}
+
+static uint8_t combo_masks_ref_layer = UINT8_MAX;
+
+/* Resolve every combo's layer mask to one cached flag for the current
+ * reference layer, so the per-event path pays a single flag test per combo
+ * instead of a callback call. Rebuilt only when the reference layer changes;
+ * a combo that becomes blocked mid-chord has its pending state cleared so it
+ * cannot resolve from stale presses when its layer returns. */
+static void update_combo_layer_masks(uint8_t ref_layer) {
+    if (ref_layer == combo_masks_ref_layer) {
+        return;
+    }
+    combo_masks_ref_layer = ref_layer;
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        combo_t *combo       = combo_get(idx);
+        combo->layer_blocked = !(combo_layer_mask(idx, combo) & ((layer_state_t)1 << ref_layer));
+        if (combo->layer_blocked && !COMBO_ACTIVE(combo)) {
+            RESET_COMBO_STATE(combo);
+        }
+    }
+}
+#endif // COMBO_LAYER_MASKS
+
 #define NO_COMBO_KEYS_ARE_DOWN (0 == COMBO_STATE(combo))
 #define ALL_COMBO_KEYS_ARE_DOWN(state, key_count) (((1 << key_count) - 1) == state)
 #define ONLY_ONE_KEY_IS_DOWN(state) !(state & (state - 1))
@@ -340,7 +451,13 @@ void apply_combo(uint16_t combo_index, combo_t *combo) {
         KEY_STATE_DOWN(state, key_index);
         if (ALL_COMBO_KEYS_ARE_DOWN(state, key_count)) {
             // this in the end executes the combo when the key_buffer is dumped.
-            record->keycode    = combo->keycode;
+            record->keycode = combo->keycode;
+#if defined(KEY_OVERRIDE_ENABLE) && !defined(COMBO_NO_KEY_OVERRIDE_PRERESOLVE)
+            // Resolve known combo-output -> override-result chains up front,
+            // so the fired combo carries its final keycode through one
+            // pipeline pass instead of re-entering via the override machinery.
+            record->keycode = combo_preresolve_press(combo_index, combo->keycode);
+#endif
             record->event.type = COMBO_EVENT;
             record->event.key  = MAKE_KEYPOS(0, 0);
 
@@ -577,18 +694,47 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
 #ifdef COMBO_ONLY_FROM_LAYER
     /* Only check keycodes from one layer. */
     keycode = keymap_key_to_keycode(COMBO_ONLY_FROM_LAYER, record->event.key);
+#    ifdef COMBO_LAYER_MASKS
+    update_combo_layer_masks(get_highest_layer(layer_state | default_layer_state));
+#    endif
 #else
     uint8_t highest_layer = get_highest_layer(layer_state | default_layer_state);
     uint8_t ref_layer     = combo_ref_from_layer(highest_layer);
     if (ref_layer != highest_layer) {
         keycode = keymap_key_to_keycode(ref_layer, record->event.key);
     }
+#    ifdef COMBO_LAYER_MASKS
+    update_combo_layer_masks(highest_layer);
+#    endif
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+    if (!combo_filters_built) {
+        build_combo_filters();
+    }
+
+    const uint8_t key_bit = combo_key_filter_bit(keycode);
+    if (combo_all_keys_filter & key_bit) {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo = combo_get(idx);
+#ifdef COMBO_LAYER_MASKS
+            if (combo->layer_blocked) {
+                // Masked out on the current layer; skip all per-combo work.
+                continue;
+            }
+#endif
+            uint8_t filter = combo->key_filter;
+            if (!filter) {
+                // Rebuild lazily, e.g. after a dynamic provider replaced the combo.
+                filter = build_combo_key_filter(combo);
+                combo_all_keys_filter |= filter;
+            }
+            if (!(filter & key_bit)) {
+                // Key is provably not in this combo's key list.
+                continue;
+            }
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+            no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
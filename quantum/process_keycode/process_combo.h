@@ -19,6 +19,9 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "action.h"
+#ifdef COMBO_LAYER_MASKS
+#    include "action_layer.h"
+#endif
 #include "keycodes.h"
 #include "quantum_keycodes.h"
 
@@ -42,6 +45,10 @@
 typedef struct combo_t {
     const uint16_t *keys;
     uint16_t        keycode;
+    uint8_t         key_filter; // Bloom-style filter of the combo's keys; 0 until lazily built
+#ifdef COMBO_LAYER_MASKS
+    bool layer_blocked; // cached: masked out on the current reference layer
+#endif
 #ifdef EXTRA_SHORT_COMBOS
     uint8_t state;
 #else
@@ -79,3 +86,9 @@ void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
 bool is_combo_enabled(void);
+
+#ifdef COMBO_LAYER_MASKS
+// Bitmask of layers on which the combo may trigger; the default allows all
+// layers. Resolved once per layer change, not per key event.
+layer_state_t combo_layer_mask(uint16_t combo_index, combo_t *combo);
+#endif
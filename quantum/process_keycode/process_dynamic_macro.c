@@ -19,7 +19,9 @@
 #include "process_dynamic_macro.h"
 #include <stddef.h>
 #include "action_layer.h"
+#include "keyboard.h"
 #include "keycodes.h"
+#include "quantum.h"
 #include "debug.h"
 #include "wait.h"
 
@@ -94,13 +96,25 @@ static layer_state_t dm1_layer_state;
 static layer_state_t dm2_layer_state;
 #endif
 
+/* A single recorded event: the keycode as resolved against the live layer
+ * state at record time, plus the originating matrix position so playback can
+ * fall back to the full processing pipeline for keycodes that cannot be
+ * turned into reports directly. Smaller than a keyrecord_t, which also buys
+ * more effective capacity out of the same DYNAMIC_MACRO_SIZE.
+ */
+typedef struct {
+    uint16_t keycode;
+    keypos_t key;
+    bool     pressed;
+} dynamic_macro_event_t;
+
 /**
  * Start recording of the dynamic macro.
  *
  * @param[out] macro_pointer The new macro buffer iterator.
  * @param[in]  macro_buffer  The macro buffer used to initialize macro_pointer.
  */
-void dynamic_macro_record_start(keyrecord_t **macro_pointer, keyrecord_t *macro_buffer, int8_t direction) {
+void dynamic_macro_record_start(dynamic_macro_event_t **macro_pointer, dynamic_macro_event_t *macro_buffer, int8_t direction) {
     dprintln("dynamic macro recording: started");
 
     dynamic_macro_record_start_kb(direction);
@@ -118,6 +132,36 @@ void dynamic_macro_record_start(keyrecord_t **macro_pointer, keyrecord_t *macro_
     *macro_pointer = macro_buffer;
 }
 
+/**
+ * Play back a single recorded event.
+ *
+ * Basic and modded keycodes were already resolved when they were recorded, so
+ * they are turned straight into reports without re-running the feature
+ * pipeline. Anything more exotic (layer keys, tap-holds, custom keycodes)
+ * still goes through process_record() with a reconstructed key event.
+ */
+static void dynamic_macro_play_event(const dynamic_macro_event_t *event) {
+    switch (event->keycode) {
+        case QK_BASIC ... QK_MODS_MAX:
+            if (event->pressed) {
+                register_code16(event->keycode);
+            } else {
+                unregister_code16(event->keycode);
+            }
+            break;
+        default: {
+            keyrecord_t record = {
+                .event = MAKE_KEYEVENT(event->key.row, event->key.col, event->pressed),
+#if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
+                .keycode = event->keycode,
+#endif
+            };
+            process_record(&record);
+            break;
+        }
+    }
+}
+
 /**
  * Play the dynamic macro.
  *
@@ -125,7 +169,7 @@ void dynamic_macro_record_start(keyrecord_t **macro_pointer, keyrecord_t *macro_
  * @param macro_end[in]    The element after the last macro buffer element.
  * @param direction[in]    Either +1 or -1, which way to iterate the buffer.
  */
-void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_t direction) {
+void dynamic_macro_play(dynamic_macro_event_t *macro_buffer, dynamic_macro_event_t *macro_end, int8_t direction) {
     dprintf("dynamic macro: slot %d playback\n", DYNAMIC_MACRO_CURRENT_SLOT());
 
     layer_state_t saved_layer_state = layer_state;
@@ -142,7 +186,7 @@ void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_
 #endif
 
     while (macro_buffer != macro_end) {
-        process_record(macro_buffer);
+        dynamic_macro_play_event(macro_buffer);
         macro_buffer += direction;
 #ifdef DYNAMIC_MACRO_DELAY
         wait_ms(DYNAMIC_MACRO_DELAY);
@@ -163,9 +207,10 @@ void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_
  * @param macro_pointer[in,out] The current buffer position.
  * @param macro2_end[in] The end of the other macro.
  * @param direction[in]  Either +1 or -1, which way to iterate the buffer.
+ * @param keycode[in]    The keycode resolved for the current keypress.
  * @param record[in]     The current keypress.
  */
-void dynamic_macro_record_key(keyrecord_t *macro_buffer, keyrecord_t **macro_pointer, keyrecord_t *macro2_end, int8_t direction, keyrecord_t *record) {
+void dynamic_macro_record_key(dynamic_macro_event_t *macro_buffer, dynamic_macro_event_t **macro_pointer, dynamic_macro_event_t *macro2_end, int8_t direction, uint16_t keycode, keyrecord_t *record) {
     /* If we've just started recording, ignore all the key releases. */
     if (!record->event.pressed && *macro_pointer == macro_buffer) {
         dprintln("dynamic macro: ignoring a leading key-up event");
@@ -176,7 +221,9 @@ void dynamic_macro_record_key(keyrecord_t *macro_buffer, keyrecord_t **macro_poi
      * is safe to use before overwriting the other macro.
      */
     if (*macro_pointer - direction != macro2_end) {
-        **macro_pointer = *record;
+        (*macro_pointer)->keycode = keycode;
+        (*macro_pointer)->key     = record->event.key;
+        (*macro_pointer)->pressed = record->event.pressed;
         *macro_pointer += direction;
     }
     dynamic_macro_record_key_kb(direction, record);
@@ -188,13 +235,13 @@ void dynamic_macro_record_key(keyrecord_t *macro_buffer, keyrecord_t **macro_poi
  * End recording of the dynamic macro. Essentially just update the
  * pointer to the end of the macro.
  */
-void dynamic_macro_record_end(keyrecord_t *macro_buffer, keyrecord_t *macro_pointer, int8_t direction, keyrecord_t **macro_end) {
+void dynamic_macro_record_end(dynamic_macro_event_t *macro_buffer, dynamic_macro_event_t *macro_pointer, int8_t direction, dynamic_macro_event_t **macro_end) {
     dynamic_macro_record_end_kb(direction);
 
     /* Do not save the keys being held when stopping the recording,
      * i.e. the keys used to access the layer DM_RSTP is on.
      */
-    while (macro_pointer != macro_buffer && (macro_pointer - direction)->event.pressed) {
+    while (macro_pointer != macro_buffer && (macro_pointer - direction)->pressed) {
         dprintln("dynamic macro: trimming a trailing key-down event");
         macro_pointer -= direction;
     }
@@ -228,28 +275,192 @@ void dynamic_macro_record_end(keyrecord_t *macro_buffer, keyrecord_t *macro_poin
  * macros or one long macro and one short macro. Or even one empty
  * and one using the whole buffer.
  */
-static keyrecord_t macro_buffer[DYNAMIC_MACRO_SIZE];
+static dynamic_macro_event_t macro_buffer[DYNAMIC_MACRO_SIZE];
 
 /* Pointer to the first buffer element after the first macro.
  * Initially points to the very beginning of the buffer since the
  * macro is empty. */
-static keyrecord_t *macro_end = macro_buffer;
+static dynamic_macro_event_t *macro_end = macro_buffer;
 
 /* The other end of the macro buffer. Serves as the beginning of
  * the second macro. */
-static keyrecord_t *const r_macro_buffer = macro_buffer + DYNAMIC_MACRO_SIZE - 1;
+static dynamic_macro_event_t *const r_macro_buffer = macro_buffer + DYNAMIC_MACRO_SIZE - 1;
 
 /* Like macro_end but for the second macro. */
-static keyrecord_t *r_macro_end = macro_buffer + DYNAMIC_MACRO_SIZE - 1;
+static dynamic_macro_event_t *r_macro_end = macro_buffer + DYNAMIC_MACRO_SIZE - 1;
 
 /* A persistent pointer to the current macro position (iterator)
  * used during the recording. */
-static keyrecord_t *macro_pointer = NULL;
+static dynamic_macro_event_t *macro_pointer = NULL;
 
 /* 0   - no macro is being recorded right now
  * 1,2 - either macro 1 or 2 is being recorded */
 static uint8_t macro_id = 0;
 
+#ifdef DYNAMIC_MACRO_EEPROM_STORAGE
+
+#    include "eeprom.h"
+#    include "nvm_eeprom_eeconfig_internal.h"
+
+#    if defined(VIA_ENABLE) || defined(DYNAMIC_KEYMAP_ENABLE)
+#        error DYNAMIC_MACRO_EEPROM_STORAGE claims the EEPROM space directly after eeconfig, which dynamic keymaps already occupy
+#    endif
+
+#    ifndef DYNAMIC_MACRO_EEPROM_ADDR
+#        define DYNAMIC_MACRO_EEPROM_ADDR (EECONFIG_SIZE)
+#    endif
+#    ifndef DYNAMIC_MACRO_EEPROM_SIZE
+#        define DYNAMIC_MACRO_EEPROM_SIZE 512
+#    endif
+
+/* Bumping this invalidates stored macros whenever the encoding changes. */
+#    define DYNAMIC_MACRO_EEPROM_MAGIC ((uint16_t)0x4D01)
+
+/* Region layout: magic (2), slot stream lengths in bytes (2 x 2), then the
+ * two encoded streams back to back. Events are stored packed: a header byte
+ * (pressed flag, keycode width, position presence), one or two keycode
+ * bytes, and the matrix position only for keycodes that play back through
+ * process_record(). Plain taps take 2 bytes instead of the in-RAM event's 5.
+ */
+#    define DYNAMIC_MACRO_EEPROM_HEADER_SIZE 6
+#    define DM_EVENT_PRESSED 0x80
+#    define DM_EVENT_WIDE 0x40
+#    define DM_EVENT_HAS_POS 0x20
+
+static uint8_t dynamic_macro_encode_event(const dynamic_macro_event_t *event, uint8_t out[5]) {
+    uint8_t header = event->pressed ? DM_EVENT_PRESSED : 0;
+    uint8_t len    = 1;
+
+    out[len++] = (uint8_t)event->keycode;
+    if (event->keycode > 0xFF) {
+        header |= DM_EVENT_WIDE;
+        out[len++] = (uint8_t)(event->keycode >> 8);
+    }
+    if (event->keycode > QK_MODS_MAX) {
+        header |= DM_EVENT_HAS_POS;
+        out[len++] = event->key.row;
+        out[len++] = event->key.col;
+    }
+    out[0] = header;
+    return len;
+}
+
+/* Returns the encoded length consumed, or 0 when the stream would overrun. */
+static uint8_t dynamic_macro_decode_event(uint16_t offset, uint16_t limit, dynamic_macro_event_t *event) {
+    uint8_t header = eeprom_read_byte((const uint8_t *)(DYNAMIC_MACRO_EEPROM_ADDR + offset));
+    uint8_t len    = 1 + ((header & DM_EVENT_WIDE) ? 2 : 1) + ((header & DM_EVENT_HAS_POS) ? 2 : 0);
+    uint8_t data[4];
+
+    if (offset + len > limit) {
+        return 0;
+    }
+    eeprom_read_block(data, (const void *)(DYNAMIC_MACRO_EEPROM_ADDR + offset + 1), len - 1);
+
+    event->pressed = (header & DM_EVENT_PRESSED) != 0;
+    event->keycode = data[0];
+    uint8_t i      = 1;
+    if (header & DM_EVENT_WIDE) {
+        event->keycode |= (uint16_t)data[i++] << 8;
+    }
+    if (header & DM_EVENT_HAS_POS) {
+        event->key.row = data[i++];
+        event->key.col = data[i++];
+    } else {
+        event->key = (keypos_t){.row = 0, .col = 0};
+    }
+    return len;
+}
+
+static void dynamic_macro_nvm_save(void) {
+    const struct {
+        const dynamic_macro_event_t *begin;
+        const dynamic_macro_event_t *end;
+        int8_t                       direction;
+    } slots[2] = {
+        {macro_buffer, macro_end, +1},
+        {r_macro_buffer, r_macro_end, -1},
+    };
+
+    uint16_t offset = DYNAMIC_MACRO_EEPROM_HEADER_SIZE;
+    uint16_t lens[2];
+
+    for (uint8_t s = 0; s < 2; s++) {
+        uint16_t len = 0;
+        for (const dynamic_macro_event_t *it = slots[s].begin; it != slots[s].end; it += slots[s].direction) {
+            uint8_t encoded[5];
+            uint8_t n = dynamic_macro_encode_event(it, encoded);
+            if (offset + n > DYNAMIC_MACRO_EEPROM_SIZE) {
+                /* Out of region; drop the tail at an event boundary. */
+                break;
+            }
+            eeprom_update_block(encoded, (void *)(DYNAMIC_MACRO_EEPROM_ADDR + offset), n);
+            offset += n;
+            len += n;
+        }
+        lens[s] = len;
+    }
+
+    /* The magic is written last so a power loss mid-save leaves either the
+     * old consistent image (lengths not yet touched) or a fully new one.
+     */
+    uint16_t magic = DYNAMIC_MACRO_EEPROM_MAGIC;
+    eeprom_update_block(lens, (void *)(DYNAMIC_MACRO_EEPROM_ADDR + 2), sizeof(lens));
+    eeprom_update_block(&magic, (void *)(DYNAMIC_MACRO_EEPROM_ADDR + 0), sizeof(magic));
+}
+
+void dynamic_macro_init(void) {
+    uint16_t magic;
+    uint16_t lens[2];
+
+    eeprom_read_block(&magic, (const void *)(DYNAMIC_MACRO_EEPROM_ADDR + 0), sizeof(magic));
+    if (magic != DYNAMIC_MACRO_EEPROM_MAGIC) {
+        return;
+    }
+    eeprom_read_block(lens, (const void *)(DYNAMIC_MACRO_EEPROM_ADDR + 2), sizeof(lens));
+    if (DYNAMIC_MACRO_EEPROM_HEADER_SIZE + (uint32_t)lens[0] + lens[1] > DYNAMIC_MACRO_EEPROM_SIZE) {
+        /* Stored lengths cannot be trusted; treat the region as empty. */
+        return;
+    }
+
+    uint16_t offset = DYNAMIC_MACRO_EEPROM_HEADER_SIZE;
+
+    /* Slot 1 fills the buffer from the left. */
+    dynamic_macro_event_t *p     = macro_buffer;
+    uint16_t               limit = offset + lens[0];
+    while (offset < limit && p < r_macro_buffer) {
+        uint8_t n = dynamic_macro_decode_event(offset, limit, p);
+        if (n == 0) {
+            break;
+        }
+        offset += n;
+        p++;
+    }
+    macro_end = p;
+
+    /* Slot 2 fills it from the right, stopping short of slot 1. Its stream
+     * starts right after slot 1's full stream, even if slot 1's decode
+     * stopped early for lack of buffer space.
+     */
+    p      = r_macro_buffer;
+    offset = DYNAMIC_MACRO_EEPROM_HEADER_SIZE + lens[0];
+    limit  = offset + lens[1];
+    while (offset < limit && p >= macro_end) {
+        uint8_t n = dynamic_macro_decode_event(offset, limit, p);
+        if (n == 0) {
+            break;
+        }
+        offset += n;
+        p--;
+    }
+    r_macro_end = p;
+}
+
+#else // DYNAMIC_MACRO_EEPROM_STORAGE
+
+void dynamic_macro_init(void) {}
+
+#endif // DYNAMIC_MACRO_EEPROM_STORAGE
+
 /**
  * If a dynamic macro is currently being recorded, stop recording.
  */
@@ -263,6 +474,10 @@ void dynamic_macro_stop_recording(void) {
             break;
     }
     macro_id = 0;
+
+#ifdef DYNAMIC_MACRO_EEPROM_STORAGE
+    dynamic_macro_nvm_save();
+#endif
 }
 
 /* Handle the key events related to the dynamic macros.
@@ -312,10 +527,10 @@ bool process_dynamic_macro(uint16_t keycode, keyrecord_t *record) {
                     /* Store the key in the macro buffer and process it normally. */
                     switch (macro_id) {
                         case 1:
-                            dynamic_macro_record_key(macro_buffer, &macro_pointer, r_macro_end, +1, record);
+                            dynamic_macro_record_key(macro_buffer, &macro_pointer, r_macro_end, +1, keycode, record);
                             break;
                         case 2:
-                            dynamic_macro_record_key(r_macro_buffer, &macro_pointer, macro_end, -1, record);
+                            dynamic_macro_record_key(r_macro_buffer, &macro_pointer, macro_end, -1, keycode, record);
                             break;
                     }
                 }
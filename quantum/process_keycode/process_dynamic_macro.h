@@ -36,6 +36,7 @@
 #endif
 
 void dynamic_macro_led_blink(void);
+void dynamic_macro_init(void);
 bool process_dynamic_macro(uint16_t keycode, keyrecord_t *record);
 bool dynamic_macro_record_start_kb(int8_t direction);
 bool dynamic_macro_record_start_user(int8_t direction);
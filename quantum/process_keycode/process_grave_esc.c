@@ -23,40 +23,34 @@
  */
 static bool grave_esc_was_shifted = false;
 
-bool process_grave_esc(uint16_t keycode, keyrecord_t *record) {
-    if (keycode == QK_GRAVE_ESCAPE) {
-        const uint8_t mods    = get_mods();
-        uint8_t       shifted = mods & MOD_MASK_SG;
-
+/* Union of the modifiers that force ESC regardless of shift state, folded to
+ * one compile-time mask so a single test replaces a branch per override:
+ * ALT covers the cmd+opt+esc shortcut on macOS, CTRL the ctrl+shift+esc
+ * shortcut on Windows, among other things. */
+#define GRAVE_ESC_OVERRIDE_MASK (0
 #ifdef GRAVE_ESC_ALT_OVERRIDE
-        // if ALT is pressed, ESC is always sent
-        // this is handy for the cmd+opt+esc shortcut on macOS, among other things.
-        if (mods & MOD_MASK_ALT) {
-            shifted = 0;
-        }
+                                 | MOD_MASK_ALT
 #endif
-
 #ifdef GRAVE_ESC_CTRL_OVERRIDE
-        // if CTRL is pressed, ESC is always sent
-        // this is handy for the ctrl+shift+esc shortcut on windows, among other things.
-        if (mods & MOD_MASK_CTRL) {
-            shifted = 0;
-        }
+                                 | MOD_MASK_CTRL
 #endif
-
 #ifdef GRAVE_ESC_GUI_OVERRIDE
-        // if GUI is pressed, ESC is always sent
-        if (mods & MOD_MASK_GUI) {
-            shifted = 0;
-        }
+                                 | MOD_MASK_GUI
 #endif
-
 #ifdef GRAVE_ESC_SHIFT_OVERRIDE
-        // if SHIFT is pressed, ESC is always sent
-        if (mods & MOD_MASK_SHIFT) {
+                                 | MOD_MASK_SHIFT
+#endif
+)
+
+bool process_grave_esc(uint16_t keycode, keyrecord_t *record) {
+    if (keycode == QK_GRAVE_ESCAPE) {
+        const uint8_t mods    = get_mods();
+        uint8_t       shifted = mods & MOD_MASK_SG;
+
+        // if an override modifier is pressed, ESC is always sent
+        if (mods & (GRAVE_ESC_OVERRIDE_MASK)) {
             shifted = 0;
         }
-#endif
 
         if (record->event.pressed) {
             grave_esc_was_shifted = shifted;
@@ -25,6 +25,8 @@
 #include "quantum_keycodes.h"
 #include "keymap_introspection.h"
 
+#include <string.h>
+
 #ifndef KEY_OVERRIDE_REPEAT_DELAY
 #    define KEY_OVERRIDE_REPEAT_DELAY 500
 #endif
@@ -88,6 +90,39 @@ static bool enabled = true;
 // Forward decls
 static const key_override_t *clear_active_override(const bool allow_reregister);
 
+// Lazily-built bitmap over all override trigger keycodes (hashed to 256
+// bits). Events involving keys that cannot be any override's trigger skip the
+// scan over every registered override with two bit tests; hash collisions
+// just fall through to the full scan.
+static uint8_t trigger_filter[32];
+static bool    trigger_filter_built    = false;
+static bool    has_no_trigger_override = false;
+
+static inline bool trigger_filter_test(const uint16_t keycode) {
+    const uint8_t h = (uint8_t)(keycode ^ (keycode >> 8));
+    return (trigger_filter[h >> 3] & (1 << (h & 7))) != 0;
+}
+
+static void build_trigger_filter(void) {
+    memset(trigger_filter, 0, sizeof(trigger_filter));
+    has_no_trigger_override = false;
+    for (uint16_t i = 0; i < key_override_count(); i++) {
+        const key_override_t *const override = key_override_get(i);
+        if (override == NULL) {
+            break;
+        }
+        if (override->trigger == KC_NO) {
+            // 'No key' overrides activate from mod changes alone; the filter
+            // cannot rule those out.
+            has_no_trigger_override = true;
+            continue;
+        }
+        const uint8_t h = (uint8_t)(override->trigger ^ (override->trigger >> 8));
+        trigger_filter[h >> 3] |= 1 << (h & 7);
+    }
+    trigger_filter_built = true;
+}
+
 void key_override_on(void) {
     enabled = true;
     key_override_printf("Key override ON\n");
@@ -250,6 +285,15 @@ static bool try_activating_override(const uint16_t keycode, const uint8_t layer,
         return true;
     }
 
+    if (!trigger_filter_built) {
+        build_trigger_filter();
+    }
+
+    // Neither the event's key nor the held key can be any override's trigger.
+    if (!has_no_trigger_override && !trigger_filter_test(keycode) && !trigger_filter_test(last_key_down)) {
+        return true;
+    }
+
     for (uint16_t i = 0; i < key_override_count(); i++) {
         const key_override_t *const override = key_override_get(i);
 
@@ -406,6 +450,57 @@ void key_override_task(void) {
     }
 }
 
+#if defined(COMBO_ENABLE) && !defined(COMBO_NO_KEY_OVERRIDE_PRERESOLVE)
+uint16_t key_override_preresolve(uint16_t keycode) {
+    if (!enabled || keycode == KC_NO) {
+        return keycode;
+    }
+    if (!trigger_filter_built) {
+        build_trigger_filter();
+    }
+    if (!trigger_filter_test(keycode)) {
+        return keycode;
+    }
+
+    // Combo events carry a synthetic key position, so the per-key source
+    // layer cache is meaningless for them; the highest active layer is the
+    // semantic the rest of the combo machinery already follows.
+    const uint8_t layer = get_highest_layer(layer_state | default_layer_state);
+
+    for (uint16_t i = 0; i < key_override_count(); i++) {
+        const key_override_t *const override = key_override_get(i);
+        if (override == NULL) {
+            break;
+        }
+        if (override->trigger != keycode) {
+            continue;
+        }
+        if (override->enabled != NULL && !(*override->enabled)) {
+            continue;
+        }
+        if ((override->layers & ((layer_state_t)1 << layer)) == 0) {
+            continue;
+        }
+        // Only chains whose outcome cannot depend on runtime modifier state
+        // resolve to a direct keycode; the first same-trigger override that
+        // is mod-dependent, suppresses mods, runs a custom action or sends no
+        // replacement would also shadow any later static one, so give up and
+        // let the event take the normal pipeline pass.
+        if (override->trigger_mods != 0 || override->negative_mod_mask != 0 || override->suppressed_mods != 0) {
+            return keycode;
+        }
+        if (override->custom_action != NULL || override->replacement == KC_NO) {
+            return keycode;
+        }
+        if ((override->options & ko_option_activation_trigger_down) == 0) {
+            return keycode;
+        }
+        return override->replacement;
+    }
+    return keycode;
+}
+#endif // defined(COMBO_ENABLE) && !defined(COMBO_NO_KEY_OVERRIDE_PRERESOLVE)
+
 bool process_key_override(const uint16_t keycode, const keyrecord_t *const record) {
 #ifdef BENCH_KEY_OVERRIDE
     uint16_t start = timer_read();
@@ -105,6 +105,11 @@ bool process_key_override(const uint16_t keycode, const keyrecord_t *const recor
 /** Perform any deferred keys */
 void key_override_task(void);
 
+#if defined(COMBO_ENABLE) && !defined(COMBO_NO_KEY_OVERRIDE_PRERESOLVE)
+/** Resolve a combo output keycode through the override table before its event enters the pipeline. Returns the replacement for trivially-static chains (trigger-mod-free, no suppressed mods, no custom action, active on the current layer), or the keycode unchanged when the outcome depends on runtime state. */
+uint16_t key_override_preresolve(uint16_t keycode);
+#endif
+
 /**
  *  Preferrably use these macros to create key overrides. They fix many of the options to a standard setting that should satisfy most basic use-cases. Only directly create a key_override_t struct when you really need to.
  */
@@ -248,22 +248,24 @@ bool process_midi(uint16_t keycode, keyrecord_t *record) {
 void midi_task(void) {
     midi_device_process(&midi_device);
 #ifdef MIDI_ADVANCED
-    if (timer_elapsed(midi_modulation_timer) < midi_config.modulation_interval) return;
-    midi_modulation_timer = timer_read();
+    if (timer_elapsed(midi_modulation_timer) >= midi_config.modulation_interval) {
+        midi_modulation_timer = timer_read();
 
-    if (midi_modulation_step != 0) {
-        dprintf("midi modulation %d\n", midi_modulation);
-        midi_send_cc(&midi_device, midi_config.channel, 0x1, midi_modulation);
+        if (midi_modulation_step != 0) {
+            dprintf("midi modulation %d\n", midi_modulation);
+            midi_send_cc(&midi_device, midi_config.channel, 0x1, midi_modulation);
 
-        if (midi_modulation_step < 0 && midi_modulation < -midi_modulation_step) {
-            midi_modulation      = 0;
-            midi_modulation_step = 0;
-            return;
-        }
-
-        midi_modulation += midi_modulation_step;
+            if (midi_modulation_step < 0 && midi_modulation < -midi_modulation_step) {
+                midi_modulation      = 0;
+                midi_modulation_step = 0;
+            } else {
+                midi_modulation += midi_modulation_step;
 
-        if (midi_modulation > 127) midi_modulation = 127;
+                if (midi_modulation > 127) midi_modulation = 127;
+            }
+        }
     }
 #endif
+    // push out any events batched up by the protocol implementation this scan
+    flush_midi_packets();
 }
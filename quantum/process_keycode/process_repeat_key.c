@@ -23,7 +23,10 @@ __attribute__((weak)) bool remember_last_key_user(uint16_t keycode, keyrecord_t*
     return true;
 }
 
-static bool remember_last_key(uint16_t keycode, keyrecord_t* record, uint8_t* remembered_mods) {
+// Keycode-only classification, kept separate from remember_last_key_user()
+// so ignored keys cost just this switch on the hot path, before any mods
+// state is gathered.
+static bool remember_last_key(uint16_t keycode, keyrecord_t* record) {
     switch (keycode) {
         // Ignore MO, TO, TG, TT, and TL layer switch keys.
         case QK_MOMENTARY ... QK_MOMENTARY_MAX:
@@ -74,7 +77,7 @@ static bool remember_last_key(uint16_t keycode, keyrecord_t* record, uint8_t* re
             return false;
     }
 
-    return remember_last_key_user(keycode, record, remembered_mods);
+    return true;
 }
 
 bool process_last_key(uint16_t keycode, keyrecord_t* record) {
@@ -82,13 +85,13 @@ bool process_last_key(uint16_t keycode, keyrecord_t* record) {
         return true;
     }
 
-    if (record->event.pressed) {
+    if (record->event.pressed && remember_last_key(keycode, record)) {
         uint8_t remembered_mods = get_mods() | get_weak_mods();
 #ifndef NO_ACTION_ONESHOT
         remembered_mods |= get_oneshot_mods();
 #endif // NO_ACTION_ONESHOT
 
-        if (remember_last_key(keycode, record, &remembered_mods)) {
+        if (remember_last_key_user(keycode, record, &remembered_mods)) {
             set_last_record(keycode, record);
             set_last_mods(remembered_mods);
         }
@@ -50,9 +50,8 @@ static inline void steno_clear_chord(void) {
 void send_steno_chord_gemini(void) {
     // Set MSB to 1 to indicate the start of packet
     chord[0] |= 0x80;
-    for (uint8_t i = 0; i < GEMINI_STROKE_SIZE; ++i) {
-        virtser_send(chord[i]);
-    }
+    // `chord` already is the wire-format packet, so it goes out in one batch write
+    virtser_send_buffer(chord, GEMINI_STROKE_SIZE);
 }
 #    else
 #        pragma message "VIRTSER_ENABLE = yes is required for Gemini PR to work properly out of the box!"
@@ -90,18 +89,21 @@ static const uint8_t boltmap[64] PROGMEM = {TXB_NUL, TXB_NUM, TXB_NUM, TXB_NUM,
 
 #    ifdef VIRTSER_ENABLE
 static void send_steno_chord_bolt(void) {
+    uint8_t packet[BOLT_STROKE_SIZE + 1];
+    uint8_t length = 0;
     for (uint8_t i = 0; i < BOLT_STROKE_SIZE; ++i) {
         // TX Bolt uses variable length packets where each byte corresponds to a bit array of certain keys.
         // If a user chorded the keys of the first group with keys of the last group, for example, there
         // would be bytes of 0x00 in `chord` for the middle groups which we mustn't send.
         if (chord[i]) {
-            virtser_send(chord[i]);
+            packet[length++] = chord[i];
         }
     }
     // Sending a null packet is not always necessary, but it is simpler and more reliable
     // to unconditionally send it every time instead of keeping track of more states and
     // creating more branches in the execution of the program.
-    virtser_send(0);
+    packet[length++] = 0;
+    virtser_send_buffer(packet, length);
 }
 #    else
 #        pragma message "VIRTSER_ENABLE = yes is required for TX Bolt to work properly out of the box!"
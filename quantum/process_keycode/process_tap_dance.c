@@ -33,6 +33,12 @@ static tap_dance_state_t tap_dance_states[TAP_DANCE_MAX_SIMULTANEOUS];
 
 static uint16_t last_tap_time;
 
+// Tapping term of the active dance, resolved once per tap so tap_dance_task()
+// is a single timer comparison instead of re-evaluating the (possibly per-key)
+// tapping term every scan. At most one dance ever awaits its timeout: a
+// second tap dance key interrupts and finishes the previous one immediately.
+static uint16_t active_td_term;
+
 static tap_dance_state_t *tap_dance_get_or_allocate_state(uint8_t tap_dance_idx, bool allocate) {
     uint8_t i;
     if (tap_dance_idx >= tap_dance_count()) {
@@ -215,6 +221,9 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
                 last_tap_time = timer_read();
                 process_tap_dance_action_on_each_tap(action, state);
                 active_td = state->finished ? 0 : keycode;
+                if (active_td) {
+                    active_td_term = GET_TAPPING_TERM(keycode, record);
+                }
             } else {
                 process_tap_dance_action_on_each_release(action, state);
                 if (state->finished) {
@@ -235,7 +244,7 @@ void tap_dance_task(void) {
     tap_dance_action_t *action;
     tap_dance_state_t  *state;
 
-    if (!active_td || timer_elapsed(last_tap_time) <= GET_TAPPING_TERM(active_td, &(keyrecord_t){})) return;
+    if (!active_td || timer_elapsed(last_tap_time) <= active_td_term) return;
 
     action = tap_dance_get(QK_TAP_DANCE_GET_INDEX(active_td));
     state  = tap_dance_get_state(QK_TAP_DANCE_GET_INDEX(active_td));
@@ -37,6 +37,10 @@ typedef struct {
 
 typedef void (*tap_dance_user_fn_t)(tap_dance_state_t *state, void *user_data);
 
+/* Tap dance definitions hold no runtime state (that lives in the separate
+ * state pool), so the keymap declares them in flash:
+ *   const tap_dance_action_t tap_dance_actions[] PROGMEM = { ... };
+ * tap_dance_get() copies the requested entry out for its callers. */
 typedef struct tap_dance_action_t {
     struct {
         tap_dance_user_fn_t on_each_tap;
@@ -95,7 +99,7 @@ typedef struct {
     }
 
 #define TD_INDEX(code) QK_TAP_DANCE_GET_INDEX(code)
-#define TAP_DANCE_KEYCODE(state) TD(((tap_dance_action_t *)state) - tap_dance_actions)
+#define TAP_DANCE_KEYCODE(state) TD(((tap_dance_state_t *)(state))->index)
 
 void reset_tap_dance(tap_dance_state_t *state);
 
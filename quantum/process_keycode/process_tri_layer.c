@@ -8,22 +8,25 @@
 bool process_tri_layer(uint16_t keycode, keyrecord_t *record) {
     switch (keycode) {
         case QK_TRI_LAYER_LOWER:
+            // batch the layer toggle and the tri-layer recomputation into one cascade
+            layer_begin_transaction();
             if (record->event.pressed) {
                 layer_on(get_tri_layer_lower_layer());
-                update_tri_layer(get_tri_layer_lower_layer(), get_tri_layer_upper_layer(), get_tri_layer_adjust_layer());
             } else {
                 layer_off(get_tri_layer_lower_layer());
-                update_tri_layer(get_tri_layer_lower_layer(), get_tri_layer_upper_layer(), get_tri_layer_adjust_layer());
             }
+            update_tri_layer(get_tri_layer_lower_layer(), get_tri_layer_upper_layer(), get_tri_layer_adjust_layer());
+            layer_commit_transaction();
             return false;
         case QK_TRI_LAYER_UPPER:
+            layer_begin_transaction();
             if (record->event.pressed) {
                 layer_on(get_tri_layer_upper_layer());
-                update_tri_layer(get_tri_layer_lower_layer(), get_tri_layer_upper_layer(), get_tri_layer_adjust_layer());
             } else {
                 layer_off(get_tri_layer_upper_layer());
-                update_tri_layer(get_tri_layer_lower_layer(), get_tri_layer_upper_layer(), get_tri_layer_adjust_layer());
             }
+            update_tri_layer(get_tri_layer_lower_layer(), get_tri_layer_upper_layer(), get_tri_layer_adjust_layer());
+            layer_commit_transaction();
             return false;
     }
     return true;
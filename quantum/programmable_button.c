@@ -20,7 +20,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #define REPORT_BIT(index) (((uint32_t)1) << (index - 1))
 
-static uint32_t programmable_button_report = 0;
+static uint32_t programmable_button_report      = 0;
+static uint32_t programmable_button_last_report = 0;
 
 void programmable_button_clear(void) {
     programmable_button_report = 0;
@@ -37,12 +38,10 @@ void programmable_button_remove(uint8_t index) {
 
 void programmable_button_register(uint8_t index) {
     programmable_button_add(index);
-    programmable_button_flush();
 }
 
 void programmable_button_unregister(uint8_t index) {
     programmable_button_remove(index);
-    programmable_button_flush();
 }
 
 bool programmable_button_is_on(uint8_t index) {
@@ -50,6 +49,12 @@ bool programmable_button_is_on(uint8_t index) {
 }
 
 void programmable_button_flush(void) {
+    // Flushing happens once per main loop tick, so a burst of register/
+    // unregister calls within one tick collapses into a single report.
+    if (programmable_button_report == programmable_button_last_report) {
+        return;
+    }
+    programmable_button_last_report = programmable_button_report;
     host_programmable_button_send(programmable_button_report);
 }
 
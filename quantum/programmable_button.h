@@ -47,14 +47,14 @@ void programmable_button_add(uint8_t index);
 void programmable_button_remove(uint8_t index);
 
 /**
- * \brief Set the state of a button, and flush the report.
+ * \brief Set the state of a button. The report is flushed at the end of the current main loop iteration.
  *
  * \param index The index of the button to press, from 0 to 31.
  */
 void programmable_button_register(uint8_t index);
 
 /**
- * \brief Reset the state of a button, and flush the report.
+ * \brief Reset the state of a button. The report is flushed at the end of the current main loop iteration.
  *
  * \param index The index of the button to release, from 0 to 31.
  */
@@ -70,7 +70,7 @@ void programmable_button_unregister(uint8_t index);
 bool programmable_button_is_on(uint8_t index);
 
 /**
- * \brief Send the programmable button report to the host.
+ * \brief Send the programmable button report to the host, if it has changed since the last send.
  */
 void programmable_button_flush(void);
 
@@ -293,6 +293,44 @@ void post_process_record_quantum(keyrecord_t *record) {
  *
  * Hands off handling to other quantum/process_keycode/ functions
  */
+// Keycode ranges claimed by the range-gated feature handlers in
+// process_record_quantum(). Sorted by start code so membership is a single
+// binary search per event; the guarded handlers never act on keycodes outside
+// their ranges, so they can be skipped wholesale for normal typing.
+typedef struct keycode_range_t {
+    uint16_t start;
+    uint16_t end;
+} keycode_range_t;
+
+static const keycode_range_t feature_keycode_ranges[] = {
+    {QK_MOMENTARY, QK_MOMENTARY_MAX},                       // layer lock bookkeeping
+    {QK_LAYER_TAP_TOGGLE, QK_LAYER_TAP_TOGGLE_MAX},         // layer lock bookkeeping
+    {QK_PERSISTENT_DEF_LAYER, QK_PERSISTENT_DEF_LAYER_MAX}, // default layer
+    {QK_MAGIC, QK_MAGIC_MAX},                               // magic
+    {QK_SEQUENCER, QK_SEQUENCER_MAX},                       // sequencer
+    {QK_JOYSTICK, QK_JOYSTICK_MAX},                         // joystick
+    {QK_PROGRAMMABLE_BUTTON, QK_PROGRAMMABLE_BUTTON_MAX},   // programmable button
+    {QK_CONNECTION, QK_CONNECTION_MAX},                     // connection
+    {QK_LIGHTING, QK_LIGHTING_MAX},                         // backlight, led matrix, underglow, rgb matrix
+    {QK_QUANTUM, QK_QUANTUM_MAX},                           // grave escape, tri layer, layer lock, dynamic tapping term
+};
+
+static bool keycode_claimed_by_feature(uint16_t keycode) {
+    uint8_t lo = 0;
+    uint8_t hi = ARRAY_SIZE(feature_keycode_ranges);
+    while (lo < hi) {
+        uint8_t mid = (lo + hi) / 2;
+        if (keycode < feature_keycode_ranges[mid].start) {
+            hi = mid;
+        } else if (keycode > feature_keycode_ranges[mid].end) {
+            lo = mid + 1;
+        } else {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool process_record_quantum(keyrecord_t *record) {
     uint16_t keycode = get_record_keycode(record, true);
 
@@ -330,6 +368,10 @@ bool process_record_quantum(keyrecord_t *record) {
     }
 #endif
 
+    // One range lookup lets all range-gated handlers below be skipped for
+    // keycodes none of them claim
+    const bool in_feature_range = keycode_claimed_by_feature(keycode);
+
     if (!(
 #if defined(KEY_LOCK_ENABLE)
             // Must run first to be able to mask key_up events.
@@ -360,7 +402,7 @@ bool process_record_quantum(keyrecord_t *record) {
             process_secure(keycode, record) &&
 #endif
 #if defined(SEQUENCER_ENABLE)
-            process_sequencer(keycode, record) &&
+            (!in_feature_range || process_sequencer(keycode, record)) &&
 #endif
 #if defined(MIDI_ENABLE) && defined(MIDI_ADVANCED)
             process_midi(keycode, record) &&
@@ -369,10 +411,10 @@ bool process_record_quantum(keyrecord_t *record) {
             process_audio(keycode, record) &&
 #endif
 #if defined(BACKLIGHT_ENABLE)
-            process_backlight(keycode, record) &&
+            (!in_feature_range || process_backlight(keycode, record)) &&
 #endif
 #if defined(LED_MATRIX_ENABLE)
-            process_led_matrix(keycode, record) &&
+            (!in_feature_range || process_led_matrix(keycode, record)) &&
 #endif
 #ifdef STENO_ENABLE
             process_steno(keycode, record) &&
@@ -399,43 +441,43 @@ bool process_record_quantum(keyrecord_t *record) {
             process_auto_shift(keycode, record) &&
 #endif
 #ifdef DYNAMIC_TAPPING_TERM_ENABLE
-            process_dynamic_tapping_term(keycode, record) &&
+            (!in_feature_range || process_dynamic_tapping_term(keycode, record)) &&
 #endif
 #ifdef SPACE_CADET_ENABLE
             process_space_cadet(keycode, record) &&
 #endif
 #ifdef MAGIC_ENABLE
-            process_magic(keycode, record) &&
+            (!in_feature_range || process_magic(keycode, record)) &&
 #endif
 #ifdef GRAVE_ESC_ENABLE
-            process_grave_esc(keycode, record) &&
+            (!in_feature_range || process_grave_esc(keycode, record)) &&
 #endif
 #if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
-            process_underglow(keycode, record) &&
+            (!in_feature_range || process_underglow(keycode, record)) &&
 #endif
 #if defined(RGB_MATRIX_ENABLE)
-            process_rgb_matrix(keycode, record) &&
+            (!in_feature_range || process_rgb_matrix(keycode, record)) &&
 #endif
 #ifdef JOYSTICK_ENABLE
-            process_joystick(keycode, record) &&
+            (!in_feature_range || process_joystick(keycode, record)) &&
 #endif
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-            process_programmable_button(keycode, record) &&
+            (!in_feature_range || process_programmable_button(keycode, record)) &&
 #endif
 #ifdef AUTOCORRECT_ENABLE
             process_autocorrect(keycode, record) &&
 #endif
 #ifdef TRI_LAYER_ENABLE
-            process_tri_layer(keycode, record) &&
+            (!in_feature_range || process_tri_layer(keycode, record)) &&
 #endif
 #if !defined(NO_ACTION_LAYER)
-            process_default_layer(keycode, record) &&
+            (!in_feature_range || process_default_layer(keycode, record)) &&
 #endif
 #ifdef LAYER_LOCK_ENABLE
-            process_layer_lock(keycode, record) &&
+            (!in_feature_range || process_layer_lock(keycode, record)) &&
 #endif
 #ifdef CONNECTION_ENABLE
-            process_connection(keycode, record) &&
+            (!in_feature_range || process_connection(keycode, record)) &&
 #endif
 #ifndef NO_ACTION_ONESHOT
             process_oneshot(keycode, record) &&
@@ -474,52 +516,64 @@ __attribute__((weak)) bool shutdown_kb(bool jump_to_bootloader) {
     return true;
 }
 
+// Set once the one-shot teardown in suspend_power_down_quantum() has run.
+// The platform suspend loop calls that function every sleep cycle, but
+// parking the feature state once per suspend is enough; keeping the repeat
+// path trivial saves power while suspended, and the parked state is restored
+// warm from RAM on wakeup instead of being re-initialised.
+static bool suspend_features_parked = false;
+
 void suspend_power_down_quantum(void) {
     suspend_power_down_modules();
     suspend_power_down_kb();
 #ifndef NO_SUSPEND_POWER_DOWN
+    if (!suspend_features_parked) {
+        suspend_features_parked = true;
+
 // Turn off backlight
 #    ifdef BACKLIGHT_ENABLE
-    backlight_level_noeeprom(0);
+        backlight_level_noeeprom(0);
 #    endif
 
 #    ifdef SLEEP_LED_ENABLE
-    sleep_led_enable();
+        sleep_led_enable();
 #    endif
 
 #    ifdef LED_MATRIX_ENABLE
-    led_matrix_task();
+        led_matrix_task();
 #    endif
 #    ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+        rgb_matrix_task();
 #    endif
 
-    // Turn off LED indicators
-    led_suspend();
+        // Turn off LED indicators
+        led_suspend();
 
 // Turn off audio
 #    ifdef AUDIO_ENABLE
-    stop_all_notes();
+        stop_all_notes();
 #    endif
 
 // Turn off underglow
 #    if defined(RGBLIGHT_SLEEP) && defined(RGBLIGHT_ENABLE)
-    rgblight_suspend();
+        rgblight_suspend();
 #    endif
 
 #    if defined(LED_MATRIX_ENABLE)
-    led_matrix_set_suspend_state(true);
+        led_matrix_set_suspend_state(true);
 #    endif
 #    if defined(RGB_MATRIX_ENABLE)
-    rgb_matrix_set_suspend_state(true);
+        rgb_matrix_set_suspend_state(true);
 #    endif
 
 #    ifdef OLED_ENABLE
-    oled_off();
+        oled_off();
 #    endif
 #    ifdef ST7565_ENABLE
-    st7565_off();
+        st7565_off();
 #    endif
+    }
+
 #    if defined(POINTING_DEVICE_ENABLE)
     // run to ensure scanning occurs while suspended
     pointing_device_task();
@@ -528,9 +582,15 @@ void suspend_power_down_quantum(void) {
 }
 
 __attribute__((weak)) void suspend_wakeup_init_quantum(void) {
+    // The state below was parked by suspend_power_down_quantum() and is
+    // restored warm from RAM - nothing on this path re-reads the EEPROM or
+    // re-initialises a driver, so the first report after wakeup is not held
+    // up behind cold re-init.
+    suspend_features_parked = false;
+
 // Turn on backlight
 #ifdef BACKLIGHT_ENABLE
-    backlight_init();
+    backlight_wakeup();
 #endif
 
 #ifdef SLEEP_LED_ENABLE
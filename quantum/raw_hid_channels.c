@@ -0,0 +1,102 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <string.h>
+
+#include "raw_hid_channels.h"
+#include "raw_hid.h"
+
+#ifdef VIA_ENABLE
+#    error "RAW_HID_CHANNELS cannot be used together with VIA, which owns the raw HID endpoint"
+#endif
+
+typedef struct raw_hid_channel_t {
+    raw_hid_channel_handler_t handler;
+    uint8_t                   priority;
+    uint8_t                   queue_head;  // next report to dispatch
+    uint8_t                   queue_count; // reports currently queued
+    uint16_t                  dropped;
+    uint8_t                   queue[RAW_HID_CHANNEL_QUEUE_DEPTH][RAW_HID_CHANNEL_PAYLOAD_SIZE];
+} raw_hid_channel_t;
+
+static raw_hid_channel_t channels[RAW_HID_CHANNEL_COUNT];
+
+bool raw_hid_channel_register(uint8_t channel, raw_hid_channel_handler_t handler, uint8_t priority) {
+    if (channel >= (RAW_HID_CHANNEL_COUNT)) {
+        return false;
+    }
+    channels[channel].handler  = handler;
+    channels[channel].priority = priority;
+    return true;
+}
+
+bool raw_hid_channel_send(uint8_t channel, const uint8_t *data, uint8_t length) {
+    if (channel >= (RAW_HID_CHANNEL_COUNT) || length > RAW_HID_CHANNEL_PAYLOAD_SIZE) {
+        return false;
+    }
+    uint8_t report[RAW_HID_CHANNEL_PAYLOAD_SIZE + 1] = {channel};
+    memcpy(&report[1], data, length);
+    raw_hid_send(report, sizeof(report));
+    return true;
+}
+
+uint16_t raw_hid_channel_dropped(uint8_t channel) {
+    if (channel >= (RAW_HID_CHANNEL_COUNT)) {
+        return 0;
+    }
+    return channels[channel].dropped;
+}
+
+// Receive path: only queue placement happens here, so the USB interrupt (or
+// polling task, depending on the protocol) never runs channel handlers.
+void raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 1) {
+        return;
+    }
+    uint8_t id = data[0];
+    if (id >= (RAW_HID_CHANNEL_COUNT) || channels[id].handler == NULL) {
+        return;
+    }
+    raw_hid_channel_t *channel = &channels[id];
+    if (channel->queue_count == (RAW_HID_CHANNEL_QUEUE_DEPTH)) {
+        channel->dropped++;
+        return;
+    }
+    uint8_t slot = (channel->queue_head + channel->queue_count) % (RAW_HID_CHANNEL_QUEUE_DEPTH);
+    memset(channel->queue[slot], 0, RAW_HID_CHANNEL_PAYLOAD_SIZE);
+    memcpy(channel->queue[slot], &data[1], length - 1 < RAW_HID_CHANNEL_PAYLOAD_SIZE ? length - 1 : RAW_HID_CHANNEL_PAYLOAD_SIZE);
+    channel->queue_count++;
+}
+
+// Pop one report from the highest-priority channel with queued traffic;
+// returns false when all queues are empty.
+static bool dispatch_one(void) {
+    raw_hid_channel_t *best    = NULL;
+    uint8_t            best_id = 0;
+    for (uint8_t id = 0; id < (RAW_HID_CHANNEL_COUNT); id++) {
+        raw_hid_channel_t *channel = &channels[id];
+        if (channel->queue_count == 0) {
+            continue;
+        }
+        if (best == NULL || channel->priority < best->priority) {
+            best    = channel;
+            best_id = id;
+        }
+    }
+    if (best == NULL) {
+        return false;
+    }
+
+    uint8_t slot = best->queue_head;
+    best->queue_head = (best->queue_head + 1) % (RAW_HID_CHANNEL_QUEUE_DEPTH);
+    best->queue_count--;
+    best->handler(best_id, best->queue[slot], RAW_HID_CHANNEL_PAYLOAD_SIZE);
+    return true;
+}
+
+void raw_hid_channels_task(void) {
+    for (uint8_t i = 0; i < (RAW_HID_CHANNELS_DISPATCH_PER_TASK); i++) {
+        if (!dispatch_one()) {
+            break;
+        }
+    }
+}
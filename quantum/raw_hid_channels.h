@@ -0,0 +1,83 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * \file
+ *
+ * \defgroup raw_hid_channels Raw HID channel multiplexing
+ *
+ * Framing layer over the single raw HID endpoint: the first byte of every
+ * report is a channel id, the remaining bytes are channel payload. Incoming
+ * reports are queued per channel inside the USB receive path and dispatched
+ * to registered handlers from the housekeeping task in priority order, so a
+ * bulk transfer on one channel cannot starve an interactive one. Queue
+ * overflow drops the report and bumps a per-channel counter the host can use
+ * for backpressure.
+ *
+ * Not compatible with VIA, which owns the raw HID endpoint with its own
+ * unframed protocol.
+ * \{
+ */
+
+// Number of multiplexed channels
+#ifndef RAW_HID_CHANNEL_COUNT
+#    define RAW_HID_CHANNEL_COUNT 4
+#endif
+
+// Queued reports held per channel before new ones are dropped
+#ifndef RAW_HID_CHANNEL_QUEUE_DEPTH
+#    define RAW_HID_CHANNEL_QUEUE_DEPTH 2
+#endif
+
+// Reports dispatched per housekeeping pass, across all channels
+#ifndef RAW_HID_CHANNELS_DISPATCH_PER_TASK
+#    define RAW_HID_CHANNELS_DISPATCH_PER_TASK 2
+#endif
+
+// Payload bytes per report: one report minus the channel id byte
+#define RAW_HID_CHANNEL_PAYLOAD_SIZE 31
+
+/**
+ * \brief Handler for payloads received on a channel. `data` points at the
+ * payload (the channel byte is stripped), `length` is always
+ * \ref RAW_HID_CHANNEL_PAYLOAD_SIZE.
+ */
+typedef void (*raw_hid_channel_handler_t)(uint8_t channel, const uint8_t *data, uint8_t length);
+
+/**
+ * \brief Register a handler for a channel.
+ *
+ * \param channel Channel id, 0 to \ref RAW_HID_CHANNEL_COUNT - 1.
+ * \param handler Invoked from the housekeeping task for each queued report.
+ * \param priority Dispatch order between channels with queued traffic; lower
+ * values are dispatched first. Give input-affecting channels low values.
+ *
+ * \return true if the channel id was valid.
+ */
+bool raw_hid_channel_register(uint8_t channel, raw_hid_channel_handler_t handler, uint8_t priority);
+
+/**
+ * \brief Send a payload on a channel. Payloads shorter than
+ * \ref RAW_HID_CHANNEL_PAYLOAD_SIZE are zero-padded.
+ *
+ * \return false if the channel id was invalid or the payload too long.
+ */
+bool raw_hid_channel_send(uint8_t channel, const uint8_t *data, uint8_t length);
+
+/**
+ * \brief Number of received reports dropped on a channel because its queue
+ * was full. Wraps at 16 bits; report it to the host for backpressure.
+ */
+uint16_t raw_hid_channel_dropped(uint8_t channel);
+
+/**
+ * \brief Dispatch queued reports to their handlers. Called from the
+ * housekeeping task.
+ */
+void raw_hid_channels_task(void);
+
+/** \} */
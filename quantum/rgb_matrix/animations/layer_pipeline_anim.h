@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef RGB_MATRIX_LAYER_PIPELINE
+RGB_MATRIX_EFFECT(LAYER_PIPELINE)
+#    ifdef RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+
+bool LAYER_PIPELINE(effect_params_t* params) {
+    return rgb_matrix_layer_pipeline_render(params);
+}
+
+#    endif // RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+#endif     // RGB_MATRIX_LAYER_PIPELINE
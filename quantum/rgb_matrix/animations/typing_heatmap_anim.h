@@ -16,10 +16,28 @@ RGB_MATRIX_EFFECT(TYPING_HEATMAP)
 #        ifndef RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT
 #            define RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT 16
 #        endif
+// Number of heatmap cells with nonzero energy; lets idle frames skip the
+// full-matrix decay and render pass once everything has cooled.
+static uint16_t heatmap_active_cells;
+// Whether a full black frame has been rendered since the last cell cooled.
+static bool heatmap_idle_rendered;
+
+// Accumulate energy into one heatmap cell, keeping the active-cell count.
+static void typing_heatmap_add(uint8_t row, uint8_t col, uint8_t amount) {
+    if (amount == 0) {
+        return;
+    }
+    if (g_rgb_frame_buffer[row][col] == 0) {
+        heatmap_active_cells++;
+    }
+    g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], amount);
+    heatmap_idle_rendered        = false;
+}
+
 void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
 #        ifdef RGB_MATRIX_TYPING_HEATMAP_SLIM
     // Limit effect to pressed keys
-    g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+    typing_heatmap_add(row, col, RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
 #        else
     if (g_led_config.matrix_co[row][col] == NO_LED) { // skip as pressed key doesn't have an led position
         return;
@@ -30,7 +48,7 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
                 continue;
             }
             if (i_row == row && i_col == col) {
-                g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+                typing_heatmap_add(row, col, RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
             } else {
 #            define LED_DISTANCE(led_a, led_b) sqrt16(((int32_t)(led_a.x - led_b.x) * (int32_t)(led_a.x - led_b.x)) + ((int32_t)(led_a.y - led_b.y) * (int32_t)(led_a.y - led_b.y)))
                 uint8_t distance = LED_DISTANCE(g_led_config.point[g_led_config.matrix_co[row][col]], g_led_config.point[g_led_config.matrix_co[i_row][i_col]]);
@@ -40,7 +58,7 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
                     if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
                         amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
                     }
-                    g_rgb_frame_buffer[i_row][i_col] = qadd8(g_rgb_frame_buffer[i_row][i_col], amount);
+                    typing_heatmap_add(i_row, i_col, amount);
                 }
             }
         }
@@ -59,6 +77,8 @@ bool TYPING_HEATMAP(effect_params_t* params) {
     if (params->init) {
         rgb_matrix_set_color_all(0, 0, 0);
         memset(g_rgb_frame_buffer, 0, sizeof g_rgb_frame_buffer);
+        heatmap_active_cells  = 0;
+        heatmap_idle_rendered = false;
     }
 
     // The heatmap animation might run in several iterations depending on
@@ -73,6 +93,12 @@ bool TYPING_HEATMAP(effect_params_t* params) {
         }
     }
 
+    // Once every cell has cooled to zero and a full black frame has been
+    // rendered, there is nothing left to decay or draw.
+    if (heatmap_active_cells == 0 && heatmap_idle_rendered && !params->init) {
+        return false;
+    }
+
     // Render heatmap & decrease
     uint8_t count = 0;
     for (uint8_t row = 0; row < MATRIX_ROWS && count < RGB_MATRIX_LED_PROCESS_LIMIT; row++) {
@@ -86,14 +112,21 @@ bool TYPING_HEATMAP(effect_params_t* params) {
                 rgb_t rgb = rgb_matrix_hsv_to_rgb(hsv);
                 rgb_matrix_set_color(g_led_config.matrix_co[row][col], rgb.r, rgb.g, rgb.b);
 
-                if (decrease_heatmap_values) {
-                    g_rgb_frame_buffer[row][col] = qsub8(val, 1);
+                if (decrease_heatmap_values && val > 0) {
+                    g_rgb_frame_buffer[row][col] = val - 1;
+                    if (val == 1) {
+                        heatmap_active_cells--;
+                    }
                 }
             }
         }
     }
 
-    return rgb_matrix_check_finished_leds(led_max);
+    bool more_leds = rgb_matrix_check_finished_leds(led_max);
+    if (!more_leds && heatmap_active_cells == 0) {
+        heatmap_idle_rendered = true;
+    }
+    return more_leds;
 }
 
 #    endif // RGB_MATRIX_CUSTOM_EFFECT_IMPLS
@@ -27,3 +27,8 @@
     defined(ENABLE_RGB_MATRIX_SOLID_MULTISPLASH)
 #    define RGB_MATRIX_KEYPRESSES
 #endif
+
+// gamma correction
+#if defined(RGB_MATRIX_GAMMA_CORRECTION)
+#    define USE_GAMMA_CURVE
+#endif
@@ -17,11 +17,22 @@
  */
 
 #include "rgb_matrix.h"
+#include "compiler_support.h"
 #include "progmem.h"
 #include "eeconfig.h"
+#include "led_tables.h"
 #include "keyboard.h"
 #include "sync_timer.h"
 #include "debug.h"
+#ifdef RGB_MATRIX_IDLE_FADE
+#    include "deferred_exec.h"
+#endif
+#ifdef RGB_MATRIX_INDICATOR_RULES
+#    include "rgb_matrix_indicator_rules.h"
+#endif
+#ifdef RGB_MATRIX_LAYER_PIPELINE
+#    include "rgb_matrix_layers.h"
+#endif
 #include <string.h>
 #include <math.h>
 #include <stdlib.h>
@@ -86,6 +97,28 @@ static uint8_t         rgb_current_effect = 0;
 static effect_params_t rgb_effect_params  = {0, LED_FLAG_ALL, false};
 static rgb_task_states rgb_task_state     = SYNCING;
 
+#ifdef RGB_MATRIX_IDLE_FADE
+#    if !(RGB_MATRIX_TIMEOUT > 0)
+#        error "RGB_MATRIX_IDLE_FADE requires RGB_MATRIX_TIMEOUT to be set"
+#    endif
+#    ifndef DEFERRED_EXEC_ENABLE
+#        error "RGB_MATRIX_IDLE_FADE requires DEFERRED_EXEC_ENABLE"
+#    endif
+
+// How often the fade job runs, and how long the full fade takes
+#    ifndef RGB_MATRIX_IDLE_FADE_INTERVAL_MS
+#        define RGB_MATRIX_IDLE_FADE_INTERVAL_MS 33 // ~30 Hz
+#    endif
+#    ifndef RGB_MATRIX_IDLE_FADE_TIME_MS
+#        define RGB_MATRIX_IDLE_FADE_TIME_MS 1000
+#    endif
+
+static bool           rgb_idle_parked     = false;
+static bool           rgb_idle_fading     = false;
+static uint8_t        rgb_idle_saved_val  = 0;
+static deferred_token rgb_idle_fade_token = INVALID_DEFERRED_TOKEN;
+#endif // RGB_MATRIX_IDLE_FADE
+
 // double buffers
 static uint32_t rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -97,6 +130,44 @@ static last_hit_t last_hit_buffer;
 const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
 #endif
 
+#if defined(RGB_MATRIX_SPLIT) && !defined(SPLIT_TRANSPORT_MIRROR)
+static rgb_matrix_hit_sync_t hit_sync_queue;
+
+static void rgb_matrix_queue_hit_sync(uint8_t row, uint8_t col, bool pressed) {
+    // Only this half's hits need to go on the wire; the other half records its own locally
+    uint8_t first_row = is_keyboard_left() ? 0 : (MATRIX_ROWS) / 2;
+    if (row < first_row || row >= first_row + (MATRIX_ROWS) / 2) {
+        return;
+    }
+    if (hit_sync_queue.count == RGB_MATRIX_HIT_SYNC_EVENTS) {
+        // Queue overflow -- drop the oldest event, lighting is best-effort
+        memmove(&hit_sync_queue.events[0], &hit_sync_queue.events[1], sizeof(hit_sync_queue.events) - sizeof(hit_sync_queue.events[0]));
+        hit_sync_queue.count--;
+    }
+    hit_sync_queue.events[hit_sync_queue.count].row     = row;
+    hit_sync_queue.events[hit_sync_queue.count].col     = col;
+    hit_sync_queue.events[hit_sync_queue.count].pressed = pressed;
+    hit_sync_queue.count++;
+}
+
+bool rgb_matrix_get_hit_sync(rgb_matrix_hit_sync_t *sync) {
+    if (hit_sync_queue.count == 0) {
+        return false;
+    }
+    hit_sync_queue.seq++;
+    memcpy(sync, &hit_sync_queue, sizeof(hit_sync_queue));
+    hit_sync_queue.count = 0;
+    return true;
+}
+
+void rgb_matrix_apply_hit_sync(const rgb_matrix_hit_sync_t *sync) {
+    uint8_t count = sync->count < RGB_MATRIX_HIT_SYNC_EVENTS ? sync->count : RGB_MATRIX_HIT_SYNC_EVENTS;
+    for (uint8_t i = 0; i < count; i++) {
+        rgb_matrix_handle_key_event(sync->events[i].row, sync->events[i].col, sync->events[i].pressed);
+    }
+}
+#endif // defined(RGB_MATRIX_SPLIT) && !defined(SPLIT_TRANSPORT_MIRROR)
+
 EECONFIG_DEBOUNCE_HELPER(rgb_matrix, rgb_matrix_config);
 
 void eeconfig_force_flush_rgb_matrix(void) {
@@ -104,7 +175,7 @@ void eeconfig_force_flush_rgb_matrix(void) {
 }
 
 void eeconfig_update_rgb_matrix_default(void) {
-    dprintf("eeconfig_update_rgb_matrix_default\n");
+    rgb_dprintf("eeconfig_update_rgb_matrix_default\n");
     rgb_matrix_config.enable = RGB_MATRIX_DEFAULT_ON;
     rgb_matrix_config.mode   = RGB_MATRIX_DEFAULT_MODE;
     rgb_matrix_config.hsv    = (hsv_t){RGB_MATRIX_DEFAULT_HUE, RGB_MATRIX_DEFAULT_SAT, RGB_MATRIX_DEFAULT_VAL};
@@ -114,18 +185,18 @@ void eeconfig_update_rgb_matrix_default(void) {
 }
 
 void eeconfig_debug_rgb_matrix(void) {
-    dprintf("rgb_matrix_config EEPROM\n");
-    dprintf("rgb_matrix_config.enable = %d\n", rgb_matrix_config.enable);
+    rgb_dprintf("rgb_matrix_config EEPROM\n");
+    rgb_dprintf("rgb_matrix_config.enable = %d\n", rgb_matrix_config.enable);
 #ifdef RGB_MATRIX_MODE_NAME_ENABLE
-    dprintf("rgb_matrix_config.mode = %d (%s)\n", rgb_matrix_config.mode, rgb_matrix_get_mode_name(rgb_matrix_config.mode));
+    rgb_dprintf("rgb_matrix_config.mode = %d (%s)\n", rgb_matrix_config.mode, rgb_matrix_get_mode_name(rgb_matrix_config.mode));
 #else
-    dprintf("rgb_matrix_config.mode = %d\n", rgb_matrix_config.mode);
+    rgb_dprintf("rgb_matrix_config.mode = %d\n", rgb_matrix_config.mode);
 #endif // RGB_MATRIX_MODE_NAME_ENABLE
-    dprintf("rgb_matrix_config.hsv.h = %d\n", rgb_matrix_config.hsv.h);
-    dprintf("rgb_matrix_config.hsv.s = %d\n", rgb_matrix_config.hsv.s);
-    dprintf("rgb_matrix_config.hsv.v = %d\n", rgb_matrix_config.hsv.v);
-    dprintf("rgb_matrix_config.speed = %d\n", rgb_matrix_config.speed);
-    dprintf("rgb_matrix_config.flags = %d\n", rgb_matrix_config.flags);
+    rgb_dprintf("rgb_matrix_config.hsv.h = %d\n", rgb_matrix_config.hsv.h);
+    rgb_dprintf("rgb_matrix_config.hsv.s = %d\n", rgb_matrix_config.hsv.s);
+    rgb_dprintf("rgb_matrix_config.hsv.v = %d\n", rgb_matrix_config.hsv.v);
+    rgb_dprintf("rgb_matrix_config.speed = %d\n", rgb_matrix_config.speed);
+    rgb_dprintf("rgb_matrix_config.flags = %d\n", rgb_matrix_config.flags);
 }
 
 void rgb_matrix_reload_from_eeprom(void) {
@@ -182,7 +253,11 @@ void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         return;
     }
 
+#ifdef RGB_MATRIX_GAMMA_CORRECTION
+    rgb_matrix_driver.set_color(led_index, pgm_read_byte(&GAMMA_CURVE[red]), pgm_read_byte(&GAMMA_CURVE[green]), pgm_read_byte(&GAMMA_CURVE[blue]));
+#else
     rgb_matrix_driver.set_color(led_index, red, green, blue);
+#endif
 }
 
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -190,7 +265,11 @@ void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
 #else
+#    ifdef RGB_MATRIX_GAMMA_CORRECTION
+    rgb_matrix_driver.set_color_all(pgm_read_byte(&GAMMA_CURVE[red]), pgm_read_byte(&GAMMA_CURVE[green]), pgm_read_byte(&GAMMA_CURVE[blue]));
+#    else
     rgb_matrix_driver.set_color_all(red, green, blue);
+#    endif
 #endif
 }
 
@@ -199,6 +278,14 @@ void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
     if (!is_keyboard_master()) return;
 #endif
 
+#if defined(RGB_MATRIX_SPLIT) && !defined(SPLIT_TRANSPORT_MIRROR)
+    // Without matrix mirroring the other half never sees this hit, so queue it for sync.
+    // Only the master forwards events -- it observes both halves, the slave only its own.
+    if (is_keyboard_master()) {
+        rgb_matrix_queue_hit_sync(row, col, pressed);
+    }
+#endif
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     uint8_t led[LED_HITS_TO_REMEMBER];
     uint8_t led_count = 0;
@@ -315,9 +402,11 @@ static void rgb_task_start(void) {
     // Ideally we would also stop sending zeros to the LED driver PWM buffers
     // while suspended and just do a software shutdown. This is a cheap hack for now.
     bool suspend_backlight = suspend_state ||
-#if RGB_MATRIX_TIMEOUT > 0
+#if RGB_MATRIX_TIMEOUT > 0 && !defined(RGB_MATRIX_IDLE_FADE)
+                             // With RGB_MATRIX_IDLE_FADE the timeout is handled
+                             // by the deferred fade job instead of a hard cut
                              (last_input_activity_elapsed() > (uint32_t)RGB_MATRIX_TIMEOUT) ||
-#endif // RGB_MATRIX_TIMEOUT > 0
+#endif // RGB_MATRIX_TIMEOUT > 0 && !defined(RGB_MATRIX_IDLE_FADE)
                              false;
 
     // Set effect to be renedered
@@ -327,44 +416,30 @@ static void rgb_task_start(void) {
     rgb_task_state = RENDERING;
 }
 
-static void rgb_task_render(uint8_t effect) {
-    bool rendering         = false;
-    rgb_effect_params.init = (effect != rgb_last_effect) || (rgb_matrix_config.enable != rgb_last_enable);
-    if (rgb_effect_params.flags != rgb_matrix_config.flags) {
-        rgb_effect_params.flags = rgb_matrix_config.flags;
-        rgb_matrix_set_color_all(0, 0, 0);
-    }
+typedef bool (*rgb_matrix_effect_fn_t)(effect_params_t *params);
 
-    // each effect can opt to do calculations
-    // and/or request PWM buffer updates.
-    switch (effect) {
-        case RGB_MATRIX_NONE:
-            rendering = rgb_matrix_none(&rgb_effect_params);
-            break;
+// Dense dispatch table indexed by the rgb_matrix_effects enum. The entries
+// line up because both are generated from the same .inc includes, and only
+// enabled effects occupy slots, so disabled ones cost neither flash nor a
+// branch in the per-frame path.
+// clang-format off
+static const rgb_matrix_effect_fn_t effect_funcs[RGB_MATRIX_EFFECT_MAX] PROGMEM = {
+    [RGB_MATRIX_NONE] = rgb_matrix_none,
 
 // ---------------------------------------------
-// -----Begin rgb effect switch case macros-----
-#define RGB_MATRIX_EFFECT(name, ...)          \
-    case RGB_MATRIX_##name:                   \
-        rendering = name(&rgb_effect_params); \
-        break;
+// -----Begin rgb effect table entry macros-----
+#define RGB_MATRIX_EFFECT(name, ...) [RGB_MATRIX_##name] = name,
 #include "rgb_matrix_effects.inc"
 #undef RGB_MATRIX_EFFECT
 
 #ifdef COMMUNITY_MODULES_ENABLE
-#    define RGB_MATRIX_EFFECT(name, ...)          \
-        case RGB_MATRIX_COMMUNITY_MODULE_##name:  \
-            rendering = name(&rgb_effect_params); \
-            break;
+#    define RGB_MATRIX_EFFECT(name, ...) [RGB_MATRIX_COMMUNITY_MODULE_##name] = name,
 #    include "rgb_matrix_community_modules.inc"
 #    undef RGB_MATRIX_EFFECT
 #endif
 
 #if defined(RGB_MATRIX_CUSTOM_KB) || defined(RGB_MATRIX_CUSTOM_USER)
-#    define RGB_MATRIX_EFFECT(name, ...)          \
-        case RGB_MATRIX_CUSTOM_##name:            \
-            rendering = name(&rgb_effect_params); \
-            break;
+#    define RGB_MATRIX_EFFECT(name, ...) [RGB_MATRIX_CUSTOM_##name] = name,
 #    ifdef RGB_MATRIX_CUSTOM_KB
 #        include "rgb_matrix_kb.inc"
 #    endif
@@ -373,15 +448,30 @@ static void rgb_task_render(uint8_t effect) {
 #    endif
 #    undef RGB_MATRIX_EFFECT
 #endif
-            // -----End rgb effect switch case macros-------
-            // ---------------------------------------------
+    // -----End rgb effect table entry macros-------
+    // ---------------------------------------------
+};
+// clang-format on
 
-        // Factory default magic value
-        case UINT8_MAX: {
-            rgb_matrix_test();
-            rgb_task_state = FLUSHING;
-        }
-            return;
+static void rgb_task_render(uint8_t effect) {
+    bool rendering         = false;
+    rgb_effect_params.init = (effect != rgb_last_effect) || (rgb_matrix_config.enable != rgb_last_enable);
+    if (rgb_effect_params.flags != rgb_matrix_config.flags) {
+        rgb_effect_params.flags = rgb_matrix_config.flags;
+        rgb_matrix_set_color_all(0, 0, 0);
+    }
+
+    // Factory default magic value
+    if (effect == UINT8_MAX) {
+        rgb_matrix_test();
+        rgb_task_state = FLUSHING;
+        return;
+    }
+
+    // each effect can opt to do calculations
+    // and/or request PWM buffer updates.
+    if (effect < RGB_MATRIX_EFFECT_MAX) {
+        rendering = ((rgb_matrix_effect_fn_t)pgm_read_ptr(&effect_funcs[effect]))(&rgb_effect_params);
     }
 
     rgb_effect_params.iter++;
@@ -408,7 +498,86 @@ static void rgb_task_flush(uint8_t effect) {
     rgb_task_state = SYNCING;
 }
 
-void rgb_matrix_task(void) {
+static void rgb_task_render_step(uint8_t effect) {
+    rgb_task_render(effect);
+    if (effect) {
+        if (rgb_task_state == FLUSHING) { // ensure we only draw basic indicators once rendering is finished
+            rgb_matrix_indicators();
+        }
+        rgb_matrix_indicators_advanced(&rgb_effect_params);
+    }
+}
+
+#ifdef RGB_MATRIX_IDLE_FADE
+/* Instead of cutting to black the moment RGB_MATRIX_TIMEOUT expires and then
+ * keeping the full render loop ticking, idle handling runs as a deferred-exec
+ * job: on the idle deadline a fade steps the brightness down at the fade
+ * interval (~30 Hz), and once dark the whole rgb task parks itself -- every
+ * invocation returns after a single timer compare until input resumes. The
+ * brightness changes are made directly on the RAM copy of the config and are
+ * never flagged for eeconfig, so the user's value is untouched in EEPROM. */
+static uint32_t rgb_idle_fade_step(uint32_t trigger_time, void *cb_arg) {
+    uint8_t steps = (RGB_MATRIX_IDLE_FADE_TIME_MS) / (RGB_MATRIX_IDLE_FADE_INTERVAL_MS);
+    uint8_t delta = rgb_idle_saved_val / (steps ? steps : 1);
+    if (delta == 0) delta = 1;
+
+    if (rgb_matrix_config.hsv.v > delta) {
+        rgb_matrix_config.hsv.v -= delta;
+        return RGB_MATRIX_IDLE_FADE_INTERVAL_MS;
+    }
+
+    // Fade finished: blank the LEDs once, park the task, and restore the
+    // brightness so the wake-up frame renders at the pre-idle level
+    rgb_matrix_config.hsv.v = 0;
+    rgb_matrix_set_color_all(0, 0, 0);
+    rgb_matrix_update_pwm_buffers();
+    rgb_matrix_config.hsv.v = rgb_idle_saved_val;
+    rgb_idle_fading         = false;
+    rgb_idle_parked         = true;
+    rgb_idle_fade_token     = INVALID_DEFERRED_TOKEN;
+    return 0;
+}
+
+// Returns true when the rgb task is parked and should do no work this scan
+static bool rgb_idle_task(void) {
+    bool input_active = last_input_activity_elapsed() <= (uint32_t)RGB_MATRIX_TIMEOUT;
+
+    if (rgb_idle_parked) {
+        if (!input_active) {
+            return true;
+        }
+        // Input resumed: rejoin the render loop at the saved brightness
+        rgb_idle_parked = false;
+        rgb_task_state  = STARTING;
+        return false;
+    }
+
+    if (rgb_idle_fading) {
+        if (input_active) {
+            // Input during the fade: cancel it and snap back to full brightness
+            cancel_deferred_exec(rgb_idle_fade_token);
+            rgb_idle_fade_token     = INVALID_DEFERRED_TOKEN;
+            rgb_matrix_config.hsv.v = rgb_idle_saved_val;
+            rgb_idle_fading         = false;
+        }
+        return false;
+    }
+
+    if (!input_active && !suspend_state && rgb_matrix_config.enable) {
+        rgb_idle_saved_val  = rgb_matrix_config.hsv.v;
+        rgb_idle_fade_token = defer_exec(RGB_MATRIX_IDLE_FADE_INTERVAL_MS, rgb_idle_fade_step, NULL);
+        rgb_idle_fading     = rgb_idle_fade_token != INVALID_DEFERRED_TOKEN;
+    }
+    return false;
+}
+#endif // RGB_MATRIX_IDLE_FADE
+
+FAST_CODE void rgb_matrix_task(void) {
+#ifdef RGB_MATRIX_IDLE_FADE
+    if (rgb_idle_task()) {
+        return;
+    }
+#endif
     rgb_task_timers();
 
     uint8_t effect = rgb_current_effect;
@@ -418,13 +587,16 @@ void rgb_matrix_task(void) {
             rgb_task_start();
             break;
         case RENDERING:
-            rgb_task_render(effect);
-            if (effect) {
-                if (rgb_task_state == FLUSHING) { // ensure we only draw basic indicators once rendering is finished
-                    rgb_matrix_indicators();
-                }
-                rgb_matrix_indicators_advanced(&rgb_effect_params);
+            rgb_task_render_step(effect);
+#if defined(RGB_MATRIX_RENDER_BUDGET_MS) && RGB_MATRIX_RENDER_BUDGET_MS > 0
+            // Keep rendering further RGB_MATRIX_LED_PROCESS_LIMIT slices of
+            // the frame while this invocation is within its time budget, so
+            // small slices no longer stretch a frame across many scan loops.
+            // The iter cursor inside rgb_effect_params carries across calls.
+            while (rgb_task_state == RENDERING && sync_timer_elapsed32(rgb_timer_buffer) < RGB_MATRIX_RENDER_BUDGET_MS) {
+                rgb_task_render_step(effect);
             }
+#endif
             break;
         case FLUSHING:
             rgb_task_flush(effect);
@@ -491,6 +663,10 @@ void rgb_matrix_indicators_advanced(effect_params_t *params) {
      * rgb_task_render, right before the iter++ line.
      */
     RGB_MATRIX_USE_LIMITS_ITER(min, max, params->iter - 1);
+#ifdef RGB_MATRIX_INDICATOR_RULES
+    // Declarative rules draw first so the kb/user hooks can still paint over them
+    rgb_matrix_indicator_rules_apply(min, max);
+#endif
     rgb_matrix_indicators_advanced_modules(min, max);
     rgb_matrix_indicators_advanced_kb(min, max);
 }
@@ -503,10 +679,37 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
     return true;
 }
 
+#if defined(RGB_MATRIX_KEYREACTIVE_ENABLED) && defined(RGB_MATRIX_DISTANCE_TABLE)
+// Pairwise LED distances from g_led_config.point[], computed once at init so
+// splash effects look distances up instead of taking a square root per LED per
+// hit per frame. Costs RGB_MATRIX_LED_COUNT^2 bytes of RAM.
+static uint8_t led_distance_table[RGB_MATRIX_LED_COUNT][RGB_MATRIX_LED_COUNT];
+
+uint8_t rgb_matrix_led_distance(uint8_t a, uint8_t b) {
+    return led_distance_table[a][b];
+}
+
+static void rgb_matrix_build_distance_table(void) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        led_distance_table[i][i] = 0;
+        for (uint8_t j = i + 1; j < RGB_MATRIX_LED_COUNT; j++) {
+            int16_t dx               = g_led_config.point[i].x - g_led_config.point[j].x;
+            int16_t dy               = g_led_config.point[i].y - g_led_config.point[j].y;
+            uint8_t dist             = sqrt16(dx * dx + dy * dy);
+            led_distance_table[i][j] = dist;
+            led_distance_table[j][i] = dist;
+        }
+    }
+}
+#endif // defined(RGB_MATRIX_KEYREACTIVE_ENABLED) && defined(RGB_MATRIX_DISTANCE_TABLE)
+
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+#    ifdef RGB_MATRIX_DISTANCE_TABLE
+    rgb_matrix_build_distance_table();
+#    endif
     g_last_hit_tracker.count = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
         g_last_hit_tracker.tick[i] = UINT16_MAX;
@@ -520,7 +723,7 @@ void rgb_matrix_init(void) {
 
     eeconfig_init_rgb_matrix();
     if (!rgb_matrix_config.mode) {
-        dprintf("rgb_matrix_init_drivers rgb_matrix_config.mode = 0. Write default values to EEPROM.\n");
+        rgb_dprintf("rgb_matrix_init_drivers rgb_matrix_config.mode = 0. Write default values to EEPROM.\n");
         eeconfig_update_rgb_matrix_default();
     }
     eeconfig_debug_rgb_matrix(); // display current eeprom values
@@ -544,7 +747,7 @@ void rgb_matrix_toggle_eeprom_helper(bool write_to_eeprom) {
     rgb_matrix_config.enable ^= 1;
     rgb_task_state = STARTING;
     eeconfig_flag_rgb_matrix(write_to_eeprom);
-    dprintf("rgb matrix toggle [%s]: rgb_matrix_config.enable = %u\n", (write_to_eeprom) ? "EEPROM" : "NOEEPROM", rgb_matrix_config.enable);
+    rgb_dprintf("rgb matrix toggle [%s]: rgb_matrix_config.enable = %u\n", (write_to_eeprom) ? "EEPROM" : "NOEEPROM", rgb_matrix_config.enable);
 }
 void rgb_matrix_toggle_noeeprom(void) {
     rgb_matrix_toggle_eeprom_helper(false);
@@ -591,9 +794,9 @@ void rgb_matrix_mode_eeprom_helper(uint8_t mode, bool write_to_eeprom) {
     rgb_task_state = STARTING;
     eeconfig_flag_rgb_matrix(write_to_eeprom);
 #ifdef RGB_MATRIX_MODE_NAME_ENABLE
-    dprintf("rgb matrix mode [%s]: %u (%s)\n", (write_to_eeprom) ? "EEPROM" : "NOEEPROM", (unsigned)rgb_matrix_config.mode, rgb_matrix_get_mode_name(rgb_matrix_config.mode));
+    rgb_dprintf("rgb matrix mode [%s]: %u (%s)\n", (write_to_eeprom) ? "EEPROM" : "NOEEPROM", (unsigned)rgb_matrix_config.mode, rgb_matrix_get_mode_name(rgb_matrix_config.mode));
 #else
-    dprintf("rgb matrix mode [%s]: %u\n", (write_to_eeprom) ? "EEPROM" : "NOEEPROM", (unsigned)rgb_matrix_config.mode);
+    rgb_dprintf("rgb matrix mode [%s]: %u\n", (write_to_eeprom) ? "EEPROM" : "NOEEPROM", (unsigned)rgb_matrix_config.mode);
 #endif // RGB_MATRIX_MODE_NAME_ENABLE
 }
 void rgb_matrix_mode_noeeprom(uint8_t mode) {
@@ -637,7 +840,7 @@ void rgb_matrix_sethsv_eeprom_helper(uint16_t hue, uint8_t sat, uint8_t val, boo
     rgb_matrix_config.hsv.s = sat;
     rgb_matrix_config.hsv.v = (val > RGB_MATRIX_MAXIMUM_BRIGHTNESS) ? RGB_MATRIX_MAXIMUM_BRIGHTNESS : val;
     eeconfig_flag_rgb_matrix(write_to_eeprom);
-    dprintf("rgb matrix set hsv [%s]: %u,%u,%u\n", (write_to_eeprom) ? "EEPROM" : "NOEEPROM", rgb_matrix_config.hsv.h, rgb_matrix_config.hsv.s, rgb_matrix_config.hsv.v);
+    rgb_dprintf("rgb matrix set hsv [%s]: %u,%u,%u\n", (write_to_eeprom) ? "EEPROM" : "NOEEPROM", rgb_matrix_config.hsv.h, rgb_matrix_config.hsv.s, rgb_matrix_config.hsv.v);
 }
 void rgb_matrix_sethsv_noeeprom(uint16_t hue, uint8_t sat, uint8_t val) {
     rgb_matrix_sethsv_eeprom_helper(hue, sat, val, false);
@@ -722,7 +925,7 @@ void rgb_matrix_decrease_val(void) {
 void rgb_matrix_set_speed_eeprom_helper(uint8_t speed, bool write_to_eeprom) {
     rgb_matrix_config.speed = speed;
     eeconfig_flag_rgb_matrix(write_to_eeprom);
-    dprintf("rgb matrix set speed [%s]: %u\n", (write_to_eeprom) ? "EEPROM" : "NOEEPROM", rgb_matrix_config.speed);
+    rgb_dprintf("rgb matrix set speed [%s]: %u\n", (write_to_eeprom) ? "EEPROM" : "NOEEPROM", rgb_matrix_config.speed);
 }
 void rgb_matrix_set_speed_noeeprom(uint8_t speed) {
     rgb_matrix_set_speed_eeprom_helper(speed, false);
@@ -758,7 +961,7 @@ void rgb_matrix_decrease_speed(void) {
 void rgb_matrix_set_flags_eeprom_helper(led_flags_t flags, bool write_to_eeprom) {
     rgb_matrix_config.flags = flags;
     eeconfig_flag_rgb_matrix(write_to_eeprom);
-    dprintf("rgb matrix set flags [%s]: %u\n", (write_to_eeprom) ? "EEPROM" : "NOEEPROM", rgb_matrix_config.flags);
+    rgb_dprintf("rgb matrix set flags [%s]: %u\n", (write_to_eeprom) ? "EEPROM" : "NOEEPROM", rgb_matrix_config.flags);
 }
 
 led_flags_t rgb_matrix_get_flags(void) {
@@ -166,6 +166,14 @@ void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
 
 void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed);
 
+#if defined(RGB_MATRIX_SPLIT) && !defined(SPLIT_TRANSPORT_MIRROR)
+// Drains this half's pending hit events into sync for transmission to the other
+// half; returns false if there is nothing to send
+bool rgb_matrix_get_hit_sync(rgb_matrix_hit_sync_t *sync);
+// Replays hit events received from the other half into the local effect state
+void rgb_matrix_apply_hit_sync(const rgb_matrix_hit_sync_t *sync);
+#endif // defined(RGB_MATRIX_SPLIT) && !defined(SPLIT_TRANSPORT_MIRROR)
+
 void rgb_matrix_task(void);
 
 // This runs after another backlight effect and replaces
@@ -180,6 +188,10 @@ bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
 void rgb_matrix_init(void);
 
+#if defined(RGB_MATRIX_KEYREACTIVE_ENABLED) && defined(RGB_MATRIX_DISTANCE_TABLE)
+uint8_t rgb_matrix_led_distance(uint8_t a, uint8_t b);
+#endif
+
 void rgb_matrix_reload_from_eeprom(void);
 
 void        rgb_matrix_set_suspend_state(bool state);
@@ -0,0 +1,136 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef RGB_MATRIX_INDICATOR_RULES
+
+#    include "rgb_matrix_indicator_rules.h"
+#    include "rgb_matrix.h"
+#    include "keymap_introspection.h"
+#    include "keymap_common.h"
+#    include "action_layer.h"
+#    include "debug.h"
+
+// Upper bound on compiled spans across all rules; a span is a run of
+// consecutive LED indices sharing one rule's colour.
+#    ifndef RGB_MATRIX_INDICATOR_MAX_SPANS
+#        define RGB_MATRIX_INDICATOR_MAX_SPANS 32
+#    endif
+
+typedef struct indicator_span_t {
+    uint8_t led_first;
+    uint8_t led_count;
+    uint8_t layer;
+    rgb_t   color;
+} indicator_span_t;
+
+static indicator_span_t span_pool[RGB_MATRIX_INDICATOR_MAX_SPANS];
+static uint8_t          span_pool_len = 0;
+static bool             spans_compiled = false;
+
+// Cached set of spans active for the current layer state, in rule order so
+// later rules draw over earlier ones.
+static uint8_t       active_spans[RGB_MATRIX_INDICATOR_MAX_SPANS];
+static uint8_t       active_span_count  = 0;
+static layer_state_t cached_layer_state = 0;
+static bool          active_list_valid  = false;
+
+static void emit_span(uint8_t led_first, uint8_t led_count, const rgb_matrix_indicator_rule_t *rule) {
+    if (span_pool_len >= RGB_MATRIX_INDICATOR_MAX_SPANS) {
+        dprintf("indicator rules: span pool full, raise RGB_MATRIX_INDICATOR_MAX_SPANS\n");
+        return;
+    }
+    span_pool[span_pool_len++] = (indicator_span_t){.led_first = led_first, .led_count = led_count, .layer = rule->layer, .color = rule->color};
+}
+
+static void compile_rule(const rgb_matrix_indicator_rule_t *rule) {
+    // For keycode-filtered rules, walk the matrix once to mark the matching
+    // LEDs; LEDs without a key position (e.g. underglow) never match a filter.
+    uint8_t member[(RGB_MATRIX_LED_COUNT + 7) / 8] = {0};
+    bool    filtered                               = rule->keycode != KC_NO;
+    if (filtered) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                uint8_t led = g_led_config.matrix_co[row][col];
+                if (led == NO_LED) continue;
+                uint16_t keycode = keymap_key_to_keycode(rule->layer, (keypos_t){.row = row, .col = col});
+                bool     match;
+                if (rule->keycode == KC_TRNS) {
+                    match = keycode != KC_TRNS && keycode != KC_NO;
+                } else {
+                    match = keycode == rule->keycode;
+                }
+                if (match) {
+                    member[led / 8] |= 1 << (led % 8);
+                }
+            }
+        }
+    }
+
+    uint8_t run_first = 0;
+    uint8_t run_len   = 0;
+    for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; led++) {
+        bool selected = (g_led_config.flags[led] & rule->flags) != 0;
+        if (selected && filtered) {
+            selected = (member[led / 8] >> (led % 8)) & 1;
+        }
+        if (selected) {
+            if (run_len == 0) run_first = led;
+            run_len++;
+        } else if (run_len) {
+            emit_span(run_first, run_len, rule);
+            run_len = 0;
+        }
+    }
+    if (run_len) {
+        emit_span(run_first, run_len, rule);
+    }
+}
+
+static void compile_spans(void) {
+    span_pool_len = 0;
+    for (uint16_t i = 0; i < rgb_matrix_indicator_rule_count(); i++) {
+        compile_rule(rgb_matrix_indicator_rule_get(i));
+    }
+    spans_compiled    = true;
+    active_list_valid = false;
+}
+
+static void rebuild_active_list(layer_state_t active_layers) {
+    active_span_count = 0;
+    for (uint8_t i = 0; i < span_pool_len; i++) {
+        if ((active_layers >> span_pool[i].layer) & 1) {
+            active_spans[active_span_count++] = i;
+        }
+    }
+    cached_layer_state = active_layers;
+    active_list_valid  = true;
+}
+
+void rgb_matrix_indicator_rules_apply(uint8_t led_min, uint8_t led_max) {
+    if (!spans_compiled) {
+        compile_spans();
+    }
+
+    layer_state_t active_layers = layer_state | default_layer_state;
+    if (!active_list_valid || active_layers != cached_layer_state) {
+        rebuild_active_list(active_layers);
+    }
+
+    for (uint8_t i = 0; i < active_span_count; i++) {
+        const indicator_span_t *span = &span_pool[active_spans[i]];
+        uint8_t                 first = span->led_first;
+        uint8_t                 last  = span->led_first + span->led_count; // exclusive
+        if (first < led_min) first = led_min;
+        if (last > led_max) last = led_max;
+        for (uint8_t led = first; led < last; led++) {
+            rgb_matrix_set_color(led, span->color.r, span->color.g, span->color.b);
+        }
+    }
+}
+
+void rgb_matrix_indicator_rules_invalidate(void) {
+    spans_compiled    = false;
+    active_list_valid = false;
+}
+
+#endif // RGB_MATRIX_INDICATOR_RULES
@@ -0,0 +1,38 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+#include "color.h"
+
+/* Declarative per-layer indicator rules. Instead of a hand-rolled
+ * `rgb_matrix_indicators_advanced_user()` walking every LED each frame, the
+ * keymap declares which key groups light up on which layers:
+ *
+ *     const rgb_matrix_indicator_rule_t rgb_matrix_indicator_rules[] = {
+ *         {.layer = 1, .flags = LED_FLAG_KEYLIGHT, .keycode = KC_TRNS, .color = {RGB_BLUE}},
+ *         {.layer = 2, .flags = LED_FLAG_MODIFIER, .keycode = KC_NO, .color = {RGB_RED}},
+ *     };
+ *
+ * The rules are compiled once into LED span lists, and the set of active
+ * spans is recomputed only when the layer state changes; per frame the
+ * engine just paints the cached spans. Later rules draw over earlier ones.
+ */
+
+typedef struct rgb_matrix_indicator_rule_t {
+    uint8_t  layer;   // layer that activates the rule
+    uint8_t  flags;   // LED flag mask selecting the key group (LED_FLAG_ALL for every LED)
+    uint16_t keycode; // KC_NO: no keycode filter; KC_TRNS: keys mapped on the layer; otherwise an exact match
+    rgb_t    color;
+} rgb_matrix_indicator_rule_t;
+
+// The rule table, defined in the keymap.
+extern const rgb_matrix_indicator_rule_t rgb_matrix_indicator_rules[];
+
+// Paints the cached spans overlapping [led_min, led_max); called by rgb_matrix_task().
+void rgb_matrix_indicator_rules_apply(uint8_t led_min, uint8_t led_max);
+
+// Forces recompilation of the span lists, e.g. after a dynamic keymap change.
+void rgb_matrix_indicator_rules_invalidate(void);
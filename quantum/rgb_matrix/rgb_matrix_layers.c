@@ -0,0 +1,134 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef RGB_MATRIX_LAYER_PIPELINE
+
+#    include "rgb_matrix_layers.h"
+#    include "rgb_matrix.h"
+
+#    include <string.h>
+
+#    include <lib/lib8tion/lib8tion.h>
+
+#    ifndef RGB_MATRIX_LAYER_PIPELINE_MAX
+#        define RGB_MATRIX_LAYER_PIPELINE_MAX 4
+#    endif
+
+#    define LAYER_COVERAGE_BYTES ((RGB_MATRIX_LED_COUNT + 7) / 8)
+
+static const rgb_matrix_layer_t *layers[RGB_MATRIX_LAYER_PIPELINE_MAX];
+static uint8_t                   layer_count = 0;
+static bool                      layer_dirty[RGB_MATRIX_LAYER_PIPELINE_MAX];
+
+// Per-layer output caches: the colours a layer painted on its last render,
+// plus a coverage bitmap recording which LEDs it actually touched. Costs
+// RGB_MATRIX_LAYER_PIPELINE_MAX * (3 * RGB_MATRIX_LED_COUNT + coverage) bytes
+// of RAM -- the price of recompositing without recomputing.
+static rgb_t   layer_cache[RGB_MATRIX_LAYER_PIPELINE_MAX][RGB_MATRIX_LED_COUNT];
+static uint8_t layer_coverage[RGB_MATRIX_LAYER_PIPELINE_MAX][LAYER_COVERAGE_BYTES];
+
+int8_t rgb_matrix_layer_register(const rgb_matrix_layer_t *layer) {
+    if (layer == NULL || layer->render == NULL || layer_count == RGB_MATRIX_LAYER_PIPELINE_MAX) {
+        return -1;
+    }
+    layers[layer_count]      = layer;
+    layer_dirty[layer_count] = true;
+    return layer_count++;
+}
+
+void rgb_matrix_layer_mark_dirty(int8_t handle) {
+    if (handle >= 0 && handle < layer_count) {
+        layer_dirty[handle] = true;
+    }
+}
+
+static inline bool layer_covers(uint8_t layer, uint8_t led) {
+    return layer_coverage[layer][led >> 3] & (1 << (led & 7));
+}
+
+bool rgb_matrix_layer_pipeline_render(effect_params_t *params) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+
+    bool invalidate_all = params->init;
+
+    // Shared config changes feed into every render callback, so they stale
+    // all caches at once
+    static hsv_t       last_hsv;
+    static uint8_t     last_speed;
+    static led_flags_t last_flags;
+    if (memcmp(&last_hsv, &rgb_matrix_config.hsv, sizeof(last_hsv)) != 0 || last_speed != rgb_matrix_config.speed || last_flags != params->flags) {
+        last_hsv       = rgb_matrix_config.hsv;
+        last_speed     = rgb_matrix_config.speed;
+        last_flags     = params->flags;
+        invalidate_all = true;
+    }
+    if (invalidate_all) {
+        for (uint8_t l = 0; l < layer_count; l++) {
+            layer_dirty[l] = true;
+        }
+    }
+
+    // Re-render dirty and animated layers into their caches for this slice
+    bool recomposite = false;
+    for (uint8_t l = 0; l < layer_count; l++) {
+        if (!layer_dirty[l] && !layers[l]->animated) {
+            continue;
+        }
+        recomposite = true;
+        for (uint8_t i = led_min; i < led_max; i++) {
+            rgb_t color   = {0, 0, 0};
+            bool  covered = HAS_ANY_FLAGS(g_led_config.flags[i], params->flags) && layers[l]->render(i, params, &color);
+            if (covered) {
+                layer_coverage[l][i >> 3] |= 1 << (i & 7);
+                layer_cache[l][i] = color;
+            } else {
+                layer_coverage[l][i >> 3] &= ~(1 << (i & 7));
+            }
+        }
+    }
+
+    // Composite the slice bottom-up; frames where every layer is static and
+    // clean skip this entirely, leaving the driver buffers as they are
+    if (recomposite) {
+        for (uint8_t i = led_min; i < led_max; i++) {
+            rgb_t out = {0, 0, 0};
+            for (uint8_t l = 0; l < layer_count; l++) {
+                if (!layer_covers(l, i)) {
+                    continue;
+                }
+                rgb_t src = layer_cache[l][i];
+                switch (layers[l]->blend) {
+                    case RGB_MATRIX_LAYER_BLEND_REPLACE:
+                        out = src;
+                        break;
+                    case RGB_MATRIX_LAYER_BLEND_ADD:
+                        out.r = qadd8(out.r, src.r);
+                        out.g = qadd8(out.g, src.g);
+                        out.b = qadd8(out.b, src.b);
+                        break;
+                    case RGB_MATRIX_LAYER_BLEND_MULTIPLY:
+                        out.r = scale8(out.r, src.r);
+                        out.g = scale8(out.g, src.g);
+                        out.b = scale8(out.b, src.b);
+                        break;
+                    case RGB_MATRIX_LAYER_BLEND_MAX:
+                        if (src.r > out.r) out.r = src.r;
+                        if (src.g > out.g) out.g = src.g;
+                        if (src.b > out.b) out.b = src.b;
+                        break;
+                }
+            }
+            rgb_matrix_set_color(i, out.r, out.g, out.b);
+        }
+    }
+
+    if (!rgb_matrix_check_finished_leds(led_max)) {
+        // Last slice of the frame: every dirty layer has re-rendered in full
+        for (uint8_t l = 0; l < layer_count; l++) {
+            layer_dirty[l] = false;
+        }
+    }
+    return rgb_matrix_check_finished_leds(led_max);
+}
+
+#endif // RGB_MATRIX_LAYER_PIPELINE
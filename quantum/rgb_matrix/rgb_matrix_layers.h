@@ -0,0 +1,61 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "color.h"
+#include "rgb_matrix_types.h"
+
+/* Chained-effect layer pipeline. Composing two effects (e.g. a heatmap with
+ * layer indicators on top) no longer needs a hand-fused custom effect that
+ * recomputes the whole frame: each piece registers as a pipeline layer with a
+ * blend mode, and the RGB_MATRIX_LAYER_PIPELINE effect composites the layers
+ * bottom-up. Every layer's output is cached per LED, so only animated layers
+ * and layers explicitly marked dirty re-render -- a static layer is
+ * recomposited from its cache for free.
+ *
+ *     static bool caps_layer_render(uint8_t led, effect_params_t *params, rgb_t *color) {
+ *         if (!host_keyboard_led_state().caps_lock || !(g_led_config.flags[led] & LED_FLAG_MODIFIER)) return false;
+ *         *color = (rgb_t){RGB_RED};
+ *         return true;
+ *     }
+ *
+ *     static const rgb_matrix_layer_t caps_layer = {.render = caps_layer_render, .blend = RGB_MATRIX_LAYER_BLEND_REPLACE};
+ *     static int8_t                   caps_layer_handle;
+ *
+ *     caps_layer_handle = rgb_matrix_layer_register(&caps_layer);
+ *     // ... on caps lock change:
+ *     rgb_matrix_layer_mark_dirty(caps_layer_handle);
+ */
+
+typedef enum rgb_matrix_layer_blend_t {
+    RGB_MATRIX_LAYER_BLEND_REPLACE,  // layer colour overwrites the pixel
+    RGB_MATRIX_LAYER_BLEND_ADD,      // saturating add per channel
+    RGB_MATRIX_LAYER_BLEND_MULTIPLY, // scales the pixel by the layer colour (white passes through, black masks)
+    RGB_MATRIX_LAYER_BLEND_MAX,      // per-channel maximum
+} rgb_matrix_layer_blend_t;
+
+// Renders one LED of the layer. Return false to leave the pixel untouched --
+// the layer is transparent there and lower layers show through.
+typedef bool (*rgb_matrix_layer_render_fn_t)(uint8_t led, effect_params_t *params, rgb_t *color);
+
+typedef struct rgb_matrix_layer_t {
+    rgb_matrix_layer_render_fn_t render;
+    rgb_matrix_layer_blend_t     blend;
+    bool                         animated; // re-renders every frame; static layers only re-render when marked dirty
+} rgb_matrix_layer_t;
+
+// Appends a layer to the pipeline (layers composite in registration order).
+// Returns a handle for rgb_matrix_layer_mark_dirty(), or -1 when the pipeline
+// is full (raise RGB_MATRIX_LAYER_PIPELINE_MAX).
+int8_t rgb_matrix_layer_register(const rgb_matrix_layer_t *layer);
+
+// Marks a static layer's cache stale so it re-renders on the next frame.
+void rgb_matrix_layer_mark_dirty(int8_t handle);
+
+// Composites the pipeline for the current slice; called by the
+// RGB_MATRIX_LAYER_PIPELINE effect.
+bool rgb_matrix_layer_pipeline_render(effect_params_t *params);
@@ -42,6 +42,26 @@ typedef struct PACKED {
 } last_hit_t;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
+#if defined(RGB_MATRIX_SPLIT) && !defined(SPLIT_TRANSPORT_MIRROR)
+#    ifndef RGB_MATRIX_HIT_SYNC_EVENTS
+#        define RGB_MATRIX_HIT_SYNC_EVENTS 8
+#    endif // RGB_MATRIX_HIT_SYNC_EVENTS
+
+// Compact key hit event log synced to the other split half, so reactive effects
+// can follow the whole board without mirroring the full matrix over the wire.
+// Each event is packed into two bytes as the split transports always transfer
+// the full registered buffer, so the struct size is what goes on the wire.
+typedef struct PACKED {
+    uint8_t seq;   // bumped on every new batch so the receiving half can detect it
+    uint8_t count; // number of valid entries in events
+    struct PACKED {
+        uint8_t col;
+        uint8_t row : 7;
+        uint8_t pressed : 1;
+    } events[RGB_MATRIX_HIT_SYNC_EVENTS];
+} rgb_matrix_hit_sync_t;
+#endif // defined(RGB_MATRIX_SPLIT) && !defined(SPLIT_TRANSPORT_MIRROR)
+
 typedef enum rgb_task_states { STARTING, RENDERING, FLUSHING, SYNCING } rgb_task_states;
 
 typedef uint8_t led_flags_t;
@@ -117,6 +117,7 @@ animation_status_t animation_status = {};
 rgblight_segment_t const *const *rgblight_layers = NULL;
 
 static bool deferred_set_layer_state = false;
+static bool layer_composite_valid    = false;
 #endif
 
 rgblight_ranges_t rgblight_ranges = {0, RGBLIGHT_LED_COUNT, 0, RGBLIGHT_LED_COUNT, RGBLIGHT_LED_COUNT};
@@ -192,14 +193,14 @@ void eeconfig_update_rgblight_default(void) {
 }
 
 void eeconfig_debug_rgblight(void) {
-    dprintf("rgblight_config EEPROM:\n");
-    dprintf("rgblight_config.enable = %d\n", rgblight_config.enable);
-    dprintf("rgblight_config.velocikey = %d\n", rgblight_config.velocikey);
-    dprintf("rghlight_config.mode = %d\n", rgblight_config.mode);
-    dprintf("rgblight_config.hue = %d\n", rgblight_config.hue);
-    dprintf("rgblight_config.sat = %d\n", rgblight_config.sat);
-    dprintf("rgblight_config.val = %d\n", rgblight_config.val);
-    dprintf("rgblight_config.speed = %d\n", rgblight_config.speed);
+    rgb_dprintf("rgblight_config EEPROM:\n");
+    rgb_dprintf("rgblight_config.enable = %d\n", rgblight_config.enable);
+    rgb_dprintf("rgblight_config.velocikey = %d\n", rgblight_config.velocikey);
+    rgb_dprintf("rghlight_config.mode = %d\n", rgblight_config.mode);
+    rgb_dprintf("rgblight_config.hue = %d\n", rgblight_config.hue);
+    rgb_dprintf("rgblight_config.sat = %d\n", rgblight_config.sat);
+    rgb_dprintf("rgblight_config.val = %d\n", rgblight_config.val);
+    rgb_dprintf("rgblight_config.speed = %d\n", rgblight_config.speed);
 }
 
 void rgblight_init(void) {
@@ -210,11 +211,11 @@ void rgblight_init(void) {
         return;
     }
 
-    dprintf("rgblight_init start!\n");
+    rgb_dprintf("rgblight_init start!\n");
     eeconfig_read_rgblight(&rgblight_config);
     RGBLIGHT_SPLIT_SET_CHANGE_MODEHSVS;
     if (!rgblight_config.mode) {
-        dprintf("rgblight_init rgblight_config.mode = 0. Write default values to EEPROM.\n");
+        rgb_dprintf("rgblight_init rgblight_config.mode = 0. Write default values to EEPROM.\n");
         eeconfig_update_rgblight_default();
         eeconfig_read_rgblight(&rgblight_config);
     }
@@ -325,9 +326,9 @@ void rgblight_mode_eeprom_helper(uint8_t mode, bool write_to_eeprom) {
     RGBLIGHT_SPLIT_SET_CHANGE_MODE;
     if (write_to_eeprom) {
         eeconfig_update_rgblight(&rgblight_config);
-        dprintf("rgblight mode [EEPROM]: %u\n", rgblight_config.mode);
+        rgb_dprintf("rgblight mode [EEPROM]: %u\n", rgblight_config.mode);
     } else {
-        dprintf("rgblight mode [NOEEPROM]: %u\n", rgblight_config.mode);
+        rgb_dprintf("rgblight mode [NOEEPROM]: %u\n", rgblight_config.mode);
     }
     if (is_static_effect(rgblight_config.mode)) {
         rgblight_timer_disable();
@@ -349,7 +350,7 @@ void rgblight_mode_noeeprom(uint8_t mode) {
 }
 
 void rgblight_toggle(void) {
-    dprintf("rgblight toggle [EEPROM]: rgblight_config.enable = %u\n", !rgblight_config.enable);
+    rgb_dprintf("rgblight toggle [EEPROM]: rgblight_config.enable = %u\n", !rgblight_config.enable);
     if (rgblight_config.enable) {
         rgblight_disable();
     } else {
@@ -358,7 +359,7 @@ void rgblight_toggle(void) {
 }
 
 void rgblight_toggle_noeeprom(void) {
-    dprintf("rgblight toggle [NOEEPROM]: rgblight_config.enable = %u\n", !rgblight_config.enable);
+    rgb_dprintf("rgblight toggle [NOEEPROM]: rgblight_config.enable = %u\n", !rgblight_config.enable);
     if (rgblight_config.enable) {
         rgblight_disable_noeeprom();
     } else {
@@ -370,20 +371,20 @@ void rgblight_enable(void) {
     rgblight_config.enable = 1;
     // No need to update EEPROM here. rgblight_mode() will do that, actually
     // eeconfig_update_rgblight(&rgblight_config);
-    dprintf("rgblight enable [EEPROM]: rgblight_config.enable = %u\n", rgblight_config.enable);
+    rgb_dprintf("rgblight enable [EEPROM]: rgblight_config.enable = %u\n", rgblight_config.enable);
     rgblight_mode(rgblight_config.mode);
 }
 
 void rgblight_enable_noeeprom(void) {
     rgblight_config.enable = 1;
-    dprintf("rgblight enable [NOEEPROM]: rgblight_config.enable = %u\n", rgblight_config.enable);
+    rgb_dprintf("rgblight enable [NOEEPROM]: rgblight_config.enable = %u\n", rgblight_config.enable);
     rgblight_mode_noeeprom(rgblight_config.mode);
 }
 
 void rgblight_disable(void) {
     rgblight_config.enable = 0;
     eeconfig_update_rgblight(&rgblight_config);
-    dprintf("rgblight disable [EEPROM]: rgblight_config.enable = %u\n", rgblight_config.enable);
+    rgb_dprintf("rgblight disable [EEPROM]: rgblight_config.enable = %u\n", rgblight_config.enable);
     rgblight_timer_disable();
     RGBLIGHT_SPLIT_SET_CHANGE_MODE;
     rgblight_set();
@@ -391,7 +392,7 @@ void rgblight_disable(void) {
 
 void rgblight_disable_noeeprom(void) {
     rgblight_config.enable = 0;
-    dprintf("rgblight disable [NOEEPROM]: rgblight_config.enable = %u\n", rgblight_config.enable);
+    rgb_dprintf("rgblight disable [NOEEPROM]: rgblight_config.enable = %u\n", rgblight_config.enable);
     rgblight_timer_disable();
     RGBLIGHT_SPLIT_SET_CHANGE_MODE;
     rgblight_set();
@@ -553,7 +554,7 @@ void rgblight_sethsv_eeprom_helper(uint8_t hue, uint8_t sat, uint8_t val, bool w
                     } else {
                         _hue = hue - _hue;
                     }
-                    dprintf("rgblight rainbow set hsv: %d,%d,%d,%u\n", i, _hue, direction, range);
+                    rgb_dprintf("rgblight rainbow set hsv: %d,%d,%d,%u\n", i, _hue, direction, range);
                     sethsv(_hue, sat, val, i + rgblight_ranges.effect_start_pos);
                 }
 #    ifdef RGBLIGHT_LAYERS_RETAIN_VAL
@@ -569,9 +570,9 @@ void rgblight_sethsv_eeprom_helper(uint8_t hue, uint8_t sat, uint8_t val, bool w
         rgblight_config.val = val;
         if (write_to_eeprom) {
             eeconfig_update_rgblight(&rgblight_config);
-            dprintf("rgblight set hsv [EEPROM]: %u,%u,%u\n", rgblight_config.hue, rgblight_config.sat, rgblight_config.val);
+            rgb_dprintf("rgblight set hsv [EEPROM]: %u,%u,%u\n", rgblight_config.hue, rgblight_config.sat, rgblight_config.val);
         } else {
-            dprintf("rgblight set hsv [NOEEPROM]: %u,%u,%u\n", rgblight_config.hue, rgblight_config.sat, rgblight_config.val);
+            rgb_dprintf("rgblight set hsv [NOEEPROM]: %u,%u,%u\n", rgblight_config.hue, rgblight_config.sat, rgblight_config.val);
         }
     }
 }
@@ -592,9 +593,9 @@ void rgblight_set_speed_eeprom_helper(uint8_t speed, bool write_to_eeprom) {
     rgblight_config.speed = speed;
     if (write_to_eeprom) {
         eeconfig_update_rgblight(&rgblight_config);
-        dprintf("rgblight set speed [EEPROM]: %u\n", rgblight_config.speed);
+        rgb_dprintf("rgblight set speed [EEPROM]: %u\n", rgblight_config.speed);
     } else {
-        dprintf("rgblight set speed [NOEEPROM]: %u\n", rgblight_config.speed);
+        rgb_dprintf("rgblight set speed [NOEEPROM]: %u\n", rgblight_config.speed);
     }
 }
 
@@ -717,6 +718,7 @@ void rgblight_set_layer_state(uint8_t layer, bool enabled) {
     // set a flag and do it the next time rgblight_task() runs.
 
     deferred_set_layer_state = true;
+    layer_composite_valid    = false;
 }
 
 bool rgblight_get_layer_state(uint8_t layer) {
@@ -724,11 +726,20 @@ bool rgblight_get_layer_state(uint8_t layer) {
     return (rgblight_status.enabled_layer_mask & mask) != 0;
 }
 
-// Write any enabled LED layers into the buffer
-static void rgblight_layers_write(void) {
-#    ifdef RGBLIGHT_LAYERS_RETAIN_VAL
-    uint8_t current_val = rgblight_get_val();
-#    endif
+// Cached composite of the enabled layers, rebuilt only when the enabled
+// layer mask changes instead of re-walking every layer's segments out of
+// flash on each render. Stacking order is preserved: later layers overwrite
+// earlier ones per LED during the rebuild.
+static struct {
+    uint8_t hue;
+    uint8_t sat;
+    uint8_t val;
+} layer_composite[RGBLIGHT_LED_COUNT];
+static uint8_t layer_composite_covered[(RGBLIGHT_LED_COUNT + 7) / 8];
+
+// Rebuild the composite from the enabled layers
+static void rgblight_layers_composite(void) {
+    memset(layer_composite_covered, 0, sizeof(layer_composite_covered));
     uint8_t i = 0;
     // For each layer
     for (const rgblight_segment_t *const *layer_ptr = rgblight_layers; i < RGBLIGHT_MAX_LAYERS; layer_ptr++, i++) {
@@ -746,18 +757,38 @@ static void rgblight_layers_write(void) {
             if (segment.index == RGBLIGHT_END_SEGMENT_INDEX) {
                 break; // No more segments
             }
-            // Write segment.count LEDs
+            // Composite segment.count LEDs
             int limit = MIN(segment.index + segment.count, RGBLIGHT_LED_COUNT);
-            for (int i = segment.index; i < limit; i++) {
-#    ifdef RGBLIGHT_LAYERS_RETAIN_VAL
-                sethsv(segment.hue, segment.sat, current_val, i);
-#    else
-                sethsv(segment.hue, segment.sat, segment.val, i);
-#    endif
+            for (int led = segment.index; led < limit; led++) {
+                layer_composite[led].hue = segment.hue;
+                layer_composite[led].sat = segment.sat;
+                layer_composite[led].val = segment.val;
+                layer_composite_covered[led / 8] |= 1 << (led % 8);
             }
             segment_ptr++;
         }
     }
+    layer_composite_valid = true;
+}
+
+// Write the layer composite into the buffer
+static void rgblight_layers_write(void) {
+    if (!layer_composite_valid) {
+        rgblight_layers_composite();
+    }
+#    ifdef RGBLIGHT_LAYERS_RETAIN_VAL
+    uint8_t current_val = rgblight_get_val();
+#    endif
+    for (uint8_t i = 0; i < RGBLIGHT_LED_COUNT; i++) {
+        if (!(layer_composite_covered[i / 8] & (1 << (i % 8)))) {
+            continue; // No layer colors this LED
+        }
+#    ifdef RGBLIGHT_LAYERS_RETAIN_VAL
+        sethsv(layer_composite[i].hue, layer_composite[i].sat, current_val, i);
+#    else
+        sethsv(layer_composite[i].hue, layer_composite[i].sat, layer_composite[i].val, i);
+#    endif
+    }
 }
 
 #    ifdef RGBLIGHT_LAYER_BLINK
@@ -900,6 +931,7 @@ void rgblight_update_sync(rgblight_syncinfo_t *syncinfo, bool write_to_eeprom) {
 #    ifdef RGBLIGHT_LAYERS
     if (syncinfo->status.change_flags & RGBLIGHT_STATUS_CHANGE_LAYERS) {
         rgblight_status.enabled_layer_mask = syncinfo->status.enabled_layer_mask;
+        layer_composite_valid              = false;
     }
 #    endif
     if (syncinfo->status.change_flags & RGBLIGHT_STATUS_CHANGE_MODE) {
@@ -946,15 +978,15 @@ void rgblight_timer_enable(void) {
     }
     animation_status.last_timer = sync_timer_read();
     RGBLIGHT_SPLIT_SET_CHANGE_TIMER_ENABLE;
-    dprintf("rgblight timer enabled.\n");
+    rgb_dprintf("rgblight timer enabled.\n");
 }
 void rgblight_timer_disable(void) {
     rgblight_status.timer_enabled = false;
     RGBLIGHT_SPLIT_SET_CHANGE_TIMER_ENABLE;
-    dprintf("rgblight timer disable.\n");
+    rgb_dprintf("rgblight timer disable.\n");
 }
 void rgblight_timer_toggle(void) {
-    dprintf("rgblight timer toggle.\n");
+    rgb_dprintf("rgblight timer toggle.\n");
     if (rgblight_status.timer_enabled) {
         rgblight_timer_disable();
     } else {
@@ -971,12 +1003,12 @@ void rgblight_show_solid_color(uint8_t r, uint8_t g, uint8_t b) {
 static void rgblight_effect_dummy(animation_status_t *anim) {
     // do nothing
     /********
-    dprintf("rgblight_task() what happened?\n");
-    dprintf("is_static_effect %d\n", is_static_effect(rgblight_config.mode));
-    dprintf("mode = %d, base_mode = %d, timer_enabled %d, ",
+    rgb_dprintf("rgblight_task() what happened?\n");
+    rgb_dprintf("is_static_effect %d\n", is_static_effect(rgblight_config.mode));
+    rgb_dprintf("mode = %d, base_mode = %d, timer_enabled %d, ",
             rgblight_config.mode, rgblight_status.base_mode,
             rgblight_status.timer_enabled);
-    dprintf("last_timer = %d\n",anim->last_timer);
+    rgb_dprintf("last_timer = %d\n",anim->last_timer);
     **/
 }
 
@@ -1066,7 +1098,7 @@ void rgblight_timer_task(void) {
                 tick_flag = false;
                 if (timer_expired(now, report_last_timer)) {
                     report_last_timer += 30000;
-                    dprintf("rgblight animation tick report to slave\n");
+                    rgb_dprintf("rgblight animation tick report to slave\n");
                     RGBLIGHT_SPLIT_ANIMATION_TICK;
                 }
             }
@@ -1447,7 +1479,7 @@ bool rgblight_velocikey_enabled(void) {
 }
 
 void rgblight_velocikey_toggle(void) {
-    dprintf("rgblight velocikey toggle [EEPROM]: rgblight_config.velocikey = %u\n", !rgblight_config.velocikey);
+    rgb_dprintf("rgblight velocikey toggle [EEPROM]: rgblight_config.velocikey = %u\n", !rgblight_config.velocikey);
     rgblight_config.velocikey = !rgblight_config.velocikey;
     eeconfig_update_rgblight_current();
 }
@@ -0,0 +1,72 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "scan_histogram.h"
+#include "basic_profiling.h" // for TIMESTAMP_GETTER
+#include "util.h"
+
+static uint32_t bucket_counts[SCAN_HISTOGRAM_STAGE_COUNT][SCAN_HISTOGRAM_BUCKETS];
+static uint32_t cycle_counts[SCAN_HISTOGRAM_STAGE_COUNT];
+static uint32_t start_timestamps[SCAN_HISTOGRAM_STAGE_COUNT];
+
+// Index of the highest set bit, i.e. floor(log2(value)) for value > 0
+static uint8_t log2_bucket(uint32_t value) {
+    uint8_t bucket = 0;
+    while (value >>= 1) {
+        bucket++;
+    }
+    return MIN(bucket, SCAN_HISTOGRAM_BUCKETS - 1);
+}
+
+void scan_histogram_begin(scan_histogram_stage_t stage) {
+    start_timestamps[stage] = (uint32_t)TIMESTAMP_GETTER;
+}
+
+void scan_histogram_end(scan_histogram_stage_t stage) {
+    uint32_t duration = (uint32_t)TIMESTAMP_GETTER - start_timestamps[stage];
+
+    bucket_counts[stage][log2_bucket(duration)]++;
+    cycle_counts[stage]++;
+}
+
+uint32_t scan_histogram_get_bucket(scan_histogram_stage_t stage, uint8_t bucket) {
+    if (stage >= SCAN_HISTOGRAM_STAGE_COUNT || bucket >= SCAN_HISTOGRAM_BUCKETS) {
+        return 0;
+    }
+    return bucket_counts[stage][bucket];
+}
+
+uint32_t scan_histogram_get_count(scan_histogram_stage_t stage) {
+    if (stage >= SCAN_HISTOGRAM_STAGE_COUNT) {
+        return 0;
+    }
+    return cycle_counts[stage];
+}
+
+void scan_histogram_reset(void) {
+    memset(bucket_counts, 0, sizeof(bucket_counts));
+    memset(cycle_counts, 0, sizeof(cycle_counts));
+}
+
+bool scan_histogram_raw_hid_report(scan_histogram_stage_t stage, uint8_t *data, uint8_t length) {
+    if (stage >= SCAN_HISTOGRAM_STAGE_COUNT || length < 2) {
+        return false;
+    }
+
+    memset(data, 0, length);
+    data[0] = (uint8_t)stage;
+    data[1] = SCAN_HISTOGRAM_BUCKETS;
+
+    uint8_t offset = 2;
+    for (uint8_t bucket = 0; bucket < SCAN_HISTOGRAM_BUCKETS && offset + 4 <= length; bucket++, offset += 4) {
+        uint32_t count   = bucket_counts[stage][bucket];
+        data[offset]     = (uint8_t)(count & 0xFF);
+        data[offset + 1] = (uint8_t)((count >> 8) & 0xFF);
+        data[offset + 2] = (uint8_t)((count >> 16) & 0xFF);
+        data[offset + 3] = (uint8_t)((count >> 24) & 0xFF);
+    }
+
+    return true;
+}
@@ -0,0 +1,60 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \defgroup scan_histogram Scan latency histograms
+ *
+ * Records per-cycle durations of the matrix scan and the whole keyboard task
+ * into fixed-size log2 histogram buckets in RAM, so scan-rate regressions can
+ * be spotted in the field without attaching a debugger.
+ *
+ * Enable with `SCAN_HISTOGRAM_ENABLE = yes` in rules.mk. Durations are
+ * measured in raw timestamp-counter ticks (the same clock used by
+ * `basic_profiling.h`), which is stable enough for comparing builds.
+ *
+ * To query over raw HID, call \ref scan_histogram_raw_hid_report from your
+ * `raw_hid_receive()` implementation and send the resulting buffer back with
+ * `raw_hid_send()`.
+ */
+
+/** \brief Number of log2 buckets per stage; bucket i counts durations in [2^i, 2^(i+1)) ticks. */
+#define SCAN_HISTOGRAM_BUCKETS 24
+
+/** \brief Instrumented stages. */
+typedef enum scan_histogram_stage_t {
+    SCAN_HISTOGRAM_MATRIX_SCAN,   /**< One call of matrix_scan(), including debounce */
+    SCAN_HISTOGRAM_KEYBOARD_TASK, /**< One full keyboard_task() pass */
+    SCAN_HISTOGRAM_STAGE_COUNT
+} scan_histogram_stage_t;
+
+/** \brief Marks the start of a stage for the current cycle. */
+void scan_histogram_begin(scan_histogram_stage_t stage);
+
+/** \brief Marks the end of a stage and accounts its duration. */
+void scan_histogram_end(scan_histogram_stage_t stage);
+
+/** \brief Gets the hit count of one bucket. */
+uint32_t scan_histogram_get_bucket(scan_histogram_stage_t stage, uint8_t bucket);
+
+/** \brief Gets the number of recorded cycles for a stage. */
+uint32_t scan_histogram_get_count(scan_histogram_stage_t stage);
+
+/** \brief Clears all recorded data. */
+void scan_histogram_reset(void);
+
+/**
+ * \brief Serializes one stage's histogram into a raw HID response buffer.
+ *
+ * Layout: `data[0]` = stage, `data[1]` = SCAN_HISTOGRAM_BUCKETS, followed by
+ * the bucket counts as little-endian uint32_t, truncated to `length`.
+ *
+ * \return false if the stage is out of range.
+ */
+bool scan_histogram_raw_hid_report(scan_histogram_stage_t stage, uint8_t *data, uint8_t length);
@@ -60,7 +60,12 @@ void secure_keypress_event(uint8_t row, uint8_t col) {
     static const uint8_t sequence_len  = ARRAY_SIZE(sequence);
 
     static uint8_t offset = 0;
-    if ((sequence[offset][0] == row) && (sequence[offset][1] == col)) {
+
+    // Fold both coordinates into a single branch-free compare, so a wrong row
+    // and a wrong column cost exactly the same and each event is one fixed
+    // xor/or against the expected step regardless of the sequence length.
+    uint8_t diff = (uint8_t)(sequence[offset][0] ^ row) | (uint8_t)(sequence[offset][1] ^ col);
+    if (diff == 0) {
         offset++;
         if (offset == sequence_len) {
             offset = 0;
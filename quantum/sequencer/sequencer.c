@@ -27,14 +27,15 @@
 #endif
 
 sequencer_config_t sequencer_config = {
-    false,    // enabled
-    {false},  // steps
-    {0},      // track notes
-    60,       // tempo
-    SQ_RES_4, // resolution
+    false,                    // enabled
+    {false},                  // steps
+    {0},                      // track notes
+    60,                       // tempo
+    SQ_RES_4,                 // resolution
+    SEQUENCER_CLOCK_INTERNAL, // clock source
 };
 
-sequencer_state_t sequencer_internal_state = {0, 0, 0, 0, SEQUENCER_PHASE_ATTACK};
+sequencer_state_t sequencer_internal_state = {0, 0, 0, 0, 0, SEQUENCER_PHASE_ATTACK};
 
 bool is_sequencer_on(void) {
     return sequencer_config.enabled;
@@ -181,6 +182,63 @@ void sequencer_decrease_resolution(void) {
     sequencer_set_resolution(sequencer_config.resolution - 1);
 }
 
+sequencer_clock_source_t sequencer_get_clock_source(void) {
+    return sequencer_config.clock_source;
+}
+
+void sequencer_set_clock_source(sequencer_clock_source_t clock_source) {
+    if (clock_source >= 0 && clock_source < SEQUENCER_CLOCK_SOURCES) {
+        sequencer_config.clock_source        = clock_source;
+        sequencer_internal_state.clock_ticks = 0;
+        dprintf("sequencer: clock source set to %d\n", clock_source);
+    } else {
+        dprintf("sequencer: clock source %d is out of range\n", clock_source);
+    }
+}
+
+void sequencer_midi_clock_tick(void) {
+    if (sequencer_config.clock_source != SEQUENCER_CLOCK_MIDI) {
+        return;
+    }
+
+    // Saturate rather than wrap if the sequencer is held while the clock
+    // keeps running, so a later resume does not fast-forward the pattern.
+    if (sequencer_internal_state.clock_ticks < UINT8_MAX) {
+        sequencer_internal_state.clock_ticks++;
+    }
+}
+
+void sequencer_midi_clock_start(void) {
+    if (sequencer_config.clock_source != SEQUENCER_CLOCK_MIDI) {
+        return;
+    }
+
+    dprintln("sequencer: MIDI start");
+    sequencer_on();
+    sequencer_internal_state.clock_ticks = 0;
+}
+
+void sequencer_midi_clock_continue(void) {
+    if (sequencer_config.clock_source != SEQUENCER_CLOCK_MIDI) {
+        return;
+    }
+
+    dprintln("sequencer: MIDI continue");
+    sequencer_config.enabled             = true;
+    sequencer_internal_state.timer       = timer_read();
+    sequencer_internal_state.clock_ticks = 0;
+}
+
+void sequencer_midi_clock_stop(void) {
+    if (sequencer_config.clock_source != SEQUENCER_CLOCK_MIDI) {
+        return;
+    }
+
+    dprintln("sequencer: MIDI stop");
+    // Unlike sequencer_off, keep the current step so 0xFB can resume from it
+    sequencer_config.enabled = false;
+}
+
 uint8_t sequencer_get_current_step(void) {
     return sequencer_internal_state.current_step;
 }
@@ -227,7 +285,15 @@ void sequencer_phase_release(void) {
 }
 
 void sequencer_phase_pause(void) {
-    if (timer_elapsed(sequencer_internal_state.timer) < sequencer_get_step_duration()) {
+    if (sequencer_config.clock_source == SEQUENCER_CLOCK_MIDI) {
+        uint8_t step_ticks = get_step_clock_ticks(sequencer_config.resolution);
+        if (sequencer_internal_state.clock_ticks < step_ticks) {
+            return;
+        }
+        // Carry the remainder over instead of resetting, so the pattern stays
+        // phase-locked to the external clock even if a step overruns
+        sequencer_internal_state.clock_ticks -= step_ticks;
+    } else if (timer_elapsed(sequencer_internal_state.timer) < sequencer_get_step_duration()) {
         return;
     }
 
@@ -301,3 +367,18 @@ uint16_t get_step_duration(uint8_t tempo, sequencer_resolution_t resolution) {
 
     return is_binary ? binary_step_duration : 2 * binary_step_duration / 3;
 }
+
+uint8_t get_step_clock_ticks(sequencer_resolution_t resolution) {
+    /**
+     * Same resolution cheatsheet as above, expressed in MIDI clock pulses:
+     * 4 beats span 4 * 24 = 96 pulses, divided evenly by every binary step
+     * count, and the ternary variants are again 1.5x faster. All resolutions
+     * map to a whole number of pulses, so the lock to the external clock is
+     * exact.
+     */
+    bool    is_binary         = resolution % 2 == 0;
+    uint8_t binary_steps      = 2 << (resolution / 2);
+    uint8_t binary_step_ticks = 4 * SEQUENCER_MIDI_CLOCK_PPQN / binary_steps;
+
+    return is_binary ? binary_step_ticks : 2 * binary_step_ticks / 3;
+}
@@ -37,6 +37,17 @@
 #    define SEQUENCER_PHASE_RELEASE_TIMEOUT 30
 #endif
 
+/**
+ * The MIDI beat clock runs at 24 pulses per quarter note.
+ */
+#define SEQUENCER_MIDI_CLOCK_PPQN 24
+
+typedef enum {
+    SEQUENCER_CLOCK_INTERNAL, // step timing derived from the configured tempo
+    SEQUENCER_CLOCK_MIDI,     // step timing locked to the incoming MIDI beat clock
+    SEQUENCER_CLOCK_SOURCES
+} sequencer_clock_source_t;
+
 /**
  * Make sure that the items of this enumeration follow the powers of 2, separated by a ternary variant.
  * Check the implementation of `get_step_duration` for further explanation.
@@ -60,6 +71,7 @@ typedef struct {
     uint16_t               track_notes[SEQUENCER_TRACKS];
     uint8_t                tempo; // Is a maximum tempo of 255 reasonable?
     sequencer_resolution_t resolution;
+    sequencer_clock_source_t clock_source;
 } sequencer_config_t;
 
 /**
@@ -77,6 +89,7 @@ typedef struct {
     uint8_t           current_track;
     uint8_t           current_step;
     uint16_t          timer;
+    uint8_t           clock_ticks; // MIDI clock pulses accumulated toward the next step
     sequencer_phase_t phase;
 } sequencer_state_t;
 
@@ -121,6 +134,19 @@ void                   sequencer_set_resolution(sequencer_resolution_t resolutio
 void                   sequencer_increase_resolution(void);
 void                   sequencer_decrease_resolution(void);
 
+sequencer_clock_source_t sequencer_get_clock_source(void);
+void                     sequencer_set_clock_source(sequencer_clock_source_t clock_source);
+
+/**
+ * MIDI beat clock handlers, wired to the incoming realtime messages when both
+ * the sequencer and MIDI are enabled. They are no-ops unless the clock source
+ * is set to `SEQUENCER_CLOCK_MIDI`.
+ */
+void sequencer_midi_clock_tick(void);     // 0xF8, 24 per quarter note
+void sequencer_midi_clock_start(void);    // 0xFA, play from the first step
+void sequencer_midi_clock_continue(void); // 0xFB, resume from the held step
+void sequencer_midi_clock_stop(void);     // 0xFC, hold the current step
+
 uint8_t sequencer_get_current_step(void);
 
 uint16_t sequencer_get_beat_duration(void);
@@ -128,5 +154,6 @@ uint16_t sequencer_get_step_duration(void);
 
 uint16_t get_beat_duration(uint8_t tempo);
 uint16_t get_step_duration(uint8_t tempo, sequencer_resolution_t resolution);
+uint8_t  get_step_clock_ticks(sequencer_resolution_t resolution);
 
 void sequencer_task(void);
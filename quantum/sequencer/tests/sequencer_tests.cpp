@@ -40,13 +40,15 @@ class SequencerTest : public ::testing::Test {
             config_copy.track_notes[i] = sequencer_config.track_notes[i];
         }
 
-        config_copy.tempo      = sequencer_config.tempo;
-        config_copy.resolution = sequencer_config.resolution;
+        config_copy.tempo        = sequencer_config.tempo;
+        config_copy.resolution   = sequencer_config.resolution;
+        config_copy.clock_source = sequencer_config.clock_source;
 
         state_copy.active_tracks = sequencer_internal_state.active_tracks;
         state_copy.current_track = sequencer_internal_state.current_track;
         state_copy.current_step  = sequencer_internal_state.current_step;
         state_copy.timer         = sequencer_internal_state.timer;
+        state_copy.clock_ticks   = sequencer_internal_state.clock_ticks;
 
         last_noteon  = 0;
         last_noteoff = 0;
@@ -65,13 +67,15 @@ class SequencerTest : public ::testing::Test {
             sequencer_config.track_notes[i] = config_copy.track_notes[i];
         }
 
-        sequencer_config.tempo      = config_copy.tempo;
-        sequencer_config.resolution = config_copy.resolution;
+        sequencer_config.tempo        = config_copy.tempo;
+        sequencer_config.resolution   = config_copy.resolution;
+        sequencer_config.clock_source = config_copy.clock_source;
 
         sequencer_internal_state.active_tracks = state_copy.active_tracks;
         sequencer_internal_state.current_track = state_copy.current_track;
         sequencer_internal_state.current_step  = state_copy.current_step;
         sequencer_internal_state.timer         = state_copy.timer;
+        sequencer_internal_state.clock_ticks   = state_copy.clock_ticks;
     }
 
     sequencer_config_t config_copy;
@@ -365,6 +369,97 @@ TEST_F(SequencerTest, TestGetStepDuration120) {
     EXPECT_EQ(get_step_duration(30, SQ_RES_16T), 333);
 }
 
+TEST_F(SequencerTest, TestSetClockSourceOutOfRange) {
+    sequencer_config.clock_source = SEQUENCER_CLOCK_INTERNAL;
+
+    sequencer_set_clock_source(SEQUENCER_CLOCK_SOURCES);
+
+    EXPECT_EQ(sequencer_config.clock_source, SEQUENCER_CLOCK_INTERNAL);
+}
+
+TEST_F(SequencerTest, TestSetClockSourceResetsTicks) {
+    sequencer_internal_state.clock_ticks = 12;
+
+    sequencer_set_clock_source(SEQUENCER_CLOCK_MIDI);
+
+    EXPECT_EQ(sequencer_config.clock_source, SEQUENCER_CLOCK_MIDI);
+    EXPECT_EQ(sequencer_internal_state.clock_ticks, 0);
+}
+
+TEST_F(SequencerTest, TestGetStepClockTicks) {
+    /**
+     * 4 beats span 4 * 24 = 96 MIDI clock pulses,
+     * divided by the number of steps per 4 beats.
+     */
+    EXPECT_EQ(get_step_clock_ticks(SQ_RES_2), 48);
+    EXPECT_EQ(get_step_clock_ticks(SQ_RES_4), 24);
+    EXPECT_EQ(get_step_clock_ticks(SQ_RES_8), 12);
+    EXPECT_EQ(get_step_clock_ticks(SQ_RES_16), 6);
+    EXPECT_EQ(get_step_clock_ticks(SQ_RES_32), 3);
+
+    EXPECT_EQ(get_step_clock_ticks(SQ_RES_2T), 32);
+    EXPECT_EQ(get_step_clock_ticks(SQ_RES_4T), 16);
+    EXPECT_EQ(get_step_clock_ticks(SQ_RES_8T), 8);
+    EXPECT_EQ(get_step_clock_ticks(SQ_RES_16T), 4);
+}
+
+TEST_F(SequencerTest, TestMidiClockTickIgnoredWithInternalClock) {
+    sequencer_config.clock_source        = SEQUENCER_CLOCK_INTERNAL;
+    sequencer_internal_state.clock_ticks = 0;
+
+    sequencer_midi_clock_tick();
+
+    EXPECT_EQ(sequencer_internal_state.clock_ticks, 0);
+}
+
+TEST_F(SequencerTest, TestMidiClockStartPlaysFromFirstStep) {
+    sequencer_config.clock_source         = SEQUENCER_CLOCK_MIDI;
+    sequencer_config.enabled              = false;
+    sequencer_internal_state.current_step = 5;
+    sequencer_internal_state.clock_ticks  = 3;
+
+    sequencer_midi_clock_start();
+
+    EXPECT_EQ(is_sequencer_on(), true);
+    EXPECT_EQ(sequencer_internal_state.current_step, 0);
+    EXPECT_EQ(sequencer_internal_state.clock_ticks, 0);
+}
+
+TEST_F(SequencerTest, TestMidiClockStopHoldsCurrentStep) {
+    sequencer_config.clock_source         = SEQUENCER_CLOCK_MIDI;
+    sequencer_config.enabled              = true;
+    sequencer_internal_state.current_step = 5;
+
+    sequencer_midi_clock_stop();
+
+    EXPECT_EQ(is_sequencer_on(), false);
+    EXPECT_EQ(sequencer_internal_state.current_step, 5);
+}
+
+TEST_F(SequencerTest, TestMidiClockContinueResumesFromHeldStep) {
+    sequencer_config.clock_source         = SEQUENCER_CLOCK_MIDI;
+    sequencer_config.enabled              = false;
+    sequencer_internal_state.current_step = 5;
+
+    sequencer_midi_clock_continue();
+
+    EXPECT_EQ(is_sequencer_on(), true);
+    EXPECT_EQ(sequencer_internal_state.current_step, 5);
+}
+
+TEST_F(SequencerTest, TestMidiClockTransportIgnoredWithInternalClock) {
+    sequencer_config.clock_source = SEQUENCER_CLOCK_INTERNAL;
+    sequencer_config.enabled      = false;
+
+    sequencer_midi_clock_start();
+    EXPECT_EQ(is_sequencer_on(), false);
+
+    sequencer_config.enabled = true;
+
+    sequencer_midi_clock_stop();
+    EXPECT_EQ(is_sequencer_on(), true);
+}
+
 void setUpMatrixScanSequencerTest(void) {
     sequencer_config.enabled    = true;
     sequencer_config.tempo      = 120;
@@ -569,6 +664,44 @@ TEST_F(SequencerTest, TestMatrixScanSequencerShouldProcessSecondTrackOnTime) {
     EXPECT_EQ(last_noteoff, 0);
 }
 
+TEST_F(SequencerTest, TestMatrixScanSequencerShouldNotAdvanceBeforeEnoughClockTicks) {
+    setUpMatrixScanSequencerTest();
+    sequencer_config.clock_source = SEQUENCER_CLOCK_MIDI;
+
+    sequencer_internal_state.current_step  = 0;
+    sequencer_internal_state.current_track = 0;
+    sequencer_internal_state.phase         = SEQUENCER_PHASE_PAUSE;
+
+    // One 16th lasts 6 MIDI clock pulses, one too few arrive
+    for (int i = 0; i < 5; i++) {
+        sequencer_midi_clock_tick();
+    }
+
+    sequencer_task();
+    EXPECT_EQ(sequencer_internal_state.current_step, 0);
+    EXPECT_EQ(sequencer_internal_state.phase, SEQUENCER_PHASE_PAUSE);
+}
+
+TEST_F(SequencerTest, TestMatrixScanSequencerShouldAdvanceOnClockTicks) {
+    setUpMatrixScanSequencerTest();
+    sequencer_config.clock_source = SEQUENCER_CLOCK_MIDI;
+
+    sequencer_internal_state.current_step  = 0;
+    sequencer_internal_state.current_track = 0;
+    sequencer_internal_state.phase         = SEQUENCER_PHASE_PAUSE;
+
+    // One 16th lasts 6 MIDI clock pulses, one extra arrives before the scan
+    for (int i = 0; i < 7; i++) {
+        sequencer_midi_clock_tick();
+    }
+
+    sequencer_task();
+    EXPECT_EQ(sequencer_internal_state.current_step, 1);
+
+    // The extra pulse is carried over so the pattern stays phase-locked
+    EXPECT_EQ(sequencer_internal_state.clock_ticks, 1);
+}
+
 TEST_F(SequencerTest, TestMatrixScanSequencerShouldLoopOnceSequenceIsOver) {
     setUpMatrixScanSequencerTest();
 
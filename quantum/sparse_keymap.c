@@ -0,0 +1,75 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "sparse_keymap.h"
+#include "keymap_introspection.h"
+#include "keycodes.h"
+#include "progmem.h"
+#include "matrix.h"
+
+#ifndef SPARSE_KEYMAP_DECODE_CACHE
+static uint16_t sparse_keymap_decode(const sparse_keymap_layer_t *layer, uint8_t row, uint8_t column) {
+    const sparse_keymap_entry_t *entries     = (const sparse_keymap_entry_t *)pgm_read_ptr(&layer->entries);
+    uint8_t                      entry_count = pgm_read_byte(&layer->entry_count);
+    for (uint8_t i = 0; i < entry_count; i++) {
+        if (pgm_read_byte(&entries[i].row) == row && pgm_read_byte(&entries[i].col) == column) {
+            return pgm_read_word(&entries[i].keycode);
+        }
+    }
+    return KC_TRNS;
+}
+#endif // !SPARSE_KEYMAP_DECODE_CACHE
+
+#ifdef SPARSE_KEYMAP_DECODE_CACHE
+// Most lookups during scanning hit the same (highest active) layer over and
+// over; keep the last sparse layer fully decoded so repeat lookups cost a
+// single array read instead of an entry-list scan
+static uint16_t decode_cache[MATRIX_ROWS][MATRIX_COLS];
+static uint8_t  cached_layer = UINT8_MAX;
+
+static uint16_t sparse_keymap_decode_cached(const sparse_keymap_layer_t *layer, uint8_t sparse_layer_num, uint8_t row, uint8_t column) {
+    if (cached_layer != sparse_layer_num) {
+        for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
+            for (uint8_t c = 0; c < MATRIX_COLS; c++) {
+                decode_cache[r][c] = KC_TRNS;
+            }
+        }
+        const sparse_keymap_entry_t *entries     = (const sparse_keymap_entry_t *)pgm_read_ptr(&layer->entries);
+        uint8_t                      entry_count = pgm_read_byte(&layer->entry_count);
+        for (uint8_t i = 0; i < entry_count; i++) {
+            uint8_t r = pgm_read_byte(&entries[i].row);
+            uint8_t c = pgm_read_byte(&entries[i].col);
+            if (r < MATRIX_ROWS && c < MATRIX_COLS) {
+                decode_cache[r][c] = pgm_read_word(&entries[i].keycode);
+            }
+        }
+        cached_layer = sparse_layer_num;
+    }
+    return decode_cache[row][column];
+}
+#endif // SPARSE_KEYMAP_DECODE_CACHE
+
+uint16_t keycode_at_sparse_keymap_location(uint8_t sparse_layer_num, uint8_t row, uint8_t column) {
+    if (row >= MATRIX_ROWS || column >= MATRIX_COLS) {
+        return KC_TRNS;
+    }
+    const sparse_keymap_layer_t *layer = sparse_keymap_layer_get(sparse_layer_num);
+    if (layer == NULL) {
+        return KC_TRNS;
+    }
+#ifdef SPARSE_KEYMAP_DECODE_CACHE
+    return sparse_keymap_decode_cached(layer, sparse_layer_num, row, column);
+#else
+    return sparse_keymap_decode(layer, row, column);
+#endif // SPARSE_KEYMAP_DECODE_CACHE
+}
+
+uint8_t keymap_layer_count(void) {
+    return keymap_layer_count_raw() + sparse_keymap_layer_count();
+}
+
+uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
+    if (layer_num < keymap_layer_count_raw()) {
+        return keycode_at_keymap_location_raw(layer_num, row, column);
+    }
+    return keycode_at_sparse_keymap_location(layer_num - keymap_layer_count_raw(), row, column);
+}
@@ -0,0 +1,48 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+
+#include "util.h"
+
+// Sparse keymap layers: flash-compressed storage for layers that are mostly
+// transparent. Instead of a full MATRIX_ROWS x MATRIX_COLS page of 16-bit
+// keycodes, a sparse layer stores only the positions that differ from
+// KC_TRNS; every unlisted position is transparent and resolves through the
+// normal active-layer stack. Sparse layers sit above the dense `keymaps[]`
+// layers, so layer 0..(keymap_layer_count_raw()-1) remain conventional and
+// sparse layer N is addressed as layer keymap_layer_count_raw() + N.
+//
+// In the keymap, define the entry lists and the layer table:
+//
+//     static const sparse_keymap_entry_t PROGMEM layer_intl_entries[] = {
+//         SPARSE_KEYMAP_ENTRY(1, 2, INTL_A),
+//         SPARSE_KEYMAP_ENTRY(1, 3, INTL_O),
+//     };
+//     const sparse_keymap_layer_t PROGMEM sparse_keymap_layers[] = {
+//         SPARSE_KEYMAP_LAYER(layer_intl_entries),
+//     };
+
+typedef struct PACKED sparse_keymap_entry_t {
+    uint8_t  row;
+    uint8_t  col;
+    uint16_t keycode;
+} sparse_keymap_entry_t;
+
+typedef struct sparse_keymap_layer_t {
+    const sparse_keymap_entry_t *entries; // stored in PROGMEM
+    uint8_t                      entry_count;
+} sparse_keymap_layer_t;
+
+#define SPARSE_KEYMAP_ENTRY(layer_row, layer_col, kc) {.row = (layer_row), .col = (layer_col), .keycode = (kc)}
+#define SPARSE_KEYMAP_LAYER(layer_entries) {.entries = (layer_entries), .entry_count = ARRAY_SIZE(layer_entries)}
+
+// Number of sparse layers defined in the keymap
+uint8_t sparse_keymap_layer_count(void);
+
+// Get the sparse layer definition, NULL if out of range
+const sparse_keymap_layer_t *sparse_keymap_layer_get(uint8_t sparse_layer_num);
+
+// Get the keycode for a sparse keymap location; unlisted positions are KC_TRNS
+uint16_t keycode_at_sparse_keymap_location(uint8_t sparse_layer_num, uint8_t row, uint8_t column);
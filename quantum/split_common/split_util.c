@@ -14,6 +14,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
+
 #include "compiler_support.h"
 #include "split_util.h"
 #include "matrix.h"
@@ -25,7 +27,7 @@
 #include "usb_util.h"
 #include "bootloader.h"
 
-#ifdef EE_HANDS
+#if defined(EE_HANDS) || defined(SPLIT_ROLE_CACHE)
 #    include "eeconfig.h"
 #endif
 
@@ -54,8 +56,40 @@
 #    define SPLIT_CONNECTION_CHECK_TIMEOUT 500
 #endif // SPLIT_CONNECTION_CHECK_TIMEOUT
 
+#ifdef SPLIT_LINK_SUPERVISION
+// How long (in milliseconds) the last successfully-read slave matrix is held after the link
+// starts failing, so a brief cable glitch neither releases held keys nor registers phantom
+// presses. Once the hold expires the slave matrix is cleared so keys release instead of sticking.
+#    ifndef SPLIT_LINK_STALE_TIMEOUT_MS
+#        define SPLIT_LINK_STALE_TIMEOUT_MS 250
+#    endif // SPLIT_LINK_STALE_TIMEOUT_MS
+STATIC_ASSERT(SPLIT_MAX_CONNECTION_ERRORS > 0, "SPLIT_LINK_SUPERVISION requires SPLIT_MAX_CONNECTION_ERRORS be above 0 for a functioning disconnection check.");
+#endif // SPLIT_LINK_SUPERVISION
+
+#ifdef SPLIT_ROLE_CACHE
+// How long (in milliseconds) an optimistically-assumed slave keeps USB alive
+// to catch a wrong cached role before settling as the slave for good.
+#    ifndef SPLIT_ROLE_CACHE_CORRECT_TIMEOUT
+#        define SPLIT_ROLE_CACHE_CORRECT_TIMEOUT 1000
+#    endif
+static bool     role_assumed_from_cache = false;
+static uint32_t role_watch_start;
+#endif // SPLIT_ROLE_CACHE
+
 static uint8_t connection_errors = 0;
 
+#ifdef SPLIT_LINK_SUPERVISION
+static matrix_row_t slave_matrix_cache[MATRIX_ROWS_PER_HAND];
+static uint32_t     link_last_good = 0;
+
+uint8_t split_link_retry_limit(void) {
+    // Full salvage retries are only worth their blocking time while the link has been
+    // healthy; once a pass has failed, single bounded attempts keep the master's own
+    // half responsive until a probe succeeds and resets the error count.
+    return connection_errors == 0 ? 10 : 1;
+}
+#endif // SPLIT_LINK_SUPERVISION
+
 volatile bool isLeftHand = true;
 
 static struct {
@@ -181,15 +215,51 @@ __attribute__((weak)) bool is_keyboard_left_impl(void) {
 }
 
 __attribute__((weak)) bool is_keyboard_master_impl(void) {
+#ifdef SPLIT_ROLE_CACHE
+    bool cached_master;
+    if (eeconfig_read_split_role(&cached_master) && !cached_master) {
+        // Optimistic fast path: this half concluded it was the slave last
+        // time, so assume that immediately instead of waiting out the
+        // detection timeout. USB stays enabled for the correction window; if
+        // a host enumerates this half after all, split_role_cache_task()
+        // re-caches the role and resets into master.
+        role_assumed_from_cache = true;
+        role_watch_start        = timer_read32();
+        return false;
+    }
+#endif
+
     bool is_master = usb_bus_detected();
 
     // Avoid NO_USB_STARTUP_CHECK - Disable USB as the previous checks seem to enable it somehow
     if (!is_master) {
         usb_disconnect();
     }
+#ifdef SPLIT_ROLE_CACHE
+    eeconfig_update_split_role(is_master);
+#endif
     return is_master;
 }
 
+#ifdef SPLIT_ROLE_CACHE
+void split_role_cache_task(void) {
+    if (!role_assumed_from_cache) {
+        return;
+    }
+    if (usb_connected_state()) {
+        // The cached role was wrong: a host enumerated the half that assumed
+        // it was the slave. Fix the cache and restart into the proper role.
+        eeconfig_update_split_role(true);
+        mcu_reset();
+    }
+    if (timer_elapsed32(role_watch_start) > SPLIT_ROLE_CACHE_CORRECT_TIMEOUT) {
+        // No host showed up; settle as the slave for good.
+        role_assumed_from_cache = false;
+        usb_disconnect();
+    }
+}
+#endif // SPLIT_ROLE_CACHE
+
 __attribute__((weak)) bool is_keyboard_left(void) {
     return split_config.left;
 }
@@ -215,6 +285,10 @@ void split_pre_init(void) {
 #endif
 
     if (is_keyboard_master()) {
+#ifdef SPLIT_SLAVE_NOTIFY_PIN
+        // Pulled low so the line reads idle until the slave half starts driving it
+        gpio_set_pin_input_low(SPLIT_SLAVE_NOTIFY_PIN);
+#endif
         transport_master_init();
     }
 }
@@ -224,6 +298,10 @@ void split_pre_init(void) {
 //     receiving before the init process has completed
 void split_post_init(void) {
     if (!is_keyboard_master()) {
+#ifdef SPLIT_SLAVE_NOTIFY_PIN
+        gpio_set_pin_output(SPLIT_SLAVE_NOTIFY_PIN);
+        gpio_write_pin_low(SPLIT_SLAVE_NOTIFY_PIN);
+#endif
         transport_slave_init();
 #if defined(SPLIT_WATCHDOG_ENABLE)
         split_watchdog_init();
@@ -247,6 +325,12 @@ bool transport_master_if_connected(matrix_row_t master_matrix[], matrix_row_t sl
 #endif // SPLIT_MAX_CONNECTION_ERRORS > 0 && SPLIT_CONNECTION_CHECK_TIMEOUT > 0
 
     __attribute__((unused)) bool okay = transport_master(master_matrix, slave_matrix);
+#ifdef SPLIT_LINK_SUPERVISION
+    if (okay) {
+        memcpy(slave_matrix_cache, slave_matrix, sizeof(slave_matrix_cache));
+        link_last_good = timer_read32();
+    }
+#endif // SPLIT_LINK_SUPERVISION
 #if SPLIT_MAX_CONNECTION_ERRORS > 0
     if (!okay) {
         if (connection_errors < UINT8_MAX) {
@@ -258,7 +342,18 @@ bool transport_master_if_connected(matrix_row_t master_matrix[], matrix_row_t sl
             connection_check_timer = timer_read();
             dprintln("Target disconnected, throttling connection attempts");
         }
+#        ifdef SPLIT_LINK_SUPERVISION
+        if (connected && timer_elapsed32(link_last_good) < SPLIT_LINK_STALE_TIMEOUT_MS) {
+            // Brief glitch: hold the last-good slave matrix so held keys don't flap
+            memcpy(slave_matrix, slave_matrix_cache, sizeof(slave_matrix_cache));
+            return true;
+        }
+        // The hold has expired: report the link down so the caller clears the
+        // slave matrix and keys release instead of sticking
+        return false;
+#        else
         return connected;
+#        endif // SPLIT_LINK_SUPERVISION
     } else if (is_disconnected) {
         dprintln("Target connected");
 #    endif // SPLIT_CONNECTION_CHECK_TIMEOUT > 0
@@ -13,6 +13,10 @@ void split_post_init(void);
 bool transport_master_if_connected(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 bool is_transport_connected(void);
 
+uint8_t split_link_retry_limit(void);
+
 void split_watchdog_update(bool done);
 void split_watchdog_task(void);
 bool split_watchdog_check(void);
+
+void split_role_cache_task(void);
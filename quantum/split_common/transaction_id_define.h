@@ -27,6 +27,8 @@ enum serial_transaction_id {
     I2C_EXECUTE_CALLBACK,
 #endif // USE_I2C
 
+    GET_SLAVE_CHECKSUMS,
+
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
 
@@ -71,6 +73,9 @@ enum serial_transaction_id {
 
 #if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
     PUT_RGB_MATRIX,
+#    if !defined(SPLIT_TRANSPORT_MIRROR)
+    PUT_RGB_MATRIX_HITS,
+#    endif // !defined(SPLIT_TRANSPORT_MIRROR)
 #endif // defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
 
 #if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
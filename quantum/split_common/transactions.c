@@ -31,6 +31,10 @@
 #include "split_util.h"
 #include "synchronization_util.h"
 
+#ifdef SPLIT_SLAVE_NOTIFY_PIN
+#    include "gpio.h"
+#endif
+
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
 #endif
@@ -71,6 +75,44 @@
 #    define FORCED_SYNC_THROTTLE_MS 100
 #endif // FORCED_SYNC_THROTTLE_MS
 
+// Longest the notify-pin idle path leaves the bus silent. The aggregate checksum read
+// doubles as the link keepalive, so this bounds how long a dropped cable can go
+// unnoticed while no keys are moving.
+#ifndef SPLIT_LINK_KEEPALIVE_MS
+#    define SPLIT_LINK_KEEPALIVE_MS FORCED_SYNC_THROTTLE_MS
+#endif // SPLIT_LINK_KEEPALIVE_MS
+
+// Drift compensation on the slave keeps the halves aligned between timer
+// syncs, so the sync timer is pushed far less often than other forced syncs
+#ifndef SYNC_TIMER_THROTTLE_MS
+#    define SYNC_TIMER_THROTTLE_MS (FORCED_SYNC_THROTTLE_MS * 10)
+#endif // SYNC_TIMER_THROTTLE_MS
+
+// Rate classes for the master-side handlers. Realtime traffic (matrix,
+// encoders, pointing) runs every pass; periodic traffic (lighting, displays)
+// and lazy traffic (WPM, activity timestamps) only attempt a sync once their
+// class interval has elapsed, and only with wire time left in the pass budget.
+#ifndef SPLIT_SYNC_PERIODIC_INTERVAL_MS
+#    define SPLIT_SYNC_PERIODIC_INTERVAL_MS 5
+#endif // SPLIT_SYNC_PERIODIC_INTERVAL_MS
+
+#ifndef SPLIT_SYNC_LAZY_INTERVAL_MS
+#    define SPLIT_SYNC_LAZY_INTERVAL_MS 50
+#endif // SPLIT_SYNC_LAZY_INTERVAL_MS
+
+// Wire-time budget for one transactions_master() pass. Realtime handlers are
+// never skipped, so whatever they consume comes off the top; periodic and
+// lazy handlers defer to the next pass once the budget is spent.
+#ifndef SPLIT_SYNC_PASS_BUDGET_MS
+#    define SPLIT_SYNC_PASS_BUDGET_MS 2
+#endif // SPLIT_SYNC_PASS_BUDGET_MS
+
+// A handler deferred this many passes in a row runs regardless of budget, so
+// handlers late in the dispatch order cannot be starved indefinitely
+#ifndef SPLIT_SYNC_MAX_DEFERRALS
+#    define SPLIT_SYNC_MAX_DEFERRALS 10
+#endif // SPLIT_SYNC_MAX_DEFERRALS
+
 #define sizeof_member(type, member) sizeof(((type *)NULL)->member)
 
 #define trans_initiator2target_initializer_cb(member, cb) {sizeof_member(split_shared_memory_t, member), offsetof(split_shared_memory_t, member), 0, 0, cb}
@@ -95,7 +137,11 @@ void slave_rpc_exec_callback(uint8_t initiator2target_buffer_size, const void *i
 // Helpers
 
 static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[], const char *prefix, bool (*handler)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[])) {
+#ifdef SPLIT_LINK_SUPERVISION
+    int num_retries = split_link_retry_limit();
+#else
     int num_retries = is_transport_connected() ? 10 : 1;
+#endif // SPLIT_LINK_SUPERVISION
     for (int iter = 1; iter <= num_retries; ++iter) {
         if (iter > 1) {
             for (int i = 0; i < iter * iter; ++i) {
@@ -104,7 +150,12 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         }
         bool this_okay = true;
         this_okay      = handler(master_matrix, slave_matrix);
-        if (this_okay) return true;
+        if (this_okay) {
+            if (iter > 1) {
+                sp_dprintf("Transaction %s succeeded after %d attempts\n", prefix, iter);
+            }
+            return true;
+        }
     }
     dprintf("Failed to execute %s\n", prefix);
     return false;
@@ -115,6 +166,35 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         if (!transaction_handler_master(master_matrix, slave_matrix, #prefix, &prefix##_handlers_master)) return false; \
     } while (0)
 
+// Start time of the current transactions_master() pass, for budget accounting
+static uint32_t sync_pass_start;
+
+static inline void split_sync_budget_start(void) {
+    sync_pass_start = timer_read32();
+}
+
+static inline bool split_sync_budget_exhausted(void) {
+    return timer_elapsed32(sync_pass_start) >= SPLIT_SYNC_PASS_BUDGET_MS;
+}
+
+#define TRANSACTION_HANDLER_MASTER_RATED(prefix, interval_ms)                                                                   \
+    do {                                                                                                                        \
+        static uint32_t last_attempt = 0;                                                                                       \
+        static uint8_t  deferrals    = 0;                                                                                       \
+        if (timer_elapsed32(last_attempt) >= (interval_ms)) {                                                                   \
+            if (split_sync_budget_exhausted() && deferrals < SPLIT_SYNC_MAX_DEFERRALS) {                                        \
+                deferrals++;                                                                                                    \
+            } else {                                                                                                            \
+                deferrals    = 0;                                                                                               \
+                last_attempt = timer_read32();                                                                                  \
+                if (!transaction_handler_master(master_matrix, slave_matrix, #prefix, &prefix##_handlers_master)) return false; \
+            }                                                                                                                   \
+        }                                                                                                                       \
+    } while (0)
+
+#define TRANSACTION_HANDLER_MASTER_PERIODIC(prefix) TRANSACTION_HANDLER_MASTER_RATED(prefix, SPLIT_SYNC_PERIODIC_INTERVAL_MS)
+#define TRANSACTION_HANDLER_MASTER_LAZY(prefix) TRANSACTION_HANDLER_MASTER_RATED(prefix, SPLIT_SYNC_LAZY_INTERVAL_MS)
+
 /**
  * @brief Constructs a transaction handler that doesn't acquire a lock to the
  * split shared memory. Therefore the locking and unlocking has to be done
@@ -156,6 +236,33 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
     return okay;
 }
 
+// Last aggregate of slave-side payload checksums, fetched in a single transaction at
+// the start of every master scan cycle; invalid until the first successful read
+static split_slave_checksums_t slave_checksums;
+static bool                    slave_checksums_valid = false;
+
+inline static bool read_if_cached_checksum_mismatch(uint8_t curr_checksum, int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
+    if (!slave_checksums_valid) {
+        // No aggregate available this cycle; fall back to reading the individual checksum
+        return read_if_checksum_mismatch(trans_id_checksum, trans_id_retrieve, last_update, destination, equiv_shmem, length);
+    }
+    bool okay = true;
+    if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != crc8(equiv_shmem, length)) {
+        okay &= transport_read(trans_id_retrieve, destination, length);
+        okay &= curr_checksum == crc8(equiv_shmem, length);
+        if (okay) {
+            *last_update = timer_read32();
+        } else {
+            // The aggregate checksum may be stale (the slave updated between the aggregate
+            // read and the data read) -- drop it so any retry re-reads the live checksum
+            slave_checksums_valid = false;
+        }
+    } else {
+        memcpy(destination, equiv_shmem, length);
+    }
+    return okay;
+}
+
 inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
     bool okay = true;
     if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition) {
@@ -172,6 +279,71 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
     return send_if_condition(trans_id, last_update, (memcmp(source, equiv_shmem, length) != 0), source, length);
 }
 
+////////////////////////////////////////////////////
+// Slave checksums
+
+static bool slave_checksums_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#ifdef SPLIT_SLAVE_NOTIFY_PIN
+    // The slave raises the notify line whenever its state changes -- as long as it is
+    // low the previous aggregate is still current and the bus can be left idle,
+    // with a periodic read as a safety net against a missed edge
+    static uint32_t last_read = 0;
+    if (slave_checksums_valid && timer_elapsed32(last_read) < SPLIT_LINK_KEEPALIVE_MS && !gpio_read_pin(SPLIT_SLAVE_NOTIFY_PIN)) {
+        return true;
+    }
+#endif // SPLIT_SLAVE_NOTIFY_PIN
+
+    // One small read covering every slave-side payload checksum -- the individual
+    // target2initiator handlers then only fetch payloads whose checksum changed
+    slave_checksums_valid = transport_read(GET_SLAVE_CHECKSUMS, &slave_checksums, sizeof(slave_checksums));
+
+#ifdef SPLIT_SLAVE_NOTIFY_PIN
+    if (slave_checksums_valid) {
+        last_read = timer_read32();
+    }
+#endif // SPLIT_SLAVE_NOTIFY_PIN
+    return slave_checksums_valid;
+}
+
+static void slave_checksums_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    // Runs after the other slave handlers have refreshed their payloads and checksums
+    split_slave_checksums_t checksums;
+    checksums.smatrix = split_shmem->smatrix.checksum;
+#ifdef ENCODER_ENABLE
+    checksums.encoders = split_shmem->encoders.checksum;
+#endif // ENCODER_ENABLE
+#if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    checksums.pointing = split_shmem->pointing.checksum;
+#endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+#ifdef SPLIT_SLAVE_NOTIFY_PIN
+    if (memcmp(&split_shmem->checksums, &checksums, sizeof(checksums)) != 0) {
+        // Raise the notify line so the master fetches the new aggregate immediately
+        gpio_write_pin_high(SPLIT_SLAVE_NOTIFY_PIN);
+    }
+#endif // SPLIT_SLAVE_NOTIFY_PIN
+    memcpy(&split_shmem->checksums, &checksums, sizeof(checksums));
+}
+
+#ifdef SPLIT_SLAVE_NOTIFY_PIN
+static void slave_checksums_read_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    // The master is picking up the aggregate -- lower the notify line. Any change
+    // arriving afterwards re-raises it on the next slave handler pass.
+    gpio_write_pin_low(SPLIT_SLAVE_NOTIFY_PIN);
+}
+#endif // SPLIT_SLAVE_NOTIFY_PIN
+
+// clang-format off
+#define TRANSACTIONS_SLAVE_CHECKSUMS_MASTER() TRANSACTION_HANDLER_MASTER(slave_checksums)
+#define TRANSACTIONS_SLAVE_CHECKSUMS_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_checksums)
+#ifdef SPLIT_SLAVE_NOTIFY_PIN
+#    define TRANSACTIONS_SLAVE_CHECKSUMS_REGISTRATIONS \
+    [GET_SLAVE_CHECKSUMS] = trans_target2initiator_initializer_cb(checksums, slave_checksums_read_callback),
+#else // SPLIT_SLAVE_NOTIFY_PIN
+#    define TRANSACTIONS_SLAVE_CHECKSUMS_REGISTRATIONS \
+    [GET_SLAVE_CHECKSUMS] = trans_target2initiator_initializer(checksums),
+#endif // SPLIT_SLAVE_NOTIFY_PIN
+// clang-format on
+
 ////////////////////////////////////////////////////
 // Slave matrix
 
@@ -180,7 +352,7 @@ static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_ro
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
     matrix_row_t        temp_matrix[(MATRIX_ROWS) / 2];       // holding area while we test whether or not checksum is correct
 
-    bool okay = read_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &last_update, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+    bool okay = read_if_cached_checksum_mismatch(slave_checksums.smatrix, GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &last_update, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
     if (okay) {
         // Checksum matches the received data, save as the last matrix state
         memcpy(last_matrix, temp_matrix, sizeof(temp_matrix));
@@ -240,9 +412,10 @@ static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t s
     static uint8_t   last_checksum = 0;
     encoder_events_t temp_events;
 
-    bool okay = read_if_checksum_mismatch(GET_ENCODERS_CHECKSUM, GET_ENCODERS_DATA, &last_update, &temp_events, &split_shmem->encoders.events, sizeof(temp_events));
+    bool okay = read_if_cached_checksum_mismatch(slave_checksums.encoders, GET_ENCODERS_CHECKSUM, GET_ENCODERS_DATA, &last_update, &temp_events, &split_shmem->encoders.events, sizeof(temp_events));
     if (okay) {
-        if (last_checksum != split_shmem->encoders.checksum) {
+        uint8_t curr_checksum = slave_checksums_valid ? slave_checksums.encoders : split_shmem->encoders.checksum;
+        if (last_checksum != curr_checksum) {
             bool    actioned = false;
             uint8_t index;
             bool    clockwise;
@@ -254,7 +427,7 @@ static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t s
             if (actioned) {
                 okay &= transport_exec(CMD_ENCODER_DRAIN);
             }
-            last_checksum = split_shmem->encoders.checksum;
+            last_checksum = curr_checksum;
         }
     }
     return okay;
@@ -297,7 +470,7 @@ static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_
     static uint32_t last_update = 0;
 
     bool okay = true;
-    if (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS) {
+    if (timer_elapsed32(last_update) >= SYNC_TIMER_THROTTLE_MS) {
         uint32_t sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
         okay &= transport_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
         if (okay) {
@@ -349,7 +522,7 @@ static void layer_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 }
 
 // clang-format off
-#    define TRANSACTIONS_LAYER_STATE_MASTER() TRANSACTION_HANDLER_MASTER(layer_state)
+#    define TRANSACTIONS_LAYER_STATE_MASTER() TRANSACTION_HANDLER_MASTER_PERIODIC(layer_state)
 #    define TRANSACTIONS_LAYER_STATE_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(layer_state)
 #    define TRANSACTIONS_LAYER_STATE_REGISTRATIONS \
     [PUT_LAYER_STATE]         = trans_initiator2target_initializer(layers.layer_state), \
@@ -380,7 +553,7 @@ static void led_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
     set_split_host_keyboard_leds(split_shmem->led_state);
 }
 
-#    define TRANSACTIONS_LED_STATE_MASTER() TRANSACTION_HANDLER_MASTER(led_state)
+#    define TRANSACTIONS_LED_STATE_MASTER() TRANSACTION_HANDLER_MASTER_PERIODIC(led_state)
 #    define TRANSACTIONS_LED_STATE_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(led_state)
 #    define TRANSACTIONS_LED_STATE_REGISTRATIONS [PUT_LED_STATE] = trans_initiator2target_initializer(led_state),
 
@@ -478,7 +651,7 @@ static void backlight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
     backlight_level_noeeprom(backlight_level);
 }
 
-#    define TRANSACTIONS_BACKLIGHT_MASTER() TRANSACTION_HANDLER_MASTER(backlight)
+#    define TRANSACTIONS_BACKLIGHT_MASTER() TRANSACTION_HANDLER_MASTER_PERIODIC(backlight)
 #    define TRANSACTIONS_BACKLIGHT_SLAVE() TRANSACTION_HANDLER_SLAVE(backlight)
 #    define TRANSACTIONS_BACKLIGHT_REGISTRATIONS [PUT_BACKLIGHT] = trans_initiator2target_initializer(backlight_level),
 
@@ -520,7 +693,7 @@ static void rgblight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
     }
 }
 
-#    define TRANSACTIONS_RGBLIGHT_MASTER() TRANSACTION_HANDLER_MASTER(rgblight)
+#    define TRANSACTIONS_RGBLIGHT_MASTER() TRANSACTION_HANDLER_MASTER_PERIODIC(rgblight)
 #    define TRANSACTIONS_RGBLIGHT_SLAVE() TRANSACTION_HANDLER_SLAVE(rgblight)
 #    define TRANSACTIONS_RGBLIGHT_REGISTRATIONS [PUT_RGBLIGHT] = trans_initiator2target_initializer(rgblight_sync),
 
@@ -554,7 +727,7 @@ static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
     led_matrix_set_suspend_state(led_suspend_state);
 }
 
-#    define TRANSACTIONS_LED_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(led_matrix)
+#    define TRANSACTIONS_LED_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER_PERIODIC(led_matrix)
 #    define TRANSACTIONS_LED_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(led_matrix)
 #    define TRANSACTIONS_LED_MATRIX_REGISTRATIONS [PUT_LED_MATRIX] = trans_initiator2target_initializer(led_matrix_sync),
 
@@ -576,21 +749,52 @@ static bool rgb_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_
     rgb_matrix_sync_t rgb_matrix_sync;
     memcpy(&rgb_matrix_sync.rgb_matrix, &rgb_matrix_config, sizeof(rgb_config_t));
     rgb_matrix_sync.rgb_suspend_state = rgb_matrix_get_suspend_state();
-    return send_if_data_mismatch(PUT_RGB_MATRIX, &last_update, &rgb_matrix_sync, &split_shmem->rgb_matrix_sync, sizeof(rgb_matrix_sync));
+    bool okay = send_if_data_mismatch(PUT_RGB_MATRIX, &last_update, &rgb_matrix_sync, &split_shmem->rgb_matrix_sync, sizeof(rgb_matrix_sync));
+
+#    if !defined(SPLIT_TRANSPORT_MIRROR)
+    // Forward any new key hits from this half so the slave's reactive effects can
+    // follow the whole board; only goes on the wire when there is something to send
+    if (okay) {
+        rgb_matrix_hit_sync_t hit_sync;
+        if (rgb_matrix_get_hit_sync(&hit_sync)) {
+            // Only the used portion of the event log needs to reach shared memory;
+            // the slave ignores everything past `count`
+            okay &= transport_write(PUT_RGB_MATRIX_HITS, &hit_sync, offsetof(rgb_matrix_hit_sync_t, events) + hit_sync.count * sizeof(hit_sync.events[0]));
+        }
+    }
+#    endif // !defined(SPLIT_TRANSPORT_MIRROR)
+    return okay;
 }
 
 static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     split_shared_memory_lock();
     memcpy(&rgb_matrix_config, &split_shmem->rgb_matrix_sync.rgb_matrix, sizeof(rgb_config_t));
     bool rgb_suspend_state = split_shmem->rgb_matrix_sync.rgb_suspend_state;
+#    if !defined(SPLIT_TRANSPORT_MIRROR)
+    static uint8_t        last_hit_seq = 0;
+    rgb_matrix_hit_sync_t hit_sync     = {.count = 0};
+    if (split_shmem->rgb_hit_sync.seq != last_hit_seq) {
+        last_hit_seq = split_shmem->rgb_hit_sync.seq;
+        memcpy(&hit_sync, &split_shmem->rgb_hit_sync, sizeof(hit_sync));
+    }
+#    endif // !defined(SPLIT_TRANSPORT_MIRROR)
     split_shared_memory_unlock();
 
     rgb_matrix_set_suspend_state(rgb_suspend_state);
+#    if !defined(SPLIT_TRANSPORT_MIRROR)
+    if (hit_sync.count > 0) {
+        rgb_matrix_apply_hit_sync(&hit_sync);
+    }
+#    endif // !defined(SPLIT_TRANSPORT_MIRROR)
 }
 
-#    define TRANSACTIONS_RGB_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(rgb_matrix)
+#    define TRANSACTIONS_RGB_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER_PERIODIC(rgb_matrix)
 #    define TRANSACTIONS_RGB_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(rgb_matrix)
-#    define TRANSACTIONS_RGB_MATRIX_REGISTRATIONS [PUT_RGB_MATRIX] = trans_initiator2target_initializer(rgb_matrix_sync),
+#    if !defined(SPLIT_TRANSPORT_MIRROR)
+#        define TRANSACTIONS_RGB_MATRIX_REGISTRATIONS [PUT_RGB_MATRIX] = trans_initiator2target_initializer(rgb_matrix_sync), [PUT_RGB_MATRIX_HITS] = trans_initiator2target_initializer(rgb_hit_sync),
+#    else // !defined(SPLIT_TRANSPORT_MIRROR)
+#        define TRANSACTIONS_RGB_MATRIX_REGISTRATIONS [PUT_RGB_MATRIX] = trans_initiator2target_initializer(rgb_matrix_sync),
+#    endif // !defined(SPLIT_TRANSPORT_MIRROR)
 
 #else // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
@@ -615,7 +819,7 @@ static void wpm_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_
     set_current_wpm(split_shmem->current_wpm);
 }
 
-#    define TRANSACTIONS_WPM_MASTER() TRANSACTION_HANDLER_MASTER(wpm)
+#    define TRANSACTIONS_WPM_MASTER() TRANSACTION_HANDLER_MASTER_LAZY(wpm)
 #    define TRANSACTIONS_WPM_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(wpm)
 #    define TRANSACTIONS_WPM_REGISTRATIONS [PUT_WPM] = trans_initiator2target_initializer(current_wpm),
 
@@ -650,7 +854,7 @@ static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
     }
 }
 
-#    define TRANSACTIONS_OLED_MASTER() TRANSACTION_HANDLER_MASTER(oled)
+#    define TRANSACTIONS_OLED_MASTER() TRANSACTION_HANDLER_MASTER_PERIODIC(oled)
 #    define TRANSACTIONS_OLED_SLAVE() TRANSACTION_HANDLER_SLAVE(oled)
 #    define TRANSACTIONS_OLED_REGISTRATIONS [PUT_OLED] = trans_initiator2target_initializer(current_oled_state),
 
@@ -685,7 +889,7 @@ static void st7565_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
     }
 }
 
-#    define TRANSACTIONS_ST7565_MASTER() TRANSACTION_HANDLER_MASTER(st7565)
+#    define TRANSACTIONS_ST7565_MASTER() TRANSACTION_HANDLER_MASTER_PERIODIC(st7565)
 #    define TRANSACTIONS_ST7565_SLAVE() TRANSACTION_HANDLER_SLAVE(st7565)
 #    define TRANSACTIONS_ST7565_REGISTRATIONS [PUT_ST7565] = trans_initiator2target_initializer(current_st7565_state),
 
@@ -717,7 +921,7 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
     static uint16_t last_cpi        = 0;
     report_mouse_t  temp_state;
     uint16_t        temp_cpi;
-    bool            okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state));
+    bool            okay = read_if_cached_checksum_mismatch(slave_checksums.pointing, GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state));
     if (okay) pointing_device_set_shared_report(temp_state);
     temp_cpi = pointing_device_get_shared_cpi();
     if (temp_cpi) {
@@ -841,7 +1045,7 @@ static void haptic_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
 }
 
 // clang-format off
-#    define TRANSACTIONS_HAPTIC_MASTER() TRANSACTION_HANDLER_MASTER(haptic)
+#    define TRANSACTIONS_HAPTIC_MASTER() TRANSACTION_HANDLER_MASTER_PERIODIC(haptic)
 #    define TRANSACTIONS_HAPTIC_SLAVE() TRANSACTION_HANDLER_SLAVE(haptic)
 #    define TRANSACTIONS_HAPTIC_REGISTRATIONS [PUT_HAPTIC] = trans_initiator2target_initializer(haptic_sync),
 // clang-format on
@@ -870,7 +1074,7 @@ static void activity_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 }
 
 // clang-format off
-#    define TRANSACTIONS_ACTIVITY_MASTER() TRANSACTION_HANDLER_MASTER(activity)
+#    define TRANSACTIONS_ACTIVITY_MASTER() TRANSACTION_HANDLER_MASTER_LAZY(activity)
 #    define TRANSACTIONS_ACTIVITY_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(activity)
 #    define TRANSACTIONS_ACTIVITY_REGISTRATIONS [PUT_ACTIVITY] = trans_initiator2target_initializer(activity_sync),
 // clang-format on
@@ -899,7 +1103,7 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
     slave_update_detected_host_os(split_shmem->detected_os);
 }
 
-#    define TRANSACTIONS_DETECTED_OS_MASTER() TRANSACTION_HANDLER_MASTER(detected_os)
+#    define TRANSACTIONS_DETECTED_OS_MASTER() TRANSACTION_HANDLER_MASTER_LAZY(detected_os)
 #    define TRANSACTIONS_DETECTED_OS_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(detected_os)
 #    define TRANSACTIONS_DETECTED_OS_REGISTRATIONS [PUT_DETECTED_OS] = trans_initiator2target_initializer(detected_os),
 
@@ -922,6 +1126,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 #endif // USE_I2C
 
     // clang-format off
+    TRANSACTIONS_SLAVE_CHECKSUMS_REGISTRATIONS
     TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS
     TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS
     TRANSACTIONS_ENCODERS_REGISTRATIONS
@@ -952,6 +1157,8 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 };
 
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    split_sync_budget_start();
+    TRANSACTIONS_SLAVE_CHECKSUMS_MASTER();
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
@@ -994,6 +1201,8 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
     TRANSACTIONS_HAPTIC_SLAVE();
     TRANSACTIONS_ACTIVITY_SLAVE();
     TRANSACTIONS_DETECTED_OS_SLAVE();
+    // Aggregated last, once every payload checksum above is up to date
+    TRANSACTIONS_SLAVE_CHECKSUMS_SLAVE();
 }
 
 #if defined(SPLIT_TRANSACTION_RPC)
@@ -148,11 +148,27 @@ typedef struct _rpc_sync_info_t {
 #    include "os_detection.h"
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+// Aggregate of every slave-side payload checksum, so the master can determine which
+// target2initiator transactions are dirty with a single read per scan cycle
+typedef struct _split_slave_checksums_t {
+    uint8_t smatrix;
+
+#ifdef ENCODER_ENABLE
+    uint8_t encoders;
+#endif // ENCODER_ENABLE
+
+#if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    uint8_t pointing;
+#endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+} split_slave_checksums_t;
+
 typedef struct _split_shared_memory_t {
 #ifdef USE_I2C
     int8_t transaction_id;
 #endif // USE_I2C
 
+    split_slave_checksums_t checksums;
+
     split_slave_matrix_sync_t smatrix;
 
 #ifdef SPLIT_TRANSPORT_MIRROR
@@ -193,6 +209,9 @@ typedef struct _split_shared_memory_t {
 
 #if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
     rgb_matrix_sync_t rgb_matrix_sync;
+#    if !defined(SPLIT_TRANSPORT_MIRROR)
+    rgb_matrix_hit_sync_t rgb_hit_sync;
+#    endif // !defined(SPLIT_TRANSPORT_MIRROR)
 #endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
 #if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
@@ -0,0 +1,64 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "spsc_queue.h"
+
+// The supported MCUs are single-core, so the only reordering hazard between
+// an interrupt producer and the main-loop consumer is the compiler moving the
+// index store ahead of the item it publishes. A compiler barrier is enough.
+static inline void compiler_barrier(void) {
+    __asm__ volatile("" ::: "memory");
+}
+
+void spsc_queue_init(spsc_queue_t *queue, void *buffer, uint8_t item_size, uint8_t capacity) {
+    queue->buffer    = (uint8_t *)buffer;
+    queue->item_size = item_size;
+    queue->mask      = capacity - 1;
+    queue->head      = 0;
+    queue->tail      = 0;
+}
+
+bool spsc_queue_enqueue(spsc_queue_t *queue, const void *item) {
+    uint8_t head = queue->head;
+    if ((uint8_t)(head - queue->tail) > queue->mask) {
+        return false;
+    }
+
+    memcpy(&queue->buffer[(head & queue->mask) * queue->item_size], item, queue->item_size);
+
+    // The item must be in place before the index that publishes it
+    compiler_barrier();
+    queue->head = head + 1;
+    return true;
+}
+
+bool spsc_queue_dequeue(spsc_queue_t *queue, void *item) {
+    uint8_t tail = queue->tail;
+    if (tail == queue->head) {
+        return false;
+    }
+
+    memcpy(item, &queue->buffer[(tail & queue->mask) * queue->item_size], queue->item_size);
+
+    // The item must be copied out before the slot is released for reuse
+    compiler_barrier();
+    queue->tail = tail + 1;
+    return true;
+}
+
+bool spsc_queue_is_empty(const spsc_queue_t *queue) {
+    return queue->head == queue->tail;
+}
+
+bool spsc_queue_is_full(const spsc_queue_t *queue) {
+    return (uint8_t)(queue->head - queue->tail) > queue->mask;
+}
+
+uint8_t spsc_queue_size(const spsc_queue_t *queue) {
+    return (uint8_t)(queue->head - queue->tail);
+}
+
+void spsc_queue_clear(spsc_queue_t *queue) {
+    queue->tail = queue->head;
+}
@@ -0,0 +1,81 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+//------------------------------------
+// Fixed-size, lock-free single-producer/single-consumer event queue.
+//
+// Interrupt-driven producers (encoder transitions, pointing device IRQs, PS/2
+// bytes) need to hand events to the main loop without losing them, and
+// ideally without disabling interrupts around every access. As long as
+// exactly one context enqueues and exactly one context dequeues, no interrupt
+// locking is required: the producer only ever writes `head`, the consumer
+// only ever writes `tail`, and each index is published only after the item it
+// guards has been written. Anything beyond that arrangement (multiple
+// producers, clearing from the producer side) needs external locking.
+//------------------------------------
+
+/**
+ * @struct Structure holding the state of one single-producer/single-consumer queue.
+ * @brief Code outside spsc_queue.c should not worry about the internals of this struct, and should only use the accessor functions below.
+ *        The indices are free-running and masked on access, so the capacity must be a power of two, at most 128.
+ */
+typedef struct spsc_queue_t {
+    uint8_t         *buffer;    // backing storage, `capacity * item_size` bytes, supplied by the owner
+    uint8_t          item_size; // size of one item, in bytes
+    uint8_t          mask;      // capacity - 1
+    volatile uint8_t head;      // written only by the producer
+    volatile uint8_t tail;      // written only by the consumer
+} spsc_queue_t;
+
+/**
+ * Initialises the supplied queue around caller-provided backing storage. Not safe to call while a producer may enqueue.
+ *
+ * @param queue[in] the queue to initialise
+ * @param buffer[in] backing storage of at least `capacity * item_size` bytes
+ * @param item_size[in] the size of one item, in bytes
+ * @param capacity[in] the number of items the queue can hold -- must be a power of two, at most 128
+ */
+void spsc_queue_init(spsc_queue_t *queue, void *buffer, uint8_t item_size, uint8_t capacity);
+
+/**
+ * Appends one item to the queue. Producer-side only; safe to call from an interrupt handler.
+ *
+ * @param queue[in] the queue to append to
+ * @param item[in] the item to copy in, `item_size` bytes
+ * @return true if the item was enqueued, false if the queue was full and the item was dropped
+ */
+bool spsc_queue_enqueue(spsc_queue_t *queue, const void *item);
+
+/**
+ * Removes the oldest item from the queue. Consumer-side only.
+ *
+ * @param queue[in] the queue to take from
+ * @param item[out] receives the item, `item_size` bytes
+ * @return true if an item was dequeued, false if the queue was empty
+ */
+bool spsc_queue_dequeue(spsc_queue_t *queue, void *item);
+
+/**
+ * Checks whether the queue holds no items. Callable from either side.
+ */
+bool spsc_queue_is_empty(const spsc_queue_t *queue);
+
+/**
+ * Checks whether the queue has no room for another item. Callable from either side.
+ */
+bool spsc_queue_is_full(const spsc_queue_t *queue);
+
+/**
+ * Counts the items currently held in the queue. Callable from either side.
+ */
+uint8_t spsc_queue_size(const spsc_queue_t *queue);
+
+/**
+ * Discards all items currently held in the queue. Consumer-side only; items enqueued concurrently after the call may survive it.
+ */
+void spsc_queue_clear(spsc_queue_t *queue);
@@ -29,13 +29,45 @@ SOFTWARE.
 #if defined(SPLIT_KEYBOARD) && !defined(DISABLE_SYNC_TIMER)
 volatile int32_t sync_timer_ms;
 
+// Crystal drift compensation: the offset from the master changes at a nearly
+// constant rate between syncs (crystal tolerance is a few hundred ppm at
+// most), so the slope estimated from successive syncs is applied to reads
+// in between. This keeps the halves aligned across a much longer sync
+// interval than offset-only correction would allow.
+static uint32_t sync_timer_last_sync;  // local time of the last sync
+static int32_t  sync_timer_drift_q16;  // offset change per local ms, Q16.16
+static bool     sync_timer_have_sync;
+
+// Anything steeper than ~1.5% is transport jitter or a corrupted sync, not
+// crystal drift; drop the sample rather than slewing the clock after it.
+#    define SYNC_TIMER_DRIFT_MAX_Q16 1000
+
 void sync_timer_init(void) {
-    sync_timer_ms = 0;
+    sync_timer_ms        = 0;
+    sync_timer_last_sync = 0;
+    sync_timer_drift_q16 = 0;
+    sync_timer_have_sync = false;
 }
 
 void sync_timer_update(uint32_t time) {
     if (is_keyboard_master()) return;
-    sync_timer_ms = time - timer_read32();
+    uint32_t now        = timer_read32();
+    int32_t  new_offset = (int32_t)(time - now);
+    if (sync_timer_have_sync) {
+        uint32_t interval = now - sync_timer_last_sync;
+        if (interval > 0) {
+            int32_t slope = (int32_t)((((int64_t)(new_offset - sync_timer_ms)) << 16) / (int32_t)interval);
+            if (slope >= -SYNC_TIMER_DRIFT_MAX_Q16 && slope <= SYNC_TIMER_DRIFT_MAX_Q16) {
+                // Average with the previous estimate to damp per-sync
+                // transport jitter
+                sync_timer_drift_q16 = (sync_timer_drift_q16 + slope) / 2;
+            }
+        }
+    } else {
+        sync_timer_have_sync = true;
+    }
+    sync_timer_ms        = new_offset;
+    sync_timer_last_sync = now;
 }
 
 uint16_t sync_timer_read(void) {
@@ -45,7 +77,9 @@ uint16_t sync_timer_read(void) {
 
 uint32_t sync_timer_read32(void) {
     if (is_keyboard_master()) return timer_read32();
-    return sync_timer_ms + timer_read32();
+    uint32_t now        = timer_read32();
+    int32_t  correction = (int32_t)(((int64_t)sync_timer_drift_q16 * (int32_t)(now - sync_timer_last_sync)) >> 16);
+    return sync_timer_ms + now + correction;
 }
 
 uint16_t sync_timer_elapsed(uint16_t last) {
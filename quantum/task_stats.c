@@ -0,0 +1,98 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "task_stats.h"
+#include "basic_profiling.h" // for TIMESTAMP_GETTER
+#include "print.h"
+
+static task_stats_t stats[TASK_STATS_TASK_COUNT];
+// EWMA state in <<TASK_STATS_EWMA_SHIFT fixed point, to keep fractional
+// precision across updates; ewma_ticks holds the rounded-down integer part.
+static uint32_t ewma_fp[TASK_STATS_TASK_COUNT];
+static uint32_t start_ticks[TASK_STATS_TASK_COUNT];
+
+void task_stats_begin(task_stats_task_t task) {
+    if (task >= TASK_STATS_TASK_COUNT) {
+        return;
+    }
+    start_ticks[task] = (uint32_t)TIMESTAMP_GETTER;
+}
+
+void task_stats_end(task_stats_task_t task) {
+    if (task >= TASK_STATS_TASK_COUNT) {
+        return;
+    }
+    const uint32_t delta = (uint32_t)TIMESTAMP_GETTER - start_ticks[task];
+    task_stats_t * s     = &stats[task];
+
+    s->last_ticks = delta;
+    if (delta > s->max_ticks) {
+        s->max_ticks = delta;
+    }
+
+    if (s->samples == 0) {
+        ewma_fp[task] = delta << TASK_STATS_EWMA_SHIFT;
+    } else {
+        ewma_fp[task] += delta - (ewma_fp[task] >> TASK_STATS_EWMA_SHIFT);
+    }
+    s->ewma_ticks = ewma_fp[task] >> TASK_STATS_EWMA_SHIFT;
+
+    s->samples++;
+}
+
+bool task_stats_get(task_stats_task_t task, task_stats_t *out) {
+    if (task >= TASK_STATS_TASK_COUNT) {
+        return false;
+    }
+    *out = stats[task];
+    return true;
+}
+
+void task_stats_reset(void) {
+    memset(stats, 0, sizeof(stats));
+    memset(ewma_fp, 0, sizeof(ewma_fp));
+}
+
+void task_stats_print(void) {
+    static const char *const task_names[TASK_STATS_TASK_COUNT] = {
+        [TASK_STATS_MATRIX_TASK]          = "matrix",          //
+        [TASK_STATS_QUANTUM_TASK]         = "quantum",         //
+        [TASK_STATS_RGBLIGHT_TASK]        = "rgblight",        //
+        [TASK_STATS_LED_MATRIX_TASK]      = "led_matrix",      //
+        [TASK_STATS_RGB_MATRIX_TASK]      = "rgb_matrix",      //
+        [TASK_STATS_POINTING_DEVICE_TASK] = "pointing_device", //
+        [TASK_STATS_OLED_TASK]            = "oled",            //
+        [TASK_STATS_HOUSEKEEPING_TASK]    = "housekeeping",    //
+    };
+
+    for (uint8_t task = 0; task < TASK_STATS_TASK_COUNT; task++) {
+        const task_stats_t *s = &stats[task];
+        if (s->samples == 0) {
+            continue;
+        }
+        dprintf("%s: last=%lu ewma=%lu max=%lu ticks (n=%lu)\n", task_names[task], (unsigned long)s->last_ticks, (unsigned long)s->ewma_ticks, (unsigned long)s->max_ticks, (unsigned long)s->samples);
+    }
+}
+
+static void write_u32_le(uint8_t *data, uint32_t value) {
+    data[0] = (uint8_t)value;
+    data[1] = (uint8_t)(value >> 8);
+    data[2] = (uint8_t)(value >> 16);
+    data[3] = (uint8_t)(value >> 24);
+}
+
+bool task_stats_raw_hid_report(task_stats_task_t task, uint8_t *data, uint8_t length) {
+    if (task >= TASK_STATS_TASK_COUNT || length < 17) {
+        return false;
+    }
+    const task_stats_t *s = &stats[task];
+
+    data[0] = (uint8_t)task;
+    write_u32_le(&data[1], s->last_ticks);
+    write_u32_le(&data[5], s->ewma_ticks);
+    write_u32_le(&data[9], s->max_ticks);
+    write_u32_le(&data[13], s->samples);
+    return true;
+}
@@ -0,0 +1,80 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \defgroup task_stats Per-task CPU accounting
+ *
+ * Accounts the time spent in each stage of the main loop — matrix scan,
+ * quantum task, lighting tasks, pointing device, display and housekeeping —
+ * into a shared stats block holding the last, exponentially-averaged and
+ * maximum observed duration per task. This is the instrumentation backbone
+ * the latency tracer and scan histograms complement: histograms show the
+ * distribution of whole-loop time, task stats show which task is eating it.
+ *
+ * Enable with `TASK_STATS_ENABLE = yes` in rules.mk. Durations are measured
+ * in raw timestamp-counter ticks (the clock from `basic_profiling.h`).
+ * Query live with \ref task_stats_get, dump to console with
+ * \ref task_stats_print, or serialize a task's block for raw HID with
+ * \ref task_stats_raw_hid_report.
+ */
+
+/** \brief Instrumented main-loop tasks. */
+typedef enum task_stats_task_t {
+    TASK_STATS_MATRIX_TASK,          /**< Matrix scan, debounce and key event processing */
+    TASK_STATS_QUANTUM_TASK,         /**< quantum_task(): feature tasks driven off the scan loop */
+    TASK_STATS_RGBLIGHT_TASK,        /**< rgblight_task() */
+    TASK_STATS_LED_MATRIX_TASK,      /**< led_matrix_task() */
+    TASK_STATS_RGB_MATRIX_TASK,      /**< rgb_matrix_task() */
+    TASK_STATS_POINTING_DEVICE_TASK, /**< pointing_device_task() */
+    TASK_STATS_OLED_TASK,            /**< oled_task() */
+    TASK_STATS_HOUSEKEEPING_TASK,    /**< housekeeping_task(): hooks and idle maintenance */
+    TASK_STATS_TASK_COUNT
+} task_stats_task_t;
+
+/**
+ * \brief EWMA smoothing factor as a right shift; alpha = 1 / 2^shift.
+ *
+ * Larger values react slower but smooth harder.
+ */
+#ifndef TASK_STATS_EWMA_SHIFT
+#    define TASK_STATS_EWMA_SHIFT 4
+#endif
+
+/** \brief Accounting block for one task. Durations are in timestamp ticks. */
+typedef struct task_stats_t {
+    uint32_t last_ticks; /**< Duration of the most recent invocation */
+    uint32_t ewma_ticks; /**< Exponentially weighted moving average duration */
+    uint32_t max_ticks;  /**< Largest duration seen since reset */
+    uint32_t samples;    /**< Number of accounted invocations */
+} task_stats_t;
+
+/** \brief Marks the start of a task for the current cycle. */
+void task_stats_begin(task_stats_task_t task);
+
+/** \brief Marks the end of a task and accounts its duration. */
+void task_stats_end(task_stats_task_t task);
+
+/** \brief Copies the current stats block for a task. \return false if out of range. */
+bool task_stats_get(task_stats_task_t task, task_stats_t *stats);
+
+/** \brief Clears all accounted data. */
+void task_stats_reset(void);
+
+/** \brief Prints the stats of every task with samples to the console. */
+void task_stats_print(void);
+
+/**
+ * \brief Serializes one task's stats block into a raw HID response buffer.
+ *
+ * Layout: `data[0]` = task, then last/ewma/max/samples as little-endian
+ * uint32_t. Requires `length` >= 17. \return false if the task is out of
+ * range or the buffer too short.
+ */
+bool task_stats_raw_hid_report(task_stats_task_t task, uint8_t *data, uint8_t length);
@@ -4,6 +4,7 @@
 #include "ucis.h"
 #include "unicode.h"
 #include "action.h"
+#include "keymap_introspection.h"
 
 uint8_t count                        = 0;
 bool    active                       = false;
@@ -63,9 +64,16 @@ static bool match_mnemonic(char *mnemonic) {
 }
 
 void ucis_finish(void) {
-    uint8_t i     = 0;
-    bool    found = false;
-    for (; ucis_symbol_table[i].mnemonic; i++) {
+    const char *first_chars  = ucis_symbol_first_chars();
+    uint16_t    symbol_count = ucis_symbol_count();
+    uint16_t    i            = 0;
+    bool        found        = false;
+    for (; i < symbol_count; i++) {
+        // Almost every entry is rejected on this single dense byte compare,
+        // without touching its mnemonic pointer
+        if (input[0] && first_chars[i] != input[0]) {
+            continue;
+        }
         if (match_mnemonic(ucis_symbol_table[i].mnemonic)) {
             found = true;
             break;
@@ -87,7 +95,7 @@ void ucis_cancel(void) {
     active = false;
 }
 
-void register_ucis(uint8_t index) {
+void register_ucis(uint16_t index) {
     const uint32_t *code_points = ucis_symbol_table[index].code_points;
 
     for (int i = 0; i < UCIS_MAX_CODE_POINTS && code_points[i]; i++) {
@@ -92,6 +92,6 @@ void ucis_cancel(void);
  *
  * \param index The index into the UCIS symbol table.
  */
-void register_ucis(uint8_t index);
+void register_ucis(uint16_t index);
 
 /** \} */
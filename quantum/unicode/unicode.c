@@ -309,6 +309,23 @@ __attribute__((weak)) void unicode_input_cancel(void) {
     set_mods(unicode_saved_mods); // Reregister previously set mods
 }
 
+// Maximum number of taps a single register_hex32() call can queue: eight hex
+// digits plus a possible leading zero, with a space chaser for each in case
+// the layout maps a digit to a dead key
+#define UNICODE_SEQUENCE_MAX_LENGTH (2 * (8 + 1))
+
+static uint8_t sequence_keycodes[UNICODE_SEQUENCE_MAX_LENGTH];
+static uint8_t sequence_mods[UNICODE_SEQUENCE_MAX_LENGTH];
+static uint8_t sequence_length = 0;
+
+static void sequence_queue_tap(uint8_t keycode, uint8_t mods) {
+    if (sequence_length < UNICODE_SEQUENCE_MAX_LENGTH) {
+        sequence_keycodes[sequence_length] = keycode;
+        sequence_mods[sequence_length]     = mods;
+        sequence_length++;
+    }
+}
+
 // clang-format off
 
 static void send_nibble_wrapper(uint8_t digit) {
@@ -316,19 +333,70 @@ static void send_nibble_wrapper(uint8_t digit) {
         uint8_t kc = digit < 10
                    ? KC_KP_1 + (10 + digit - 1) % 10
                    : KC_A + (digit - 10);
-        tap_code(kc);
+        sequence_queue_tap(kc, 0);
         return;
     }
-    send_nibble(digit);
+    char ascii_code = digit < 10
+                    ? digit + '0'
+                    : digit - 10 + 'a';
+    // clang-format on
+    uint8_t keycode = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+    uint8_t mods    = 0;
+    if (PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code)) {
+        mods |= MOD_BIT(KC_LEFT_SHIFT);
+    }
+    if (PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code)) {
+        mods |= MOD_BIT(KC_RIGHT_ALT);
+    }
+    sequence_queue_tap(keycode, mods);
+    if (PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code)) {
+        sequence_queue_tap(KC_SPACE, 0);
+    }
 }
 
-// clang-format on
+// Send the queued taps as a back-to-back report stream. The release of each
+// tap rides along in the same report as the next press, so the whole sequence
+// costs one report per tap instead of two; only a repeated keycode or a
+// modifier change needs a separating report so the host applies them in order.
+// Assumes the caller has already cleared the real mods (unicode_input_start).
+static void sequence_flush(void) {
+    uint8_t held = KC_NO;
+    uint8_t mods = 0;
+    for (uint8_t i = 0; i < sequence_length; i++) {
+        uint8_t keycode = sequence_keycodes[i];
+        if (held != KC_NO && (keycode == held || sequence_mods[i] != mods)) {
+            del_key(held);
+            send_keyboard_report();
+            held = KC_NO;
+        }
+        if (sequence_mods[i] != mods) {
+            mods = sequence_mods[i];
+            set_mods(mods);
+            send_keyboard_report();
+        }
+        if (held != KC_NO) {
+            del_key(held);
+        }
+        add_key(keycode);
+        send_keyboard_report();
+        held = keycode;
+    }
+    if (held != KC_NO) {
+        del_key(held);
+    }
+    if (mods != 0) {
+        set_mods(0);
+    }
+    send_keyboard_report();
+    sequence_length = 0;
+}
 
 void register_hex(uint16_t hex) {
     for (int i = 3; i >= 0; i--) {
         uint8_t digit = ((hex >> (i * 4)) & 0xF);
         send_nibble_wrapper(digit);
     }
+    sequence_flush();
 }
 
 void register_hex32(uint32_t hex) {
@@ -354,6 +422,7 @@ void register_hex32(uint32_t hex) {
             first_digit = false;
         }
     }
+    sequence_flush();
 }
 
 void register_unicode(uint32_t code_point) {
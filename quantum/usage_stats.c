@@ -0,0 +1,139 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <string.h>
+
+#include "usage_stats.h"
+#include "nvm_usage_stats.h"
+#include "timer.h"
+
+static usage_stats_t stats;
+static bool          dirty;
+static uint32_t      uptime_accounted_at;
+static uint32_t      flush_timer;
+static uint32_t      last_press_time;
+static bool          last_press_valid;
+
+// Fold the time elapsed since the last accrual into the cumulative uptime.
+// Done lazily (on read and on flush) rather than every scan, so sub-millisecond
+// housekeeping intervals don't truncate to zero and undercount.
+static void accrue_uptime(void) {
+    uint32_t now = timer_read32();
+    stats.uptime_ms += now - uptime_accounted_at;
+    uptime_accounted_at = now;
+}
+
+void usage_stats_init(void) {
+    if (!nvm_usage_stats_load(&stats)) {
+        memset(&stats, 0, sizeof(stats));
+    }
+    uptime_accounted_at = timer_read32();
+    flush_timer         = timer_read32();
+    dirty               = false;
+}
+
+void usage_stats_record_keypress(uint8_t row, uint8_t col) {
+    if (row >= MATRIX_ROWS || col >= MATRIX_COLS) {
+        return;
+    }
+    stats.keypress_counts[row][col]++;
+    stats.total_keypresses++;
+
+    // Bucket the time since the previous press as floor(log2(ms)); the first
+    // press after power-up has no predecessor and is not counted
+    uint32_t now = timer_read32();
+    if (last_press_valid) {
+        uint32_t interval = now - last_press_time;
+        uint8_t  bucket   = 0;
+        while (interval > 1 && bucket < (USAGE_STATS_INTERVAL_BUCKETS)-1) {
+            interval >>= 1;
+            bucket++;
+        }
+        stats.interval_histogram[bucket]++;
+    }
+    last_press_time  = now;
+    last_press_valid = true;
+
+    dirty = true;
+}
+
+uint32_t usage_stats_keypress_count(uint8_t row, uint8_t col) {
+    if (row >= MATRIX_ROWS || col >= MATRIX_COLS) {
+        return 0;
+    }
+    return stats.keypress_counts[row][col];
+}
+
+uint32_t usage_stats_total_keypresses(void) {
+    return stats.total_keypresses;
+}
+
+uint32_t usage_stats_uptime_ms(void) {
+    accrue_uptime();
+    return stats.uptime_ms;
+}
+
+uint32_t usage_stats_interval_bucket(uint8_t bucket) {
+    if (bucket >= (USAGE_STATS_INTERVAL_BUCKETS)) {
+        return 0;
+    }
+    return stats.interval_histogram[bucket];
+}
+
+static void write_u32_le(uint8_t *data, uint32_t value) {
+    data[0] = (uint8_t)(value & 0xFF);
+    data[1] = (uint8_t)((value >> 8) & 0xFF);
+    data[2] = (uint8_t)((value >> 16) & 0xFF);
+    data[3] = (uint8_t)((value >> 24) & 0xFF);
+}
+
+bool usage_stats_raw_hid_summary(uint8_t *data, uint8_t length) {
+    if (length < 8) {
+        return false;
+    }
+    accrue_uptime();
+    write_u32_le(&data[0], stats.uptime_ms);
+    write_u32_le(&data[4], stats.total_keypresses);
+    return true;
+}
+
+bool usage_stats_raw_hid_counts(uint16_t start, uint8_t *data, uint8_t length) {
+    const uint16_t total = MATRIX_ROWS * MATRIX_COLS;
+    if (start >= total || length < 3 + 4) {
+        return false;
+    }
+
+    uint8_t count = (length - 3) / 4;
+    if (count > total - start) {
+        count = total - start;
+    }
+
+    data[0] = (uint8_t)(start & 0xFF);
+    data[1] = (uint8_t)(start >> 8);
+    data[2] = count;
+    for (uint8_t i = 0; i < count; i++) {
+        uint16_t index = start + i;
+        write_u32_le(&data[3 + 4 * i], stats.keypress_counts[index / MATRIX_COLS][index % MATRIX_COLS]);
+    }
+    return true;
+}
+
+void usage_stats_flush(void) {
+    accrue_uptime();
+    nvm_usage_stats_save(&stats);
+    dirty       = false;
+    flush_timer = timer_read32();
+}
+
+void usage_stats_task(void) {
+    if (dirty && timer_elapsed32(flush_timer) >= (USAGE_STATS_FLUSH_INTERVAL_MS)) {
+        usage_stats_flush();
+    }
+}
+
+void usage_stats_reset(void) {
+    memset(&stats, 0, sizeof(stats));
+    uptime_accounted_at = timer_read32();
+    flush_timer         = timer_read32();
+    dirty               = false;
+    nvm_usage_stats_erase();
+}
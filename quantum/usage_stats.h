@@ -0,0 +1,69 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "matrix.h"
+
+// Persistent usage statistics: per-key actuation counts, total keypresses and
+// cumulative uptime, journaled to NVM at a low rate so that the counters
+// survive power loss. Counters accumulate in RAM and are written out at most
+// once per USAGE_STATS_FLUSH_INTERVAL_MS, and only when something changed, so
+// the write-cycle cost stays negligible.
+
+// How long counters may stay unflushed before being committed to NVM
+#ifndef USAGE_STATS_FLUSH_INTERVAL_MS
+#    define USAGE_STATS_FLUSH_INTERVAL_MS 600000 // 10 minutes
+#endif
+
+// Inter-press interval histogram buckets; bucket i counts intervals of
+// [2^i, 2^(i+1)) milliseconds, with the last bucket absorbing everything longer
+#ifndef USAGE_STATS_INTERVAL_BUCKETS
+#    define USAGE_STATS_INTERVAL_BUCKETS 16
+#endif
+
+typedef struct usage_stats_t {
+    uint32_t uptime_ms;        // cumulative powered-on time across sessions
+    uint32_t total_keypresses; // total number of key-down events
+    uint32_t keypress_counts[MATRIX_ROWS][MATRIX_COLS];
+    uint32_t interval_histogram[USAGE_STATS_INTERVAL_BUCKETS]; // log2-bucketed time between consecutive presses
+} usage_stats_t;
+
+// Load the most recent journal entry from NVM, zeroing the counters if none is valid
+void usage_stats_init(void);
+
+// Periodic processing: commits the counters to NVM once the flush interval has elapsed
+void usage_stats_task(void);
+
+// Record a key-down event at the given matrix position
+void usage_stats_record_keypress(uint8_t row, uint8_t col);
+
+// Number of key-down events recorded at the given matrix position
+uint32_t usage_stats_keypress_count(uint8_t row, uint8_t col);
+
+// Total number of key-down events recorded
+uint32_t usage_stats_total_keypresses(void);
+
+// Cumulative powered-on time across sessions, in milliseconds
+uint32_t usage_stats_uptime_ms(void);
+
+// Number of inter-press intervals recorded in the given histogram bucket
+uint32_t usage_stats_interval_bucket(uint8_t bucket);
+
+// Serialize a summary (uptime u32, total keypresses u32, little-endian) into
+// `data`; returns false if `length` is under 8 bytes
+bool usage_stats_raw_hid_summary(uint8_t *data, uint8_t length);
+
+// Serialize a chunk of per-key counts for raw HID export. Keys are indexed
+// flat (row * MATRIX_COLS + col) starting at `start`; the layout is start
+// index (u16 LE), entry count (u8), then that many u32 LE counters. Returns
+// false if `start` is out of range or `length` cannot fit a single entry.
+bool usage_stats_raw_hid_counts(uint16_t start, uint8_t *data, uint8_t length);
+
+// Immediately commit the counters to NVM
+void usage_stats_flush(void);
+
+// Zero all counters and erase the NVM journal
+void usage_stats_reset(void);
@@ -17,107 +17,205 @@
 #include "variable_trace.h"
 #include <stddef.h>
 #include <string.h>
+#include "basic_profiling.h" // for TIMESTAMP_GETTER
+#include "debug.h"
 
-#ifdef NO_PRINT
-#    error "You need undef NO_PRINT to use the variable trace feature"
+#ifdef RAW_HID_CHANNELS_ENABLE
+#    include "raw_hid_channels.h"
 #endif
 
-#ifndef CONSOLE_ENABLE
-#    error "The console needs to be enabled in the makefile to use the variable trace feature"
-#endif
-
-#define NUM_TRACED_VARIABLES 1
-#ifndef MAX_VARIABLE_TRACE_SIZE
-#    define MAX_VARIABLE_TRACE_SIZE 4
+#ifndef NUM_TRACED_VARIABLES
+#    define NUM_TRACED_VARIABLES 1
 #endif
 
 typedef struct {
     const char* name;
     void*       addr;
-    unsigned    size;
-    const char* func;
-    int         line;
+    uint8_t     size;
     uint8_t     last_value[MAX_VARIABLE_TRACE_SIZE];
-
 } traced_variable_t;
 
 static traced_variable_t traced_variables[NUM_TRACED_VARIABLES];
 
-void add_traced_variable(const char* name, void* addr, unsigned size, const char* func, int line) {
-    verify_traced_variables(func, line);
+static variable_trace_record_t records[VARIABLE_TRACE_RING_SIZE];
+static uint16_t                record_head; // next slot to write
+static uint16_t                record_count;
+static uint16_t                record_overwritten;
+
+static void capture_change(uint8_t id, traced_variable_t* t) {
+    variable_trace_record_t* r = &records[record_head];
+    r->id                      = id;
+    r->size                    = t->size;
+    r->timestamp               = (uint32_t)TIMESTAMP_GETTER;
+    memcpy(r->value, t->addr, t->size);
+    memcpy(t->last_value, t->addr, t->size);
+    record_head = (uint16_t)((record_head + 1) % VARIABLE_TRACE_RING_SIZE);
+    if (record_count < VARIABLE_TRACE_RING_SIZE) {
+        record_count++;
+    } else {
+        record_overwritten++;
+    }
+}
+
+void add_traced_variable(const char* name, void* addr, unsigned size) {
     if (size > MAX_VARIABLE_TRACE_SIZE) {
-#if defined(__AVR__)
-        xprintf("Traced variable \"%S\" exceeds the maximum size %d\n", name, size);
-#else
-        xprintf("Traced variable \"%s\" exceeds the maximum size %d\n", name, size);
-#endif
+        dprintf("Traced variable truncated to %d bytes\n", MAX_VARIABLE_TRACE_SIZE);
         size = MAX_VARIABLE_TRACE_SIZE;
     }
     int index = -1;
     for (int i = 0; i < NUM_TRACED_VARIABLES; i++) {
         if (index == -1 && traced_variables[i].addr == NULL) {
             index = i;
-        } else if (strcmp_P(name, traced_variables[i].name) == 0) {
+        } else if (traced_variables[i].name != NULL && strcmp_P(name, traced_variables[i].name) == 0) {
             index = i;
             break;
         }
     }
 
     if (index == -1) {
-        xprintf("You can only trace %d variables at the same time\n", NUM_TRACED_VARIABLES);
+        dprintf("You can only trace %d variables at the same time\n", NUM_TRACED_VARIABLES);
         return;
     }
 
     traced_variable_t* t = &traced_variables[index];
     t->name              = name;
     t->addr              = addr;
-    t->size              = size;
-    t->func              = func;
-    t->line              = line;
+    t->size              = (uint8_t)size;
     memcpy(&t->last_value[0], addr, size);
 }
 
-void remove_traced_variable(const char* name, const char* func, int line) {
-    verify_traced_variables(func, line);
+void remove_traced_variable(const char* name) {
     for (int i = 0; i < NUM_TRACED_VARIABLES; i++) {
-        if (strcmp_P(name, traced_variables[i].name) == 0) {
-            traced_variables[i].name = 0;
+        if (traced_variables[i].name != NULL && strcmp_P(name, traced_variables[i].name) == 0) {
+            traced_variables[i].name = NULL;
             traced_variables[i].addr = NULL;
             break;
         }
     }
 }
 
-void verify_traced_variables(const char* func, int line) {
+void verify_traced_variables(void) {
     for (int i = 0; i < NUM_TRACED_VARIABLES; i++) {
         traced_variable_t* t = &traced_variables[i];
-        if (t->addr != NULL && t->name != NULL) {
-            if (memcmp(t->last_value, t->addr, t->size) != 0) {
-#if defined(__AVR__)
-                xprintf("Traced variable \"%S\" has been modified\n", t->name);
-                xprintf("Between %S:%d\n", t->func, t->line);
-                xprintf("And %S:%d\n", func, line);
+        if (t->addr != NULL && t->name != NULL && memcmp(t->last_value, t->addr, t->size) != 0) {
+            capture_change((uint8_t)i, t);
+        }
+    }
+}
 
-#else
-                xprintf("Traced variable \"%s\" has been modified\n", t->name);
-                xprintf("Between %s:%d\n", t->func, t->line);
-                xprintf("And %s:%d\n", func, line);
-#endif
-                xprintf("Previous value ");
-                for (int j = 0; j < t->size; j++) {
-                    print_hex8(t->last_value[j]);
-                }
-                xprintf("\nNew value ");
-                uint8_t* addr = (uint8_t*)(t->addr);
-                for (int j = 0; j < t->size; j++) {
-                    print_hex8(addr[j]);
+bool variable_trace_get(uint16_t index, variable_trace_record_t* record) {
+    if (index >= record_count) {
+        return false;
+    }
+    uint16_t slot = (uint16_t)((record_head + VARIABLE_TRACE_RING_SIZE - record_count + index) % VARIABLE_TRACE_RING_SIZE);
+    *record       = records[slot];
+    return true;
+}
+
+uint16_t variable_trace_count(void) {
+    return record_count;
+}
+
+uint16_t variable_trace_overwritten(void) {
+    return record_overwritten;
+}
+
+void variable_trace_reset(void) {
+    record_head        = 0;
+    record_count       = 0;
+    record_overwritten = 0;
+}
+
+void variable_trace_dump(void) {
+    variable_trace_record_t record;
+    for (uint16_t i = 0; variable_trace_get(i, &record); i++) {
+        dprintf("%u: id=%u t=%lu value=", i, record.id, (unsigned long)record.timestamp);
+        for (uint8_t j = 0; j < record.size; j++) {
+            dprintf("%02X", record.value[j]);
+        }
+        dprintf("\n");
+    }
+    dprintf("%u records, %u overwritten\n", record_count, record_overwritten);
+}
+
+#ifdef RAW_HID_CHANNELS_ENABLE
+
+// Wire format of one dumped record: id, size, timestamp (little endian),
+// MAX_VARIABLE_TRACE_SIZE value bytes. Two fit a report after the 6-byte
+// response header with the default 4-byte value size.
+#    define TRACE_WIRE_RECORD_SIZE (6 + MAX_VARIABLE_TRACE_SIZE)
+#    define TRACE_RECORDS_PER_REPORT ((RAW_HID_CHANNEL_PAYLOAD_SIZE - 6) / TRACE_WIRE_RECORD_SIZE)
+
+static uint16_t read_le16(const uint8_t* data) {
+    return (uint16_t)((uint16_t)data[0] | ((uint16_t)data[1] << 8));
+}
+
+static void write_le16(uint8_t* data, uint16_t value) {
+    data[0] = (uint8_t)(value >> 0);
+    data[1] = (uint8_t)(value >> 8);
+}
+
+static void trace_handler(uint8_t channel, const uint8_t* data, uint8_t length) {
+    (void)channel;
+    (void)length;
+
+    uint8_t cmd = data[0];
+    switch (cmd) {
+        case VARIABLE_TRACE_CMD_DUMP: {
+            // [cmd, returned, total le16, overwritten le16, records...];
+            // the host walks the ring by advancing its start index until
+            // returned comes back 0
+            uint16_t start                                                           = read_le16(&data[1]);
+            uint8_t  response[6 + TRACE_RECORDS_PER_REPORT * TRACE_WIRE_RECORD_SIZE] = {cmd};
+            write_le16(&response[2], record_count);
+            write_le16(&response[4], record_overwritten);
+            uint8_t                 returned = 0;
+            variable_trace_record_t record;
+            while (returned < TRACE_RECORDS_PER_REPORT && variable_trace_get(start + returned, &record)) {
+                uint8_t* out = &response[6 + returned * TRACE_WIRE_RECORD_SIZE];
+                out[0]       = record.id;
+                out[1]       = record.size;
+                out[2]       = (uint8_t)(record.timestamp >> 0);
+                out[3]       = (uint8_t)(record.timestamp >> 8);
+                out[4]       = (uint8_t)(record.timestamp >> 16);
+                out[5]       = (uint8_t)(record.timestamp >> 24);
+                memcpy(&out[6], record.value, MAX_VARIABLE_TRACE_SIZE);
+                returned++;
+            }
+            response[1] = returned;
+            raw_hid_channel_send(VARIABLE_TRACE_CHANNEL, response, (uint8_t)(6 + returned * TRACE_WIRE_RECORD_SIZE));
+        } break;
+
+        case VARIABLE_TRACE_CMD_LIST: {
+            // [cmd, id, size, name...] - size 0 marks an empty or invalid slot
+            uint8_t id                                     = data[1];
+            uint8_t response[RAW_HID_CHANNEL_PAYLOAD_SIZE] = {cmd, id};
+            if (id < NUM_TRACED_VARIABLES && traced_variables[id].name != NULL) {
+                response[2] = traced_variables[id].size;
+                for (uint8_t i = 0; i < RAW_HID_CHANNEL_PAYLOAD_SIZE - 4; i++) {
+                    response[3 + i] = pgm_read_byte(&traced_variables[id].name[i]);
+                    if (response[3 + i] == '\0') {
+                        break;
+                    }
                 }
-                xprintf("\n");
-                memcpy(t->last_value, addr, t->size);
             }
-        }
+            raw_hid_channel_send(VARIABLE_TRACE_CHANNEL, response, sizeof(response));
+        } break;
 
-        t->func = func;
-        t->line = line;
+        case VARIABLE_TRACE_CMD_RESET: {
+            variable_trace_reset();
+            uint8_t response[1] = {cmd};
+            raw_hid_channel_send(VARIABLE_TRACE_CHANNEL, response, sizeof(response));
+        } break;
     }
 }
+
+void variable_trace_init(void) {
+    raw_hid_channel_register(VARIABLE_TRACE_CHANNEL, trace_handler, VARIABLE_TRACE_CHANNEL_PRIORITY);
+}
+
+#else
+
+void variable_trace_init(void) {}
+
+#endif // RAW_HID_CHANNELS_ENABLE
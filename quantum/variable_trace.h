@@ -18,20 +18,60 @@
 
 // For more information about the variable tracing see the readme.
 
-#include "print.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include "progmem.h"
+
+// Changes to watched variables are captured as binary records - variable id,
+// raw timestamp-counter ticks, new value - into a ring overwritten oldest
+// first, instead of being printed as they happen. Capture is a memcmp plus a
+// memcpy per watched variable, cheap enough to leave enabled in the field;
+// the ring is pulled in bulk over raw HID (or dumped to the console) on
+// demand.
+
+// Value bytes captured per change record
+#ifndef MAX_VARIABLE_TRACE_SIZE
+#    define MAX_VARIABLE_TRACE_SIZE 4
+#endif
+
+// Change records held before the oldest is overwritten
+#ifndef VARIABLE_TRACE_RING_SIZE
+#    define VARIABLE_TRACE_RING_SIZE 64
+#endif
+
+// Raw HID channel the trace log is pulled over, when channels are enabled
+#ifndef VARIABLE_TRACE_CHANNEL
+#    define VARIABLE_TRACE_CHANNEL 2
+#endif
+#ifndef VARIABLE_TRACE_CHANNEL_PRIORITY
+#    define VARIABLE_TRACE_CHANNEL_PRIORITY 210
+#endif
+
+// Host commands, first payload byte of a request on the channel
+#define VARIABLE_TRACE_CMD_DUMP 0x01  // [start index le16] -> records, oldest first
+#define VARIABLE_TRACE_CMD_LIST 0x02  // [slot id] -> id, size, name of the watched slot
+#define VARIABLE_TRACE_CMD_RESET 0x03 // drop the ring and the overwrite counter
+
+// One captured change of a watched variable
+typedef struct variable_trace_record_t {
+    uint8_t  id;        // slot index of the watched variable
+    uint8_t  size;      // valid bytes in value[]
+    uint32_t timestamp; // raw timestamp-counter ticks at capture
+    uint8_t  value[MAX_VARIABLE_TRACE_SIZE];
+} variable_trace_record_t;
 
 #ifdef NUM_TRACED_VARIABLES
 
 // Start tracing a variable at the memory address addr
 // The name can be anything and is used only for reporting
 // The size should usually be the same size as the variable you are interested in
-#    define ADD_TRACED_VARIABLE(name, addr, size) add_traced_variable(PSTR(name), (void*)addr, size, PSTR(__FILE__), __LINE__)
+#    define ADD_TRACED_VARIABLE(name, addr, size) add_traced_variable(PSTR(name), (void*)addr, size)
 
 // Stop tracing the variable with the given name
-#    define REMOVE_TRACED_VARIABLE(name) remove_traced_variable(PSTR(name), PSTR(__FILE__), __LINE__)
+#    define REMOVE_TRACED_VARIABLE(name) remove_traced_variable(PSTR(name))
 
-// Call to get messages when the variable has been changed
-#    define VERIFY_TRACED_VARIABLES() verify_traced_variables(PSTR(__FILE__), __LINE__)
+// Call to capture changes to watched variables into the ring
+#    define VERIFY_TRACED_VARIABLES() verify_traced_variables()
 
 #else
 
@@ -42,6 +82,20 @@
 #endif
 
 // Don't call directly, use the macros instead
-void add_traced_variable(const char* name, void* addr, unsigned size, const char* func, int line);
-void remove_traced_variable(const char* name, const char* func, int line);
-void verify_traced_variables(const char* func, int line);
+void add_traced_variable(const char* name, void* addr, unsigned size);
+void remove_traced_variable(const char* name);
+void verify_traced_variables(void);
+
+// Registers the raw HID channel; no-op without RAW_HID_CHANNELS_ENABLE
+void variable_trace_init(void);
+
+// Oldest-first read-out of the change ring; returns false past the end
+bool variable_trace_get(uint16_t index, variable_trace_record_t* record);
+// Records currently held in the ring
+uint16_t variable_trace_count(void);
+// Changes lost to ring overwrites since the last reset
+uint16_t variable_trace_overwritten(void);
+// Drop all captured records and the overwrite counter
+void variable_trace_reset(void);
+// Dump the ring through the console, oldest first
+void variable_trace_dump(void);
@@ -28,6 +28,7 @@
 
 #include "via.h"
 
+#include <string.h>
 #include "raw_hid.h"
 #include "dynamic_keymap.h"
 #include "eeconfig.h"
@@ -37,6 +38,14 @@
 #include "version.h" // for QMK_BUILDDATE used in EEPROM magic
 #include "nvm_via.h"
 
+#ifdef NVM_STATS_ENABLE
+#    include "nvm_stats.h"
+#endif // NVM_STATS_ENABLE
+
+#ifdef USAGE_STATS_ENABLE
+#    include "usage_stats.h"
+#endif // USAGE_STATS_ENABLE
+
 #if defined(SECURE_ENABLE)
 #    include "secure.h"
 #endif
@@ -287,6 +296,20 @@ __attribute__((weak)) bool via_command_kb(uint8_t *data, uint8_t length) {
     return false;
 }
 
+// State for bulk keymap buffer transactions. The host streams sequence-tagged
+// chunks into the staging buffer and the keymap is only touched on commit, so
+// a multi-report update lands as one dynamic_keymap_set_buffer() call instead
+// of one nvm write burst per report. Any sequencing error aborts the
+// transaction without modifying the keymap.
+static struct {
+    uint16_t offset;
+    uint16_t total_size;
+    uint16_t received;
+    uint8_t  next_seq;
+    bool     active;
+    uint8_t  buffer[VIA_BULK_TRANSFER_BUFFER_SIZE];
+} via_bulk_transaction;
+
 void raw_hid_receive(uint8_t *data, uint8_t length) {
     uint8_t *command_id   = &(data[0]);
     uint8_t *command_data = &(data[1]);
@@ -357,6 +380,56 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
                     command_data[4] = value & 0xFF;
                     break;
                 }
+#ifdef NVM_STATS_ENABLE
+                case id_nvm_stats: {
+                    // Queried one domain at a time: command_data[1] holds the
+                    // requested nvm_stats_domain_t index, the response carries
+                    // the domain count followed by read count, write count and
+                    // cumulative stall time in microseconds
+                    nvm_stats_t stats;
+                    nvm_stats_get((nvm_stats_domain_t)command_data[1], &stats);
+                    command_data[2]  = NVM_STATS_DOMAIN_COUNT;
+                    command_data[3]  = (stats.read_count >> 24) & 0xFF;
+                    command_data[4]  = (stats.read_count >> 16) & 0xFF;
+                    command_data[5]  = (stats.read_count >> 8) & 0xFF;
+                    command_data[6]  = stats.read_count & 0xFF;
+                    command_data[7]  = (stats.write_count >> 24) & 0xFF;
+                    command_data[8]  = (stats.write_count >> 16) & 0xFF;
+                    command_data[9]  = (stats.write_count >> 8) & 0xFF;
+                    command_data[10] = stats.write_count & 0xFF;
+                    command_data[11] = (stats.stall_us >> 24) & 0xFF;
+                    command_data[12] = (stats.stall_us >> 16) & 0xFF;
+                    command_data[13] = (stats.stall_us >> 8) & 0xFF;
+                    command_data[14] = stats.stall_us & 0xFF;
+                    break;
+                }
+#endif // NVM_STATS_ENABLE
+#ifdef USAGE_STATS_ENABLE
+                case id_usage_stats: {
+                    // command_data[1] == 0 queries the session summary,
+                    // command_data[1] == 1 queries the actuation count for the
+                    // matrix position in command_data[2] / command_data[3]
+                    if (command_data[1] == 0) {
+                        uint32_t total  = usage_stats_total_keypresses();
+                        uint32_t uptime = usage_stats_uptime_ms();
+                        command_data[2] = (total >> 24) & 0xFF;
+                        command_data[3] = (total >> 16) & 0xFF;
+                        command_data[4] = (total >> 8) & 0xFF;
+                        command_data[5] = total & 0xFF;
+                        command_data[6] = (uptime >> 24) & 0xFF;
+                        command_data[7] = (uptime >> 16) & 0xFF;
+                        command_data[8] = (uptime >> 8) & 0xFF;
+                        command_data[9] = uptime & 0xFF;
+                    } else {
+                        uint32_t count  = usage_stats_keypress_count(command_data[2], command_data[3]);
+                        command_data[4] = (count >> 24) & 0xFF;
+                        command_data[5] = (count >> 16) & 0xFF;
+                        command_data[6] = (count >> 8) & 0xFF;
+                        command_data[7] = count & 0xFF;
+                    }
+                    break;
+                }
+#endif // USAGE_STATS_ENABLE
                 default: {
                     // The value ID is not known
                     // Return the unhandled state
@@ -378,6 +451,18 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
                     via_set_device_indication(value);
                     break;
                 }
+#ifdef NVM_STATS_ENABLE
+                case id_nvm_stats: {
+                    nvm_stats_reset();
+                    break;
+                }
+#endif // NVM_STATS_ENABLE
+#ifdef USAGE_STATS_ENABLE
+                case id_usage_stats: {
+                    usage_stats_reset();
+                    break;
+                }
+#endif // USAGE_STATS_ENABLE
                 default: {
                     // The value ID is not known
                     // Return the unhandled state
@@ -456,6 +541,46 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
             dynamic_keymap_set_buffer(offset, size, &command_data[3]);
             break;
         }
+        case id_dynamic_keymap_set_buffer_begin: {
+            uint16_t offset = (command_data[0] << 8) | command_data[1];
+            uint16_t size   = (command_data[2] << 8) | command_data[3];
+            if (size == 0 || size > VIA_BULK_TRANSFER_BUFFER_SIZE) {
+                // Too large to stage; host should fall back to id_dynamic_keymap_set_buffer
+                via_bulk_transaction.active = false;
+                *command_id                 = id_unhandled;
+                break;
+            }
+            via_bulk_transaction.offset     = offset;
+            via_bulk_transaction.total_size = size;
+            via_bulk_transaction.received   = 0;
+            via_bulk_transaction.next_seq   = 0;
+            via_bulk_transaction.active     = true;
+            break;
+        }
+        case id_dynamic_keymap_set_buffer_continue: {
+            uint8_t seq  = command_data[0];
+            uint8_t size = command_data[1]; // size <= 26
+            if (!via_bulk_transaction.active || seq != via_bulk_transaction.next_seq || size > length - 3 || via_bulk_transaction.received + size > via_bulk_transaction.total_size) {
+                // Out-of-sequence or oversized chunk; abort without touching the keymap
+                via_bulk_transaction.active = false;
+                *command_id                 = id_unhandled;
+                break;
+            }
+            memcpy(&via_bulk_transaction.buffer[via_bulk_transaction.received], &command_data[2], size);
+            via_bulk_transaction.received += size;
+            via_bulk_transaction.next_seq++;
+            break;
+        }
+        case id_dynamic_keymap_set_buffer_commit: {
+            if (!via_bulk_transaction.active || via_bulk_transaction.received != via_bulk_transaction.total_size) {
+                via_bulk_transaction.active = false;
+                *command_id                 = id_unhandled;
+                break;
+            }
+            dynamic_keymap_set_buffer(via_bulk_transaction.offset, via_bulk_transaction.total_size, via_bulk_transaction.buffer);
+            via_bulk_transaction.active = false;
+            break;
+        }
 #ifdef ENCODER_MAP_ENABLE
         case id_dynamic_keymap_get_encoder: {
             uint16_t keycode = dynamic_keymap_get_encoder(command_data[0], command_data[1], command_data[2] != 0);
@@ -37,6 +37,14 @@
 #    define VIA_EEPROM_CUSTOM_CONFIG_SIZE 0
 #endif
 
+// Staging area for bulk keymap buffer transactions
+// (id_dynamic_keymap_set_buffer_begin/continue/commit). Hosts requesting a
+// transaction larger than this receive id_unhandled and are expected to fall
+// back to per-report id_dynamic_keymap_set_buffer writes.
+#ifndef VIA_BULK_TRANSFER_BUFFER_SIZE
+#    define VIA_BULK_TRANSFER_BUFFER_SIZE 128
+#endif
+
 // This is changed only when the command IDs change,
 // so VIA Configurator can detect compatible firmware.
 #define VIA_PROTOCOL_VERSION 0x000C
@@ -73,6 +81,9 @@ enum via_command_id {
     id_dynamic_keymap_set_buffer            = 0x13,
     id_dynamic_keymap_get_encoder           = 0x14,
     id_dynamic_keymap_set_encoder           = 0x15,
+    id_dynamic_keymap_set_buffer_begin      = 0x16,
+    id_dynamic_keymap_set_buffer_continue   = 0x17,
+    id_dynamic_keymap_set_buffer_commit     = 0x18,
     id_unhandled                            = 0xFF,
 };
 
@@ -82,6 +93,8 @@ enum via_keyboard_value_id {
     id_switch_matrix_state = 0x03,
     id_firmware_version    = 0x04,
     id_device_indication   = 0x05,
+    id_nvm_stats           = 0x06,
+    id_usage_stats         = 0x07,
 };
 
 enum via_channel_id {
@@ -7,3 +7,8 @@ void virtser_recv(const uint8_t ch);
 
 /* Call this to send a character over the Virtual Serial Device */
 void virtser_send(const uint8_t byte);
+
+/* Call this to send a whole buffer over the Virtual Serial Device in one
+ * batch; cheaper than sending the bytes individually on transports that
+ * flush per write */
+void virtser_send_buffer(const uint8_t *data, uint16_t length);
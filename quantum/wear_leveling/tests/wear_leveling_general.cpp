@@ -202,3 +202,43 @@ TEST_F(WearLevelingGeneral, WriteFailure_NoSubsequentWrites) {
     wear_leveling_read(0x04, &test_val, sizeof(test_val));
     EXPECT_EQ(test_val, 0x14) << "Readback should come from cache regardless of unlock failure";
 }
+
+/**
+ * This test verifies that `wear_leveling_task()` leaves the backing store untouched while the write log still has
+ * headroom, and performs the pending consolidation once fewer than WEAR_LEVELING_CONSOLIDATION_HEADROOM bytes remain.
+ */
+TEST_F(WearLevelingGeneral, BackgroundConsolidation) {
+    auto& inst = MockBackingStore::Instance();
+
+    // The write log spans 24 bytes (backing size minus logical size and hash), i.e. 12 two-byte entries. With the
+    // default headroom of 1/8th of the backing size (6 bytes), the task should only consolidate once 9 or more
+    // entries are occupied.
+    std::array<std::uint8_t, 9> testvalue;
+    std::iota(testvalue.begin(), testvalue.end(), 0x30);
+
+    // Fill 8 entries; the task should not touch the backing store yet
+    for (std::size_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(wear_leveling_write(i, &testvalue[i], 1), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task should have been a no-op";
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Erase should not have been invoked";
+
+    // The 9th entry crosses the headroom threshold; the next task invocation should consolidate
+    EXPECT_EQ(wear_leveling_write(8, &testvalue[8], 1), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_CONSOLIDATED) << "Task should have consolidated";
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "Erase should have been invoked once";
+
+    // The log is now empty again
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task should have been a no-op";
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "Erase should not have been invoked again";
+
+    // Verify the data is what we expected
+    std::array<std::uint8_t, 9> readback;
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read back the saved data";
+    EXPECT_TRUE(memcmp(readback.data(), testvalue.data(), testvalue.size()) == 0) << "Readback did not match";
+
+    // Re-init and re-read, verifying the reload capability
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read back the saved data";
+    EXPECT_TRUE(memcmp(readback.data(), testvalue.data(), testvalue.size()) == 0) << "Readback did not match";
+}
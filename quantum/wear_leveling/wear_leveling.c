@@ -62,6 +62,11 @@
             to other subsystems performing reads/writes. This must be a multiple
             of the write size.
 
+        - WEAR_LEVELING_CONSOLIDATION_HEADROOM: The number of bytes of write
+            log remaining below which wear_leveling_task() preemptively
+            consolidates, so that the erase-and-rewrite cycle happens while
+            idle rather than synchronously inside a write.
+
     General algorithm:
 
         During initialization:
@@ -744,6 +749,37 @@ wear_leveling_status_t wear_leveling_read(const uint32_t address, void *value, s
     return WEAR_LEVELING_SUCCESS;
 }
 
+/**
+ * Background consolidation of the write log.
+ * Consolidation erases the backing store and rewrites the full logical data, which can stall the caller
+ * for multiple milliseconds on flash-backed stores -- invoking this while idle moves that stall out of
+ * whichever write would otherwise have filled the log.
+ */
+wear_leveling_status_t wear_leveling_task(void) {
+    // Nothing to do until the write log's remaining headroom drops below the consolidation threshold
+    if (wear_leveling.write_address + (WEAR_LEVELING_CONSOLIDATION_HEADROOM) < (WEAR_LEVELING_BACKING_SIZE)) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status = wear_leveling_consolidate_force();
+
+    // Lock the backing store if we acquired the lock successfully
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+}
+
 /**
  * Weak implementation of bulk read, drivers can implement more optimised implementations.
  */
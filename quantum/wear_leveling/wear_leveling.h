@@ -52,3 +52,13 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Background maintenance, intended to be invoked while the keyboard is otherwise idle.
+ *
+ * If the write log's remaining headroom has dropped below WEAR_LEVELING_CONSOLIDATION_HEADROOM, the
+ * pending consolidation is performed now instead of synchronously inside a later write.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_task(void);
@@ -59,10 +59,17 @@ typedef uint64_t backing_store_int_t;
         } while (0)
 #endif // WEAR_LEVELING_ASSERTS
 
+// Remaining write log headroom (in bytes) below which wear_leveling_task()
+// performs a preemptive consolidation.
+#ifndef WEAR_LEVELING_CONSOLIDATION_HEADROOM
+#    define WEAR_LEVELING_CONSOLIDATION_HEADROOM ((WEAR_LEVELING_BACKING_SIZE) / 8)
+#endif
+
 // Compile-time validation of configurable options
 STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Total backing size must be at least twice the size of the logical size");
 STATIC_ASSERT(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
+STATIC_ASSERT(WEAR_LEVELING_CONSOLIDATION_HEADROOM < (WEAR_LEVELING_BACKING_SIZE) - (WEAR_LEVELING_LOGICAL_SIZE)-8, "Consolidation headroom must be smaller than the write log");
 
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
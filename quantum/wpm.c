@@ -21,6 +21,7 @@
 #include "quantum_keycodes.h"
 #include "action_util.h"
 #include <math.h>
+#include <string.h>
 
 // WPM Stuff
 static uint8_t  current_wpm = 0;
@@ -42,6 +43,14 @@ static int16_t period_presses[MAX_PERIODS] = {0};
 static uint8_t current_period              = 0;
 static uint8_t periods                     = 1;
 
+/* Sum over the whole ring, maintained incrementally as keypresses arrive and
+ * buckets are retired, so decay_wpm() does not rescan the buffer every call. */
+static int32_t window_presses = 0;
+
+/* Last value handed to wpm_changed_kb(), so the callback only fires when the
+ * integer WPM actually changes. */
+static uint8_t last_reported_wpm = 0;
+
 #if !defined(WPM_UNFILTERED)
 /* LATENCY is used as part of filtering, and controls how quickly the reported
  * WPM trails behind our actual instantaneous measured WPM value, and is
@@ -58,8 +67,23 @@ static uint8_t  prev_wpm        = 0;
 static uint8_t  next_wpm        = 0;
 #endif
 
+__attribute__((weak)) void wpm_changed_user(uint8_t wpm) {}
+
+__attribute__((weak)) void wpm_changed_kb(uint8_t wpm) {
+    wpm_changed_user(wpm);
+}
+
+/* notify consumers, but only when the integer WPM value moved */
+static void report_wpm(void) {
+    if (current_wpm != last_reported_wpm) {
+        last_reported_wpm = current_wpm;
+        wpm_changed_kb(current_wpm);
+    }
+}
+
 void set_current_wpm(uint8_t new_wpm) {
     current_wpm = new_wpm;
+    report_wpm();
 }
 uint8_t get_current_wpm(void) {
     return current_wpm;
@@ -112,40 +136,46 @@ __attribute__((weak)) uint8_t wpm_regress_count(uint16_t keycode) {
 void update_wpm(uint16_t keycode) {
     if (wpm_keycode(keycode) && period_presses[current_period] < INT16_MAX) {
         period_presses[current_period]++;
+        window_presses++;
     }
 #if defined(WPM_ALLOW_COUNT_REGRESSION)
     uint8_t regress = wpm_regress_count(keycode);
     if (regress && period_presses[current_period] > INT16_MIN) {
         period_presses[current_period]--;
+        window_presses--;
     }
 #endif
 }
 
-void decay_wpm(void) {
-    int32_t presses = period_presses[0];
-    for (int i = 1; i <= periods; i++) {
-        presses += period_presses[i];
-    }
-    if (presses < 0) {
-        presses = 0;
-    }
-    int32_t  elapsed  = timer_elapsed32(wpm_timer);
+/* instantaneous WPM over the sample window */
+static int32_t calc_wpm(int32_t presses, int32_t elapsed) {
     uint32_t duration = (((periods)*PERIOD_DURATION) + elapsed);
     int32_t  wpm_now  = (60000 * presses) / (duration * WPM_ESTIMATED_WORD_SIZE);
 
     if (wpm_now < 0) // set some reasonable WPM measurement limits
         wpm_now = 0;
     if (wpm_now > 240) wpm_now = 240;
+    if (presses < 2) // don't guess high WPM based on a single keypress.
+        wpm_now = 0;
+    return wpm_now;
+}
+
+void decay_wpm(void) {
+    int32_t presses = window_presses;
+    if (presses < 0) {
+        presses = 0;
+    }
+    int32_t elapsed = timer_elapsed32(wpm_timer);
 
     if (elapsed > PERIOD_DURATION) {
-        current_period                 = (current_period + 1) % MAX_PERIODS;
+        // retire the oldest bucket from the running sum before reusing it
+        current_period = (current_period + 1) % MAX_PERIODS;
+        window_presses -= period_presses[current_period];
         period_presses[current_period] = 0;
         periods                        = (periods < MAX_PERIODS - 1) ? periods + 1 : MAX_PERIODS - 1;
         elapsed                        = 0;
         wpm_timer                      = timer_read32();
     }
-    if (presses < 2) // don't guess high WPM based on a single keypress.
-        wpm_now = 0;
 
 #if defined(WPM_LAUNCH_CONTROL)
     /*
@@ -156,23 +186,26 @@ void decay_wpm(void) {
      * has been filled.
      */
     if (presses == 0) {
-        current_period    = 0;
-        periods           = 0;
-        wpm_now           = 0;
-        period_presses[0] = 0;
+        current_period = 0;
+        periods        = 0;
+        memset(period_presses, 0, sizeof(period_presses));
+        window_presses = 0;
     }
 #endif // WPM_LAUNCH_CONTROL
 
 #if defined(WPM_UNFILTERED)
-    current_wpm = wpm_now;
+    current_wpm = calc_wpm(presses, elapsed);
 #else
     int32_t latency = timer_elapsed32(smoothing_timer);
     if (latency > LATENCY) {
+        // the instantaneous value is only sampled once per LATENCY window, so
+        // this is the only place the division runs in filtered mode
         smoothing_timer = timer_read32();
         prev_wpm        = current_wpm;
-        next_wpm        = wpm_now;
+        next_wpm        = calc_wpm(presses, elapsed);
     }
 
     current_wpm = prev_wpm + (latency * ((int)next_wpm - (int)prev_wpm) / LATENCY);
 #endif
+    report_wpm();
 }
@@ -43,3 +43,8 @@ uint8_t get_current_wpm(void);
 void    update_wpm(uint16_t);
 
 void decay_wpm(void);
+
+/* called only when the integer WPM value changes, so consumers such as OLED
+ * rendering can redraw on change instead of polling every scan */
+void wpm_changed_kb(uint8_t wpm);
+void wpm_changed_user(uint8_t wpm);
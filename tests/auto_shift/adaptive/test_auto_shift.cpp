@@ -0,0 +1,78 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+extern "C" void autoshift_adaptive_reset(void);
+
+class AdaptiveAutoShift : public TestFixture {
+    void SetUp() override {
+        TestFixture::SetUp();
+        autoshift_adaptive_reset();
+    }
+};
+
+TEST_F(AdaptiveAutoShift, configured_timeout_applies_before_any_samples) {
+    TestDriver driver;
+    InSequence s;
+    auto       regular_key = KeymapKey(0, 2, 0, KC_A);
+
+    set_keymap({regular_key});
+
+    /* Hold well past what an adapted timeout could be, but short of the
+     * configured one; with no tap samples yet this must stay a tap. */
+    EXPECT_NO_REPORT(driver);
+    regular_key.press();
+    idle_for(120);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    regular_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(AdaptiveAutoShift, fast_taps_lower_the_timeout) {
+    TestDriver driver;
+    InSequence s;
+    auto       regular_key = KeymapKey(0, 2, 0, KC_A);
+
+    set_keymap({regular_key});
+
+    /* Seed the per-key statistics with fast ~60ms taps. */
+    for (int i = 0; i < 3; i++) {
+        EXPECT_NO_REPORT(driver);
+        regular_key.press();
+        idle_for(60);
+        VERIFY_AND_CLEAR(driver);
+
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+        regular_key.release();
+        run_one_scan_loop();
+        VERIFY_AND_CLEAR(driver);
+    }
+
+    /* The adapted timeout is now roughly 1.5x the tap average (~90ms), so a
+     * hold well below AUTO_SHIFT_TIMEOUT resolves as shifted mid-hold. */
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    regular_key.press();
+    idle_for(120);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The release has nothing left to report. */
+    EXPECT_NO_REPORT(driver);
+    regular_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,79 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class CoalescedReports : public TestFixture {};
+
+TEST_F(CoalescedReports, ModAndCharWithTheSameKey) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key = KeymapKey(0, 0, 0, RALT(KC_9));
+
+    set_keymap({key});
+
+    /* Press of the mod-wrapped key sends the mod and the key in one report. */
+    key.press();
+    EXPECT_REPORT(driver, (KC_RALT, KC_9));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release drops both in a single empty report. */
+    key.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(CoalescedReports, ModWrappedModifier) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key = KeymapKey(0, 0, 0, LSFT(KC_LEFT_GUI));
+
+    set_keymap({key});
+
+    /* Both modifiers arrive in the same report. */
+    key.press();
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_LEFT_GUI));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(CoalescedReports, WeakModsClearedBetweenKeys) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_plus = KeymapKey(0, 1, 0, KC_PLUS);
+    KeymapKey  key_eql  = KeymapKey(0, 0, 0, KC_EQUAL);
+
+    set_keymap({key_plus, key_eql});
+
+    key_plus.press();
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_EQUAL));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_plus.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* The weak shift from KC_PLUS must not leak onto the plain key. */
+    key_eql.press();
+    EXPECT_REPORT(driver, (KC_EQUAL));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_eql.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,102 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.h"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class ComboLayerMasks : public TestFixture {};
+
+TEST_F(ComboLayerMasks, masked_combo_fires_on_its_layer) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(0, 1, 0, KC_B);
+    set_keymap({key_a, key_b});
+
+    EXPECT_REPORT(driver, (KC_SPACE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboLayerMasks, masked_combo_keys_pass_through_on_other_layer) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(0, 1, 0, KC_B);
+    KeymapKey  key_a1(1, 0, 0, KC_A);
+    KeymapKey  key_b1(1, 1, 0, KC_B);
+    set_keymap({key_a, key_b, key_a1, key_b1});
+
+    layer_on(1);
+
+    // The combo is masked out here, so its keys report individually with no
+    // combo buffering delay.
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    key_b.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    key_b.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    layer_off(1);
+}
+
+TEST_F(ComboLayerMasks, unmasked_combo_fires_on_any_layer) {
+    TestDriver driver;
+    KeymapKey  key_c(0, 2, 0, KC_C);
+    KeymapKey  key_d(0, 3, 0, KC_D);
+    KeymapKey  key_c1(1, 2, 0, KC_C);
+    KeymapKey  key_d1(1, 3, 0, KC_D);
+    set_keymap({key_c, key_d, key_c1, key_d1});
+
+    layer_on(1);
+
+    EXPECT_REPORT(driver, (KC_ENTER));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_c, key_d});
+    VERIFY_AND_CLEAR(driver);
+
+    layer_off(1);
+}
+
+TEST_F(ComboLayerMasks, masked_combo_recovers_when_layer_returns) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(0, 1, 0, KC_B);
+    KeymapKey  key_a1(1, 0, 0, KC_A);
+    KeymapKey  key_b1(1, 1, 0, KC_B);
+    set_keymap({key_a, key_b, key_a1, key_b1});
+
+    layer_on(1);
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.press();
+    run_one_scan_loop();
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    layer_off(1);
+
+    EXPECT_REPORT(driver, (KC_SPACE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b});
+    VERIFY_AND_CLEAR(driver);
+}
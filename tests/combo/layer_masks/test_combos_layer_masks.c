@@ -0,0 +1,23 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+enum combos { ab_base_only, cd_all_layers };
+
+uint16_t const ab_combo[] = {KC_A, KC_B, COMBO_END};
+uint16_t const cd_combo[] = {KC_C, KC_D, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [ab_base_only]  = COMBO(ab_combo, KC_SPACE),
+    [cd_all_layers] = COMBO(cd_combo, KC_ENTER)
+};
+// clang-format on
+
+layer_state_t combo_layer_mask(uint16_t combo_index, combo_t *combo) {
+    switch (combo_index) {
+        case ab_base_only:
+            return 1 << 0;
+    }
+    return ~(layer_state_t)0;
+}
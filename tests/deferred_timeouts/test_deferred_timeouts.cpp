@@ -0,0 +1,99 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Checks that the feature timeouts which migrate onto the deferred executor
+// when it is enabled - Caps Word idle, Leader sequence, Auto Shift hold -
+// still fire at the right time as scheduled wake-ups.
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::AnyNumber;
+using testing::AnyOf;
+using testing::InSequence;
+
+class DeferredTimeouts : public TestFixture {};
+
+TEST_F(DeferredTimeouts, caps_word_turns_off_after_idle_timeout) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    // Allow any number of reports with no keys or only KC_LSFT.
+    // clang-format off
+    EXPECT_CALL(driver, send_keyboard_mock(AnyOf(
+                KeyboardReport(),
+                KeyboardReport(KC_LSFT))))
+        .Times(AnyNumber());
+    // clang-format on
+
+    // Expect "Shift+A" while Caps Word is on.
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    caps_word_on();
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(CAPS_WORD_IDLE_TIMEOUT);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(is_caps_word_on(), false);
+
+    // Expect unshifted "A" once the wake-up has turned Caps Word off.
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DeferredTimeouts, leader_sequence_ends_after_timeout) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_leader, key_a});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    EXPECT_EQ(leader_sequence_active(), true);
+
+    idle_for(300 + 2); // default LEADER_TIMEOUT, plus the strict-comparison margin
+    EXPECT_EQ(leader_sequence_active(), false);
+    VERIFY_AND_CLEAR(driver);
+
+    // Keys report normally again once the sequence has timed out.
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DeferredTimeouts, auto_shift_fires_at_timeout_while_held) {
+    TestDriver driver;
+    InSequence s;
+
+    auto regular_key = KeymapKey(0, 2, 0, KC_A);
+    set_keymap({regular_key});
+
+    // The scheduled wake-up sends the shifted tap mid-hold.
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    regular_key.press();
+    idle_for(AUTO_SHIFT_TIMEOUT + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    // The release has nothing left to report.
+    EXPECT_NO_REPORT(driver);
+    regular_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,15 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+enum combos { fuzz_space, fuzz_enter };
+
+uint16_t const fuzz_space_combo[] = {KC_Y, KC_U, COMBO_END};
+uint16_t const fuzz_enter_combo[] = {KC_Z, KC_X, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [fuzz_space] = COMBO(fuzz_space_combo, KC_SPACE),
+    [fuzz_enter] = COMBO(fuzz_enter_combo, KC_ENTER),
+};
+// clang-format on
@@ -0,0 +1,204 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Randomized stress test over the tap-hold, combo and caps-word state
+// machines. Deterministic seeds generate timed press/release streams over a
+// keymap mixing mod-taps, combo chords and plain keys; after every stream the
+// pipeline must quiesce with nothing stuck. Failures print the seed and the
+// full event schedule, so a failing stream can be replayed with
+// QMK_FUZZ_SEED=<seed> while shrinking it by hand.
+
+#include <array>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.h"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+
+namespace {
+
+struct FuzzEvent {
+    unsigned gap_ms; // idle time before the event
+    uint8_t  key;    // index into the fuzz keymap
+    bool     press;
+};
+
+constexpr unsigned DEFAULT_STREAMS           = 16;
+constexpr unsigned DEFAULT_EVENTS_PER_STREAM = 64;
+constexpr unsigned MAX_GAP_MS                = 12;
+
+// Long enough for the tapping term, the combo term and any one-shot timers
+// to expire after the last release.
+constexpr unsigned SETTLE_MS = TAPPING_TERM + COMBO_TERM + 100;
+
+bool keyboard_report_empty(const report_keyboard_t& report) {
+    if (report.mods != 0) {
+        return false;
+    }
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report.keys[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+class FuzzActions : public TestFixture {
+   protected:
+    // Keymap under test: two mod-taps, two combo chords (Y+U -> space,
+    // Z+X -> enter, defined in fuzz_combos.c), a plain key and the caps-word
+    // toggle, all on layer 0.
+    std::vector<KeymapKey> make_fuzz_keys() {
+        return {
+            KeymapKey(0, 0, 0, LSFT_T(KC_A)), //
+            KeymapKey(0, 1, 0, RCTL_T(KC_B)), //
+            KeymapKey(0, 2, 0, KC_Y),         //
+            KeymapKey(0, 3, 0, KC_U),         //
+            KeymapKey(0, 4, 0, KC_Z),         //
+            KeymapKey(0, 5, 0, KC_X),         //
+            KeymapKey(0, 6, 0, KC_C),         //
+            KeymapKey(0, 7, 0, QK_CAPS_WORD_TOGGLE),
+        };
+    }
+
+    // Generates a stream of timed toggles: each event flips a random key and
+    // is preceded by a random idle gap, then everything still held is
+    // released so the stream always ends with all switches up.
+    std::vector<FuzzEvent> generate_stream(uint32_t seed, unsigned event_count, size_t key_count) {
+        std::mt19937                            rng(seed);
+        std::uniform_int_distribution<unsigned> gap_dist(0, MAX_GAP_MS);
+        std::uniform_int_distribution<size_t>   key_dist(0, key_count - 1);
+
+        std::vector<FuzzEvent> events;
+        std::vector<bool>      down(key_count, false);
+
+        for (unsigned i = 0; i < event_count; i++) {
+            const uint8_t key = (uint8_t)key_dist(rng);
+            events.push_back({gap_dist(rng), key, !down[key]});
+            down[key] = !down[key];
+        }
+        for (uint8_t key = 0; key < key_count; key++) {
+            if (down[key]) {
+                events.push_back({1, key, false});
+            }
+        }
+        return events;
+    }
+
+    std::string describe_stream(uint32_t seed, const std::vector<FuzzEvent>& events, const std::vector<KeymapKey>& keys) {
+        std::ostringstream out;
+        out << "seed=" << seed << " schedule:";
+        for (const FuzzEvent& event : events) {
+            out << " +" << event.gap_ms << "ms " << (event.press ? "dn(" : "up(") << keys[event.key].name << ")";
+        }
+        return out.str();
+    }
+};
+
+TEST_F(FuzzActions, RandomStreamsLeaveNoStuckKeys) {
+    NiceMock<TestDriver> driver;
+    auto                 keys = make_fuzz_keys();
+    set_keymap({keys[0], keys[1], keys[2], keys[3], keys[4], keys[5], keys[6], keys[7]});
+
+    // Capture every keyboard report instead of asserting on exact contents;
+    // the invariants below are about the final state, not the sequence.
+    report_keyboard_t last_report = {};
+    uint32_t          report_count = 0;
+    ON_CALL(driver, send_keyboard_mock(_)).WillByDefault(Invoke([&](report_keyboard_t& report) {
+        last_report = report;
+        report_count++;
+    }));
+
+    uint32_t first_seed = 1;
+    unsigned streams    = DEFAULT_STREAMS;
+    unsigned events     = DEFAULT_EVENTS_PER_STREAM;
+    if (const char* seed_env = std::getenv("QMK_FUZZ_SEED")) {
+        // Replay a single reported seed with a denser stream.
+        first_seed = (uint32_t)std::strtoul(seed_env, nullptr, 0);
+        streams    = 1;
+        events     = 4 * DEFAULT_EVENTS_PER_STREAM;
+    }
+
+    for (uint32_t seed = first_seed; seed < first_seed + streams; seed++) {
+        const auto stream = generate_stream(seed, events, keys.size());
+
+        for (const FuzzEvent& event : stream) {
+            idle_for(event.gap_ms);
+            if (event.press) {
+                keys[event.key].press();
+            } else {
+                keys[event.key].release();
+            }
+            run_one_scan_loop();
+        }
+
+        // All switches are up: once every timer has expired, the last report
+        // must be empty (no stuck keys or mods)...
+        idle_for(SETTLE_MS);
+        if (report_count > 0 && !keyboard_report_empty(last_report)) {
+            ADD_FAILURE() << "stuck keys after stream; " << describe_stream(seed, stream, keys);
+        }
+
+        // ...and the pipeline must stay quiet: further scanning with no input
+        // may not emit reports, which would indicate an oscillating state
+        // machine.
+        const uint32_t settled_count = report_count;
+        idle_for(50);
+        if (report_count != settled_count) {
+            ADD_FAILURE() << "reports while idle after stream; " << describe_stream(seed, stream, keys);
+        }
+    }
+}
+
+TEST_F(FuzzActions, DenseChordStreamsResolveAllCombos) {
+    NiceMock<TestDriver> driver;
+    auto                 keys = make_fuzz_keys();
+    set_keymap({keys[0], keys[1], keys[2], keys[3], keys[4], keys[5], keys[6], keys[7]});
+
+    report_keyboard_t last_report  = {};
+    uint32_t          report_count = 0;
+    ON_CALL(driver, send_keyboard_mock(_)).WillByDefault(Invoke([&](report_keyboard_t& report) {
+        last_report = report;
+        report_count++;
+    }));
+
+    // Hammer only the four combo keys with tight gaps, the regime where the
+    // combo queue and key buffer are most stressed.
+    std::mt19937                            rng(0xC0FFEE);
+    std::uniform_int_distribution<unsigned> gap_dist(0, 2);
+    std::uniform_int_distribution<size_t>   key_dist(2, 5); // KC_Y..KC_X
+    std::vector<bool>                       down(keys.size(), false);
+
+    for (unsigned i = 0; i < 256; i++) {
+        const size_t key = key_dist(rng);
+        idle_for(gap_dist(rng));
+        if (down[key]) {
+            keys[key].release();
+        } else {
+            keys[key].press();
+        }
+        down[key] = !down[key];
+        run_one_scan_loop();
+    }
+    for (size_t key = 2; key <= 5; key++) {
+        if (down[key]) {
+            keys[key].release();
+            run_one_scan_loop();
+        }
+    }
+
+    idle_for(SETTLE_MS);
+    EXPECT_TRUE(report_count == 0 || keyboard_report_empty(last_report)) << "stuck keys after dense combo stream";
+}
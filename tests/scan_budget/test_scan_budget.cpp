@@ -0,0 +1,99 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+#include <algorithm>
+
+extern "C" {
+/* Test platform virtual clock instrumentation, see platforms/test/timer.c.
+ * Every timer_read()/timer_read32() call bumps the access counter, which
+ * makes "timer reads per keyboard_task()" a deterministic, machine-independent
+ * proxy for per-scan work: features that poll the clock per scan, per key or
+ * per LED show up here long before anyone measures a real board. */
+void     reset_access_counter(void);
+uint32_t current_access_counter(void);
+void     advance_time(uint32_t ms);
+}
+
+/* Budgets are tripwires, not targets: they carry several times the current
+ * cost so that only a structural regression (per-key polling in the scan
+ * loop, a feature running its timers while idle) trips them. When a budget
+ * fires, either fix the regression or consciously raise the budget here and
+ * say why in the commit. */
+namespace {
+constexpr uint32_t IDLE_TIMER_READ_BUDGET  = 128;
+constexpr uint32_t EVENT_TIMER_READ_BUDGET = 256;
+
+uint32_t timer_reads_in_one_task() {
+    reset_access_counter();
+    keyboard_task();
+    uint32_t reads = current_access_counter();
+    housekeeping_task();
+    advance_time(1);
+    return reads;
+}
+} // namespace
+
+class ScanBudget : public TestFixture {};
+
+TEST_F(ScanBudget, IdleScanLoopStaysWithinBudget) {
+    TestDriver driver;
+    set_keymap({KeymapKey{0, 0, 0, KC_A}});
+
+    EXPECT_NO_REPORT(driver);
+
+    /* Let startup-only work (initial debounce, first-run housekeeping) drain. */
+    for (int i = 0; i < 10; i++) {
+        timer_reads_in_one_task();
+    }
+
+    for (int i = 0; i < 50; i++) {
+        EXPECT_LE(timer_reads_in_one_task(), IDLE_TIMER_READ_BUDGET) << "idle loop " << i << " exceeded its timer-read budget";
+    }
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ScanBudget, KeyEventScanLoopStaysWithinBudget) {
+    TestDriver driver;
+    KeymapKey  key_a = KeymapKey{0, 0, 0, KC_A};
+    set_keymap({key_a});
+
+    for (int i = 0; i < 10; i++) {
+        timer_reads_in_one_task();
+    }
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    EXPECT_LE(timer_reads_in_one_task(), EVENT_TIMER_READ_BUDGET) << "press loop exceeded its timer-read budget";
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    EXPECT_LE(timer_reads_in_one_task(), EVENT_TIMER_READ_BUDGET) << "release loop exceeded its timer-read budget";
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ScanBudget, IdleWorkDoesNotGrowOverTime) {
+    TestDriver driver;
+    set_keymap({KeymapKey{0, 0, 0, KC_A}});
+
+    EXPECT_NO_REPORT(driver);
+
+    for (int i = 0; i < 10; i++) {
+        timer_reads_in_one_task();
+    }
+
+    /* Steady-state idle cost must not creep upward; take the early maximum
+     * and require later loops to stay at or below it. */
+    uint32_t steady_state_max = 0;
+    for (int i = 0; i < 20; i++) {
+        steady_state_max = std::max(steady_state_max, timer_reads_in_one_task());
+    }
+    for (int i = 0; i < 100; i++) {
+        EXPECT_LE(timer_reads_in_one_task(), steady_state_max) << "idle loop " << i << " does more timer reads than the steady state measured earlier";
+    }
+
+    VERIFY_AND_CLEAR(driver);
+}
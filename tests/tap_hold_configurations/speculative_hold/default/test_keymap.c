@@ -17,4 +17,4 @@
 // Shift + Esc = Home
 const key_override_t home_esc_override = ko_make_basic(MOD_MASK_SHIFT, KC_ESC, KC_HOME);
 
-const key_override_t *key_overrides[] = {&home_esc_override};
+const key_override_t *const key_overrides[] PROGMEM = {&home_esc_override};
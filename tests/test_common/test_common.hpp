@@ -25,3 +25,4 @@ extern "C" {
 #include "test_keymap_key.hpp"
 #include "keyboard_report_util.hpp"
 #include "test_fixture.hpp"
+#include "test_trace.hpp"
@@ -23,6 +23,9 @@ extern "C" {
 #include "debug.h"
 #include "eeconfig.h"
 #include "keyboard.h"
+#ifdef DEFERRED_EXEC_ENABLE
+#    include "deferred_exec.h"
+#endif
 
 void set_time(uint32_t t);
 void advance_time(uint32_t ms);
@@ -104,6 +107,9 @@ void TestFixture::add_key(KeymapKey key) {
     }
 
     this->keymap.push_back(key);
+
+    /* The keymap contents changed behind quantum's back. */
+    invalidate_resolved_layer_cache();
 }
 
 void TestFixture::tap_key(KeymapKey key, unsigned delay_ms) {
@@ -180,6 +186,11 @@ void TestFixture::idle_for(unsigned time) {
     test_logger.trace() << +time << " keyboard task " << (time > 1 ? "loops" : "loop") << std::endl;
     for (unsigned i = 0; i < time; i++) {
         keyboard_task();
+#ifdef DEFERRED_EXEC_ENABLE
+        // Mirrors the main loop, which runs the deferred executor between
+        // keyboard_task() and housekeeping_task().
+        deferred_exec_task();
+#endif
         housekeeping_task();
         advance_time(1);
     }
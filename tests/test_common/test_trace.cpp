@@ -0,0 +1,84 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_trace.hpp"
+
+#include <chrono>
+#include <sstream>
+
+#include "gtest/gtest.h"
+#include "test_logger.hpp"
+#include "test_matrix.h"
+
+extern "C" {
+#include "keyboard.h"
+
+void advance_time(uint32_t ms);
+}
+
+std::vector<TraceEvent> parse_trace(const std::string& text) {
+    std::vector<TraceEvent> trace;
+    std::istringstream      lines(text);
+    std::string             line;
+
+    while (std::getline(lines, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        uint32_t           time;
+        unsigned           col, row;
+        char               direction;
+        if (!(fields >> time >> col >> row >> direction) || (direction != 'd' && direction != 'u')) {
+            ADD_FAILURE() << "malformed trace line: \"" << line << "\"";
+            continue;
+        }
+        if (!trace.empty() && time < trace.back().time) {
+            ADD_FAILURE() << "trace events out of order at line: \"" << line << "\"";
+            continue;
+        }
+
+        trace.push_back(TraceEvent{time, static_cast<uint8_t>(col), static_cast<uint8_t>(row), direction == 'd'});
+    }
+
+    return trace;
+}
+
+TraceReplayStats replay_trace(const std::vector<TraceEvent>& trace) {
+    TraceReplayStats stats = {};
+
+    if (trace.empty()) {
+        return stats;
+    }
+
+    test_logger.trace() << "replaying trace with " << trace.size() << " events over " << (trace.back().time + 1) << " loops" << std::endl;
+
+    size_t next_event = 0;
+    for (uint32_t now = 0; now <= trace.back().time; now++) {
+        while (next_event < trace.size() && trace[next_event].time == now) {
+            const TraceEvent& event = trace[next_event++];
+            if (event.pressed) {
+                press_key(event.col, event.row);
+            } else {
+                release_key(event.col, event.row);
+            }
+            stats.events++;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        keyboard_task();
+        auto loop_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+        housekeeping_task();
+        advance_time(1);
+
+        stats.scan_loops++;
+        stats.total_loop_us += loop_us;
+        if (static_cast<uint64_t>(loop_us) > stats.max_loop_us) {
+            stats.max_loop_us = loop_us;
+        }
+    }
+
+    return stats;
+}
@@ -0,0 +1,47 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief One recorded matrix transition.
+ *
+ * Times are in milliseconds relative to the start of the trace; one
+ * millisecond corresponds to one scan loop of the emulated keyboard.
+ */
+struct TraceEvent {
+    uint32_t time;
+    uint8_t  col;
+    uint8_t  row;
+    bool     pressed;
+};
+
+/** @brief Host-side cost of replaying a trace, for spotting processing regressions. */
+struct TraceReplayStats {
+    uint32_t events;        /**< Matrix transitions applied. */
+    uint32_t scan_loops;    /**< keyboard_task() invocations. */
+    uint64_t total_loop_us; /**< Wall-clock microseconds spent inside keyboard_task(). */
+    uint64_t max_loop_us;   /**< Most expensive single keyboard_task() call. */
+};
+
+/**
+ * @brief Parses a textual trace.
+ *
+ * One event per line: `<time_ms> <col> <row> <d|u>` where `d` is a press and
+ * `u` a release. Blank lines and lines starting with `#` are skipped. Events
+ * must be ordered by time.
+ */
+std::vector<TraceEvent> parse_trace(const std::string& text);
+
+/**
+ * @brief Replays a trace against the emulated keyboard.
+ *
+ * Runs one scan loop per virtual millisecond, applying each event's matrix
+ * transition just before the loop of its timestamp, so report expectations
+ * set on a TestDriver are verified in recorded order and at recorded timing.
+ */
+TraceReplayStats replay_trace(const std::vector<TraceEvent>& trace);
@@ -0,0 +1,72 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+#include "gtest/gtest-spi.h"
+
+using testing::InSequence;
+
+class TraceReplay : public TestFixture {};
+
+TEST_F(TraceReplay, RollingTraceEmitsOrderedReports) {
+    TestDriver driver;
+    InSequence s;
+
+    set_keymap({KeymapKey{0, 0, 0, KC_A}, KeymapKey{0, 1, 0, KC_B}, KeymapKey{0, 2, 0, KC_C}});
+
+    /* A rolls into B before releasing, then C is tapped on its own. */
+    auto trace = parse_trace(
+        "# time col row d/u\n"
+        "0 0 0 d\n"
+        "2 1 0 d\n"
+        "4 0 0 u\n"
+        "6 1 0 u\n"
+        "8 2 0 d\n"
+        "10 2 0 u\n");
+    ASSERT_EQ(trace.size(), 6u);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+
+    TraceReplayStats stats = replay_trace(trace);
+    EXPECT_EQ(stats.events, 6u);
+    EXPECT_EQ(stats.scan_loops, 11u);
+    EXPECT_GE(stats.max_loop_us, stats.total_loop_us / stats.scan_loops);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TraceReplay, SimultaneousTransitionsApplyInOneLoop) {
+    TestDriver driver;
+    InSequence s;
+
+    set_keymap({KeymapKey{0, 0, 0, KC_A}, KeymapKey{0, 1, 0, KC_B}});
+
+    /* Both keys go down in the same scan loop and come up together later.
+     * Each transition still yields its own report, in matrix order. */
+    auto trace = parse_trace(
+        "0 0 0 d\n"
+        "0 1 0 d\n"
+        "5 0 0 u\n"
+        "5 1 0 u\n");
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+
+    TraceReplayStats stats = replay_trace(trace);
+    EXPECT_EQ(stats.events, 4u);
+    EXPECT_EQ(stats.scan_loops, 6u);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TraceReplay, MalformedTraceLinesAreRejected) {
+    EXPECT_NONFATAL_FAILURE(parse_trace("0 0 0 x\n"), "malformed trace line");
+    EXPECT_NONFATAL_FAILURE(parse_trace("5 0 0 d\n1 1 0 d\n"), "out of order");
+}
@@ -8,6 +8,15 @@ using testing::InSequence;
 
 class TriLayer : public TestFixture {};
 
+namespace {
+uint32_t layer_state_set_kb_count = 0;
+} // namespace
+
+extern "C" layer_state_t layer_state_set_kb(layer_state_t state) {
+    layer_state_set_kb_count++;
+    return layer_state_set_user(state);
+}
+
 TEST_F(TriLayer, TriLayerLowerTest) {
     TestDriver driver;
     KeymapKey  lower_layer_key = KeymapKey{0, 0, 0, QK_TRI_LAYER_LOWER};
@@ -101,3 +110,72 @@ TEST_F(TriLayer, TriLayerAdjustTest) {
     EXPECT_FALSE(layer_state_is(get_tri_layer_adjust_layer()));
     VERIFY_AND_CLEAR(driver);
 }
+
+TEST_F(TriLayer, TriLayerSingleCascadePerEvent) {
+    TestDriver driver;
+    KeymapKey  lower_layer_key = KeymapKey{0, 0, 0, QK_TRI_LAYER_LOWER};
+    KeymapKey  upper_layer_key = KeymapKey{0, 1, 0, QK_TRI_LAYER_UPPER};
+
+    set_keymap({
+        upper_layer_key,
+        lower_layer_key,
+        KeymapKey{1, 0, 0, KC_TRNS},
+        KeymapKey{1, 1, 0, KC_TRNS},
+        KeymapKey{2, 0, 0, KC_TRNS},
+        KeymapKey{2, 1, 0, KC_TRNS},
+        KeymapKey{3, 0, 0, KC_TRNS},
+        KeymapKey{3, 1, 0, KC_TRNS},
+    });
+
+    /* Each tri-layer key event batches the layer toggle and the tri-layer
+     * recomputation into a single layer_state_set cascade. */
+    EXPECT_NO_REPORT(driver);
+    uint32_t baseline = layer_state_set_kb_count;
+    lower_layer_key.press();
+    run_one_scan_loop();
+    EXPECT_EQ(layer_state_set_kb_count, baseline + 1);
+    EXPECT_TRUE(layer_state_is(get_tri_layer_lower_layer()));
+
+    upper_layer_key.press();
+    run_one_scan_loop();
+    EXPECT_EQ(layer_state_set_kb_count, baseline + 2);
+    EXPECT_TRUE(layer_state_is(get_tri_layer_adjust_layer()));
+
+    upper_layer_key.release();
+    run_one_scan_loop();
+    EXPECT_EQ(layer_state_set_kb_count, baseline + 3);
+    EXPECT_FALSE(layer_state_is(get_tri_layer_adjust_layer()));
+
+    lower_layer_key.release();
+    run_one_scan_loop();
+    EXPECT_EQ(layer_state_set_kb_count, baseline + 4);
+    EXPECT_FALSE(layer_state_is(get_tri_layer_lower_layer()));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TriLayer, LayerTransactionCommitsOnce) {
+    TestDriver driver;
+    set_keymap({KeymapKey{0, 0, 0, KC_A}, KeymapKey{1, 0, 0, KC_TRNS}, KeymapKey{2, 0, 0, KC_TRNS}, KeymapKey{3, 0, 0, KC_TRNS}});
+
+    EXPECT_NO_REPORT(driver);
+    uint32_t baseline = layer_state_set_kb_count;
+    layer_begin_transaction();
+    layer_on(1);
+    layer_on(2);
+    /* intermediate state is visible inside the transaction */
+    EXPECT_TRUE(layer_state_is(1));
+    EXPECT_TRUE(layer_state_is(2));
+    EXPECT_EQ(layer_state_set_kb_count, baseline);
+    layer_commit_transaction();
+    EXPECT_EQ(layer_state_set_kb_count, baseline + 1);
+    EXPECT_TRUE(layer_state_is(1));
+    EXPECT_TRUE(layer_state_is(2));
+
+    /* a transaction with no layer operations commits without a cascade */
+    layer_begin_transaction();
+    layer_commit_transaction();
+    EXPECT_EQ(layer_state_set_kb_count, baseline + 1);
+
+    layer_clear();
+    VERIFY_AND_CLEAR(driver);
+}
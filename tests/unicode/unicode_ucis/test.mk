@@ -3,3 +3,4 @@
 # --------------------------------------------------------------------------------
 
 UCIS_ENABLE = yes
+INTROSPECTION_KEYMAP_C = ucis_symbols.c
@@ -8,11 +8,8 @@
 
 using testing::_;
 
-// clang-format off
-const ucis_symbol_t ucis_symbol_table[] = UCIS_TABLE(
-    UCIS_SYM("qmk", 0x03A8) // Ψ
-);
-// clang-format on
+// The UCIS symbol table lives in ucis_symbols.c, pulled in through the
+// introspection keymap so the table size is visible to keymap_introspection.c.
 
 class UnicodeUCIS : public TestFixture {};
 
@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// The first entry deliberately starts with a different character than "qmk",
+// so the tests also cover the first-character prefilter skipping entries.
+// clang-format off
+const ucis_symbol_t ucis_symbol_table[] = UCIS_TABLE(
+    UCIS_SYM("rofl", 0x1F923), // 🤣
+    UCIS_SYM("qmk", 0x03A8)    // Ψ
+);
+// clang-format on
@@ -291,6 +291,71 @@ bool usb_endpoint_in_send(usb_endpoint_in_t *endpoint, const uint8_t *data, size
     }
 }
 
+uint8_t *usb_endpoint_in_begin_report(usb_endpoint_in_t *endpoint, sysinterval_t timeout) {
+    osalDbgCheck(endpoint != NULL);
+
+    osalSysLock();
+    if (usbGetDriverStateI(endpoint->config.usbp) != USB_ACTIVE) {
+        osalSysUnlock();
+        return NULL;
+    }
+
+    /* Short circuit the waiting if this endpoint timed out before, see
+     * usb_endpoint_in_send for the rationale. */
+    if (endpoint->timed_out && timeout != TIME_INFINITE) {
+        timeout = TIME_IMMEDIATE;
+    }
+    osalSysUnlock();
+
+    while (true) {
+        /* Acquire the next transmit buffer directly, so the report can be
+         * assembled in place without an intermediate copy through the byte
+         * queue. On success the writable area is exposed through the queue's
+         * access pointer. */
+        if (obqGetEmptyBufferTimeout(&endpoint->obqueue, timeout) == MSG_OK) {
+            return endpoint->obqueue.ptr;
+        }
+
+        /* The queue is full because the host stopped draining it - drop the
+         * queued stale reports to make room for the freshest one, mirroring
+         * the timeout handling in usb_endpoint_in_send. */
+        osalSysLock();
+        endpoint->timed_out = true;
+        bqSuspendI(&endpoint->obqueue);
+        obqResetI(&endpoint->obqueue);
+        bqResumeX(&endpoint->obqueue);
+        osalOsRescheduleS();
+        osalSysUnlock();
+    }
+}
+
+bool usb_endpoint_in_commit_report(usb_endpoint_in_t *endpoint, size_t size) {
+    osalDbgCheck((endpoint != NULL) && (size > 0U) && (size <= endpoint->config.buffer_size));
+
+    osalSysLock();
+    /* The acquired buffer is revoked when the queue is reset from ISR
+     * context, e.g. on bus reset or suspend. In that case the report must not
+     * be posted, its backing buffer is no longer ours. */
+    if (endpoint->obqueue.ptr == NULL) {
+        osalSysUnlock();
+        return false;
+    }
+    obqPostFullBufferS(&endpoint->obqueue, size);
+    osalSysUnlock();
+
+    return true;
+}
+
+void usb_endpoint_in_rollback_report(usb_endpoint_in_t *endpoint) {
+    osalDbgCheck(endpoint != NULL);
+
+    /* Releasing the access pointer without posting discards the report; the
+     * queue's write position was never advanced. */
+    osalSysLock();
+    endpoint->obqueue.ptr = NULL;
+    osalSysUnlock();
+}
+
 void usb_endpoint_in_flush(usb_endpoint_in_t *endpoint, bool padded) {
     osalDbgCheck(endpoint != NULL);
 
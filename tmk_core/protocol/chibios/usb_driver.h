@@ -188,6 +188,10 @@ bool usb_endpoint_in_send(usb_endpoint_in_t *endpoint, const uint8_t *data, size
 void usb_endpoint_in_flush(usb_endpoint_in_t *endpoint, bool padded);
 bool usb_endpoint_in_is_inactive(usb_endpoint_in_t *endpoint);
 
+uint8_t *usb_endpoint_in_begin_report(usb_endpoint_in_t *endpoint, sysinterval_t timeout);
+bool     usb_endpoint_in_commit_report(usb_endpoint_in_t *endpoint, size_t size);
+void     usb_endpoint_in_rollback_report(usb_endpoint_in_t *endpoint);
+
 void usb_endpoint_in_suspend_cb(usb_endpoint_in_t *endpoint);
 void usb_endpoint_in_wakeup_cb(usb_endpoint_in_t *endpoint);
 void usb_endpoint_in_configure_cb(usb_endpoint_in_t *endpoint);
@@ -32,6 +32,11 @@
 #    include "raw_hid.h"
 #endif
 
+#ifdef MIDI_ENABLE
+#    include "qmk_midi.h"
+#    include "util.h"
+#endif
+
 #ifdef NKRO_ENABLE
 #    include "keycode_config.h"
 
@@ -136,12 +141,15 @@ static inline void usb_event_wakeup_handler(void) {
 
 bool last_suspend_state = false;
 
+static void usb_report_dedup_invalidate(void);
+
 void usb_event_queue_task(void) {
     usbevent_t event;
     while (usb_event_queue_dequeue(&event)) {
         switch (event) {
             case USB_EVENT_SUSPEND:
                 last_suspend_state = true;
+                usb_report_dedup_invalidate();
                 usb_event_suspend_handler();
                 break;
             case USB_EVENT_WAKEUP:
@@ -155,6 +163,7 @@ void usb_event_queue_task(void) {
                 usb_device_state_set_configuration(false, 0);
                 break;
             case USB_EVENT_RESET:
+                usb_report_dedup_invalidate();
                 usb_device_state_set_reset();
                 usb_device_state_set_protocol(USB_PROTOCOL_REPORT);
                 break;
@@ -390,7 +399,36 @@ __attribute__((weak)) void restart_usb_driver(USBDriver *usbp) {
  * @return false Failure
  */
 bool send_report(usb_endpoint_in_lut_t endpoint, void *report, size_t size) {
-    return usb_endpoint_in_send(&usb_endpoints_in[endpoint], (uint8_t *)report, size, TIME_MS2I(100), false);
+    uint8_t *buffer = usb_endpoint_in_begin_report(&usb_endpoints_in[endpoint], TIME_MS2I(100));
+    if (buffer == NULL) {
+        return false;
+    }
+    memcpy(buffer, report, size);
+    return usb_endpoint_in_commit_report(&usb_endpoints_in[endpoint], size);
+}
+
+/**
+ * @brief Send a report to the host without ever blocking the caller. If the
+ * endpoint's output queue is full, e.g. because a stalled or resuming host has
+ * stopped draining it, the queued stale reports are dropped in favour of this
+ * freshest one instead of waiting on the host. Only suitable for non-key
+ * reports, where the newest report supersedes everything still in flight and
+ * blocking the main loop - and thereby delaying key reports - hurts more than
+ * losing stale data.
+ *
+ * @param endpoint USB IN endpoint to send the report from
+ * @param report pointer to the report
+ * @param size size of the report
+ * @return true Success
+ * @return false Failure
+ */
+static bool send_report_nonblocking(usb_endpoint_in_lut_t endpoint, void *report, size_t size) {
+    uint8_t *buffer = usb_endpoint_in_begin_report(&usb_endpoints_in[endpoint], TIME_IMMEDIATE);
+    if (buffer == NULL) {
+        return false;
+    }
+    memcpy(buffer, report, size);
+    return usb_endpoint_in_commit_report(&usb_endpoints_in[endpoint], size);
 }
 
 /**
@@ -434,18 +472,59 @@ static bool receive_report(usb_endpoint_out_lut_t endpoint, void *report, size_t
     return usb_endpoint_out_receive(&usb_endpoints_out[endpoint], (uint8_t *)report, size, TIME_IMMEDIATE);
 }
 
+/* The last report successfully queued on each key endpoint. Comparing against
+ * these lets us drop reports that are byte-identical to their predecessor -
+ * which mod churn on the NKRO report generates in abundance - as resending
+ * them cannot change the host's view of our state. */
+static report_keyboard_t last_keyboard_report;
+static bool              last_keyboard_report_valid = false;
+
+#ifdef NKRO_ENABLE
+static report_nkro_t last_nkro_report;
+static bool          last_nkro_report_valid = false;
+#endif
+
+/* Invalidate the report deduplication state, forcing the next report of each
+ * kind onto the wire. Called whenever the host may have lost or cleared its
+ * view of our state, i.e. on bus reset and suspend. */
+static void usb_report_dedup_invalidate(void) {
+    last_keyboard_report_valid = false;
+#ifdef NKRO_ENABLE
+    last_nkro_report_valid = false;
+#endif
+}
+
 void send_keyboard(report_keyboard_t *report) {
+    if (last_keyboard_report_valid && memcmp(report, &last_keyboard_report, sizeof(report_keyboard_t)) == 0) {
+        return;
+    }
+
+    bool sent;
     /* If we're in Boot Protocol, don't send any report ID or other funky fields */
     if (usb_device_state_get_protocol() == USB_PROTOCOL_BOOT) {
-        send_report(USB_ENDPOINT_IN_KEYBOARD, &report->mods, 8);
+        sent = send_report(USB_ENDPOINT_IN_KEYBOARD, &report->mods, 8);
     } else {
-        send_report(USB_ENDPOINT_IN_KEYBOARD, report, KEYBOARD_REPORT_SIZE);
+        sent = send_report(USB_ENDPOINT_IN_KEYBOARD, report, KEYBOARD_REPORT_SIZE);
+    }
+
+    if (sent) {
+        last_keyboard_report = *report;
     }
+    last_keyboard_report_valid = sent;
 }
 
 void send_nkro(report_nkro_t *report) {
 #ifdef NKRO_ENABLE
-    send_report(USB_ENDPOINT_IN_SHARED, report, sizeof(report_nkro_t));
+    if (last_nkro_report_valid && memcmp(report, &last_nkro_report, sizeof(report_nkro_t)) == 0) {
+        return;
+    }
+
+    bool sent = send_report(USB_ENDPOINT_IN_SHARED, report, sizeof(report_nkro_t));
+
+    if (sent) {
+        last_nkro_report = *report;
+    }
+    last_nkro_report_valid = sent;
 #endif
 }
 
@@ -456,7 +535,7 @@ void send_nkro(report_nkro_t *report) {
 
 void send_mouse(report_mouse_t *report) {
 #ifdef MOUSE_ENABLE
-    send_report(USB_ENDPOINT_IN_MOUSE, report, sizeof(report_mouse_t));
+    send_report_nonblocking(USB_ENDPOINT_IN_MOUSE, report, sizeof(report_mouse_t));
 #endif
 }
 
@@ -467,7 +546,7 @@ void send_mouse(report_mouse_t *report) {
 
 void send_extra(report_extra_t *report) {
 #ifdef EXTRAKEY_ENABLE
-    send_report(USB_ENDPOINT_IN_SHARED, report, sizeof(report_extra_t));
+    send_report_nonblocking(USB_ENDPOINT_IN_SHARED, report, sizeof(report_extra_t));
 #endif
 }
 
@@ -496,11 +575,72 @@ void send_digitizer(report_digitizer_t *report) {
 
 #ifdef CONSOLE_ENABLE
 
+#    ifndef CONSOLE_BUFFER_SIZE
+#        define CONSOLE_BUFFER_SIZE 512
+#    endif
+
+#    if (CONSOLE_BUFFER_SIZE & (CONSOLE_BUFFER_SIZE - 1)) != 0
+#        error "CONSOLE_BUFFER_SIZE must be a power of two"
+#    endif
+
+/* Single-producer single-consumer ring buffer decoupling log producers from
+ * the USB endpoint. sendchar() is the only producer and console_task() the
+ * only consumer, so head and tail each have exactly one writer and no locking
+ * is needed. A full buffer drops bytes instead of ever blocking the caller,
+ * so enabling the console no longer perturbs the timing of the code being
+ * debugged; console_dropped_count() exposes how much was lost. */
+static uint8_t           console_buffer[CONSOLE_BUFFER_SIZE];
+static volatile uint16_t console_head    = 0; /* written by sendchar() only */
+static volatile uint16_t console_tail    = 0; /* written by console_task() only */
+static volatile uint32_t console_dropped = 0;
+
 int8_t sendchar(uint8_t c) {
-    return (int8_t)send_report_buffered(USB_ENDPOINT_IN_CONSOLE, &c, sizeof(uint8_t));
+    uint16_t head = console_head;
+    uint16_t next = (head + 1) & (CONSOLE_BUFFER_SIZE - 1);
+
+    if (next == console_tail) {
+        /* Buffer full - guaranteed-drop semantics, never block or wait. */
+        console_dropped = console_dropped + 1;
+        return -1;
+    }
+
+    console_buffer[head] = c;
+    console_head         = next;
+
+    return 0;
+}
+
+uint32_t console_dropped_count(void) {
+    return console_dropped;
 }
 
 void console_task(void) {
+    uint16_t tail = console_tail;
+    uint16_t head = console_head;
+
+    if (tail == head) {
+        return;
+    }
+
+    /* Drain the ring in contiguous endpoint-sized chunks, then flush the
+     * batch as a single padded transfer per main-loop pass. */
+    while (tail != head) {
+        uint16_t chunk = (head > tail) ? (head - tail) : (CONSOLE_BUFFER_SIZE - tail);
+        if (chunk > CONSOLE_EPSIZE) {
+            chunk = CONSOLE_EPSIZE;
+        }
+
+        if (!send_report_buffered(USB_ENDPOINT_IN_CONSOLE, &console_buffer[tail], chunk)) {
+            /* USB inactive - leave the remainder in the ring and retry on
+             * the next pass. */
+            break;
+        }
+
+        tail = (tail + chunk) & (CONSOLE_BUFFER_SIZE - 1);
+    }
+
+    console_tail = tail;
+
     flush_report_buffered(USB_ENDPOINT_IN_CONSOLE, true);
 }
 
@@ -525,8 +665,25 @@ void raw_hid_task(void) {
 
 #ifdef MIDI_ENABLE
 
+/* Outgoing events are batched into one endpoint-sized report instead of
+ * committing a separate 4-byte transfer per event; the batch is pushed out
+ * when full, or by flush_midi_packets() once per scan. */
+static MIDI_EventPacket_t midi_out_queue[MIDI_STREAM_EPSIZE / sizeof(MIDI_EventPacket_t)];
+static uint8_t            midi_out_count = 0;
+
 void send_midi_packet(MIDI_EventPacket_t *event) {
-    send_report(USB_ENDPOINT_IN_MIDI, (uint8_t *)event, sizeof(MIDI_EventPacket_t));
+    midi_out_queue[midi_out_count++] = *event;
+    if (midi_out_count == ARRAY_SIZE(midi_out_queue)) {
+        flush_midi_packets();
+    }
+}
+
+void flush_midi_packets(void) {
+    if (midi_out_count == 0) {
+        return;
+    }
+    send_report(USB_ENDPOINT_IN_MIDI, (uint8_t *)midi_out_queue, midi_out_count * sizeof(MIDI_EventPacket_t));
+    midi_out_count = 0;
 }
 
 bool recv_midi_packet(MIDI_EventPacket_t *const event) {
@@ -572,6 +729,10 @@ void virtser_send(const uint8_t byte) {
     send_report_buffered(USB_ENDPOINT_IN_CDC_DATA, (void *)&byte, sizeof(byte));
 }
 
+void virtser_send_buffer(const uint8_t *data, uint16_t length) {
+    send_report_buffered(USB_ENDPOINT_IN_CDC_DATA, (void *)data, length);
+}
+
 __attribute__((weak)) void virtser_recv(uint8_t c) {
     // Ignore by default
 }
@@ -55,6 +55,9 @@ void usb_event_queue_task(void);
 /* Putchar over the USB console */
 int8_t sendchar(uint8_t c);
 
+/* Number of console bytes dropped because the buffer was full */
+uint32_t console_dropped_count(void);
+
 #endif /* CONSOLE_ENABLE */
 
 /* --------------
@@ -19,6 +19,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "keyboard.h"
 #include "keycode.h"
 #include "action.h"
+#include "action_util.h"
 #include "host.h"
 #include "util.h"
 #include "debug.h"
@@ -36,6 +37,14 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "connection.h"
 #endif
 
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+
+#ifdef LATENCY_TEST_RIG_ENABLE
+#    include "latency_test_rig.h"
+#endif
+
 #ifdef BLUETOOTH_ENABLE
 #    include "bluetooth.h"
 
@@ -94,7 +103,22 @@ static void host_update_active_driver(connection_host_t current, connection_host
     host_disconnect_active_driver_kb(current);
 
     if (current != CONNECTION_HOST_NONE) {
-        clear_keyboard();
+        // Push blank reports over the transport being left behind so no keys
+        // stay stuck on that host. The action layer state is deliberately
+        // untouched - the live report is reinstated on the new transport
+        // right after the switch, so held keys carry across seamlessly.
+        report_keyboard_t empty_keyboard = {0};
+        host_keyboard_send(&empty_keyboard);
+#    ifdef NKRO_ENABLE
+        report_nkro_t empty_nkro = {0};
+        host_nkro_send(&empty_nkro);
+#    endif
+#    ifdef MOUSE_ENABLE
+        report_mouse_t empty_mouse = {0};
+        host_mouse_send(&empty_mouse);
+#    endif
+        host_system_send(0);
+        host_consumer_send(0);
     }
 
     host_connect_active_driver_user(next);
@@ -114,6 +138,16 @@ void host_task(void) {
         host_update_active_driver(active_host, next_host);
 
         active_host = next_host;
+
+        if (next_host != CONNECTION_HOST_NONE) {
+            // Reinstate the live keyboard report on the new transport so a
+            // transport change never drops keys that are physically held. The
+            // dedup caches still match the live report (the blank reports above
+            // bypassed them), so they must be invalidated or the send is
+            // silently dropped as a duplicate.
+            keyboard_report_dedup_invalidate();
+            send_keyboard_report();
+        }
     }
 #endif
 }
@@ -183,6 +217,13 @@ void host_keyboard_send(report_keyboard_t *report) {
 #endif
     (*driver->send_keyboard)(report);
 
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_stage(LATENCY_TRACE_REPORT_SENT);
+#endif
+#ifdef LATENCY_TEST_RIG_ENABLE
+    latency_test_rig_report_sent();
+#endif
+
     if (debug_keyboard) {
         dprintf("keyboard_report: %02X | ", report->mods);
         for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
@@ -199,6 +240,13 @@ void host_nkro_send(report_nkro_t *report) {
     report->report_id = REPORT_ID_NKRO;
     (*driver->send_nkro)(report);
 
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_stage(LATENCY_TRACE_REPORT_SENT);
+#endif
+#ifdef LATENCY_TEST_RIG_ENABLE
+    latency_test_rig_report_sent();
+#endif
+
     if (debug_keyboard) {
         dprintf("nkro_report: %02X | ", report->mods);
         for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
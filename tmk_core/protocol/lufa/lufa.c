@@ -36,6 +36,8 @@
   this software.
 */
 
+#include <string.h>
+
 #include "report.h"
 #include "host.h"
 #include "host_driver.h"
@@ -91,21 +93,66 @@ host_driver_t lufa_driver = {
 #endif
 };
 
-void send_report(uint8_t endpoint, void *report, size_t size) {
-    uint8_t timeout = 255;
+/* Report submission is event-driven: a report is written immediately when its
+ * IN endpoint bank is free, otherwise it is parked in a per-interface pending
+ * slot and flushed from protocol_post_task() once the host has drained the
+ * bank. The previous implementation busy-waited up to ~10ms per report in
+ * keyboard_task() context. A parked report is replaced by a newer one of the
+ * same interface, so the host always receives the latest state. */
+
+enum pending_report_flags {
+    PENDING_KEYBOARD            = (1 << 0),
+    PENDING_NKRO                = (1 << 1),
+    PENDING_MOUSE               = (1 << 2),
+    PENDING_EXTRA               = (1 << 3),
+    PENDING_JOYSTICK            = (1 << 4),
+    PENDING_DIGITIZER           = (1 << 5),
+    PENDING_PROGRAMMABLE_BUTTON = (1 << 6),
+    PENDING_RAW                 = (1 << 7),
+};
 
-    if (USB_DeviceState != DEVICE_STATE_Configured) return;
+static uint8_t pending_flags = 0;
+
+static struct {
+    report_keyboard_t keyboard;
+#ifdef NKRO_ENABLE
+    report_nkro_t nkro;
+#endif
+#ifdef MOUSE_ENABLE
+    report_mouse_t mouse;
+#endif
+#ifdef EXTRAKEY_ENABLE
+    report_extra_t extra;
+#endif
+#ifdef JOYSTICK_ENABLE
+    report_joystick_t joystick;
+#endif
+#ifdef DIGITIZER_ENABLE
+    report_digitizer_t digitizer;
+#endif
+#ifdef PROGRAMMABLE_BUTTON_ENABLE
+    report_programmable_button_t programmable_button;
+#endif
+#ifdef RAW_ENABLE
+    uint8_t raw[RAW_EPSIZE];
+#endif
+} pending_reports;
 
+static bool try_send_report(uint8_t endpoint, void *report, size_t size) {
+    if (USB_DeviceState != DEVICE_STATE_Configured) return true; // not enumerated, drop instead of parking
+
+    uint8_t ep = Endpoint_GetCurrentEndpoint();
     Endpoint_SelectEndpoint(endpoint);
 
-    /* Check if write ready for a polling interval around 10ms */
-    while (timeout-- && !Endpoint_IsReadWriteAllowed()) {
-        _delay_us(40);
+    if (!Endpoint_IsReadWriteAllowed()) {
+        Endpoint_SelectEndpoint(ep);
+        return false;
     }
-    if (!Endpoint_IsReadWriteAllowed()) return;
 
     Endpoint_Write_Stream_LE(report, size, NULL);
     Endpoint_ClearIN();
+    Endpoint_SelectEndpoint(ep);
+    return true;
 }
 
 #ifdef VIRTSER_ENABLE
@@ -143,7 +190,10 @@ USB_ClassInfo_CDC_Device_t cdc_device = {
  */
 static void send_raw_hid(uint8_t *data, uint8_t length) {
     if (length != RAW_EPSIZE) return;
-    send_report(RAW_IN_EPNUM, data, RAW_EPSIZE);
+    if (!try_send_report(RAW_IN_EPNUM, data, RAW_EPSIZE)) {
+        memcpy(pending_reports.raw, data, RAW_EPSIZE);
+        pending_flags |= PENDING_RAW;
+    }
 }
 
 /** \brief Raw HID Task
@@ -512,12 +562,18 @@ void EVENT_USB_Device_ControlRequest(void) {
  *
  * FIXME: Needs doc
  */
-static void send_keyboard(report_keyboard_t *report) {
+static bool try_send_keyboard(report_keyboard_t *report) {
     /* If we're in Boot Protocol, don't send any report ID or other funky fields */
     if (usb_device_state_get_protocol() == USB_PROTOCOL_BOOT) {
-        send_report(KEYBOARD_IN_EPNUM, &report->mods, 8);
-    } else {
-        send_report(KEYBOARD_IN_EPNUM, report, KEYBOARD_REPORT_SIZE);
+        return try_send_report(KEYBOARD_IN_EPNUM, &report->mods, 8);
+    }
+    return try_send_report(KEYBOARD_IN_EPNUM, report, KEYBOARD_REPORT_SIZE);
+}
+
+static void send_keyboard(report_keyboard_t *report) {
+    if (!try_send_keyboard(report)) {
+        pending_reports.keyboard = *report;
+        pending_flags |= PENDING_KEYBOARD;
     }
 
     keyboard_report_sent = *report;
@@ -529,7 +585,10 @@ static void send_keyboard(report_keyboard_t *report) {
  */
 static void send_nkro(report_nkro_t *report) {
 #ifdef NKRO_ENABLE
-    send_report(SHARED_IN_EPNUM, report, sizeof(report_nkro_t));
+    if (!try_send_report(SHARED_IN_EPNUM, report, sizeof(report_nkro_t))) {
+        pending_reports.nkro = *report;
+        pending_flags |= PENDING_NKRO;
+    }
 #endif
 }
 
@@ -539,7 +598,10 @@ static void send_nkro(report_nkro_t *report) {
  */
 static void send_mouse(report_mouse_t *report) {
 #ifdef MOUSE_ENABLE
-    send_report(MOUSE_IN_EPNUM, report, sizeof(report_mouse_t));
+    if (!try_send_report(MOUSE_IN_EPNUM, report, sizeof(report_mouse_t))) {
+        pending_reports.mouse = *report;
+        pending_flags |= PENDING_MOUSE;
+    }
 #endif
 }
 
@@ -549,25 +611,83 @@ static void send_mouse(report_mouse_t *report) {
  */
 static void send_extra(report_extra_t *report) {
 #ifdef EXTRAKEY_ENABLE
-    send_report(SHARED_IN_EPNUM, report, sizeof(report_extra_t));
+    if (!try_send_report(SHARED_IN_EPNUM, report, sizeof(report_extra_t))) {
+        pending_reports.extra = *report;
+        pending_flags |= PENDING_EXTRA;
+    }
 #endif
 }
 
 void send_joystick(report_joystick_t *report) {
 #ifdef JOYSTICK_ENABLE
-    send_report(JOYSTICK_IN_EPNUM, report, sizeof(report_joystick_t));
+    if (!try_send_report(JOYSTICK_IN_EPNUM, report, sizeof(report_joystick_t))) {
+        pending_reports.joystick = *report;
+        pending_flags |= PENDING_JOYSTICK;
+    }
 #endif
 }
 
 void send_programmable_button(report_programmable_button_t *report) {
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-    send_report(SHARED_IN_EPNUM, report, sizeof(report_programmable_button_t));
+    if (!try_send_report(SHARED_IN_EPNUM, report, sizeof(report_programmable_button_t))) {
+        pending_reports.programmable_button = *report;
+        pending_flags |= PENDING_PROGRAMMABLE_BUTTON;
+    }
 #endif
 }
 
 void send_digitizer(report_digitizer_t *report) {
 #ifdef DIGITIZER_ENABLE
-    send_report(DIGITIZER_IN_EPNUM, report, sizeof(report_digitizer_t));
+    if (!try_send_report(DIGITIZER_IN_EPNUM, report, sizeof(report_digitizer_t))) {
+        pending_reports.digitizer = *report;
+        pending_flags |= PENDING_DIGITIZER;
+    }
+#endif
+}
+
+/** \brief Retry parked reports whose endpoint bank was full when they were
+ * submitted. Called once per main loop pass.
+ */
+static void flush_pending_reports(void) {
+    if (!pending_flags) return;
+
+    if ((pending_flags & PENDING_KEYBOARD) && try_send_keyboard(&pending_reports.keyboard)) {
+        pending_flags &= ~PENDING_KEYBOARD;
+    }
+#ifdef NKRO_ENABLE
+    if ((pending_flags & PENDING_NKRO) && try_send_report(SHARED_IN_EPNUM, &pending_reports.nkro, sizeof(report_nkro_t))) {
+        pending_flags &= ~PENDING_NKRO;
+    }
+#endif
+#ifdef MOUSE_ENABLE
+    if ((pending_flags & PENDING_MOUSE) && try_send_report(MOUSE_IN_EPNUM, &pending_reports.mouse, sizeof(report_mouse_t))) {
+        pending_flags &= ~PENDING_MOUSE;
+    }
+#endif
+#ifdef EXTRAKEY_ENABLE
+    if ((pending_flags & PENDING_EXTRA) && try_send_report(SHARED_IN_EPNUM, &pending_reports.extra, sizeof(report_extra_t))) {
+        pending_flags &= ~PENDING_EXTRA;
+    }
+#endif
+#ifdef JOYSTICK_ENABLE
+    if ((pending_flags & PENDING_JOYSTICK) && try_send_report(JOYSTICK_IN_EPNUM, &pending_reports.joystick, sizeof(report_joystick_t))) {
+        pending_flags &= ~PENDING_JOYSTICK;
+    }
+#endif
+#ifdef PROGRAMMABLE_BUTTON_ENABLE
+    if ((pending_flags & PENDING_PROGRAMMABLE_BUTTON) && try_send_report(SHARED_IN_EPNUM, &pending_reports.programmable_button, sizeof(report_programmable_button_t))) {
+        pending_flags &= ~PENDING_PROGRAMMABLE_BUTTON;
+    }
+#endif
+#ifdef DIGITIZER_ENABLE
+    if ((pending_flags & PENDING_DIGITIZER) && try_send_report(DIGITIZER_IN_EPNUM, &pending_reports.digitizer, sizeof(report_digitizer_t))) {
+        pending_flags &= ~PENDING_DIGITIZER;
+    }
+#endif
+#ifdef RAW_ENABLE
+    if ((pending_flags & PENDING_RAW) && try_send_report(RAW_IN_EPNUM, pending_reports.raw, RAW_EPSIZE)) {
+        pending_flags &= ~PENDING_RAW;
+    }
 #endif
 }
 
@@ -713,8 +833,16 @@ void virtser_task(void) {
  * FIXME: Needs doc
  */
 void virtser_send(const uint8_t byte) {
-    uint8_t timeout = 255;
-    uint8_t ep      = Endpoint_GetCurrentEndpoint();
+    virtser_send_buffer(&byte, 1);
+}
+
+/** \brief Virtual Serial Send Buffer
+ *
+ * Sends a whole buffer with a single endpoint flush, instead of one USB
+ * packet per byte.
+ */
+void virtser_send_buffer(const uint8_t *data, uint16_t length) {
+    uint8_t ep = Endpoint_GetCurrentEndpoint();
 
     if (cdc_device.State.ControlLineStates.HostToDevice & CDC_CONTROL_LINE_OUT_DTR) {
         /* IN packet */
@@ -725,10 +853,14 @@ void virtser_send(const uint8_t byte) {
             return;
         }
 
-        while (timeout-- && !Endpoint_IsReadWriteAllowed())
-            _delay_us(40);
+        while (length--) {
+            uint8_t timeout = 255;
+            while (timeout-- && !Endpoint_IsReadWriteAllowed())
+                _delay_us(40);
+
+            Endpoint_Write_8(*data++);
+        }
 
-        Endpoint_Write_8(byte);
         CDC_Device_Flush(&cdc_device);
 
         if (Endpoint_IsINReady()) {
@@ -838,6 +970,8 @@ void protocol_pre_task(void) {
 }
 
 void protocol_post_task(void) {
+    flush_pending_reports();
+
 #ifdef CONSOLE_ENABLE
     console_task();
 #endif
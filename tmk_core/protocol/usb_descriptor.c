@@ -49,6 +49,32 @@
 #    include "os_detection.h"
 #endif
 
+// Every report packed onto the shared endpoint must fit into its bank,
+// which is sized down when the larger reports are not enabled.
+#ifdef SHARED_EP_ENABLE
+#    ifdef KEYBOARD_SHARED_EP
+STATIC_ASSERT(sizeof(report_keyboard_t) <= SHARED_EPSIZE, "Keyboard report does not fit the shared endpoint");
+#    endif
+#    ifdef NKRO_ENABLE
+STATIC_ASSERT(sizeof(report_nkro_t) <= SHARED_EPSIZE, "NKRO report does not fit the shared endpoint");
+#    endif
+#    ifdef MOUSE_SHARED_EP
+STATIC_ASSERT(sizeof(report_mouse_t) <= SHARED_EPSIZE, "Mouse report does not fit the shared endpoint");
+#    endif
+#    ifdef EXTRAKEY_ENABLE
+STATIC_ASSERT(sizeof(report_extra_t) <= SHARED_EPSIZE, "Extra keys report does not fit the shared endpoint");
+#    endif
+#    ifdef PROGRAMMABLE_BUTTON_ENABLE
+STATIC_ASSERT(sizeof(report_programmable_button_t) <= SHARED_EPSIZE, "Programmable button report does not fit the shared endpoint");
+#    endif
+#    ifdef JOYSTICK_SHARED_EP
+STATIC_ASSERT(sizeof(report_joystick_t) <= SHARED_EPSIZE, "Joystick report does not fit the shared endpoint");
+#    endif
+#    ifdef DIGITIZER_SHARED_EP
+STATIC_ASSERT(sizeof(report_digitizer_t) <= SHARED_EPSIZE, "Digitizer report does not fit the shared endpoint");
+#    endif
+#endif
+
 #if defined(SERIAL_NUMBER) || (defined(SERIAL_NUMBER_USE_HARDWARE_ID) && SERIAL_NUMBER_USE_HARDWARE_ID == TRUE)
 
 #    define HAS_SERIAL_NUMBER
@@ -280,11 +280,21 @@ enum usb_endpoints {
 #endif
 
 #if (NEXT_EPNUM - 1) > MAX_ENDPOINTS
-#    error There are not enough available endpoints to support all functions. Please disable one or more of the following: Mouse Keys, Extra Keys, Console, NKRO, MIDI, Serial, Steno
+#    error There are not enough available endpoints to support all functions. Free one by packing the keyboard report onto the shared endpoint (KEYBOARD_SHARED_EP = yes), or disable one or more of the following: Console, MIDI, Virtual Serial, Raw HID.
 #endif
 
 #define KEYBOARD_EPSIZE 8
-#define SHARED_EPSIZE 32
+// The shared endpoint only needs a 32 byte bank for the NKRO report or a
+// worst-case joystick report; all other packed reports stay well under 16
+// bytes. Halving the bank size when possible frees USB packet memory, which
+// is a scarce resource on F103-class MCUs.
+#ifndef SHARED_EPSIZE
+#    if defined(NKRO_ENABLE) || defined(JOYSTICK_SHARED_EP)
+#        define SHARED_EPSIZE 32
+#    else
+#        define SHARED_EPSIZE 16
+#    endif
+#endif
 #define MOUSE_EPSIZE 16
 #define RAW_EPSIZE 32
 #define CONSOLE_EPSIZE 32
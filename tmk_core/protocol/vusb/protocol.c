@@ -140,12 +140,16 @@ void protocol_keyboard_task(void) {
     usbPoll();
 
     // TODO: configuration process is inconsistent. it sometime fails.
-    // To prevent failing to configure NOT scan keyboard during configuration
-    if (usbConfiguration && usbInterruptIsReady()) {
+    // To prevent failing to configure NOT scan keyboard during configuration.
+    // Scanning is no longer gated on the interrupt endpoint being free -
+    // report submission stashes into a pending slot instead of waiting, so
+    // the scan rate stays constant while the host drains reports at its own
+    // polling interval.
+    if (usbConfiguration) {
         keyboard_task();
     }
 }
 
 void protocol_post_task(void) {
-    // do nothing
+    vusb_transfer_pending();
 }
@@ -16,6 +16,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include <stdint.h>
+#include <string.h>
 
 #include <avr/wdt.h>
 
@@ -89,52 +90,127 @@ STATIC_ASSERT(TOTAL_INTERFACES <= MAX_INTERFACES, "There are not enough availabl
 
 static report_keyboard_t keyboard_report_sent;
 
-static void send_report_fragment(uint8_t endpoint, void *data, size_t size) {
-    for (uint8_t retries = 5; retries > 0; retries--) {
-        switch (endpoint) {
-            case 1:
-                if (usbInterruptIsReady()) {
-                    usbSetInterrupt(data, size);
-                    return;
-                }
-                break;
-            case USB_CFG_EP3_NUMBER:
-                if (usbInterruptIsReady3()) {
-                    usbSetInterrupt3(data, size);
-                    return;
-                }
-                break;
-            case USB_CFG_EP4_NUMBER:
-                if (usbInterruptIsReady4()) {
-                    usbSetInterrupt4(data, size);
-                    return;
-                }
-                break;
-            default:
-                return;
-        }
+// One pending-report slot per IN endpoint. send_report() stashes the report
+// and pushes as many 8-byte fragments as the endpoint accepts right away;
+// whatever is left is flushed from vusb_transfer_pending() on subsequent main
+// loop passes. Report submission therefore never waits on the host, which
+// previously cost up to 25ms of retries with matrix scanning stalled.
 
-        usbPoll();
-        wait_ms(5);
+#ifdef KEYBOARD_SHARED_EP
+#    define EP1_SLOT_SIZE 32
+#else
+#    define EP1_SLOT_SIZE sizeof(report_keyboard_t)
+#endif
+
+typedef struct {
+    uint8_t *data;
+    uint8_t  size;
+    uint8_t  offset;
+} pending_report_t;
+
+static uint8_t ep1_slot_buffer[EP1_SLOT_SIZE];
+static uint8_t ep3_slot_buffer[32];
+#ifdef RAW_ENABLE
+static uint8_t ep4_slot_buffer[32];
+#endif
+
+#ifdef NKRO_ENABLE
+STATIC_ASSERT(sizeof(report_nkro_t) <= 32, "NKRO report does not fit its pending slot");
+#endif
+
+static pending_report_t pending_reports[] = {
+    [0] = {.data = ep1_slot_buffer},
+    [1] = {.data = ep3_slot_buffer},
+#ifdef RAW_ENABLE
+    [2] = {.data = ep4_slot_buffer},
+#endif
+};
+
+static pending_report_t *slot_for_endpoint(uint8_t endpoint) {
+    switch (endpoint) {
+        case 1:
+            return &pending_reports[0];
+        case USB_CFG_EP3_NUMBER:
+            return &pending_reports[1];
+#ifdef RAW_ENABLE
+        case USB_CFG_EP4_NUMBER:
+            return &pending_reports[2];
+#endif
+        default:
+            return NULL;
     }
 }
 
-static void send_report(uint8_t endpoint, void *report, size_t size) {
-    uint8_t *temp = (uint8_t *)report;
+static bool endpoint_ready(uint8_t endpoint) {
+    switch (endpoint) {
+        case 1:
+            return usbInterruptIsReady();
+        case USB_CFG_EP3_NUMBER:
+            return usbInterruptIsReady3();
+        case USB_CFG_EP4_NUMBER:
+            return usbInterruptIsReady4();
+        default:
+            return false;
+    }
+}
 
-    // Send as many full packets as possible
-    for (uint8_t i = 0; i < size / 8; i++) {
-        send_report_fragment(endpoint, temp, 8);
-        temp += 8;
+static void write_fragment(uint8_t endpoint, uint8_t *data, uint8_t size) {
+    switch (endpoint) {
+        case 1:
+            usbSetInterrupt(data, size);
+            break;
+        case USB_CFG_EP3_NUMBER:
+            usbSetInterrupt3(data, size);
+            break;
+        case USB_CFG_EP4_NUMBER:
+            usbSetInterrupt4(data, size);
+            break;
     }
+}
 
-    // Send any data left over
-    uint8_t remainder = size % 8;
-    if (remainder) {
-        send_report_fragment(endpoint, temp, remainder);
+static void flush_slot(uint8_t endpoint, pending_report_t *slot) {
+    while (slot->offset < slot->size && endpoint_ready(endpoint)) {
+        uint8_t fragment = slot->size - slot->offset;
+        if (fragment > 8) {
+            fragment = 8;
+        }
+        write_fragment(endpoint, slot->data + slot->offset, fragment);
+        slot->offset += fragment;
     }
 }
 
+void vusb_transfer_pending(void) {
+    flush_slot(1, &pending_reports[0]);
+    flush_slot(USB_CFG_EP3_NUMBER, &pending_reports[1]);
+#ifdef RAW_ENABLE
+    flush_slot(USB_CFG_EP4_NUMBER, &pending_reports[2]);
+#endif
+}
+
+static void send_report(uint8_t endpoint, void *report, size_t size) {
+    pending_report_t *slot = slot_for_endpoint(endpoint);
+    if (slot == NULL) {
+        return;
+    }
+
+    // A partially transmitted report must be finished first - replacing it
+    // mid-flight would corrupt the reassembly on the host side. This only
+    // waits when two reports hit the same endpoint in quick succession.
+    for (uint8_t retries = 5; slot->offset < slot->size && retries > 0; retries--) {
+        flush_slot(endpoint, slot);
+        usbPoll();
+        wait_ms(1);
+    }
+    if (slot->offset < slot->size) {
+        return; // host stopped polling, drop the new report
+    }
+
+    memcpy(slot->data, report, size);
+    slot->size   = size;
+    slot->offset = 0;
+    flush_slot(endpoint, slot);
+}
+
 /*------------------------------------------------------------------*
  * RAW HID
  *------------------------------------------------------------------*/
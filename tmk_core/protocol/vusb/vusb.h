@@ -120,3 +120,7 @@ typedef struct usbConfigurationDescriptor {
 extern bool vusb_suspended;
 
 host_driver_t *vusb_driver(void);
+
+/* Push any report fragments still waiting for their IN endpoint. Called once
+ * per main loop pass, after usbPoll() has refreshed the endpoint state. */
+void vusb_transfer_pending(void);
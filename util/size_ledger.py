@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Generate a per-subsystem flash/RAM footprint ledger from a linker map.
+
+Parses the GNU ld map file emitted for every firmware build (-Wl,-Map=...),
+attributes each input section's size to the subsystem that owns its object
+file, and writes a machine-readable JSON ledger. Given a previous ledger it
+also prints a per-subsystem diff, so footprint changes can be reviewed per
+feature instead of hand-auditing the map file.
+
+Usage:
+    util/size_ledger.py .build/planck_rev6_default.map -o ledger.json
+    util/size_ledger.py .build/planck_rev6_default.map --diff old_ledger.json
+"""
+
+import argparse
+import json
+import re
+import sys
+from pathlib import Path
+
+# (subsystem, path fragment); first match wins, so keep specific entries first.
+SUBSYSTEM_RULES = [
+    ('painter', 'quantum/painter'),
+    ('rgb_matrix', 'quantum/rgb_matrix'),
+    ('led_matrix', 'quantum/led_matrix'),
+    ('rgblight', 'quantum/rgblight'),
+    ('audio', 'quantum/audio'),
+    ('pointing_device', 'quantum/pointing_device'),
+    ('split', 'quantum/split_common'),
+    ('quantum_core', 'quantum/'),
+    ('keyboard', 'keyboards/'),
+    ('platform', 'platforms/'),
+    ('protocol', 'tmk_core/'),
+    ('drivers', 'drivers/'),
+    ('libs', 'lib/'),
+]
+
+# Flash-resident output sections vs RAM-resident ones; .data counts as both.
+FLASH_SECTIONS = ('text', 'rodata', 'progmem', 'vectors', 'init', 'fini', 'crc')
+RAM_SECTIONS = ('bss', 'noinit', 'ram')
+
+SECTION_RE = re.compile(r'^ [ ]?\.([A-Za-z_][\w.$]*)')
+PLACEMENT_RE = re.compile(r'0x[0-9a-fA-F]+\s+0x([0-9a-fA-F]+)\s+(\S+\.(?:o|obj)\b|\S+\.a\(\S+\))')
+
+
+def subsystem_for(obj_path):
+    normalized = obj_path.replace('\\', '/')
+    # process_keycode features get their own line items
+    match = re.search(r'quantum/process_keycode/process_(\w+)\.o', normalized)
+    if match:
+        return 'feature_' + match.group(1)
+    if normalized.endswith('.a') or '.a(' in normalized:
+        return 'toolchain'
+    for name, fragment in SUBSYSTEM_RULES:
+        if fragment in normalized:
+            return name
+    return 'other'
+
+
+def parse_map(map_path):
+    """Returns {subsystem: {"flash": bytes, "ram": bytes}}."""
+    ledger = {}
+    in_memory_map = False
+    pending_section = None
+
+    for line in Path(map_path).read_text(errors='replace').splitlines():
+        if line.startswith('Linker script and memory map'):
+            in_memory_map = True
+            continue
+        if not in_memory_map:
+            continue
+        if line.startswith('OUTPUT(') or line.startswith('Cross Reference Table'):
+            break
+
+        section_match = SECTION_RE.match(line)
+        if section_match:
+            pending_section = section_match.group(1)
+        elif not line.startswith('  '):
+            continue
+        if pending_section is None:
+            continue
+
+        placement = PLACEMENT_RE.search(line)
+        if not placement:
+            continue
+
+        size = int(placement.group(1), 16)
+        if size == 0:
+            pending_section = None
+            continue
+
+        top_section = pending_section.split('.')[0]
+        pending_section = None
+
+        in_flash = top_section in FLASH_SECTIONS or top_section == 'data'
+        in_ram = top_section in RAM_SECTIONS or top_section == 'data'
+        if not in_flash and not in_ram:
+            continue
+
+        entry = ledger.setdefault(subsystem_for(placement.group(2)), {'flash': 0, 'ram': 0})
+        if in_flash:
+            entry['flash'] += size
+        if in_ram:
+            entry['ram'] += size
+
+    return ledger
+
+
+def print_ledger(ledger):
+    width = max((len(name) for name in ledger), default=10)
+    print(f'{"subsystem".ljust(width)}  {"flash":>8}  {"ram":>8}')
+    for name in sorted(ledger, key=lambda n: -ledger[n]['flash']):
+        print(f'{name.ljust(width)}  {ledger[name]["flash"]:>8}  {ledger[name]["ram"]:>8}')
+    total_flash = sum(e['flash'] for e in ledger.values())
+    total_ram = sum(e['ram'] for e in ledger.values())
+    print(f'{"total".ljust(width)}  {total_flash:>8}  {total_ram:>8}')
+
+
+def print_diff(old, new):
+    print('footprint changes vs previous ledger:')
+    changed = False
+    for name in sorted(set(old) | set(new)):
+        old_entry = old.get(name, {'flash': 0, 'ram': 0})
+        new_entry = new.get(name, {'flash': 0, 'ram': 0})
+        delta_flash = new_entry['flash'] - old_entry['flash']
+        delta_ram = new_entry['ram'] - old_entry['ram']
+        if delta_flash or delta_ram:
+            changed = True
+            print(f'  {name}: flash {delta_flash:+d}, ram {delta_ram:+d}')
+    if not changed:
+        print('  none')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('map_file', help='linker map file (.build/<target>.map)')
+    parser.add_argument('-o', '--output', help='write the JSON ledger to this path')
+    parser.add_argument('--diff', help='previous JSON ledger to diff against')
+    args = parser.parse_args()
+
+    ledger = parse_map(args.map_file)
+    if not ledger:
+        print(f'error: no attributable sections found in {args.map_file}', file=sys.stderr)
+        return 1
+
+    print_ledger(ledger)
+
+    if args.diff:
+        try:
+            old = json.loads(Path(args.diff).read_text())
+        except FileNotFoundError:
+            old = {}
+        print_diff(old, ledger)
+
+    if args.output:
+        Path(args.output).write_text(json.dumps(ledger, indent=2, sort_keys=True) + '\n')
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())